@@ -154,6 +154,16 @@ template <int num_channels> class mono_AudioSampleBuffer
     AudioSampleBuffer buffer;
     int size;
 
+    // juce::AudioBuffer::getWritePointer WRITES THE CLEAR FLAG, THE RENDER WORKERS MUST NOT
+    float *channels[num_channels];
+    inline void update_channels() noexcept
+    {
+        for (int i = 0; i != num_channels; ++i)
+        {
+            channels[i] = buffer.getWritePointer(i);
+        }
+    }
+
   public:
     inline const float *getReadPointer(int channelNumber = 0) const noexcept
     {
@@ -180,17 +190,24 @@ template <int num_channels> class mono_AudioSampleBuffer
                       << std::endl;
         }
 #endif
-        return buffer.getWritePointer(channelNumber);
+        return channels[channelNumber];
     }
     inline void setSize(int newNumSamples, bool keep_existing_content_ = false) noexcept
     {
         buffer.setSize(num_channels, newNumSamples + DEBUG_BUFFER_SIDE_OFFSET,
                        keep_existing_content_, true, false);
         size = newNumSamples;
+        update_channels();
     }
 
     inline int get_size() const noexcept { return size; }
-    inline void clear() noexcept { buffer.clear(); }
+    inline void clear() noexcept
+    {
+        for (int i = 0; i != num_channels; ++i)
+        {
+            juce::FloatVectorOperations::clear(channels[i], buffer.getNumSamples());
+        }
+    }
 
     //==========================================================================
     COLD mono_AudioSampleBuffer(int numSamples) noexcept
@@ -198,6 +215,7 @@ template <int num_channels> class mono_AudioSampleBuffer
           size(numSamples)
     {
         buffer.clear();
+        update_channels();
     }
     COLD ~mono_AudioSampleBuffer() noexcept
     {
@@ -0,0 +1,453 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+// monique-render: RENDERS A MIDI FILE OFFLINE THROUGH THE PLUGIN PROCESSOR, NO EDITOR, NO
+// AUDIO DEVICE. PRINTS THE TIME OF EACH STAGE AND DSP STAGE AND THE REAL TIME FACTOR AND CAN
+// COMPARE THE RESULT AGAINST A GOLDEN WAV FILE. ALSO RUNS THE DSP SELF CHECKS (--check).
+
+#include "version.h"
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+juce::AudioProcessor *JUCE_CALLTYPE createPluginFilter();
+bool run_dsp_check(juce::AudioProcessor &processor_, const juce::String &name_) noexcept;
+juce::StringArray get_dsp_check_names() noexcept;
+void print_dsp_stage_times(juce::AudioProcessor &processor_) noexcept;
+
+static const char *const usage =
+    "usage: monique-render --midi <file.mid> [options]\n"
+    "       monique-render --check <name> [--sample-rate <hz>] [--block-size <n>]\n"
+    "       monique-render --list-checks\n"
+    "\n"
+    "  --midi <file>          the MIDI file to render, all tracks are merged\n"
+    "  --out <file.wav>       the WAV file to write\n"
+    "  --program <file>       a .mlprog program, default: the factory default\n"
+    "  --sample-rate <hz>     default: 44100\n"
+    "  --block-size <n>       default: 512\n"
+    "  --bpm <bpm>            host tempo, default: the first tempo of the file or 120\n"
+    "  --tail <seconds>       rendered after the last event, default: 2\n"
+    "  --bits <16|24|32>      WAV bit depth, 32 is float, default: 32\n"
+    "  --golden <file.wav>    compare the rendering against this file\n"
+    "  --tolerance <value>    max allowed sample difference, default: 0.0001\n"
+    "  --check <name>         runs a DSP self check instead of rendering\n"
+    "\n"
+    "exit codes: 0 success, 1 error, 2 the rendering does not match the golden file,\n"
+    "            3 the check failed, 4 the golden file does not exist\n"
+    "note: programs using the noise oscillator are not deterministic\n";
+
+enum
+{
+    EXIT_GOLDEN_MISMATCH = 2,
+    EXIT_CHECK_FAILED = 3,
+    EXIT_GOLDEN_MISSING = 4
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// THE PROCESSOR ONLY RENDERS WITH A PLAY HEAD, THIS ONE PLAYS FROM SAMPLE ZERO AT A FIXED TEMPO
+class OfflinePlayHead : public juce::AudioPlayHead
+{
+  public:
+    double sample_rate;
+    double bpm;
+    std::int64_t time_in_samples;
+
+#if JUCE_MAJOR_VERSION >= 7
+    juce::Optional<PositionInfo> getPosition() const override
+    {
+        const double time_in_seconds = double(time_in_samples) / sample_rate;
+        const double ppq = time_in_seconds * bpm / 60;
+
+        PositionInfo info;
+        info.setBpm(bpm);
+        info.setTimeSignature(TimeSignature{4, 4});
+        info.setTimeInSamples(time_in_samples);
+        info.setTimeInSeconds(time_in_seconds);
+        info.setPpqPosition(ppq);
+        info.setPpqPositionOfLastBarStart(std::floor(ppq / 4) * 4);
+        info.setIsPlaying(true);
+        return info;
+    }
+#else
+    bool getCurrentPosition(CurrentPositionInfo &info_) override
+    {
+        const double time_in_seconds = double(time_in_samples) / sample_rate;
+        const double ppq = time_in_seconds * bpm / 60;
+
+        info_.resetToDefault();
+        info_.bpm = bpm;
+        info_.timeSigNumerator = 4;
+        info_.timeSigDenominator = 4;
+        info_.timeInSamples = time_in_samples;
+        info_.timeInSeconds = time_in_seconds;
+        info_.ppqPosition = ppq;
+        info_.ppqPositionOfLastBarStart = std::floor(ppq / 4) * 4;
+        info_.isPlaying = true;
+        return true;
+    }
+#endif
+
+    OfflinePlayHead(double sample_rate_, double bpm_) noexcept
+        : sample_rate(sample_rate_), bpm(bpm_), time_in_samples(0)
+    {
+    }
+};
+
+//==============================================================================
+class StageTimer
+{
+    const std::int64_t start_ticks;
+
+  public:
+    double get_ms() const noexcept
+    {
+        return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() -
+                                                        start_ticks) *
+               1000;
+    }
+
+    StageTimer() noexcept : start_ticks(juce::Time::getHighResolutionTicks()) {}
+};
+
+static void print_stage(const char *name_, double ms_) noexcept
+{
+    std::printf("  %-10s %10.2f ms\n", name_, ms_);
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+static double get_option(const juce::ArgumentList &args_, const juce::String &option_,
+                         double default_)
+{
+    if (!args_.containsOption(option_))
+    {
+        return default_;
+    }
+
+    const juce::String value = args_.getValueForOption(option_);
+    if (value.isEmpty() || !value.containsOnly("0123456789.-+eE"))
+    {
+        juce::ConsoleApplication::fail(option_ + " needs a number");
+    }
+    return value.getDoubleValue();
+}
+
+static juce::MidiMessageSequence read_midi(const juce::File &file_, double &bpm_)
+{
+    juce::FileInputStream stream(file_);
+    juce::MidiFile midi_file;
+    if (!stream.openedOk() || !midi_file.readFrom(stream))
+    {
+        juce::ConsoleApplication::fail("can not read the MIDI file " + file_.getFullPathName());
+    }
+    midi_file.convertTimestampTicksToSeconds();
+
+    juce::MidiMessageSequence sequence;
+    for (int track_id = 0; track_id != midi_file.getNumTracks(); ++track_id)
+    {
+        sequence.addSequence(*midi_file.getTrack(track_id), 0);
+    }
+    sequence.sort();
+
+    for (int i = 0; i != sequence.getNumEvents(); ++i)
+    {
+        const juce::MidiMessage &message = sequence.getEventPointer(i)->message;
+        if (message.isTempoMetaEvent() && bpm_ <= 0)
+        {
+            bpm_ = 60 / message.getTempoSecondsPerQuarterNote();
+        }
+    }
+
+    return sequence;
+}
+
+static void load_program(juce::AudioProcessor &processor_, const juce::File &file_)
+{
+    std::unique_ptr<juce::XmlElement> xml = juce::XmlDocument::parse(file_);
+    if (!xml || !xml->hasTagName("PROJECT-1.0"))
+    {
+        juce::ConsoleApplication::fail("can not read the program " + file_.getFullPathName());
+    }
+
+    juce::MemoryBlock state;
+    juce::AudioProcessor::copyXmlToBinary(*xml, state);
+    processor_.setStateInformation(state.getData(), int(state.getSize()));
+}
+
+static void write_wav(const juce::AudioBuffer<float> &buffer_, const juce::File &file_,
+                      double sample_rate_, int bits_)
+{
+    file_.deleteFile();
+    auto stream = std::make_unique<juce::FileOutputStream>(file_);
+    if (!stream->openedOk())
+    {
+        juce::ConsoleApplication::fail("can not write " + file_.getFullPathName());
+    }
+
+    juce::WavAudioFormat format;
+    std::unique_ptr<juce::AudioFormatWriter> writer(format.createWriterFor(
+        stream.get(), sample_rate_, juce::uint32(buffer_.getNumChannels()), bits_, {}, 0));
+    if (!writer)
+    {
+        juce::ConsoleApplication::fail("unsupported WAV format, bits: " + juce::String(bits_));
+    }
+    stream.release(); // OWNED BY THE WRITER
+
+    writer->writeFromAudioSampleBuffer(buffer_, 0, buffer_.getNumSamples());
+}
+
+// RETURNS FALSE IF THE BUFFER DOES NOT MATCH THE GOLDEN FILE
+static bool compare_with_golden(const juce::AudioBuffer<float> &buffer_, const juce::File &file_,
+                                double tolerance_)
+{
+    juce::AudioFormatManager format_manager;
+    format_manager.registerBasicFormats();
+    std::unique_ptr<juce::AudioFormatReader> reader(format_manager.createReaderFor(file_));
+    if (!reader)
+    {
+        juce::ConsoleApplication::fail("can not read the golden file " + file_.getFullPathName());
+    }
+
+    const int num_samples = buffer_.getNumSamples();
+    const int num_channels = buffer_.getNumChannels();
+    if (reader->lengthInSamples != num_samples || int(reader->numChannels) != num_channels)
+    {
+        std::printf("golden: FAILED, length or channels differ (%lld samples, %d channels)\n",
+                    static_cast<long long>(reader->lengthInSamples), int(reader->numChannels));
+        return false;
+    }
+
+    juce::AudioBuffer<float> golden(num_channels, num_samples);
+    reader->read(&golden, 0, num_samples, 0, true, true);
+
+    double max_diff = 0;
+    double sum_square_diff = 0;
+    int first_mismatch = -1;
+    for (int channel = 0; channel != num_channels; ++channel)
+    {
+        const float *rendered = buffer_.getReadPointer(channel);
+        const float *expected = golden.getReadPointer(channel);
+        for (int sid = 0; sid != num_samples; ++sid)
+        {
+            const double diff = std::abs(double(rendered[sid]) - double(expected[sid]));
+            sum_square_diff += diff * diff;
+            max_diff = std::max(max_diff, diff);
+            if (diff > tolerance_ && (first_mismatch == -1 || sid < first_mismatch))
+            {
+                first_mismatch = sid;
+            }
+        }
+    }
+    const double rms_diff = std::sqrt(sum_square_diff / (double(num_samples) * num_channels));
+
+    if (first_mismatch != -1)
+    {
+        std::printf("golden: FAILED, max diff %g, rms diff %g, first mismatch at sample %d\n",
+                    max_diff, rms_diff, first_mismatch);
+        return false;
+    }
+    std::printf("golden: OK, max diff %g, rms diff %g\n", max_diff, rms_diff);
+    return true;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+static int check(const juce::ArgumentList &args_)
+{
+    const double sample_rate = get_option(args_, "--sample-rate", 44100);
+    const int block_size = int(get_option(args_, "--block-size", 512));
+    if (sample_rate <= 0 || block_size <= 0)
+    {
+        juce::ConsoleApplication::fail("sample rate and block size must be positive");
+    }
+
+    const juce::ScopedJuceInitialiser_GUI juce_initialiser;
+    std::unique_ptr<juce::AudioProcessor> processor(createPluginFilter());
+    processor->setNonRealtime(true);
+    processor->setRateAndBufferSizeDetails(sample_rate, block_size);
+    processor->prepareToPlay(sample_rate, block_size);
+    const bool passed = run_dsp_check(*processor, args_.getValueForOption("--check"));
+    processor->releaseResources();
+
+    return passed ? 0 : EXIT_CHECK_FAILED;
+}
+
+//==============================================================================
+static int render(const juce::ArgumentList &args_)
+{
+    if (args_.containsOption("--list-checks"))
+    {
+        std::printf("%s\n", get_dsp_check_names().joinIntoString("\n").toRawUTF8());
+        return 0;
+    }
+    if (args_.containsOption("--check"))
+    {
+        return check(args_);
+    }
+    if (args_.containsOption("--help|-h") || !args_.containsOption("--midi"))
+    {
+        std::printf("%s", usage);
+        return args_.containsOption("--help|-h") ? 0 : 1;
+    }
+
+    const juce::File midi_file = args_.getExistingFileForOption("--midi");
+    const double sample_rate = get_option(args_, "--sample-rate", 44100);
+    const int block_size = int(get_option(args_, "--block-size", 512));
+    const double tail = get_option(args_, "--tail", 2);
+    const int bits = int(get_option(args_, "--bits", 32));
+    const double tolerance = get_option(args_, "--tolerance", 0.0001);
+    if (sample_rate <= 0 || block_size <= 0 || tail < 0)
+    {
+        juce::ConsoleApplication::fail("sample rate, block size and tail must be positive");
+    }
+
+    double bpm = get_option(args_, "--bpm", 0);
+    const juce::MidiMessageSequence sequence = read_midi(midi_file, bpm);
+    if (bpm <= 0)
+    {
+        bpm = 120;
+    }
+
+    std::printf("monique-render %s\n", Monique::Build::FullVersionStr);
+
+    // STARTUP
+    StageTimer startup_timer;
+    const juce::ScopedJuceInitialiser_GUI juce_initialiser;
+    std::unique_ptr<juce::AudioProcessor> processor(createPluginFilter());
+    const double startup_ms = startup_timer.get_ms();
+
+    // PROGRAM
+    StageTimer program_timer;
+    if (args_.containsOption("--program"))
+    {
+        load_program(*processor, args_.getExistingFileForOption("--program"));
+    }
+    const double program_ms = program_timer.get_ms();
+
+    // PREPARE
+    StageTimer prepare_timer;
+    OfflinePlayHead play_head(sample_rate, bpm);
+    processor->setPlayHead(&play_head);
+    processor->setNonRealtime(true);
+    processor->setRateAndBufferSizeDetails(sample_rate, block_size);
+    processor->prepareToPlay(sample_rate, block_size);
+    const double prepare_ms = prepare_timer.get_ms();
+
+    // RENDER
+    const double end_time = sequence.getNumEvents() ? sequence.getEndTime() : 0;
+    const int total_samples = int(std::ceil((end_time + tail) * sample_rate));
+    const int num_channels = processor->getTotalNumOutputChannels();
+    juce::AudioBuffer<float> output(num_channels, total_samples);
+    juce::AudioBuffer<float> block(num_channels, block_size);
+    juce::MidiBuffer midi;
+
+    StageTimer render_timer;
+    double max_block_ms = 0;
+    int num_blocks = 0;
+    int next_event = 0;
+    for (int pos = 0; pos < total_samples; pos += block_size)
+    {
+        const int num_samples = std::min(block_size, total_samples - pos);
+        block.setSize(num_channels, num_samples, false, false, true);
+
+        midi.clear();
+        for (; next_event < sequence.getNumEvents(); ++next_event)
+        {
+            const juce::MidiMessage &message = sequence.getEventPointer(next_event)->message;
+            const int at_sample = juce::roundToInt(message.getTimeStamp() * sample_rate);
+            if (at_sample >= pos + num_samples)
+            {
+                break;
+            }
+            if (!message.isMetaEvent())
+            {
+                midi.addEvent(message, std::max(0, at_sample - pos));
+            }
+        }
+
+        play_head.time_in_samples = pos;
+        StageTimer block_timer;
+        processor->processBlock(block, midi);
+        max_block_ms = std::max(max_block_ms, block_timer.get_ms());
+        ++num_blocks;
+
+        for (int channel = 0; channel != num_channels; ++channel)
+        {
+            output.copyFrom(channel, pos, block, channel, 0, num_samples);
+        }
+    }
+    const double render_ms = render_timer.get_ms();
+    processor->releaseResources();
+
+    // WRITE
+    StageTimer write_timer;
+    if (args_.containsOption("--out"))
+    {
+        write_wav(output, args_.getFileForOption("--out"), sample_rate, bits);
+    }
+    const double write_ms = write_timer.get_ms();
+
+    // REPORT
+    const double audio_seconds = total_samples / sample_rate;
+    std::printf("%.2f s of audio, %d Hz, block size %d, %.2f bpm\n", audio_seconds,
+                int(sample_rate), block_size, bpm);
+    print_stage("startup", startup_ms);
+    print_stage("program", program_ms);
+    print_stage("prepare", prepare_ms);
+    print_stage("render", render_ms);
+    print_stage("write", write_ms);
+    std::printf("  block: mean %.3f ms, max %.3f ms, real time budget %.3f ms\n",
+                num_blocks ? render_ms / num_blocks : 0, max_block_ms,
+                block_size * 1000 / sample_rate);
+    std::printf("  real time factor: %.2fx\n",
+                render_ms > 0 ? audio_seconds * 1000 / render_ms : 0);
+    print_dsp_stage_times(*processor);
+
+    bool matches_golden = true;
+    if (args_.containsOption("--golden"))
+    {
+        const juce::File golden_file = args_.getFileForOption("--golden");
+        if (!golden_file.existsAsFile())
+        {
+            std::printf("golden: SKIPPED, %s does not exist\n",
+                        golden_file.getFullPathName().toRawUTF8());
+            return EXIT_GOLDEN_MISSING;
+        }
+
+        StageTimer compare_timer;
+        matches_golden = compare_with_golden(output, golden_file, tolerance);
+        print_stage("compare", compare_timer.get_ms());
+    }
+
+    return matches_golden ? 0 : EXIT_GOLDEN_MISMATCH;
+}
+
+int main(int argc, char *argv[])
+{
+    const juce::ArgumentList args(argc, argv);
+    return juce::ConsoleApplication::invokeCatchingFailures([&] { return render(args); });
+}
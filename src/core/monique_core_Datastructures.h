@@ -148,7 +148,7 @@ class DataBuffer // DEFINITION IN SYNTH.CPP
     // WORKERS
     // TODO REDUCE TO NEEDED
     mono_AudioSampleBuffer<SUM_EQ_BANDS> band_env_buffers;
-    mono_AudioSampleBuffer<SUM_EQ_BANDS> band_out_buffers;
+    mono_AudioSampleBuffer<2> band_sum_buffers;
 
     mono_AudioSampleBuffer<SUM_FILTERS> lfo_amplitudes;
     mono_AudioSampleBuffer<SUM_MORPHER_GROUPS> mfo_amplitudes;
@@ -255,21 +255,82 @@ class RuntimeNotifyer : public juce::DeletedAtShutdown
 //==============================================================================
 //==============================================================================
 //==============================================================================
-class Step
+struct Step
+{
+    int step_id;
+    std::int64_t at_absolute_sample;
+    int samples_per_step;
+};
+
+//==============================================================================
+// A PREALLOCATED FIFO OF STEPS, FILLED AND READ ON THE AUDIO THREAD.
+// IF IT RUNS FULL THE NEW STEP IS DROPPED, THE OLD ONES ARE STILL PENDING.
+class StepQueue
 {
   public:
-    const int step_id;
-    const std::int64_t at_absolute_sample;
-    const int samples_per_step;
-
-    inline Step(int step_id_, std::int64_t at_absolute_sample_,
-                std::int64_t samples_per_step_) noexcept
-        : step_id(step_id_), at_absolute_sample(at_absolute_sample_),
-          samples_per_step(samples_per_step_)
+    static constexpr int CAPACITY = 256;
+
+  private:
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+    Step steps[CAPACITY];
+    int first;
+    int num_steps;
+
+    inline int index_of(int i_) const noexcept { return (first + i_) & (CAPACITY - 1); }
+
+  public:
+    //==========================================================================
+    inline int size() const noexcept { return num_steps; }
+    inline const Step &get_first() const noexcept { return steps[first]; }
+    inline const Step &get(int i_) const noexcept { return steps[index_of(i_)]; }
+
+    inline void add(int step_id_, std::int64_t at_absolute_sample_,
+                    std::int64_t samples_per_step_) noexcept
+    {
+        if (num_steps == CAPACITY)
+        {
+            return;
+        }
+
+        Step &step(steps[index_of(num_steps)]);
+        step.step_id = step_id_;
+        step.at_absolute_sample = at_absolute_sample_;
+        step.samples_per_step = int(samples_per_step_);
+        ++num_steps;
+    }
+    inline void remove_first() noexcept
     {
+        first = index_of(1);
+        --num_steps;
     }
-    inline ~Step() noexcept {}
+    // CLOSES THE GAP BY MOVING THE NEWER STEPS, IN PRACTICE i_ IS AT THE FRONT
+    inline void remove(int i_) noexcept
+    {
+        if (i_ == 0)
+        {
+            remove_first();
+            return;
+        }
+
+        for (int i = i_ + 1; i < num_steps; ++i)
+        {
+            steps[index_of(i - 1)] = steps[index_of(i)];
+        }
+        --num_steps;
+    }
+    inline void clear() noexcept
+    {
+        first = 0;
+        num_steps = 0;
+    }
+
+    inline StepQueue() noexcept : steps(), first(0), num_steps(0) {}
+    inline ~StepQueue() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE(StepQueue)
 };
+
 struct RuntimeInfo
 {
     std::int64_t samples_since_start;
@@ -401,7 +462,7 @@ struct RuntimeInfo
             inline ~ClockSync() noexcept {}
         } clock_sync_information;
 
-        juce::OwnedArray<Step> steps_in_block;
+        StepQueue steps_in_block;
     };
     std::unique_ptr<standalone_features> standalone_features_pimpl;
 
@@ -466,6 +527,16 @@ class SmoothedParameter : RuntimeListener
     mono_AudioSampleBuffer<1> values;
     mono_AudioSampleBuffer<1> modulation_power;
 
+    // SETTLED: THE WHOLE BUFFER HOLDS ONE VALUE, FILLED ONCE AND SKIPPED UNTIL SOMETHING MOVES
+    bool is_settled;
+    float settled_value;
+    bool is_modulation_settled;
+    float settled_modulation;
+    inline void settle(float value_) noexcept;
+    inline void settle_modulation(float modulation_) noexcept;
+
+    int coefficients_time_in_ms;
+
   public:
     Parameter *const param_to_smooth;
     float const max_value;
@@ -516,6 +587,9 @@ class SmoothedParameter : RuntimeListener
     {
         return values.getReadPointer();
     }
+    // TRUE IF THE BUFFER HOLDS get_constant_value() FOR THE WHOLE BLOCK
+    inline bool is_constant() const noexcept { return is_settled; }
+    inline float get_constant_value() const noexcept { return settled_value; }
     inline void sample_rate_or_block_changed() noexcept override;
 
     //==========================================================================
@@ -1276,7 +1350,7 @@ struct ChorusData
 //==============================================================================
 //==============================================================================
 //==============================================================================
-class MorphGroup : public juce::Timer, ParameterListener
+class MorphGroup : public ParameterRampScheduler::Client, ParameterListener
 {
     MorphGroup *left_morph_source;
     MorphGroup *right_morph_source;
@@ -1289,6 +1363,15 @@ class MorphGroup : public juce::Timer, ParameterListener
     bool current_switch;
     juce::Array<IntParameter *> switch_int_params;
 
+    // THE SMOOTHED PARAMS OF THE GROUP WITH THEIR SOURCES, BUILD IN set_sources
+    struct MorphRoute
+    {
+        SmoothedParameter *smoother;
+        const Parameter *left_source_param;
+        const Parameter *right_source_param;
+    };
+    juce::Array<MorphRoute> morph_routes;
+
   public:
     //==========================================================================
     inline int indexOf(const Parameter *param_) const noexcept
@@ -1331,11 +1414,13 @@ class MorphGroup : public juce::Timer, ParameterListener
 
   private:
     //==========================================================================
+    juce::Array<float> sync_param_starts;
     juce::Array<float> sync_param_deltas;
+    juce::Array<float> sync_modulation_starts; // HAS_NO_MODULATION IF NOT MODULATED
     juce::Array<float> sync_modulation_deltas;
     void run_sync_morph() noexcept;
-    int current_callbacks;
-    void timerCallback() override;
+    void stop_sync_morph() noexcept;
+    void ramp_progress(float progress_) noexcept override;
 
   private:
     //==========================================================================
@@ -1363,6 +1448,7 @@ class MorphGroup : public juce::Timer, ParameterListener
 struct MTSClient;
 struct MoniqueTuningData
 {
+    COLD MoniqueTuningData() noexcept;
     ~MoniqueTuningData();
 
     enum Mode
@@ -1371,30 +1457,252 @@ struct MoniqueTuningData
         SCL_KBM,
         MTS_ESP
     } mode{TWELVE_TET};
-    float midiNoteToFrequency(float note)
+
+    // THE RETUNED PITCH OF EACH MIDI NOTE IS STORED IN SEMITONES, FRACTIONAL NOTES ARE
+    // INTERPOLATED BETWEEN THE NEIGHBOURS AND THE PITCH IS CONVERTED BY A ONE OCTAVE EXP2 TABLE
+    enum
+    {
+        NUM_NOTES = 128,
+        OCTAVE_TABLE_SIZE = 1024,
+        OCTAVE_OFFSET = 16
+    };
+    float midiNoteToFrequency(float note) const noexcept
     {
         switch (mode)
         {
         case TWELVE_TET:
-            return 440.0 * pow(2.0f, ((note - 69.0f) * (1.0f / 12)));
-            break;
+            return pitchToFrequency(note);
         case SCL_KBM:
-            // not implemented yet
-            return 440.0 * pow(2.0f, ((note - 69.0f) * (1.0f / 12)));
-            break;
         case MTS_ESP:
-            return midiNoteFromMTS(note);
-            break;
+            return pitchToFrequency(retunedPitch(note));
         }
         return 421;
     }
 
+  private:
+    float note_pitches[NUM_NOTES + 1];
+    float octave_table[OCTAVE_TABLE_SIZE + 1];
+    float octave_scales[2 * OCTAVE_OFFSET];
+
+    inline float retunedPitch(float note) const noexcept
+    {
+        if (note <= 0)
+        {
+            return note + note_pitches[0];
+        }
+        else if (note >= NUM_NOTES)
+        {
+            return note + (note_pitches[NUM_NOTES] - NUM_NOTES);
+        }
+        const int idx = int(note);
+        const float frac = note - idx;
+        return note_pitches[idx] + frac * (note_pitches[idx + 1] - note_pitches[idx]);
+    }
+    inline float pitchToFrequency(float pitch) const noexcept
+    {
+        // THE OFFSET KEEPS THE OCTAVE POSITIVE, SO THE CAST FLOORS
+        const float octaves = juce::jlimit(0.0f, 2.0f * OCTAVE_OFFSET - 0.001f,
+                                           (pitch - 69.0f) * (1.0f / 12) + OCTAVE_OFFSET);
+        const int octave = int(octaves);
+        const float index = (octaves - octave) * OCTAVE_TABLE_SIZE;
+        const int idx = int(index);
+        const float frac = index - idx;
+        return octave_scales[octave] *
+               (octave_table[idx] + frac * (octave_table[idx + 1] - octave_table[idx]));
+    }
+
+  public:
+    // SCL/KBM FILE CONTENT, KBM CAN BE EMPTY FOR THE DEFAULT LINEAR MAPPING (60 = 261.63 HZ)
+    // Parses on the caller thread, the audio thread picks the new table up in update().
+    // THE FILE CONTENT IS STORED WITH THE PLUGIN STATE, NOT WITH THE PROGRAMS.
+    bool loadSclKbm(const juce::String &scl_, const juce::String &kbm_) noexcept;
+    void resetToTwelveTET() noexcept;
+    juce::String scl_data;
+    juce::String kbm_data;
+
+  private:
+    // pending_lock GUARDS THE PENDING TABLE AND FLAGS, update() ONLY TRIES THE LOCK AND PICKS
+    // THE CHANGE UP NEXT BLOCK IF THE LOADER HOLDS IT
+    juce::SpinLock pending_lock;
+    float pending_note_pitches[NUM_NOTES + 1];
+    bool has_pending_scl_kbm{false};
+    bool has_pending_reset{false};
+    float scl_kbm_note_pitches[NUM_NOTES + 1];
+    bool is_scl_kbm_loaded{false};
+    void fillTwelveTETPitches() noexcept;
+    void fillMTSPitches() noexcept;
+    void fillSclKbmPitches() noexcept;
+
+  public:
+    // CALLED ONCE PER BLOCK BY THE AUDIO THREAD
+    void update() noexcept;
+
     MTSClient *mts_client{nullptr};
     int mtsChecked{0};
     void updateMTSESPStatus();
-    float midiNoteFromMTS(float note);
+
+    JUCE_DECLARE_NON_COPYABLE(MoniqueTuningData)
 };
 
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// THE PARSED SAVEABLE VALUES OF A SYNTH DATA, IN THE ORDER OF ITS SAVEABLE PARAMETERS
+struct MoniqueSynthDataSnapshot
+{
+    bool is_valid; // FALSE IF THE FILE HAS NO DATA FOR IT
+    juce::Array<float> values;
+    juce::Array<float> modulation_amounts;
+
+    COLD MoniqueSynthDataSnapshot() noexcept : is_valid(false) {}
+    COLD ~MoniqueSynthDataSnapshot() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MoniqueSynthDataSnapshot)
+};
+
+// A PROGRAM AS IT IS IN ITS FILE, READY TO BE READ WITHOUT ANY FILE OR XML ACCESS
+struct MoniqueProgramSnapshot
+{
+    int bank;
+    int program;
+    bool is_valid; // FALSE IF THE FILE COULD NOT BE PARSED
+
+    MoniqueSynthDataSnapshot data;
+    MoniqueSynthDataSnapshot left_morph_sources[SUM_MORPHER_GROUPS];
+    MoniqueSynthDataSnapshot right_morph_sources[SUM_MORPHER_GROUPS];
+    juce::String left_morph_source_names[SUM_MORPHER_GROUPS];
+    juce::String right_morph_source_names[SUM_MORPHER_GROUPS];
+
+    COLD MoniqueProgramSnapshot() noexcept : bank(-1), program(-1), is_valid(false) {}
+    COLD ~MoniqueProgramSnapshot() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MoniqueProgramSnapshot)
+};
+
+// PARSES PROGRAM FILES ON ITS OWN THREAD AND KEEPS THE LAST USED PROGRAMS, SO A PROGRAM CHANGE
+// ON THE AUDIO THREAD DOES NOT TOUCH ANY FILE. THE NEIGHBOURS OF A REQUESTED PROGRAM ARE
+// PREFETCHED, THE LEAST RECENTLY USED PROGRAM WILL BE REPLACED.
+// THE AUDIO THREAD ONLY SETS THE VALUES OF A CACHED PROGRAM, THE REST OF THE LOAD (LISTENERS,
+// MORPH, BACKUP, MIDI FEEDBACK) RUNS ON THE MESSAGE THREAD.
+struct MoniqueSynthData;
+class MoniqueProgramCache : public juce::Thread, juce::AsyncUpdater
+{
+    static constexpr int CACHE_SIZE = 16;
+
+    MoniqueSynthData *const synth_data;
+
+    juce::CriticalSection lock;
+    std::unique_ptr<MoniqueProgramSnapshot> snapshots[CACHE_SIZE];
+    juce::uint32 last_used[CACHE_SIZE];
+    juce::uint32 use_counter;
+
+    // OWNED BY THE CACHE THREAD UNTIL IT IS SWAPPED IN
+    std::unique_ptr<MoniqueProgramSnapshot> spare;
+
+    // BANK << 16 | PROGRAM, -1 IF NOTHING IS REQUESTED
+    std::atomic_int requested{-1};
+    std::atomic_int last_requested{-1};
+    // THE LAST REQUESTED PROGRAM THAT DOES NOT EXIST
+    std::atomic_int failed{-1};
+    // THE LAST PROGRAM THE AUDIO THREAD HAS SET THE VALUES OF
+    std::atomic_int loaded{-1};
+    // THE NEXT BANK FILE TO UPDATE, -1 IF ALL ARE UP TO DATE. THE FIRST SCAN RUNS ON START.
+    std::atomic_int next_outdated_bank{0};
+    std::atomic_int generation{0};
+
+    void run() override;
+    // FALSE IF THERE IS NO SUCH PROGRAM
+    bool cache(int bank_, int program_) noexcept;
+    void handleAsyncUpdate() override;
+
+  public:
+    // ==============================================================================
+    // AUDIO THREAD
+    void request(int bank_, int program_) noexcept;
+
+    // THE LOCK MUST BE HELD AS LONG AS THE SNAPSHOT IS IN USE, NULLPTR IF NOT CACHED YET
+    juce::CriticalSection &get_lock() noexcept { return lock; }
+    const MoniqueProgramSnapshot *find(int bank_, int program_) noexcept;
+    // TRUE IF THE REQUESTED PROGRAM DOES NOT EXIST, IT WILL NEVER BE CACHED
+    bool has_failed(int bank_, int program_) const noexcept;
+    // AFTER read_values_from OF A CACHED PROGRAM, FINISHES THE LOAD ON THE MESSAGE THREAD
+    void finish_load(int bank_, int program_) noexcept;
+
+    // ==============================================================================
+    // MESSAGE THREAD, IF PROGRAM FILES ARE CHANGED
+    void clear() noexcept;
+    // MESSAGE THREAD, AFTER THE PROGRAM NAMES ARE REFRESHED
+    void update_bank_files() noexcept;
+
+  public:
+    // ==============================================================================
+    COLD MoniqueProgramCache(MoniqueSynthData *synth_data_) noexcept;
+    COLD ~MoniqueProgramCache() noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MoniqueProgramCache)
+};
+
+// A COMPACT BINARY COPY OF A BANK FOLDER, STORED NEXT TO IT (A.mlbank FOR THE FOLDER A). AN INDEX
+// WITH THE NAMES, FILE TIMES, FILE SIZES AND OFFSETS IS FOLLOWED BY ONE FIXED LAYOUT VALUE VECTOR
+// PER PROGRAM.
+// THE FILE IS MEMORY MAPPED, THE .mlprog XML FILES STAY THE FORMAT FOR IMPORT AND EXPORT.
+class MoniqueBankFile
+{
+    struct Header
+    {
+        char magic[4];
+        juce::uint32 version;
+        juce::uint32 layout_id;
+        juce::uint32 values_per_program;
+        juce::uint32 strings_per_program;
+        juce::uint32 num_programs;
+        juce::uint64 values_offset;
+    };
+    struct IndexEntry
+    {
+        juce::int64 file_time;
+        juce::int64 file_size;
+        // THE NAME, FOLLOWED BY strings_per_program ZERO TERMINATED UTF-8 STRINGS
+        juce::uint64 strings_offset;
+    };
+
+    std::unique_ptr<juce::MemoryMappedFile> mapped_file;
+    const Header *header;
+    const IndexEntry *index;
+
+  public:
+    // ==============================================================================
+    // FALSE IF THE FILE DOES NOT EXIST, IS BROKEN OR HAS AN OTHER LAYOUT
+    bool open(const juce::File &file_, juce::uint32 layout_id_, int values_per_program_,
+              int strings_per_program_) noexcept;
+    void close() noexcept;
+    bool is_open() const noexcept { return header != nullptr; }
+
+    int size() const noexcept;
+    juce::int64 get_file_time(int program_) const noexcept;
+    juce::int64 get_file_size(int program_) const noexcept;
+    juce::String get_name(int program_) const noexcept;
+    juce::String get_string(int program_, int string_id_) const noexcept;
+    const float *get_values(int program_) const noexcept;
+
+    // ==============================================================================
+    // names_.size() PROGRAMS, values_ AND strings_ ARE THE VECTORS OF ALL PROGRAMS IN A ROW
+    static bool write(const juce::File &file_, juce::uint32 layout_id_, int values_per_program_,
+                      int strings_per_program_, const juce::StringArray &names_,
+                      const juce::Array<juce::int64> &file_times_,
+                      const juce::Array<juce::int64> &file_sizes_,
+                      const juce::StringArray &strings_,
+                      const juce::Array<float> &values_) noexcept;
+
+  public:
+    // ==============================================================================
+    COLD MoniqueBankFile() noexcept : header(nullptr), index(nullptr) {}
+    COLD ~MoniqueBankFile() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MoniqueBankFile)
+};
+
+//==============================================================================
 //==============================================================================
 //==============================================================================
 //==============================================================================
@@ -1403,6 +1711,52 @@ struct MoniqueTuningData
 //==============================================================================
 //==============================================================================
 //==============================================================================
+// THE CURVE OF AN ENV OR MFO POPUP, ONLY RENDERED AGAIN IF ONE OF ITS INPUTS HAS CHANGED
+struct CurvePreview
+{
+    static constexpr int MAX_POINTS = 4096;
+    static constexpr int SUM_INPUTS = 8;
+
+    float points[MAX_POINTS];
+    int num_points;
+
+  private:
+    float inputs[SUM_INPUTS];
+    bool is_valid;
+
+  public:
+    //==========================================================================
+    // STORES THE INPUTS AND RETURNS TRUE IF THE CURVE HAS TO BE RENDERED FOR THEM
+    inline bool set_inputs(std::initializer_list<float> inputs_) noexcept
+    {
+        jassert(inputs_.size() <= SUM_INPUTS);
+
+        bool has_changed = !is_valid;
+        int input_id = 0;
+        for (const float input : inputs_)
+        {
+            if (inputs[input_id] != input)
+            {
+                inputs[input_id] = input;
+                has_changed = true;
+            }
+            ++input_id;
+        }
+        is_valid = true;
+
+        return has_changed;
+    }
+
+    //==========================================================================
+    COLD CurvePreview() noexcept : num_points(0), is_valid(false)
+    {
+        juce::FloatVectorOperations::clear(inputs, SUM_INPUTS);
+    }
+    COLD ~CurvePreview() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CurvePreview)
+};
+
 //==============================================================================
 class MoniqueSynthesiserVoice;
 struct MoniqueSynthData : ParameterListener
@@ -1511,6 +1865,9 @@ struct MoniqueSynthData : ParameterListener
     BoolParameter ui_is_large;
     Parameter ui_scale_factor;
 
+    // RENDER THE INDEPENDENT STAGES OF A BLOCK ON WORKER THREADS
+    BoolParameter render_in_parallel;
+
     // MIDI HACKS
     Parameter midi_lfo_wave;
     IntParameter midi_lfo_speed;
@@ -1540,6 +1897,12 @@ struct MoniqueSynthData : ParameterListener
   private:
     // ==============================================================================
     juce::Array<Parameter *> saveable_parameters;
+    // ATTRIBUTE NAME TO (INDEX IN saveable_parameters + 1) * 2, +1 FOR ITS _mod ATTRIBUTE
+    juce::HashMap<juce::String, int> saveable_attribute_ids;
+    // THE SAME FOR THE BINARY STATE: THE STATE IDS AT INDEX * 2 (+1 _mod, 0 IF NONE) AND
+    // STATE ID TO ATTRIBUTE ID
+    juce::Array<juce::uint32> saveable_state_ids;
+    juce::HashMap<int, int> saveable_state_attribute_ids;
     juce::Array<Parameter *> automateable_parameters;
     juce::Array<float> saveable_backups;
     juce::Array<Parameter *> global_parameters;
@@ -1658,6 +2021,7 @@ struct MoniqueSynthData : ParameterListener
     void calc_current_program_abs() noexcept;
 
     static void update_banks(juce::StringArray &) noexcept;
+    // THE NAMES FROM THE BANK FOLDER, THE CACHE THREAD UPDATES THE BANK FILES AFTERWARDS
     static void update_bank_programms(MoniqueSynthData &synth_data, int bank_id_,
                                       juce::StringArray &program_names_) noexcept;
 
@@ -1695,9 +2059,42 @@ struct MoniqueSynthData : ParameterListener
     bool load_prev() noexcept;
     bool load_next() noexcept;
 
+    // AUDIO THREAD: LOADS THE CURRENT PROGRAM FROM THE PROGRAM CACHE, THE PROGRAM WILL BE READ BY
+    // read_pending_program AT THE START OF A BLOCK AS SOON AS IT IS PARSED. IT ONLY SETS THE
+    // VALUES, THE CACHE FINISHES THE LOAD ON THE MESSAGE THREAD.
+    // OFFLINE (isNonRealtime) THE PROGRAM IS PARSED AND SET AT ONCE, SO A RENDERING DOES NOT
+    // DEPEND ON THE SPEED OF THE CACHE THREAD.
+    void load_async() noexcept;
+    void read_pending_program() noexcept;
+
   private:
-    bool load(const juce::String bank_name_, const juce::String program_name_,
-              bool load_morph_groups = true, bool ignore_warnings_ = false) noexcept;
+    friend class MoniqueProgramCache;
+    std::unique_ptr<MoniqueProgramCache> program_cache;
+    int pending_bank;
+    int pending_program;
+    bool is_offline() const noexcept;
+    void load_values_now(int bank_, int program_) noexcept;
+    // FALSE IF THERE IS NO SUCH PROGRAM, READS THE BANK FILE IF IT IS UP TO DATE
+    bool parse_program(int bank_, int program_, MoniqueProgramSnapshot &snapshot_) const noexcept;
+    // CACHE THREAD: OPENS THE BANK FILE AND REBUILDS IT IF A PROGRAM FILE HAS BEEN ADDED, REMOVED
+    // OR CHANGED (TIME OR SIZE). FALSE IF THERE IS NO SUCH BANK.
+    bool update_bank_file(int bank_id_) noexcept;
+
+    // MASTER ONLY, ONE PER BANK. THE LOCK GUARDS THEM AND THE PROGRAM NAMES AGAINST A REFRESH
+    juce::OwnedArray<MoniqueBankFile> bank_files;
+    juce::ReadWriteLock bank_lock;
+
+    // THE VALUE VECTOR OF A PROGRAM IN THE BANK FILE: FOR THE DATA AND EACH MORPH SOURCE A VALID
+    // FLAG, THE VALUES AND THE MODULATION AMOUNTS OF THE PARAMETERS WITH MODULATION
+    enum
+    {
+        SNAPSHOTS_PER_PROGRAM = 1 + SUM_MORPHER_GROUPS * 2,
+        STRINGS_PER_PROGRAM = SUM_MORPHER_GROUPS * 2
+    };
+    juce::uint32 get_program_layout_id() const noexcept;
+    int get_program_layout_size() const noexcept;
+    void pack(const MoniqueProgramSnapshot &snapshot_, float *dest_) const noexcept;
+    void unpack(const float *src_, MoniqueProgramSnapshot &snapshot_) const noexcept;
 
   public:
     // ==============================================================================
@@ -1706,6 +2103,39 @@ struct MoniqueSynthData : ParameterListener
     void save_to(juce::XmlElement *xml) noexcept;
     bool force_morph_update__load_flag;
     void read_from(const juce::XmlElement *xml) noexcept;
+    void read_from(const MoniqueProgramSnapshot &snapshot_) noexcept;
+
+  private:
+    // A LOAD IN TWO STEPS. read_values_from ONLY SETS THE VALUES, WITHOUT LOCKS, LISTENERS OR
+    // ALLOCATIONS, SO THE AUDIO THREAD CAN CALL IT. finish_program_load DOES THE REST.
+    void read_values_from(const MoniqueProgramSnapshot &snapshot_) noexcept;
+    void read_values_from(const MoniqueSynthDataSnapshot &snapshot_) noexcept;
+    void finish_program_load(const juce::String *left_morph_source_names_,
+                             const juce::String *right_morph_source_names_) noexcept;
+    void notify_values_loaded() noexcept;
+
+    // ONLY READS THE PARAMETER INFOS, SO IT CAN PARSE ON ANY THREAD
+    void parse(const juce::XmlElement *xml_, MoniqueProgramSnapshot &snapshot_) const noexcept;
+    void parse(const juce::XmlElement *xml_, MoniqueSynthDataSnapshot &snapshot_) const noexcept;
+    void read_from(const MoniqueSynthDataSnapshot &snapshot_) noexcept;
+    void init_snapshot(MoniqueSynthDataSnapshot &snapshot_) const noexcept;
+    void set_parsed_value(MoniqueSynthDataSnapshot &snapshot_, int attribute_id_,
+                          float value_) const noexcept;
+
+  public:
+    // ==============================================================================
+    // BINARY PLUGIN STATE, SAVING CHANGES NOTHING. EACH DATA SET IS STORED AS (ID, VALUE) PAIRS
+    // OF THE VALUES THAT DIFFER FROM THE INIT VALUES, THE ID IS A HASH OF THE ATTRIBUTE NAME
+    void write_state(juce::OutputStream &stream_,
+                     const juce::String &program_name_) const noexcept;
+    static bool is_state(const void *data_, int size_in_bytes_) noexcept;
+    // FALSE IF THE STATE IS BROKEN OR NEWER, NOTHING IS READ THEN
+    bool read_state(const void *data_, int size_in_bytes_, juce::String &program_name_) noexcept;
+
+  private:
+    void write_state_values(juce::OutputStream &stream_) const noexcept;
+    bool parse_state_values(juce::InputStream &stream_,
+                            MoniqueSynthDataSnapshot &snapshot_) const noexcept;
 
   private:
     bool write2file(const juce::String &bank_name_, const juce::String &program_name_) noexcept;
@@ -1723,9 +2153,8 @@ struct MoniqueSynthData : ParameterListener
 
   public:
     // ==============================================================================
-    void get_full_adstr(ENVData &env_data_, juce::Array<float> &curve) noexcept;
-    void get_full_mfo(LFOData &mfo_data_, juce::Array<float> &curve,
-                      MoniqueSynthData *data_) noexcept;
+    void get_full_adstr(ENVData &env_data_, CurvePreview &curve_) noexcept;
+    void get_full_mfo(LFOData &mfo_data_, CurvePreview &curve_, MoniqueSynthData *data_) noexcept;
     bool is_key_down(int id) const noexcept;
     float get_tracking_env_state(int id) const noexcept;
 };
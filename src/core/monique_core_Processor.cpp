@@ -762,9 +762,16 @@ void MoniqueAudioProcessor::processBlockBypassed(juce::AudioSampleBuffer &buffer
     process(buffer_, midi_messages_, true);
 }
 void MoniqueAudioProcessor::reset_pending_notes() { synth->reset_note_down_store(); }
+bool MoniqueAudioProcessor::queue_event(const juce::MidiMessage &message_) noexcept
+{
+    return synth->queue_event(message_);
+}
 void MoniqueAudioProcessor::process(juce::AudioSampleBuffer &buffer_,
                                     juce::MidiBuffer &midi_messages_, bool bypassed_)
 {
+    // FTZ/DAZ FOR THE WHOLE BLOCK, THE FILTERS DO NOT FLUSH DENORMALS THEMSELVES
+    juce::ScopedNoDenormals no_denormals;
+
     if (is_standalone())
     {
         if (!standalone_features_pimpl->block_lock.tryEnter())
@@ -785,7 +792,7 @@ void MoniqueAudioProcessor::process(juce::AudioSampleBuffer &buffer_,
 
     if (synth_data->tuning)
     {
-        synth_data->tuning->updateMTSESPStatus();
+        synth_data->tuning->update();
     }
 
     const int num_samples = buffer_.getNumSamples();
@@ -845,19 +852,12 @@ void MoniqueAudioProcessor::process(juce::AudioSampleBuffer &buffer_,
                 {
                     // CLEAN LAST BLOCK
                     // FOR SECURITy REMOVE INVALID OLD STEPS
-                    juce::OwnedArray<Step> &steps_in_block(info_standalone_features.steps_in_block);
-                    if (steps_in_block.size())
-                    {
-                        while (steps_in_block.getFirst()->at_absolute_sample <
+                    StepQueue &steps_in_block(info_standalone_features.steps_in_block);
+                    while (steps_in_block.size() &&
+                           steps_in_block.get_first().at_absolute_sample <
                                current_pos_info.timeInSamples)
-                        {
-                            steps_in_block.remove(0, true);
-
-                            if (!steps_in_block.size())
-                            {
-                                break;
-                            }
-                        }
+                    {
+                        steps_in_block.remove_first();
                     }
                     info_standalone_features.clock_sync_information.clear();
 
@@ -937,18 +937,18 @@ void MoniqueAudioProcessor::process(juce::AudioSampleBuffer &buffer_,
                                             if (clock_absolute % clocks_per_step == 0)
                                             {
                                                 info_standalone_features.steps_in_block.add(
-                                                    new Step(clock_absolute / clocks_per_step,
-                                                             abs_event_time_in_samples + 1,
-                                                             abs_event_time_in_samples -
-                                                                 standalone_features_pimpl
-                                                                     ->last_clock_sample));
+                                                    clock_absolute / clocks_per_step,
+                                                    abs_event_time_in_samples + 1,
+                                                    abs_event_time_in_samples -
+                                                        standalone_features_pimpl
+                                                            ->last_clock_sample);
                                                 success = true;
                                             }
                                         }
                                         else
                                         {
                                             info_standalone_features.steps_in_block.add(
-                                                new Step(0, abs_event_time_in_samples + 1, 0));
+                                                0, abs_event_time_in_samples + 1, 0);
                                             success = true;
                                         }
                                     }
@@ -969,11 +969,10 @@ void MoniqueAudioProcessor::process(juce::AudioSampleBuffer &buffer_,
                                                 if (tmp_clock_id % clocks_per_step == 0)
                                                 {
                                                     info_standalone_features.steps_in_block.add(
-                                                        new Step(tmp_clock_id / clocks_per_step,
-                                                                 abs_event_time_in_samples +
-                                                                     current_samples_per_clock * i +
-                                                                     1,
-                                                                 current_samples_per_clock));
+                                                        tmp_clock_id / clocks_per_step,
+                                                        abs_event_time_in_samples +
+                                                            current_samples_per_clock * i + 1,
+                                                        current_samples_per_clock);
 
                                                     success = true;
                                                 }
@@ -981,7 +980,7 @@ void MoniqueAudioProcessor::process(juce::AudioSampleBuffer &buffer_,
                                             else
                                             {
                                                 info_standalone_features.steps_in_block.add(
-                                                    new Step(0, abs_event_time_in_samples + 1, 0));
+                                                    0, abs_event_time_in_samples + 1, 0);
                                                 success = true;
                                             }
                                         }
@@ -1003,12 +1002,12 @@ void MoniqueAudioProcessor::process(juce::AudioSampleBuffer &buffer_,
                                             if (fmod(faster_clocks_semi_absolut, factor) == 0)
                                             {
                                                 info_standalone_features.steps_in_block.add(
-                                                    new Step(faster_clocks_semi_absolut / factor,
-                                                             abs_event_time_in_samples + 1,
-                                                             (abs_event_time_in_samples -
-                                                              standalone_features_pimpl
-                                                                  ->last_clock_sample) *
-                                                                 speed_multiplyer__));
+                                                    faster_clocks_semi_absolut / factor,
+                                                    abs_event_time_in_samples + 1,
+                                                    (abs_event_time_in_samples -
+                                                     standalone_features_pimpl
+                                                         ->last_clock_sample) *
+                                                        speed_multiplyer__);
 
                                                 success = true;
                                             }
@@ -1016,7 +1015,7 @@ void MoniqueAudioProcessor::process(juce::AudioSampleBuffer &buffer_,
                                         else
                                         {
                                             info_standalone_features.steps_in_block.add(
-                                                new Step(0, abs_event_time_in_samples + 1, 0));
+                                                0, abs_event_time_in_samples + 1, 0);
                                         }
                                     }
 
@@ -1030,7 +1029,7 @@ void MoniqueAudioProcessor::process(juce::AudioSampleBuffer &buffer_,
                                 else if (input_midi_message.isMidiStart())
                                 {
                                     info_standalone_features.clock_counter.reset();
-                                    info_standalone_features.steps_in_block.clearQuick(true);
+                                    info_standalone_features.steps_in_block.clear();
                                     info_standalone_features.is_running = true;
                                     info_standalone_features.is_extern_synced = true;
 
@@ -1160,6 +1159,9 @@ COLD void MoniqueAudioProcessor::prepareToPlay(double sampleRate, int block_size
         data_buffer->resize_buffer_if_required(block_size_);
     }
 
+    // OFFLINE RENDERS SPLIT AT EVERY MIDI EVENT, HOSTS PREPARE AGAIN AFTER setNonRealtime
+    synth->set_minimum_sub_block_size(isNonRealtime() ? 1 : MONIQUE_MIDI_SUB_BLOCK_SIZE);
+
     voice->reset_internal();
 }
 COLD void MoniqueAudioProcessor::sample_rate_or_block_changed() noexcept
@@ -1434,20 +1436,33 @@ double MoniqueAudioProcessor::getTailLengthSeconds() const { return 0.0; }
 //==============================================================================
 void MoniqueAudioProcessor::getStateInformation(juce::MemoryBlock &destData)
 {
-    // xml.getIntAttribute( "BANK", synth_data->current_bank );
-    // xml.getIntAttribute( "PROG", synth_data->current_program );
-    juce::XmlElement xml("PROJECT-1.0");
-    juce::String modded_name = synth_data->alternative_program_name;
-    {
-        juce::String name = modded_name.fromFirstOccurrenceOf("0RIGINAL WAS: ", false, false);
-        xml.setAttribute("MODDED_PROGRAM", name == "" ? modded_name : name);
-        synth_data->save_to(&xml);
-        copyXmlToBinary(xml, destData);
-    }
+    // HOSTS CALL THIS FOR EVERY UNDO STEP AND AUTOSAVE, SO IT ONLY WRITES THE BINARY STATE
+    const juce::String &modded_name = synth_data->alternative_program_name;
+    const juce::String name = modded_name.fromFirstOccurrenceOf("0RIGINAL WAS: ", false, false);
+
+    juce::MemoryOutputStream stream(destData, false);
+    synth_data->write_state(stream, name == "" ? modded_name : name);
 }
 
 void MoniqueAudioProcessor::setStateInformation(const void *data, int sizeInBytes)
 {
+    if (MoniqueSynthData::is_state(data, sizeInBytes))
+    {
+        juce::String old_name;
+        if (synth_data->read_state(data, sizeInBytes, old_name))
+        {
+            synth_data->alternative_program_name = juce::String("0RIGINAL WAS: ") + old_name;
+        }
+        else
+        {
+            synth_data->alternative_program_name = "ERROR: Could not load patch!";
+        }
+
+        restore_time = juce::Time::getMillisecondCounter();
+        return;
+    }
+
+    // XML STATE OF OLDER VERSIONS
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml)
     {
@@ -83,6 +83,8 @@ class MoniqueAudioProcessor : public juce::AudioProcessor,
 
   public:
     COLD void reset_pending_notes();
+    // UI EVENTS, LOCK FREE, HANDLED AT THE START OF THE NEXT BLOCK
+    bool queue_event(const juce::MidiMessage &message_) noexcept;
 
     inline const juce::AudioPlayHead::CurrentPositionInfo &get_current_pos_info() const noexcept
     {
@@ -1,8654 +1,11643 @@
-/*
-** Monique is Free and Open Source Software
-**
-** Monique is made available under the Gnu General Public License, v3.0
-** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
-** reserve the right to re-license their contributions under the MIT license in the
-** future at the discretion of the project maintainers.
-**
-** Copyright 2016-2022 by various individuals as described by the git transaction log
-**
-** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
-**
-** Monique was a commercial product from 2016-2021, with copyright and ownership
-** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
-** open source in December 2021.
-*/
-
-#include "monique_core_Synth.h"
-
-#include "monique_core_Datastructures.h"
-#include "monique_core_Processor.h"
-#include "ui/monique_ui_AmpPainter.h"
-#include "ui/monique_ui_SegmentedMeter.h"
-
-#include <memory>
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-// TOOPT WITH SIMDRegister or AudioBuffer and Function
-static inline float sample_mix(float s1_, float s2_) noexcept
-{
-    if ((s1_ > 0) && (s2_ > 0))
-    {
-        s1_ = s1_ + s2_ - (s1_ * s2_);
-    }
-    else if ((s1_ < 0) && (s2_ < 0))
-    {
-        s1_ = s1_ + s2_ + (s1_ * s2_);
-    }
-    else
-    {
-        s1_ += s2_;
-    }
-
-    return s1_;
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-// TOOPT WITH TABLE LOCKUP
-#define left_pan(pan_, sin_lookup_)                                                                \
-    juce::jmax((float)std::sin(((pan_ + 1) * 0.5) * (juce::MathConstants<float>::pi * 0.5f)),      \
-               0.00001f)
-// TOOPT WITH TABLE LOCKUP
-#define right_pan(pan_, cos_lookup_)                                                               \
-    juce::jmax((float)std::cos(((pan_ + 1) * 0.5) * (juce::MathConstants<float>::pi * 0.5f)),      \
-               0.00001f)
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-COLD SmoothedParameter::SmoothedParameter(SmoothManager *const smooth_manager_,
-                                          Parameter *const param_to_smooth_) noexcept
-    : RuntimeListener(smooth_manager_ ? smooth_manager_->notifyer : nullptr),
-      smooth_manager(smooth_manager_),
-
-      values(block_size), modulation_power(block_size),
-
-      param_to_smooth(param_to_smooth_),
-
-      max_value(param_to_smooth_->get_info().max_value),
-      min_value(param_to_smooth_->get_info().min_value),
-
-      simple_smoother(0.001), left_morph_smoother(0.001), right_morph_smoother(0.001),
-      left_modulation_morph_smoother(0.001), right_modulation_morph_smoother(0.001),
-      morph_power_smoother(0.001), modulation_power_smoother(0.001), amp_power_smoother(0.001)
-{
-    if (smooth_manager)
-    {
-        smooth_manager->smoothers.add(this);
-        param_to_smooth_->get_runtime_info().my_smoother = this;
-    }
-
-    sample_rate_or_block_changed();
-}
-COLD SmoothedParameter::~SmoothedParameter() noexcept
-{
-    if (smooth_manager)
-    {
-        // param_to_smooth->get_runtime_info().my_smoother = nullptr;
-        smooth_manager->smoothers.removeFirstMatchingValue(this);
-    }
-}
-COLD void SmoothedParameter::set_offline() noexcept
-{
-    if (smooth_manager)
-    {
-        smooth_manager->smoothers.removeFirstMatchingValue(this);
-    }
-}
-
-//==============================================================================
-COLD void SmoothedParameter::sample_rate_or_block_changed() noexcept
-{
-    values.setSize(block_size);
-    modulation_power.setSize(block_size);
-
-    simple_smoother.set_value(morph_power_smoother.get_last_value());
-    simple_smoother.reset_coefficients(sample_rate, 0);
-
-    left_morph_smoother.set_value(morph_power_smoother.get_last_value());
-    left_morph_smoother.reset_coefficients(sample_rate, 0);
-
-    right_morph_smoother.set_value(morph_power_smoother.get_last_value());
-    right_morph_smoother.reset_coefficients(sample_rate, 0);
-
-    left_modulation_morph_smoother.set_value(morph_power_smoother.get_last_value());
-    left_modulation_morph_smoother.reset_coefficients(sample_rate, 0);
-
-    right_modulation_morph_smoother.set_value(morph_power_smoother.get_last_value());
-    right_modulation_morph_smoother.reset_coefficients(sample_rate, 0);
-
-    morph_power_smoother.set_value(morph_power_smoother.get_last_value());
-    morph_power_smoother.reset_coefficients(sample_rate, 0);
-
-    modulation_power_smoother.set_value(morph_power_smoother.get_last_value());
-    modulation_power_smoother.reset_coefficients(sample_rate, 0);
-
-    amp_power_smoother.set_value(morph_power_smoother.get_last_value());
-    amp_power_smoother.reset_coefficients(sample_rate, 0);
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class Smoother : RuntimeListener
-{
-    int pos;
-    float sum;
-    int size_in_ms;
-    int size;
-    mono_AudioSampleBuffer<1> buffer;
-    float *ptr_to_buffer;
-
-  public:
-    //==========================================================================
-    inline void add(float val_) noexcept
-    {
-        sum -= ptr_to_buffer[pos];
-        ptr_to_buffer[pos] = val_;
-        sum += val_;
-
-        if (++pos >= size)
-        {
-            pos = 0;
-        }
-    }
-    inline float add_and_get_average(float val_) noexcept
-    {
-        add(val_);
-        return get_average();
-    }
-    inline float get_average() const noexcept { return sum * (1.0f / size); }
-    inline void reset(float value_) noexcept
-    {
-        sum = 0;
-        for (int i = 0; i != size; ++i)
-        {
-            ptr_to_buffer[i] = value_;
-            sum += value_;
-        }
-    }
-    void set_size_in_ms(int size_in_ms_, bool force_ = false) noexcept
-    {
-        if (size_in_ms != size_in_ms_ || force_)
-        {
-            float last_average = get_average();
-
-            size_in_ms = size_in_ms_;
-            size = juce::jmax(3, msToSamplesFast(size_in_ms_, sample_rate));
-            buffer.setSize(size, false);
-            ptr_to_buffer = buffer.getWritePointer();
-
-            if (pos > size)
-            {
-                pos = 0;
-            }
-
-            sum = 0;
-            for (int i = 0; i != size; ++i)
-            {
-                ptr_to_buffer[i] = last_average;
-                sum += last_average;
-            }
-        }
-    }
-
-  private:
-    virtual void sample_rate_or_block_changed() noexcept override
-    {
-        set_size_in_ms(size_in_ms, true);
-    };
-
-  public:
-    //==========================================================================
-    COLD Smoother(RuntimeNotifyer *const notifyer_, int init_size_in_ms_) noexcept
-        : RuntimeListener(notifyer_), pos(0), sum(0), size_in_ms(init_size_in_ms_),
-          size(juce::jmax(3, msToSamplesFast(init_size_in_ms_, sample_rate))), buffer(size),
-          ptr_to_buffer(buffer.getWritePointer())
-    {
-        reset(0);
-    }
-    COLD ~Smoother() {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Smoother)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-// TOOPT with AudioBuffer and Function
-// atan lookup???
-static inline float soft_clipping(float input_and_worker_) noexcept
-{
-    return (std::atan(input_and_worker_) * (1.0f / juce::MathConstants<float>::pi)) * 1.5;
-}
-
-//==============================================================================
-// TOOPT with AudioBuffer and Function
-static inline float lfo2amp(float sample_) noexcept { return (sample_ + 1.0f) * 0.5f; }
-
-//==============================================================================
-static inline float distortion(float input_and_worker_, float distortion_power_) noexcept
-{
-    if (distortion_power_ != 0)
-    {
-        const float distortion_add_on = distortion_power_ * 0.9f;
-        input_and_worker_ =
-            ((1.0f + distortion_add_on) * input_and_worker_) -
-            (input_and_worker_ * input_and_worker_ * input_and_worker_) * distortion_add_on;
-    }
-
-    return input_and_worker_;
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-// TOOPT with AudioBuffer and Function
-static inline float clipp_to_0_and_1(float input_and_worker_) noexcept
-{
-    if (input_and_worker_ > 1)
-    {
-        input_and_worker_ = 1;
-    }
-    else if (input_and_worker_ < 0)
-    {
-        input_and_worker_ = 0;
-    }
-
-    return input_and_worker_;
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-// TOOPT with AudioBuffer and Function
-static inline float soft_clipp_greater_1_2(float x) noexcept
-{
-    if (x > 1)
-    {
-        x = 1.0f + soft_clipping(x - 1.0f);
-    }
-    else if (x < -1)
-    {
-        x = -1.0f + soft_clipping(x + 1.0f);
-    }
-
-    if (x > 1.2)
-    {
-        x = 1.2;
-    }
-    else if (x < -1.2)
-    {
-        x = -1.2;
-    }
-
-    return x;
-}
-//==============================================================================
-//==============================================================================
-//==============================================================================
-// TOOPT with AudioBuffer and Function
-static inline float soft_clipp_greater_0_9(float x) noexcept
-{
-    if (x > 0.9f)
-    {
-        x = 0.9f + soft_clipping(x - 0.9f);
-    }
-    else if (x < -0.9f)
-    {
-        x = -0.9f + soft_clipping(x + 0.9f);
-    }
-
-    if (x > 1)
-    {
-        x = 1;
-    }
-    else if (x < -1)
-    {
-        x = -1;
-    }
-
-    return x;
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-// TOOPT with AudioBuffer and Function
-static inline float hard_clipper_1(float x) noexcept
-{
-    if (x > 1)
-    {
-        x = 1;
-    }
-    else if (x < -1)
-    {
-        x = -1;
-    }
-
-    return x;
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-// replace with juce table lookup
-static float inline lookup(const float *table_, float x) noexcept
-{
-    return table_[int(x * TABLESIZE_MULTI) % LOOKUP_TABLE_SIZE];
-}
-//==============================================================================
-COLD DataBuffer::DataBuffer(int init_buffer_size_) noexcept
-    : size(init_buffer_size_),
-
-      band_env_buffers(init_buffer_size_), band_out_buffers(init_buffer_size_),
-
-      lfo_amplitudes(init_buffer_size_), mfo_amplitudes(init_buffer_size_),
-      filter_output_samples_l_r(init_buffer_size_), filter_stereo_output_samples(init_buffer_size_),
-
-      osc_samples(init_buffer_size_), osc_switchs(init_buffer_size_),
-      osc_sync_switchs(init_buffer_size_), modulator_samples(init_buffer_size_),
-
-      final_env(init_buffer_size_),
-#ifdef POLY
-      filter_env_tracking(init_buffer_size_),
-#endif
-      chorus_env(init_buffer_size_),
-
-      filter_input_samples(init_buffer_size_), filter_input_env_amps(init_buffer_size_),
-      filter_output_samples(init_buffer_size_), filter_env_amps(init_buffer_size_),
-
-      tmp_buffer(init_buffer_size_),
-
-      second_mono_buffer(init_buffer_size_),
-
-      velocity_buffer(init_buffer_size_)
-{
-}
-COLD DataBuffer::~DataBuffer() noexcept {}
-
-//==============================================================================
-COLD void DataBuffer::resize_buffer_if_required(int size_) noexcept
-{
-    if (size_ != size)
-    {
-        size = size_;
-
-        band_env_buffers.setSize(size_);
-        band_out_buffers.setSize(size_);
-
-        lfo_amplitudes.setSize(size_);
-        mfo_amplitudes.setSize(size_);
-        filter_stereo_output_samples.setSize(size_);
-        filter_output_samples_l_r.setSize(size_);
-
-        osc_samples.setSize(size_);
-        osc_switchs.setSize(size_);
-        osc_sync_switchs.setSize(size_);
-        modulator_samples.setSize(size_);
-
-        final_env.setSize(size_);
-#ifdef POLY
-        filter_env_tracking.setSize(size_);
-#endif
-        chorus_env.setSize(size_);
-
-        filter_input_samples.setSize(size_);
-        filter_input_env_amps.setSize(size_);
-        filter_output_samples.setSize(size_);
-        filter_env_amps.setSize(size_);
-
-        tmp_buffer.setSize(size_);
-
-        second_mono_buffer.setSize(size_);
-
-        velocity_buffer.setSize(size_);
-    }
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class PerfectCycleCounter : RuntimeListener
-{
-    //==========================================================================
-    double frequency;
-
-    double delta;
-    double angle;
-
-    double rate;
-    double phase;
-
-    double cylces_per_sec;
-
-    bool new_cycle;
-
-  public:
-    //==========================================================================
-    inline void set_frequency(double frequency_) noexcept
-    {
-        if (frequency != frequency_)
-        {
-            frequency = frequency_;
-            cylces_per_sec = sample_rate / frequency_;
-
-            delta = frequency_ / sample_rate *
-                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-            rate = (1.0 / cylces_per_sec) * juce::MathConstants<double>::pi;
-        }
-    }
-    inline void tick() noexcept
-    {
-        new_cycle = false;
-
-        angle += delta;
-        phase += rate;
-        if (angle > (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
-        {
-            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-            phase -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-            new_cycle = true;
-        }
-    }
-    inline double get_last_angle() const noexcept { return angle; }
-    inline double get_last_phase() const noexcept { return phase; }
-
-    inline double get_cylces_per_sec() const noexcept { return cylces_per_sec; }
-    inline bool is_new_cycle() const noexcept { return new_cycle; }
-    inline bool is_clean() const noexcept { return angle == 0 && new_cycle && phase == 0; }
-
-    //==========================================================================
-    void reset() noexcept
-    {
-        angle = 0;
-        new_cycle = true;
-        phase = 0;
-    }
-
-    //==========================================================================
-    void sample_rate_or_block_changed() noexcept override
-    {
-        float frequency_old = frequency;
-        frequency = 0;
-        set_frequency(frequency_old);
-    }
-
-  public:
-    //==========================================================================
-    COLD PerfectCycleCounter(RuntimeNotifyer *const notifyer_) noexcept
-        : RuntimeListener(notifyer_), frequency(0), delta(0), angle(0), rate(0), phase(0),
-          cylces_per_sec(0), new_cycle(true)
-    {
-    }
-    COLD ~PerfectCycleCounter() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PerfectCycleCounter)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_BlitSaw
-{
-    float phase_offset;
-    double last_tick_value;
-    double p_;
-    double C2_;
-    double phase_correction;
-    double a_;
-    double state_;
-
-    unsigned int m_;
-
-  public:
-    //==========================================================================
-    inline float tick(double phase_) noexcept
-    {
-        double tmp;
-        {
-            const double working_phase_ = (phase_ + phase_offset) - phase_correction;
-
-            // Avoid a divide by zero, or use of a denormalized divisor
-            // at the sinc peak, which has a limiting value of m_ / p_.
-            const double denominator = std::sin(working_phase_);
-            if (std::fabs(denominator) <= std::numeric_limits<double>::epsilon())
-            {
-                tmp = a_;
-            }
-            else
-            {
-                tmp = sin(working_phase_ * m_) / (p_ * denominator);
-            }
-        }
-
-        tmp += (state_ - C2_);
-        state_ = tmp * 0.995;
-
-        return last_tick_value = tmp;
-    }
-    inline float lastOut() const noexcept { return last_tick_value; }
-
-    //==========================================================================
-    inline void set_phase_offset(float offset_) noexcept
-    {
-        phase_offset = offset_ * juce::MathConstants<float>::pi;
-    }
-    inline void updateHarmonics(double p) noexcept
-    {
-        p_ = p;
-        C2_ = 1.0 / p;
-        phase_correction = C2_ * (juce::MathConstants<double>::pi * 0.5) / 0.9;
-        m_ = 2 * floor(0.5 * p) + 1;
-        a_ = p / p;
-    }
-
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        state_ = 0;
-        last_tick_value = 0;
-    }
-
-  public:
-    //==========================================================================
-    COLD mono_BlitSaw() noexcept
-        : phase_offset(0), last_tick_value(0), p_(0), C2_(0), phase_correction(0), a_(0), state_(0),
-          m_(0)
-    {
-    }
-    COLD ~mono_BlitSaw() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_BlitSaw)
-};
-
-//==============================================================================
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_BlitSquare
-{
-    float last_tick_value;
-    float phase_offset;
-    double a_;
-    double p_;
-    double phase_correction;
-    double lastBlitOutput_;
-    double dcbState_;
-
-    unsigned int m_;
-
-  public:
-    //==========================================================================
-    inline float tick(double phase_) noexcept
-    {
-        // OUTPUT PROCESS
-        float out;
-        {
-            const double temp = lastBlitOutput_;
-            {
-                const double current_phase = (phase_ + phase_offset) - phase_correction;
-
-                // Avoid a divide by zero, or use of a denomralized divisor
-                // at the sinc peak, which has a limiting value of 1.0.
-                {
-
-                    const double denominator = std::sin(current_phase);
-                    if (std::fabs(denominator) < std::numeric_limits<double>::epsilon())
-                    {
-                        // Inexact comparison safely distinguishes between *close to zero*, and
-                        // *close to PI*.
-                        if (current_phase < 0.0001 ||
-                            current_phase > (juce::MathConstants<double>::pi +
-                                             juce::MathConstants<double>::pi) -
-                                                0.0001)
-                        {
-                            lastBlitOutput_ = a_;
-                        }
-                        else
-                        {
-                            lastBlitOutput_ = -a_;
-                        }
-                    }
-                    else
-                    {
-                        lastBlitOutput_ = std::sin(current_phase * m_) / (p_ * denominator);
-                    }
-                }
-            }
-
-            lastBlitOutput_ += temp;
-
-            // Now apply DC blocker.
-            out = lastBlitOutput_ - dcbState_ + 0.999f * last_tick_value;
-            dcbState_ = lastBlitOutput_;
-        }
-
-        return last_tick_value = out;
-    }
-    inline float lastOut(void) const noexcept { return last_tick_value; }
-
-    //==========================================================================
-    inline void set_phase_offset(float offset_) noexcept
-    {
-        phase_offset = offset_ * juce::MathConstants<float>::pi;
-    }
-    inline void updateHarmonics(double p) noexcept
-    {
-        p_ = p * 0.5;
-        m_ = (floor(0.5 * p_) + 1) * 2;
-        a_ = p / p;
-
-        phase_correction = (1.0 / p) * juce::MathConstants<double>::pi;
-    }
-
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        last_tick_value = 0;
-        dcbState_ = 0;
-        lastBlitOutput_ = 0;
-    }
-
-  public:
-    //==========================================================================
-    COLD mono_BlitSquare() noexcept
-        : last_tick_value(0), phase_offset(0), a_(0), p_(0), phase_correction(0),
-          lastBlitOutput_(0), dcbState_(0), m_(0)
-    {
-    }
-    COLD ~mono_BlitSquare() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_BlitSquare)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_SineWave
-{
-    const float *const sine_lookup;
-
-    float last_tick_value;
-    float phase_offset;
-
-  public:
-    //==========================================================================
-    inline float tick(double angle_) noexcept
-    {
-        return last_tick_value = lookup(sine_lookup, angle_ + phase_offset);
-    }
-    inline float lastOut() const noexcept { return last_tick_value; }
-
-    //==========================================================================
-    inline void set_phase_offset(float offset_) noexcept
-    {
-        phase_offset = offset_ * juce::MathConstants<float>::pi;
-    }
-
-  public:
-    //==========================================================================
-    COLD mono_SineWave(const float *sine_lookup_) noexcept
-        : sine_lookup(sine_lookup_), last_tick_value(0), phase_offset(0)
-    {
-    }
-    COLD ~mono_SineWave() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWave)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_SineWaveAutonom : public RuntimeListener
-{
-    const float *const sine_lookup;
-
-    double frequency;
-
-    double delta;
-    double angle;
-
-    bool new_cycle;
-
-    float last_tick_value;
-
-  public:
-    //==========================================================================
-    inline float tick() noexcept
-    {
-        new_cycle = false;
-
-        angle += delta;
-        if (angle > (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
-        {
-            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-            new_cycle = true;
-        }
-
-        return last_tick_value = lookup(sine_lookup, angle);
-    }
-    inline float lastOut_with_phase_offset(float offset_) noexcept
-    {
-        return lookup(sine_lookup, angle + offset_ * (juce::MathConstants<double>::pi +
-                                                      juce::MathConstants<double>::pi));
-    }
-    inline float lastOut() const noexcept { return last_tick_value; }
-
-    //==========================================================================
-    inline void set_frequency(double frequency_) noexcept
-    {
-        if (frequency != frequency_)
-        {
-            frequency = frequency_;
-            delta = frequency_ / sample_rate *
-                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-        }
-    }
-    inline void overwrite_angle(float angle_) noexcept { angle = angle_; }
-
-    //==========================================================================
-    inline bool is_new_cycle() const noexcept { return new_cycle; }
-
-    inline void sample_rate_or_block_changed() noexcept override
-    {
-        float frequency_old = frequency;
-        frequency = 0;
-        set_frequency(frequency_old);
-    }
-
-  public:
-    //==========================================================================
-    COLD mono_SineWaveAutonom(RuntimeNotifyer *const notifyer_,
-                              const float *const sine_lookup_) noexcept
-        : RuntimeListener(notifyer_),
-
-          sine_lookup(sine_lookup_), frequency(0),
-
-          delta(0), angle(0),
-
-          new_cycle(0),
-
-          last_tick_value(0)
-    {
-    }
-    COLD ~mono_SineWaveAutonom() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWaveAutonom)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_SineWaveAutonomShifted : public RuntimeListener
-{
-    const float *const sine_lookup;
-
-    double frequency;
-
-    double delta;
-    double angle;
-
-    bool new_cycle;
-
-    float last_tick_value;
-
-  public:
-    //==========================================================================
-    inline float tick() noexcept
-    {
-        new_cycle = false;
-
-        angle += delta;
-        if (angle - (juce::MathConstants<double>::pi * 0.5) >
-            (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
-        {
-            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-            new_cycle = true;
-        }
-
-        return last_tick_value = (lookup(sine_lookup, angle) * -1 + 1) * 0.5;
-    }
-    inline float lastOut() const noexcept { return last_tick_value; }
-
-    //==========================================================================
-    inline void set_frequency(double frequency_) noexcept
-    {
-        if (frequency != frequency_)
-        {
-            frequency = frequency_;
-            delta = frequency_ / sample_rate *
-                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-        }
-    }
-
-    //==========================================================================
-    inline bool is_new_cycle() const noexcept { return new_cycle; }
-
-    //==========================================================================
-    inline void sample_rate_or_block_changed() noexcept override
-    {
-        float frequency_old = frequency;
-        frequency = 0;
-        set_frequency(frequency_old);
-    }
-
-  public:
-    //==========================================================================
-    COLD mono_SineWaveAutonomShifted(RuntimeNotifyer *const notifyer_,
-                                     const float *const sine_lookup_) noexcept
-        : RuntimeListener(notifyer_),
-
-          sine_lookup(sine_lookup_), frequency(0),
-
-          delta(0), angle(juce::MathConstants<double>::pi * 0.5),
-
-          new_cycle(0),
-
-          last_tick_value(0)
-    {
-    }
-    COLD ~mono_SineWaveAutonomShifted() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWaveAutonomShifted)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_Noise
-{
-    juce::Random random;
-    float last_tick_value;
-
-  public:
-    //==========================================================================
-    inline float tick() noexcept { return last_tick_value = random.nextFloat() * 2 - 1; }
-    inline float lastOut() const noexcept { return last_tick_value; }
-
-  public:
-    //==========================================================================
-    COLD mono_Noise() noexcept : last_tick_value(0) {}
-    COLD ~mono_Noise() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Noise)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_OnePole
-{
-    float last_tick_value;
-    float gain;
-    float a1, b;
-
-  public:
-    //==========================================================================
-    inline float tick(float input) noexcept
-    {
-        return last_tick_value = b * gain * input - a1 * last_tick_value;
-    }
-    inline float lastOut() const noexcept { return last_tick_value; }
-
-    //==========================================================================
-    inline void setPole(float thePole) noexcept
-    {
-        if (thePole > 0)
-        {
-            b = 1.0f - thePole;
-        }
-        else
-        {
-            b = 1.0f + thePole;
-        }
-
-        a1 = -thePole;
-    }
-    inline void setGain(float gain_) noexcept { gain = gain_; }
-
-  public:
-    //==========================================================================
-    COLD mono_OnePole(float thePole = 0.9) noexcept : last_tick_value(0), gain(0), a1(0), b(0)
-    {
-        this->setPole(thePole);
-    }
-    COLD ~mono_OnePole() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_OnePole)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_Modulate : public RuntimeListener
-{
-    const float *const sine_lookup;
-
-    mono_SineWaveAutonomShifted vibrato;
-    mono_SineWaveAutonom swing;
-    mono_OnePole filter;
-    mono_Noise noise;
-
-    float last_tick_value;
-    float last_swing_frequency;
-    unsigned int noiseRate;
-    unsigned int noiseCounter;
-
-  public:
-    //==========================================================================
-    inline float tick() noexcept
-    {
-        // Compute periodic and random modulations.
-        last_tick_value = vibrato.tick();
-        if (++noiseCounter > noiseRate)
-        {
-            noise.tick();
-            noiseCounter = 0;
-        }
-        last_tick_value += filter.tick(noise.lastOut());
-
-        return last_tick_value * swing.tick();
-    }
-    inline float lastOut() const noexcept { return last_tick_value; }
-
-    //==========================================================================
-    inline void set_vibrato_frequency(float frequency_) noexcept
-    {
-        vibrato.set_frequency(frequency_);
-    }
-    inline void set_swing_frequency(float frequency_) noexcept
-    {
-        if (last_swing_frequency != frequency_)
-        {
-            if (frequency_ == 0)
-            {
-                swing.overwrite_angle(juce::MathConstants<float>::pi * 0.5);
-            }
-
-            last_swing_frequency = frequency_;
-            swing.set_frequency(frequency_);
-        }
-    }
-    inline bool is_next_a_new_cycle() const noexcept { return vibrato.is_new_cycle(); }
-
-    //==========================================================================
-    inline void reset() noexcept { last_tick_value = 0; }
-
-    void sample_rate_or_block_changed() noexcept override
-    {
-        noiseRate = (unsigned int)(330.0 * sample_rate / 22050.0);
-    }
-
-  public:
-    //==========================================================================
-    COLD mono_Modulate(RuntimeNotifyer *const notifyer_, const float *const sine_lookup_) noexcept
-        : RuntimeListener(notifyer_),
-
-          sine_lookup(sine_lookup_),
-
-          vibrato(notifyer_, sine_lookup_), swing(notifyer_, sine_lookup_),
-
-          filter(), noise(),
-
-          last_tick_value(0), last_swing_frequency(0), noiseRate(0), noiseCounter(0)
-    {
-        vibrato.set_frequency(6.0);
-        swing.set_frequency(0);
-        swing.overwrite_angle(juce::MathConstants<float>::pi * 0.5);
-
-        noiseRate = (unsigned int)(330.0 * sample_rate / 22050.0);
-        noiseCounter = noiseRate;
-
-        filter.setPole(0.999);
-        filter.setGain(0.05);
-    }
-    COLD ~mono_Modulate() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Modulate)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class LFO : public RuntimeListener
-{
-    const float *const sine_lookup;
-
-    float delta;
-    float angle;
-    int last_samples_per_clock;
-
-    int last_speed;
-    float last_out;
-
-    float glide_samples;
-    int glide_counter;
-    float glide_value;
-
-    DataBuffer *const data_buffer;
-    const LFOData *const lfo_data;
-    const RuntimeInfo *const runtime_info;
-
-    //==============================================================================
-    inline void calculate_delta(const int samples_per_clock_, const float speed_multi_,
-                                const std::int64_t sync_sample_pos_) noexcept
-    {
-        if (last_samples_per_clock != samples_per_clock_)
-        {
-            {
-                const float samples_per_bar = samples_per_clock_ * 96;
-                const float samples_per_cylce = samples_per_bar * speed_multi_;
-                delta = (1.0f / samples_per_cylce);
-            }
-
-            last_samples_per_clock = samples_per_clock_;
-        }
-    }
-
-  public:
-    inline void process(float *dest_, int step_number_, int absoloute_step_number_,
-                        int start_pos_in_buffer_, int num_samples_, bool use_process_sample = true,
-                        juce::Array<RuntimeInfo::standalone_features::ClockSync::SyncPosPair>
-                            *clock_infos_ = nullptr) noexcept
-    {
-        // USER SPEED
-        const int speed(lfo_data->speed);
-        const float speed_multi(get_lfo_speed_multi(speed));
-        if (speed != last_speed)
-        {
-            glide_samples = glide_counter = sample_rate / 1000;
-            glide_value = last_out;
-            last_speed = speed;
-        }
-
-        // TO MIDI CLOCK SYNC
-        std::int64_t sync_sample_pos =
-            (runtime_info->relative_samples_since_start + start_pos_in_buffer_);
-        if (!use_process_sample)
-        {
-            sync_sample_pos = start_pos_in_buffer_;
-        }
-
-        bool same_samples_per_block_for_buffer = true;
-        if (is_standalone() && runtime_info->standalone_features_pimpl->is_extern_synced)
-        {
-            auto &runtime_info_standalone_features = *runtime_info->standalone_features_pimpl;
-
-            juce::Array<RuntimeInfo::standalone_features::ClockSync::SyncPosPair>
-                clock_informations =
-                    clock_infos_ ? *clock_infos_
-                                 : runtime_info_standalone_features.clock_sync_information
-                                       .get_a_working_copy();
-
-            if (!runtime_info_standalone_features.clock_sync_information.has_clocks_inside())
-            {
-                same_samples_per_block_for_buffer = true;
-                calculate_delta(runtime_info_standalone_features.clock_sync_information
-                                    .get_last_samples_per_clock(),
-                                speed_multi, sync_sample_pos);
-            }
-            else
-            {
-                same_samples_per_block_for_buffer = false;
-            }
-
-            if (sync_sample_pos <= 0)
-            {
-                angle = 0;
-            }
-
-            // FORCE SYNC
-            if (step_number_ != -1)
-            {
-                bool should_smooth = false;
-                if (fmod(absoloute_step_number_, speed_multi * 16) == 0)
-                {
-                    should_smooth = angle != 0;
-                    angle = 0;
-                }
-
-                if (should_smooth && glide_counter <= 0)
-                {
-                    glide_samples = glide_counter = juce::jmax(10.0, sample_rate / 1000);
-                    glide_value = last_out;
-                }
-            }
-
-            // PROCESS
-            {
-                const float *smoothed_wave_buffer(
-                    lfo_data->wave_smoother.get_smoothed_value_buffer());
-                const float *smoothed_offset_buffer(
-                    lfo_data->phase_shift_smoother.get_smoothed_value_buffer());
-                for (int sid = 0; sid != num_samples_; ++sid)
-                {
-                    if (++sync_sample_pos < 0)
-                    {
-                        continue;
-                    }
-
-                    {
-                        float amp;
-                        {
-                            // CURRENT ANGLE
-                            {
-                                if (!same_samples_per_block_for_buffer)
-                                {
-                                    calculate_delta(
-                                        runtime_info_standalone_features.clock_sync_information
-                                            .get_samples_per_clock(start_pos_in_buffer_ + sid,
-                                                                   clock_informations),
-                                        speed_multi, sync_sample_pos);
-                                }
-                                angle += delta;
-                                angle = angle - floor(angle);
-                            }
-
-                            // AMP
-                            {
-                                const float sine_amp =
-                                    lookup(sine_lookup, angle * juce::MathConstants<double>::twoPi +
-                                                            smoothed_offset_buffer[sid] *
-                                                                juce::MathConstants<double>::twoPi);
-                                const float wave = smoothed_wave_buffer[sid];
-                                amp = sine_amp * (1.0f - wave) +
-                                      (std::atan(sine_amp * 250 * juce::jmax(speed_multi, 1.0f)) *
-                                       (1.0f / 1.55)) *
-                                          wave;
-                                if (amp > 1)
-                                {
-                                    amp = 1;
-                                }
-                                else if (amp < -1)
-                                {
-                                    amp = -1;
-                                }
-                                amp = lfo2amp(amp);
-                            }
-                        }
-
-                        if (--glide_counter > 0)
-                        {
-                            float glide = (1.0f / glide_samples * glide_counter);
-                            amp = amp * (1.0f - glide) + glide_value * glide;
-                        }
-
-                        dest_[sid] = amp;
-                    }
-                }
-                last_out = dest_[num_samples_ - 1];
-            }
-        }
-        else
-        // PERFECT SYNC
-        {
-            const float bars_per_sec = runtime_info->bpm / 4 / 60;
-            const float samples_per_bar = (1.0f / bars_per_sec) * sample_rate;
-            const float samples_per_cylce = samples_per_bar * speed_multi;
-            const float cycles_per_sample = (1.0 / samples_per_cylce);
-
-            // PROCESS
-            {
-                const float *smoothed_wave_buffer(
-                    lfo_data->wave_smoother.get_smoothed_value_buffer());
-                const float *smoothed_offset_buffer(
-                    lfo_data->phase_shift_smoother.get_smoothed_value_buffer());
-                for (int sid = 0; sid != num_samples_; ++sid)
-                {
-                    float amp;
-                    {
-                        angle = cycles_per_sample * sync_sample_pos;
-                        angle = angle - floor(angle);
-
-                        // AMP
-                        {
-                            const float sine_amp =
-                                lookup(sine_lookup, angle * juce::MathConstants<double>::twoPi +
-                                                        smoothed_offset_buffer[sid] *
-                                                            juce::MathConstants<double>::twoPi);
-                            const float wave = smoothed_wave_buffer[sid];
-                            amp = sine_amp * (1.0f - wave) +
-                                  (std::atan(sine_amp * 250 * juce::jmax(speed_multi, 1.0f)) *
-                                   (1.0f / 1.55)) *
-                                      wave;
-                            if (amp > 1)
-                            {
-                                amp = 1;
-                            }
-                            else if (amp < -1)
-                            {
-                                amp = -1;
-                            }
-                            amp = lfo2amp(amp);
-                        }
-                    }
-
-                    if (glide_counter > 0 && false)
-                    {
-                        --glide_counter;
-                        float glide = (1.0f / glide_samples * glide_counter);
-                        amp = amp * (1.0f - glide) + glide_value * glide;
-                    }
-
-                    dest_[sid] = amp;
-
-                    ++sync_sample_pos;
-                }
-                last_out = dest_[num_samples_ - 1];
-            }
-        }
-    }
-
-    void sample_rate_or_block_changed() noexcept override { last_speed = -1; }
-
-    //==========================================================================
-    float get_current_amp() const noexcept { return last_out; }
-
-    //==========================================================================
-    void reset() noexcept { last_out = 0; }
-
-  public:
-    //==========================================================================
-    LFO(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_, LFOData *lfo_data_,
-        const float *const sine_lookup_)
-    noexcept
-        : RuntimeListener(notifyer_),
-
-          sine_lookup(sine_lookup_),
-
-          delta(0), angle(0), last_samples_per_clock(-1),
-
-          last_speed(0), last_out(0),
-
-          glide_samples(0), glide_counter(0), glide_value(0),
-
-          data_buffer(synth_data_->data_buffer), lfo_data(lfo_data_),
-          runtime_info(synth_data_->runtime_info)
-    {
-    }
-    ~LFO() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LFO)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class MasterOSC : public RuntimeListener
-{
-    // RUNTIME
-    //==============================================================================
-    int freq_glide_samples_left;
-    float freq_glide_delta;
-
-    float sync_glide_samples;
-    int sync_glide_samples_left;
-    float last_value;
-    float last_modulator_value;
-    float sync_value;
-    float sync_modulator_value;
-
-    float root_note;
-
-    float last_root_note;
-    float last_frequency;
-
-    float last_modulator_frequency;
-    int modulator_sync_cylces;
-    int modulator_run_circle;
-    bool modulator_waits_for_sync_cycle;
-
-    // RAW OSCILATORS
-    //==============================================================================
-    PerfectCycleCounter cycle_counter;
-    mono_BlitSaw saw_generator;
-    mono_BlitSquare square_generator;
-    mono_SineWave sine_generator;
-    mono_Noise noise;
-
-    mono_Modulate modulator;
-
-    // DATA SOURCE
-    //==============================================================================
-    DataBuffer *const data_buffer;
-    const MoniqueSynthData *const synth_data;
-    FMOscData *const fm_osc_data;
-    OSCData *const osc_data;
-
-  public:
-    //==============================================================================
-    inline void process(DataBuffer *data_buffer_, const int num_samples_) noexcept
-    {
-        float *const output_buffer(data_buffer->osc_samples.getWritePointer(MASTER_OSC));
-
-        float *const switch_buffer(data_buffer->osc_switchs.getWritePointer());
-        juce::FloatVectorOperations::clear(switch_buffer, num_samples_);
-        float *const modulator_buffer(data_buffer->modulator_samples.getWritePointer(MASTER_OSC));
-        const float *const lfo_amps((data_buffer->lfo_amplitudes.getReadPointer(MASTER_OSC)));
-
-        const bool is_lfo_modulated = osc_data->is_lfo_modulated;
-        const bool fm_sync = fm_osc_data->sync;
-
-        fm_osc_data->master_shift_smoother.process_modulation(is_lfo_modulated, lfo_amps,
-                                                              num_samples_);
-
-        // const float*const smoothed_tune_buffer(
-        // osc_data->tune_smoother.get_smoothed_modulated_value_buffer() );
-        const float *const smoothed_fm_amount_buffer(
-            osc_data->fm_amount_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_wave_buffer(
-            osc_data->wave_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_fm_freq_buffer(
-            fm_osc_data->fm_freq_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_fm_swing_buffer(
-            fm_osc_data->fm_swing_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_fm_phaser(
-            fm_osc_data->fm_shape_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_phase_offset(
-            fm_osc_data->master_shift_smoother.get_smoothed_value_buffer());
-
-        for (int sid = 0; sid < num_samples_; ++sid)
-        {
-            // SETUP TUNE
-            {
-                // BASE FREQUENCY
-                bool base_frequency_changed = false;
-                if (freq_glide_samples_left > 0 || last_root_note != root_note)
-                {
-                    if (freq_glide_samples_left > 0)
-                    {
-                        --freq_glide_samples_left;
-                    }
-
-                    {
-                        last_root_note = root_note;
-
-                        const float new_frequence = juce::jmax(
-                            5.0f, synth_data->tuning->midiNoteToFrequency(
-                                      root_note + freq_glide_delta * freq_glide_samples_left));
-                        if (new_frequence != last_frequency)
-                        {
-                            cycle_counter.set_frequency(new_frequence);
-                            square_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
-                            saw_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
-
-                            last_frequency = new_frequence;
-                        }
-                    }
-
-                    base_frequency_changed = true;
-                }
-
-                // MODULATOR FREQUENCY
-                {
-                    const float modulator_freq = smoothed_fm_freq_buffer[sid];
-                    if (base_frequency_changed || modulator_freq != last_modulator_frequency)
-                    {
-                        modulator.set_vibrato_frequency(
-                            last_frequency + last_frequency * (modulator_freq * 6 + 1.01));
-                        modulator_sync_cylces = std::floor(modulator_freq * 6 + 1);
-
-                        last_modulator_frequency = modulator_freq;
-                    }
-                }
-
-                // ADD PHASE SHIFT
-                square_generator.set_phase_offset(smoothed_phase_offset[sid]);
-                saw_generator.set_phase_offset(smoothed_phase_offset[sid]);
-                sine_generator.set_phase_offset(smoothed_phase_offset[sid]);
-            }
-
-            // PROCESS OSC ITSELF
-            bool is_last_sample_of_cycle = false;
-            float sample;
-            {
-                // TICK ALL OSCILATTORS
-                {
-                    cycle_counter.tick();
-                    saw_generator.tick(cycle_counter.get_last_phase());
-                    {
-                        double angle = cycle_counter.get_last_angle();
-                        square_generator.tick(angle);
-                        sine_generator.tick(angle);
-                    }
-
-                    // FORCE SYNC OF THE SINE AT THE NEXT SID
-                    if (cycle_counter.is_new_cycle())
-                    {
-                        // SET THE SWITCH
-                        is_last_sample_of_cycle = true;
-                        switch_buffer[sid] = true;
-                    }
-                }
-
-                // CALC THE SAMPLE MIX
-                {
-                    const float wave_form = smoothed_wave_buffer[sid];
-
-                    // SINE - SQUARE
-                    if (wave_form <= 1)
-                    {
-                        const float multi = wave_form;
-                        const float sine_wave_powerd = sine_generator.lastOut() * (1.0f - multi);
-                        const float square_wave_powerd = square_generator.lastOut() * multi;
-                        sample = sine_wave_powerd + square_wave_powerd;
-                    }
-                    // SQUARE - SAW
-                    else if (wave_form <= 2)
-                    {
-                        const float multi = wave_form - 1;
-                        const float square_wave_powerd =
-                            square_generator.lastOut() * (1.0f - multi);
-                        const float saw_wave_powerd = saw_generator.lastOut() * multi;
-                        sample = square_wave_powerd + saw_wave_powerd;
-                    }
-                    // SAW - RAND
-                    else /*if( wave_form <= 3 )*/
-                    {
-                        const float multi = wave_form - 2;
-                        const float saw_wave_powerd = saw_generator.lastOut() * (1.0f - multi);
-                        const float noice_powerd = noise.tick() * multi;
-                        sample = saw_wave_powerd + noice_powerd;
-                    }
-                }
-            }
-
-            // PROCESS MODULATOR
-            float modulator_sample = 0;
-            {
-                // MODULATOR SYNC AND PROCESSING
-                if (!modulator_waits_for_sync_cycle)
-                {
-                    modulator_sample = modulator.tick();
-                }
-
-                const bool is_last_sample_of_modulator_cycle = modulator.is_next_a_new_cycle();
-
-                // STOP THE MODULATOR IF IN SYNC // IGNORED IF SHOT IS ENABLED
-                if (modulator_run_circle > modulator_sync_cylces && fm_sync)
-                {
-                    modulator_waits_for_sync_cycle = !is_last_sample_of_cycle;
-                    modulator_run_circle = 0;
-                }
-                else if (is_last_sample_of_cycle)
-                {
-                    modulator_waits_for_sync_cycle = false;
-                    modulator_run_circle = 0;
-                }
-
-                // COUNT CYCLES AND CLEAR STATE IF NOT WAITING FOR SYNC
-                if (is_last_sample_of_modulator_cycle && !modulator_waits_for_sync_cycle)
-                {
-                    ++modulator_run_circle;
-                }
-
-                // UPDATE SWING
-                if (is_last_sample_of_modulator_cycle)
-                {
-                    modulator.set_swing_frequency(smoothed_fm_swing_buffer[sid] * 5);
-                }
-            }
-
-            // ADD FM TO THE OUTPUT
-            {
-                if (const float fm_amount = smoothed_fm_amount_buffer[sid])
-                {
-                    const float phase_move =
-                        smoothed_fm_phaser[sid]; // * jmin(1.0f,smoothed_fm_swing_buffer[sid]*80);
-                    sample = (1.0f - fm_amount) * sample +
-                             fm_amount * ((1.0f - phase_move) * sample * modulator_sample +
-                                          phase_move * (modulator_sample * modulator_sample *
-                                                        modulator_sample * sample));
-                }
-
-                if (--sync_glide_samples_left > 0)
-                {
-                    const float power = 1.0f / sync_glide_samples * sync_glide_samples_left;
-                    sample = sample * (1.0f - power) + sync_value * power;
-                    modulator_sample =
-                        modulator_sample * (1.0f - power) + sync_modulator_value * power;
-                }
-
-                output_buffer[sid] = sample;
-                modulator_buffer[sid] = modulator_sample;
-            }
-        }
-
-        last_value = output_buffer[num_samples_ - 1];
-        last_modulator_value = modulator_buffer[num_samples_ - 1];
-    }
-
-    //==============================================================================
-    inline void update(float root_note_, int sample_pos_) noexcept
-    {
-        root_note_ += synth_data->octave_offset * 12;
-        const float glide = synth_data->glide_smoother.get_smoothed_value_buffer()[sample_pos_];
-        if (glide != 0 && (root_note != root_note_ || freq_glide_samples_left > 0))
-        {
-            root_note_ = juce::jmax(1.0f, juce::jmin(127.0f, root_note_));
-
-            const float rest_glide = freq_glide_delta * freq_glide_samples_left;
-            freq_glide_samples_left = juce::jmax(10.0f, float(sample_rate * 0.5) * glide);
-            const float glide_notes_diverence = root_note - root_note_;
-            if (freq_glide_samples_left > 0)
-            {
-                freq_glide_delta = (glide_notes_diverence + rest_glide) / freq_glide_samples_left;
-            }
-            else
-            {
-                freq_glide_delta = 0;
-            }
-        }
-
-        root_note = root_note_;
-    }
-    inline void reset() noexcept
-    {
-        cycle_counter.reset();
-        saw_generator.reset();
-        square_generator.reset();
-        modulator.reset();
-
-        freq_glide_delta = 0;
-        freq_glide_samples_left = 0;
-
-        sync_value = last_value;
-        sync_modulator_value = last_modulator_value;
-        sync_glide_samples = juce::jmax(10, msToSamplesFast(1, sample_rate));
-        sync_glide_samples_left = sync_glide_samples;
-    }
-
-    void sample_rate_or_block_changed() noexcept override {}
-
-  public:
-    //==============================================================================
-    COLD MasterOSC(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
-                   const float *const sine_lookup_) noexcept
-        : RuntimeListener(notifyer_),
-
-          freq_glide_samples_left(0), freq_glide_delta(0),
-
-          sync_glide_samples(0), sync_glide_samples_left(0), last_value(0), last_modulator_value(0),
-          sync_value(0), sync_modulator_value(0),
-
-          root_note(60),
-
-          last_root_note(0), last_frequency(0),
-
-          last_modulator_frequency(0), modulator_sync_cylces(0), modulator_run_circle(0),
-          modulator_waits_for_sync_cycle(false),
-
-          cycle_counter(notifyer_), saw_generator(), square_generator(),
-          sine_generator(sine_lookup_), noise(),
-
-          modulator(notifyer_, sine_lookup_),
-
-          data_buffer(synth_data_->data_buffer), synth_data(synth_data_),
-          fm_osc_data(synth_data_->fm_osc_data.get()), osc_data(synth_data_->osc_datas[MASTER_OSC])
-    {
-    }
-    COLD ~MasterOSC() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MasterOSC)
-};
-
-//===================================================================================
-//===================================================================================
-//===================================================================================
-class SecondOSC : public RuntimeListener
-{
-    const int id;
-
-    // RUNTIME
-    //==============================================================================
-    int freq_glide_samples_left;
-    float freq_glide_delta;
-
-    float sync_glide_samples;
-    int sync_glide_samples_left;
-    float last_value;
-    float sync_value;
-
-    float root_note;
-    float last_root_note;
-    float last_tune;
-    float last_frequency;
-
-    bool wait_for_new_master_cycle;
-    float last_sync_was_to_tune;
-
-    // RAW OSCILATORS
-    //==============================================================================
-    PerfectCycleCounter cycle_counter;
-    mono_BlitSaw saw_generator;
-    mono_BlitSquare square_generator;
-    mono_SineWave sine_generator;
-    mono_Noise noise;
-
-    // DATA SOURCE
-    //==============================================================================
-    DataBuffer *const data_buffer;
-    const MoniqueSynthData *const synth_data;
-    OSCData *const osc_data;
-    OSCData *const master_osc_data;
-    FMOscData *const fm_osc_data;
-
-  public:
-    //==============================================================================
-    static inline bool is_syncanble_by_tune(float tune_) noexcept
-    {
-        bool syncable = false;
-        if (tune_ == 0)
-        {
-            syncable = true;
-        }
-        else if (tune_ == 0 + 24)
-        {
-            syncable = true;
-        }
-        else if (tune_ == 0 - 24)
-        {
-            syncable = true;
-        }
-
-        return syncable;
-    }
-
-    //==============================================================================
-    inline void process(DataBuffer *data_buffer_, const int num_samples_) noexcept
-    {
-        float *const output_buffer(data_buffer->osc_samples.getWritePointer(id));
-
-        const float *const switch_buffer(data_buffer->osc_switchs.getWritePointer());
-        const float *const modulator_buffer(
-            data_buffer->modulator_samples.getWritePointer(MASTER_OSC));
-        const float *const lfo_amps((data_buffer->lfo_amplitudes.getReadPointer(id)));
-
-        const bool is_lfo_modulated = osc_data->is_lfo_modulated;
-
-        const bool sync_to_master = osc_data->sync;
-        osc_data->tune_smoother.process_modulation(is_lfo_modulated, lfo_amps, num_samples_);
-        const float *const smoothed_tune_buffer(
-            osc_data->tune_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_fm_amount_buffer(
-            osc_data->fm_amount_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_wave_buffer(
-            osc_data->wave_smoother.get_smoothed_value_buffer());
-        // const float*const smoothed_fm_swing_buffer(
-        // fm_osc_data->fm_swing_smoother.get_smoothed_modulated_value_buffer() );
-        const float *const smoothed_fm_phaser(
-            fm_osc_data->fm_shape_smoother.get_smoothed_value_buffer());
-        for (int sid = 0; sid < num_samples_; ++sid)
-        {
-            // SETUP TUNE
-            const float tune = smoothed_tune_buffer[sid];
-            {
-                // FREQUENCY
-                if (freq_glide_samples_left > 0 || tune != last_tune || last_root_note != root_note)
-                {
-                    if (freq_glide_samples_left > 0)
-                    {
-                        --freq_glide_samples_left;
-                    }
-
-                    {
-                        last_tune = tune;
-                        last_root_note = root_note;
-
-                        const float new_frequence =
-                            juce::jmax(5.0f, synth_data->tuning->midiNoteToFrequency(
-                                                 root_note + tune +
-                                                 freq_glide_delta * freq_glide_samples_left));
-                        if (new_frequence != last_frequency)
-                        {
-                            cycle_counter.set_frequency(new_frequence);
-                            square_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
-                            saw_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
-                        }
-                    }
-                }
-            }
-
-            // PROCESS OSC AND SYNC IT TO THE MASTER
-            const bool is_last_sample_of_master_cycle = switch_buffer[sid];
-            float sample = 0;
-            {
-                // TICK ALL OSCILATTORS
-                if (!wait_for_new_master_cycle)
-                {
-                    cycle_counter.tick();
-                    saw_generator.tick(cycle_counter.get_last_phase());
-                    {
-                        double angle = cycle_counter.get_last_angle();
-                        square_generator.tick(angle);
-                        sine_generator.tick(angle);
-                    }
-                }
-
-                // FORCE SYNC OF THE SINE AT THE NEXT SID
-                if (cycle_counter.is_new_cycle())
-                {
-                    const bool syncanble_by_tune = is_syncanble_by_tune(tune);
-                    if (!syncanble_by_tune)
-                    {
-                        last_sync_was_to_tune = -25;
-                    }
-                    if (sync_to_master)
-                    {
-                        if (!is_lfo_modulated && !syncanble_by_tune &&
-                            last_sync_was_to_tune != tune)
-                        {
-                            wait_for_new_master_cycle = true;
-                        }
-                    }
-                    else
-                    {
-                        if (!is_lfo_modulated && freq_glide_samples_left <= 0)
-                        {
-                            if (syncanble_by_tune && last_sync_was_to_tune != tune)
-                            {
-                                wait_for_new_master_cycle = true;
-                                last_sync_was_to_tune = tune;
-                            }
-                        }
-                    }
-                }
-                if (is_last_sample_of_master_cycle)
-                {
-                    wait_for_new_master_cycle = false;
-                }
-
-                // CALC THE SAMPLE MIX
-                if (!wait_for_new_master_cycle)
-                {
-                    const float wave_form = smoothed_wave_buffer[sid];
-
-                    // SINE - SQUARE
-                    if (wave_form <= 1)
-                    {
-                        const float multi = wave_form;
-                        const float sine_wave_powerd = sine_generator.lastOut() * (1.0f - multi);
-                        const float square_wave_powerd = square_generator.lastOut() * multi;
-                        sample = sine_wave_powerd + square_wave_powerd;
-                    }
-                    // SQUARE - SAW
-                    else if (wave_form <= 2)
-                    {
-                        const float multi = wave_form - 1;
-                        const float square_wave_powerd =
-                            square_generator.lastOut() * (1.0f - multi);
-                        const float saw_wave_powerd = saw_generator.lastOut() * multi;
-                        sample = square_wave_powerd + saw_wave_powerd;
-                    }
-                    // SAW - RAND
-                    else /*if( wave_form <= 3 )*/
-                    {
-                        const float multi = wave_form - 2;
-                        const float saw_wave_powerd = saw_generator.lastOut() * (1.0f - multi);
-                        const float noice_powerd = noise.tick() * multi;
-                        sample = saw_wave_powerd + noice_powerd;
-                    }
-                }
-            }
-
-            // ADD FM TO THE OUTPUT
-            {
-                if (const float fm_amount = smoothed_fm_amount_buffer[sid])
-                {
-                    float modulator_sample = modulator_buffer[sid];
-                    const float phase_move =
-                        smoothed_fm_phaser[sid]; // * jmin(1.0f,smoothed_fm_swing_buffer[sid]*80);
-                    sample = (1.0f - fm_amount) * sample +
-                             fm_amount * ((1.0f - phase_move) * sample * modulator_sample +
-                                          phase_move * (modulator_sample * modulator_sample *
-                                                        modulator_sample * sample));
-                }
-
-                if (--sync_glide_samples_left > 0)
-                {
-                    const float power = 1.0f / sync_glide_samples * sync_glide_samples_left;
-                    sample = sample * (1.0f - power) + sync_value * power;
-                }
-
-                output_buffer[sid] = sample;
-            }
-        }
-
-        last_value = output_buffer[num_samples_ - 1];
-    }
-
-    //==============================================================================
-    inline void update(float root_note_, int sample_pos_) noexcept
-    {
-        root_note_ += synth_data->octave_offset * 12;
-        const float glide = synth_data->glide_smoother.get_smoothed_value_buffer()[sample_pos_];
-        if (glide != 0 && (root_note != root_note_ || freq_glide_samples_left > 0))
-        {
-            root_note_ = juce::jmax(1.0f, juce::jmin(127.0f, root_note_));
-
-            const float rest_glide = freq_glide_delta * freq_glide_samples_left;
-            freq_glide_samples_left = (sample_rate * 0.5) * glide;
-            const float glide_notes_diverence = root_note - root_note_;
-            if (freq_glide_samples_left > 0)
-            {
-                freq_glide_delta = (glide_notes_diverence + rest_glide) / freq_glide_samples_left;
-            }
-            else
-            {
-                freq_glide_delta = 0;
-            }
-        }
-
-        root_note = root_note_;
-    }
-    inline void reset() noexcept
-    {
-        cycle_counter.reset();
-        saw_generator.reset();
-        square_generator.reset();
-
-        freq_glide_delta = 0;
-        freq_glide_samples_left = 0;
-
-        wait_for_new_master_cycle = false;
-
-        sync_value = last_value;
-        sync_glide_samples = juce::jmax(10, msToSamplesFast(1, sample_rate));
-        sync_glide_samples_left = sync_glide_samples;
-    }
-    void sample_rate_or_block_changed() noexcept override {}
-
-  public:
-    //==============================================================================
-    COLD SecondOSC(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_, int id_,
-                   const float *const sine_lookup_) noexcept
-        : RuntimeListener(notifyer_),
-
-          id(id_),
-
-          freq_glide_samples_left(0), freq_glide_delta(0),
-
-          sync_glide_samples(0), sync_glide_samples_left(0), last_value(0), sync_value(0),
-
-          root_note(60), last_root_note(0), last_tune(-25), last_frequency(0),
-
-          wait_for_new_master_cycle(false), last_sync_was_to_tune(-25),
-
-          cycle_counter(notifyer_), saw_generator(), square_generator(),
-          sine_generator(sine_lookup_), noise(),
-
-          data_buffer(synth_data_->data_buffer), synth_data(synth_data_),
-          osc_data(synth_data_->osc_datas[id_]),
-          master_osc_data(synth_data_->osc_datas[MASTER_OSC]),
-          fm_osc_data(synth_data_->fm_osc_data.get())
-    {
-    }
-    COLD ~SecondOSC() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SecondOSC)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_ENVOsccilator : public RuntimeListener
-{
-    const float *const sine_lookup;
-    const float *const cos_lookup;
-    const float *const exp_lookup;
-
-    float start_amp;
-    float out_amp;
-    float target_amp;
-    enum TYPE
-    {
-        ATTACK,
-        RELEASE,
-        KEEP
-    };
-    TYPE type;
-
-    float delta;
-    float angle;
-    float sine_angle_start;
-
-    float shape;
-    float time_in_samples;
-    int sample_counter;
-    bool is_unlimited;
-
-  public:
-    //==========================================================================
-    // SHAPE 0 - sine-, 1 - linear, 2 - sine+
-    inline void set_process_values(float start_value_, float end_value_, float shape_,
-                                   float time_in_samples_) noexcept
-    {
-        start_amp = start_value_;
-        target_amp = end_value_;
-        shape = ((shape_ + 1) * 0.5f) * 0.9f + 0.1;
-        time_in_samples = time_in_samples_;
-    }
-    inline void calculate_attack_coeffecients() noexcept
-    {
-        sample_counter = time_in_samples;
-        angle = 0;
-        sine_angle_start = juce::MathConstants<float>::pi * 1.5f;
-        type = TYPE::ATTACK;
-        is_unlimited = false;
-        delta = juce::MathConstants<float>::pi / sample_counter;
-    }
-    inline void calculate_release_coeffecients() noexcept
-    {
-        sample_counter = time_in_samples;
-        angle = 0;
-        sine_angle_start = juce::MathConstants<float>::pi * 1.5f;
-        type = TYPE::RELEASE;
-        is_unlimited = false;
-        delta = juce::MathConstants<float>::pi / sample_counter;
-    }
-    inline void calculate_keep_coeffecients() noexcept
-    {
-        sample_counter = time_in_samples;
-        delta = 0;
-        angle = 0;
-        type = TYPE::KEEP;
-        is_unlimited = false;
-    }
-    inline void calculate_unlimited_coeffecients() noexcept
-    {
-        sample_counter = 0;
-        delta = 0;
-        angle = 0;
-        type = TYPE::KEEP;
-        is_unlimited = true;
-    }
-    inline void only_calculate_new_target(float target_) noexcept
-    {
-        // start_amp = out_amp;
-        target_amp = target_;
-        // sample_counter = time_in_samples;
-        // delta = (juce::MathConstants<float>::pi) / sample_counter;
-        // angle = 0;
-    }
-
-    //==========================================================================
-    void sample_rate_or_block_changed() noexcept override
-    {
-        // AUTO RESET ON NEXT CYCLE
-    }
-
-  public:
-    //==========================================================================
-    inline float tick() noexcept
-    {
-        if (--sample_counter > 0)
-        {
-            if (delta != 0)
-            {
-                angle += delta;
-                /*shape*(angle-cos_for_angle)*/
-                const float angle_drift =
-                    lookup(exp_lookup, angle) * angle * shape +
-                    (angle + lookup(cos_lookup, angle + sine_angle_start)) * (1.0f - shape);
-                if (type == TYPE::ATTACK)
-                {
-                    out_amp = start_amp +
-                              ((lookup(sine_lookup, angle_drift + sine_angle_start) + 1) * 0.5f) *
-                                  (target_amp - start_amp);
-                }
-                else if (type == TYPE::RELEASE)
-                {
-                    out_amp = start_amp -
-                              ((lookup(sine_lookup, angle_drift + sine_angle_start) + 1) * 0.5f) *
-                                  (start_amp - target_amp);
-                }
-            }
-        }
-        else
-        {
-            out_amp = target_amp;
-        }
-
-        return out_amp;
-    }
-
-  public:
-    //==========================================================================
-    inline float last_out() const noexcept { return out_amp; }
-    inline void overwrite_current_value(float amp_) noexcept { out_amp = amp_; }
-
-    //==========================================================================
-    inline bool is_finished() const noexcept { return is_endless() && sample_counter <= 0; }
-    inline bool is_endless() const noexcept { return !is_unlimited; }
-
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        sample_counter = 0;
-        start_amp = 0;
-        out_amp = 0;
-        type = KEEP;
-        target_amp = 0;
-        delta = 0;
-        angle = 0;
-        time_in_samples = 0;
-        sample_counter = 0;
-        is_unlimited = false;
-    }
-
-  public:
-    //==========================================================================
-    COLD mono_ENVOsccilator(RuntimeNotifyer *const notifyer_, const float *const sine_lookup_,
-                            const float *const cos_lookup_, const float *const exp_lookup_) noexcept
-
-        : RuntimeListener(notifyer_), sine_lookup(sine_lookup_), cos_lookup(cos_lookup_),
-          exp_lookup(exp_lookup_),
-
-          start_amp(0), out_amp(0), target_amp(0), type(KEEP),
-
-          delta(0), angle(0), sine_angle_start(0),
-
-          shape(0),
-
-          time_in_samples(0), sample_counter(0), is_unlimited(false)
-    {
-    }
-    COLD ~mono_ENVOsccilator() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_ENVOsccilator)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-enum STAGES
-{
-    END_ENV = false,
-    ATTACK = true,
-    DECAY,
-    SUSTAIN,
-    RELEASE,
-    TRIGGER_START
-};
-class ENV : RuntimeListener
-{
-    mono_ENVOsccilator env_osc;
-
-    STAGES current_stage;
-
-    const MoniqueSynthData *const synth_data;
-    float last_sustain;
-    bool goes_to_sustain;
-    bool is_sustain;
-
-  public:
-    ENVData *const env_data;
-
-  public:
-    //==========================================================================
-    inline void process(float *dest_, const int num_samples_) noexcept
-    {
-        const float *smoothed_sustain_buffer =
-            env_data->sustain_smoother.get_smoothed_value_buffer();
-        for (int sid = 0; sid < num_samples_; ++sid)
-        {
-            const float sustain = smoothed_sustain_buffer[sid];
-            if (last_sustain != sustain)
-            {
-                last_sustain = sustain;
-                if (goes_to_sustain)
-                {
-                    env_osc.only_calculate_new_target(last_sustain);
-                }
-                else if (is_sustain)
-                {
-                    env_osc.overwrite_current_value(last_sustain);
-                }
-            }
-            dest_[sid] = env_osc.tick();
-
-            if (env_osc.is_finished())
-            {
-                update_stage(sid);
-            }
-        }
-    }
-
-  private:
-    inline void update_stage(int sid_, bool force_relese_ = false) noexcept
-    {
-        const float *smoothed_sustain_buffer =
-            env_data->sustain_smoother.get_smoothed_value_buffer();
-        const float *smoothed_shape_buffer = env_data->shape_smoother.get_smoothed_value_buffer();
-        switch (current_stage)
-        {
-        case TRIGGER_START: // --> ATTACK
-        {
-            if (env_data->decay > 0)
-            {
-                env_osc.set_process_values(env_osc.last_out(), 1, smoothed_shape_buffer[sid_],
-                                           get_env_samples(env_data->attack, sample_rate));
-                goes_to_sustain = false;
-                is_sustain = false;
-            }
-            else
-            {
-                env_osc.set_process_values(env_osc.last_out(), smoothed_sustain_buffer[sid_],
-                                           smoothed_shape_buffer[sid_],
-                                           get_env_samples(env_data->attack, sample_rate));
-                goes_to_sustain = true;
-                is_sustain = false;
-            }
-
-            env_osc.calculate_attack_coeffecients();
-            current_stage = ATTACK;
-
-            break;
-        }
-        case ATTACK: // --> DECAY
-        {
-            const float decay = env_data->decay;
-            if (decay > 0)
-            {
-                env_osc.set_process_values(env_osc.last_out(), smoothed_sustain_buffer[sid_],
-                                           smoothed_shape_buffer[sid_],
-                                           get_env_samples(decay, sample_rate));
-                goes_to_sustain = true;
-                is_sustain = false;
-                env_osc.calculate_release_coeffecients();
-
-                current_stage = DECAY;
-
-                break;
-            }
-            // ELSE FALL TO DECAY AND START SUSTAIN LEVEL
-            [[fallthrough]];
-        }
-        case DECAY: // --> SUSTAIN
-        {
-            const float sustain_time = env_data->sustain_time;
-            const float sustain_level = smoothed_sustain_buffer[sid_];
-            if (sustain_time >= 1)
-            {
-                env_osc.set_process_values(env_osc.last_out(), sustain_level,
-                                           smoothed_shape_buffer[sid_],
-                                           get_env_samples(sustain_time, sample_rate));
-                env_osc.calculate_unlimited_coeffecients();
-                is_sustain = true;
-                goes_to_sustain = false;
-            }
-            else
-            {
-                env_osc.set_process_values(
-                    env_osc.last_out(), sustain_level, smoothed_shape_buffer[sid_],
-                    juce::jmax(20.0f, get_env_samples(sustain_time, sample_rate)));
-                env_osc.calculate_release_coeffecients();
-                is_sustain = true;
-                goes_to_sustain = false;
-            }
-            current_stage = SUSTAIN;
-
-            break;
-        }
-        case SUSTAIN: // --> RELEASE or RETRIGGER
-        {
-            const float sustain_time = env_data->sustain_time;
-            if (force_relese_)
-            {
-                env_osc.set_process_values(env_osc.last_out(), 0, smoothed_shape_buffer[sid_],
-                                           get_env_samples(env_data->release, sample_rate));
-                goes_to_sustain = false;
-                is_sustain = false;
-                env_osc.calculate_release_coeffecients();
-
-                current_stage = RELEASE;
-            }
-            // RETRIGGER
-            else
-            {
-                start_attack();
-            }
-
-            break;
-        }
-        case RELEASE: // --> RELEASE
-        {
-            goes_to_sustain = false;
-            is_sustain = false;
-            current_stage = END_ENV;
-
-            break;
-        }
-        default:
-        {
-            goes_to_sustain = false;
-            is_sustain = false;
-            current_stage = END_ENV;
-        }
-        }
-    }
-
-  public:
-    //==========================================================================
-    inline void start_attack() noexcept
-    {
-        current_stage = TRIGGER_START;
-        update_stage(0);
-    }
-    inline void set_to_release() noexcept
-    {
-        current_stage = SUSTAIN;
-        update_stage(0, true);
-    }
-    inline void reset() noexcept
-    {
-        current_stage = END_ENV;
-
-        last_sustain = 0;
-        goes_to_sustain = false;
-        is_sustain = false;
-        env_osc.reset();
-    }
-
-    //==============================================================================
-    inline STAGES get_current_stage() const noexcept { return current_stage; }
-    inline void set_current_stage(STAGES current_stage_) noexcept
-    {
-        current_stage = current_stage_;
-    }
-    inline void overwrite_current_value(float amp_) noexcept
-    {
-        env_osc.overwrite_current_value(amp_);
-        last_sustain = amp_;
-    }
-    inline bool is_endless() noexcept { return env_osc.is_endless(); }
-
-    //==============================================================================
-    inline float get_amp() const noexcept { return env_osc.last_out(); }
-
-    //==============================================================================
-    void sample_rate_or_block_changed() noexcept override {}
-
-  public:
-    //==============================================================================
-    inline ENV(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
-               ENVData *env_data_, const float *const sine_lookup_, const float *const cos_lookup_,
-               const float *const exp_lookup_) noexcept
-        : RuntimeListener(notifyer_), env_osc(notifyer_, sine_lookup_, cos_lookup_, exp_lookup_),
-
-          current_stage(END_ENV),
-
-          synth_data(synth_data_),
-
-          last_sustain(0), goes_to_sustain(false), is_sustain(false),
-
-          env_data(env_data_)
-    {
-    }
-    inline ~ENV() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ENV)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-template <int smooth_samples> class AmpSmoother
-{
-    float current_value;
-    float target_value;
-    float delta;
-    int counter;
-
-  private:
-    inline void glide_tick() noexcept;
-
-  public:
-    inline float add_get(float in_) noexcept;
-    bool is_up_to_date() const noexcept;
-    inline float add_get_and_keep_current_time(float in_) noexcept;
-    inline void reset(float value_ = 0) noexcept;
-    inline float get_current_value() const noexcept;
-
-    COLD AmpSmoother(float start_value_ = 0) noexcept;
-    COLD ~AmpSmoother() noexcept;
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AmpSmoother)
-};
-
-//==============================================================================
-template <int smooth_samples>
-COLD AmpSmoother<smooth_samples>::AmpSmoother(float start_value_) noexcept
-    : current_value(0), target_value(start_value_), delta(0), counter(0)
-{
-}
-template <int smooth_samples> COLD AmpSmoother<smooth_samples>::~AmpSmoother() noexcept {}
-
-//==============================================================================
-template <int smooth_samples> inline float AmpSmoother<smooth_samples>::add_get(float in_) noexcept
-{
-    if (current_value != in_ || target_value != in_)
-    {
-        // ONLY UPDATE IF WE HAVE A NEW VALUE
-        if (target_value != in_)
-        {
-            counter = smooth_samples;
-            delta = (in_ - current_value) / smooth_samples;
-            target_value = in_;
-        }
-
-        glide_tick();
-    }
-
-    return current_value;
-}
-template <int smooth_samples> bool AmpSmoother<smooth_samples>::is_up_to_date() const noexcept
-{
-    return target_value == current_value;
-}
-template <int smooth_samples> inline void AmpSmoother<smooth_samples>::reset(float value_) noexcept
-{
-    current_value = value_;
-    delta = 0;
-    counter = 0;
-}
-template <int smooth_samples>
-inline float AmpSmoother<smooth_samples>::add_get_and_keep_current_time(float in_) noexcept
-{
-    if (current_value != in_ || target_value != in_)
-    {
-        // ONLY UPDATE IF WE HAVE A NEW VALUE
-        if (target_value != in_)
-        {
-            delta = (in_ - current_value) / counter;
-            target_value = in_;
-        }
-
-        glide_tick();
-    }
-
-    return current_value;
-}
-template <int smooth_samples> inline void AmpSmoother<smooth_samples>::glide_tick() noexcept
-{
-    if (--counter <= 0)
-        current_value = target_value;
-    else
-    {
-        current_value += delta;
-        if (current_value > 1 || current_value < 0)
-        {
-            current_value = target_value;
-            counter = 0;
-        }
-    }
-}
-template <int smooth_samples>
-inline float AmpSmoother<smooth_samples>::get_current_value() const noexcept
-{
-    return current_value;
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class AnalogFilter : public RuntimeListener
-{
-    friend class DoubleAnalogFilter;
-    float p, k, r;
-    float y1, y2, y3, y4;
-    float oldx;
-    float oldy1, oldy2, oldy3;
-
-    float cutoff, res, res_original;
-
-    bool force_update;
-    int zero_counter;
-
-  public:
-    //==========================================================================
-    // RETURNS TRUE ON COFF CHANGED
-    inline bool update(float resonance_, float cutoff_) noexcept
-    {
-        bool success = false;
-        if (force_update || (cutoff != cutoff_ || res_original != resonance_))
-        {
-            cutoff = cutoff_;
-            res_original = resonance_;
-            res = juce::jmax(0.00001f, resonance_ *= 0.99999);
-            success = true;
-
-            force_update = false;
-        }
-        return success;
-    }
-    inline void update_with_fixed_cutoff(float resonance_, float cutoff_) noexcept
-    {
-        if (force_update || (cutoff != cutoff_ || res_original != resonance_))
-        {
-            cutoff = cutoff_;
-            res_original = resonance_;
-            res = resonance_;
-            calc_coefficients(cutoff);
-
-            force_update = false;
-        }
-    }
-    //==========================================================================
-    inline void copy_coefficient_from(const AnalogFilter &other_) noexcept
-    {
-        cutoff = other_.cutoff;
-        res = other_.res;
-
-        p = other_.p;
-        k = other_.k;
-        r = other_.r;
-    }
-    inline void copy_state_from(const AnalogFilter &other_) noexcept
-    {
-        oldx = other_.oldx;
-        oldy1 = other_.oldy1;
-        oldy2 = other_.oldy2;
-        oldy3 = other_.oldy3;
-        y1 = other_.y1;
-        y2 = other_.y2;
-        y3 = other_.y3;
-        y4 = other_.y4;
-    }
-#define MONO_UNDENORMALISE(n)                                                                      \
-    if (!(n < -1.0e-8f || n > 1.0e-8f))                                                            \
-        n = 0;
-    //==========================================================================
-    inline float processLow(float input_and_worker_) noexcept
-    {
-        MONO_UNDENORMALISE(input_and_worker_);
-        if (input_and_worker_ != 0)
-        {
-            zero_counter = 0;
-        }
-        else if (y4 == 0)
-        {
-            ++zero_counter;
-        }
-        else
-        {
-            zero_counter = 0;
-        }
-
-        if (zero_counter < 50)
-        {
-            input_and_worker_ -= r * y4;
-            MONO_UNDENORMALISE(input_and_worker_);
-
-            // Four cascaded onepole filters (bilinear transform)
-            y1 = input_and_worker_ * p + oldx * p - k * y1;
-            y2 = y1 * p + oldy1 * p - k * y2;
-            y3 = y2 * p + oldy2 * p - k * y3;
-            y4 = y3 * p + oldy3 * p - k * y4;
-
-            // Clipper band limited sigmoid
-            y4 -= (y4 * y4 * y4) / 6;
-            MONO_UNDENORMALISE(y4);
-
-            oldx = input_and_worker_;
-            oldy1 = y1;
-            oldy2 = y2;
-            oldy3 = y3;
-
-            input_and_worker_ = soft_clipp_greater_1_2(y4);
-            MONO_UNDENORMALISE(input_and_worker_);
-        }
-
-        return input_and_worker_;
-    }
-    inline float processLowResonance(float input_and_worker_) noexcept
-    {
-        MONO_UNDENORMALISE(input_and_worker_);
-        if (input_and_worker_ != 0)
-        {
-            zero_counter = 0;
-        }
-        else if (y4 == 0)
-        {
-            ++zero_counter;
-        }
-        else
-        {
-            zero_counter = 0;
-        }
-
-        if (zero_counter < 50)
-        {
-            // process input
-            input_and_worker_ -= r * y4;
-            MONO_UNDENORMALISE(y1);
-
-            // Four cascaded onepole filters (bilinear transform)
-            y1 = input_and_worker_ * p + oldx * p - k * y1;
-            y2 = y1 * p + oldy1 * p - k * y2;
-            y3 = y2 * p + oldy2 * p - k * y3;
-            y4 = y3 * p + oldy3 * p - k * y4;
-
-            // Clipper band limited sigmoid
-            y4 -= (y4 * y4 * y4) / 6;
-            MONO_UNDENORMALISE(y4);
-
-            oldx = input_and_worker_;
-            oldy1 = y1;
-            oldy2 = y2;
-            oldy3 = y3;
-
-            input_and_worker_ = soft_clipp_greater_1_2(sample_mix(y4, y3 * res));
-            MONO_UNDENORMALISE(input_and_worker_);
-        }
-
-        return input_and_worker_;
-    }
-    inline float processHighResonance(float input_and_worker_) noexcept
-    {
-        MONO_UNDENORMALISE(input_and_worker_);
-        if (input_and_worker_ != 0)
-        {
-            zero_counter = 0;
-        }
-        else if (y4 == 0)
-        {
-            ++zero_counter;
-        }
-        else
-        {
-            zero_counter = 0;
-        }
-
-        if (zero_counter < 50)
-        {
-            // process input
-            input_and_worker_ -= r * y4;
-            MONO_UNDENORMALISE(input_and_worker_);
-
-            // Four cascaded onepole filters (bilinear transform)
-            y1 = input_and_worker_ * p + oldx * p - k * y1;
-            y2 = y1 * p + oldy1 * p - k * y2;
-            y3 = y2 * p + oldy2 * p - k * y3;
-            y4 = y3 * p + oldy3 * p - k * y4;
-
-            // Clipper band limited sigmoid
-            y4 -= (y4 * y4 * y4) / 6;
-            MONO_UNDENORMALISE(y4);
-
-            oldx = input_and_worker_;
-            oldy1 = y1;
-            oldy2 = y2;
-            oldy3 = y3;
-
-            input_and_worker_ = hard_clipper_1(input_and_worker_ - y4);
-            MONO_UNDENORMALISE(input_and_worker_);
-        }
-
-        return input_and_worker_;
-    }
-
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        y1 = y2 = y3 = y4 = oldx = oldy1 = oldy2 = oldy3 = 0;
-        zero_counter = 0;
-    }
-
-    //==========================================================================
-    inline void calc_coefficients(float cutoff_) noexcept
-    {
-        {
-            float f = cutoff_ / sample_rate;
-
-            // float agressive = 0.98f *( 1.0f - res );
-            // float agressive = 0.98f * jmax(0.0f,( 1.0f/8000.0f*cutoff ));
-            // p=f*((1.99f-agressive)-((0.99f-agressive)*f));
-            p = f * (1.8f - 0.8f * f);
-            k = p * 2 - 1;
-        }
-        {
-            // const float cutoff_power = 1.0f - (0.5f * jmin(1.0f,1.0f/(8000.0f*cutoff_)));
-            float t =
-                (1.0f - p) * 1.386249f; // + ( 0.2f * (1.0f-1.0f/(1000.0f*jmax(0.00001f,cutoff))) );
-            const float t2 = 12.0f + t * t;
-            r = res * (t2 + 6.0f * t) / (t2 - 6.0f * t); // * cutoff_power;
-        }
-    }
-
-  private:
-    //==========================================================================
-    COLD void sample_rate_or_block_changed() noexcept override
-    {
-        reset();
-        force_update = true;
-    }
-
-  public:
-    //==========================================================================
-    COLD AnalogFilter(RuntimeNotifyer *const notifyer_) noexcept
-        : RuntimeListener(notifyer_),
-
-          p(1), k(1), r(1), y1(0), y2(0), y3(0), y4(0), oldx(0), oldy1(0), oldy2(0), oldy3(0),
-
-          cutoff(1000), res(1), res_original(0.99999),
-
-          force_update(true), zero_counter(0)
-    {
-        sample_rate_or_block_changed();
-    }
-    COLD ~AnalogFilter() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalogFilter)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-#define FILTER_CHANGE_GLIDE_TIME_MS (msToSamplesFast(200, flt_1.sample_rate) + 50)
-class DoubleAnalogFilter
-{
-    AnalogFilter flt_1;
-    AnalogFilter flt_2;
-
-    DoubleAnalogFilter *smooth_filter;
-
-    FILTER_TYPS last_filter_type;
-    FILTER_TYPS smooth_filter_type;
-    int glide_time_4_filters;
-
-  public:
-    // LP
-    //==========================================================================
-    inline void updateLow2Pass(float resonance_, float cutoff_) noexcept
-    {
-        if (flt_2.update(resonance_, cutoff_))
-        {
-            flt_2.calc_coefficients(get_cutoff(cutoff_));
-            flt_1.copy_coefficient_from(flt_2);
-        }
-    }
-    inline float processLow2Pass(float in_) noexcept
-    {
-        const float out = flt_2.processLowResonance(in_);
-        const float low = flt_1.processLowResonance(out);
-
-        return process_filter_change(in_,
-                                     //(out+low)*(1.0f-gain) + resonance_clipping(out+low)*gain
-                                     sample_mix(out, low));
-    }
-
-    // 1 PASS HP
-    //==========================================================================
-    inline void updateHigh2Pass(float resonance_, float cutoff_) noexcept
-    {
-        if (flt_1.update(resonance_, cutoff_))
-        {
-            flt_1.calc_coefficients(get_cutoff(cutoff_));
-        }
-    }
-    inline float processHigh2Pass(float in_) noexcept
-    {
-        in_ = soft_clipp_greater_1_2(in_);
-        const float out = flt_1.processHighResonance(in_);
-        return process_filter_change(in_, out);
-    }
-
-    // BAND
-    //==========================================================================
-    inline void updateBand(float resonance_, float cutoff_) noexcept
-    {
-        float cutoff_2 = cutoff_ + cutoff_ * 0.02;
-        if (flt_1.update(resonance_, cutoff_2))
-        {
-            flt_1.calc_coefficients(get_cutoff(cutoff_));
-            flt_2.update(resonance_, cutoff_);
-            flt_2.calc_coefficients(get_cutoff(cutoff_));
-        }
-    }
-    inline float processBand(float in_) noexcept
-    {
-        return process_filter_change(
-            in_, flt_1.processLowResonance(flt_2.processHighResonance(in_)) * 2);
-    }
-
-    // PASS
-    //==========================================================================
-    inline float processPass(float in_) noexcept { return process_filter_change(in_, in_); }
-
-    // BY TYPE
-    //==========================================================================
-    inline void update_filter_to(FILTER_TYPS type_) noexcept
-    {
-        if (last_filter_type != type_)
-        {
-            if (smooth_filter)
-            {
-                // SET THE SECOND FILTER TO THE OLD COMPLETE STATE
-                if (last_filter_type != PASS)
-                {
-                    smooth_filter->flt_1.copy_coefficient_from(flt_1);
-                    smooth_filter->flt_1.copy_state_from(flt_1);
-                    flt_1.force_update = true;
-
-                    smooth_filter->flt_2.copy_coefficient_from(flt_2);
-                    smooth_filter->flt_2.copy_state_from(flt_2);
-                    flt_2.force_update = true;
-                }
-                else
-                {
-                    flt_1.reset();
-                    flt_2.reset();
-                }
-                flt_1.force_update = true;
-                flt_2.force_update = true;
-
-                glide_time_4_filters = FILTER_CHANGE_GLIDE_TIME_MS;
-
-                smooth_filter->last_filter_type = last_filter_type;
-                smooth_filter_type = last_filter_type;
-            }
-
-            last_filter_type = type_;
-        }
-    }
-    inline float process_filter_change(float original_in_, float result_in_) noexcept
-    {
-        if (glide_time_4_filters > 0)
-        {
-            // if( smooth_filter ) IS TRUE IF glide_time_4_filters != 0
-            {
-                const float smooth_out =
-                    smooth_filter->processByType(original_in_, smooth_filter_type);
-
-                float mix = 1.0f / float(FILTER_CHANGE_GLIDE_TIME_MS) * glide_time_4_filters;
-                result_in_ = result_in_ * (1.0f - mix) + smooth_out * mix;
-            }
-            --glide_time_4_filters;
-        }
-
-        return result_in_;
-    }
-    inline float processByType(float io_, FILTER_TYPS type_) noexcept
-    {
-        switch (type_)
-        {
-        case LPF:
-        case LPF_2_PASS:
-            io_ = processLow2Pass(io_);
-            break;
-        case HPF:
-        case HIGH_2_PASS:
-            io_ = processHigh2Pass(io_);
-            break;
-        case BPF:
-            io_ = processBand(io_);
-            break;
-        default /* PASS & UNKNOWN */:; // io_ = filter_hard_clipper(io_);
-        }
-
-        return io_;
-    }
-
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        last_filter_type = UNKNOWN;
-        smooth_filter_type = UNKNOWN;
-        glide_time_4_filters = 0;
-        if (smooth_filter)
-        {
-            smooth_filter->reset();
-        }
-        flt_1.reset();
-        flt_2.reset();
-    }
-
-  public:
-    //==============================================================================
-    COLD DoubleAnalogFilter(RuntimeNotifyer *const notifyer_,
-                            bool create_smooth_filter = true) noexcept
-        : flt_1(notifyer_), flt_2(notifyer_),
-
-          smooth_filter(nullptr),
-
-          last_filter_type(UNKNOWN), smooth_filter_type(UNKNOWN),
-
-          glide_time_4_filters(0)
-    {
-        if (create_smooth_filter)
-        {
-            smooth_filter = new DoubleAnalogFilter(notifyer_, false);
-        }
-    }
-    COLD ~DoubleAnalogFilter() noexcept
-    {
-        if (smooth_filter)
-        {
-            delete smooth_filter;
-        }
-    }
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DoubleAnalogFilter)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class FilterProcessor
-{
-    juce::OwnedArray<DoubleAnalogFilter> double_filter;
-    friend class mono_ParameterOwnerStore;
-
-  public:
-    std::unique_ptr<ENV> env;
-    juce::Array<ENVData *> input_env_datas;
-    juce::OwnedArray<ENV> input_envs;
-
-  private:
-    const int id;
-
-    const MoniqueSynthData *const synth_data;
-    FilterData *const filter_data;
-    DataBuffer *const data_buffer;
-
-    const float *const sin_lookup;
-    const float *const cos_lookup;
-
-  public:
-    //==========================================================================
-    inline void start_attack() noexcept
-    {
-        start_env();
-        start_input_env(0);
-        start_input_env(1);
-        start_input_env(2);
-    }
-    inline void start_env() noexcept { env->start_attack(); }
-    inline void start_input_env(int id_) noexcept { input_envs.getUnchecked(id_)->start_attack(); }
-    inline void start_release() noexcept
-    {
-        start_env_release();
-        start_input_env_release(0);
-        start_input_env_release(1);
-        start_input_env_release(2);
-    }
-    inline void start_env_release() noexcept { env->set_to_release(); }
-    inline void start_input_env_release(int id_) noexcept
-    {
-        input_envs.getUnchecked(id_)->set_to_release();
-    }
-
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        env->reset();
-        for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
-        {
-            input_envs.getUnchecked(input_id)->reset();
-        }
-
-        // double_filter[0]->reset();
-        // double_filter[1]->reset();
-        // double_filter[2]->reset();
-    }
-
-  private:
-    //==========================================================================
-    inline void pre_process(const int input_id, const int num_samples) noexcept
-    {
-        // CALCULATE INPUTS AND ENVELOPS
-        {
-            {
-                const int glide_modotr_time = synth_data->glide_motor_time;
-                if (id == FILTER_1)
-                {
-                    float *tmp_input_amp = data_buffer->filter_input_env_amps.getWritePointer(
-                        input_id + SUM_INPUTS_PER_FILTER * FILTER_1);
-                    ENV *const input_env(input_envs.getUnchecked(input_id));
-                    filter_data->input_smoothers[input_id]->process_amp(
-                        !filter_data->input_holds[input_id], glide_modotr_time, input_env,
-                        tmp_input_amp, num_samples);
-
-                    float *filter_input_buffer =
-                        data_buffer->filter_input_samples.getWritePointer(input_id);
-                    const float *const osc_input_buffer =
-                        data_buffer->osc_samples.getReadPointer(input_id);
-                    for (int sid = 0; sid != num_samples; ++sid)
-                    {
-                        filter_input_buffer[sid] = osc_input_buffer[sid] * tmp_input_amp[sid];
-                    }
-                }
-                else if (id == FILTER_2)
-                {
-                    float *tmp_input_amp = data_buffer->filter_input_env_amps.getWritePointer(
-                        input_id + SUM_INPUTS_PER_FILTER * FILTER_2);
-                    ENV *const input_env(input_envs.getUnchecked(input_id));
-                    filter_data->input_smoothers[input_id]->process_amp(
-                        !filter_data->input_holds[input_id], glide_modotr_time, input_env,
-                        tmp_input_amp, num_samples);
-
-                    float *const filter_input_buffer =
-                        data_buffer->filter_input_samples.getWritePointer(
-                            input_id + SUM_INPUTS_PER_FILTER * FILTER_2);
-                    const float *const filter_before_buffer =
-                        data_buffer->filter_output_samples.getReadPointer(
-                            input_id + SUM_INPUTS_PER_FILTER * FILTER_1);
-                    const float *const osc_input_buffer =
-                        data_buffer->osc_samples.getReadPointer(input_id);
-                    for (int sid = 0; sid != num_samples; ++sid)
-                    {
-                        filter_input_buffer[sid] =
-                            tmp_input_amp[sid] < 0 ? osc_input_buffer[sid] * tmp_input_amp[sid] * -1
-                                                   : filter_before_buffer[sid] * tmp_input_amp[sid];
-                    }
-                }
-                else
-                {
-                    float *tmp_input_amp_1 = data_buffer->filter_input_env_amps.getWritePointer(
-                        0 + SUM_INPUTS_PER_FILTER * FILTER_3);
-                    float *tmp_input_amp_2 = data_buffer->filter_input_env_amps.getWritePointer(
-                        1 + SUM_INPUTS_PER_FILTER * FILTER_3);
-                    float *tmp_input_amp_3 = data_buffer->filter_input_env_amps.getWritePointer(
-                        2 + SUM_INPUTS_PER_FILTER * FILTER_3);
-                    {
-                        ENV *const input_env(input_envs.getUnchecked(0));
-                        filter_data->input_smoothers[0]->process_amp(!filter_data->input_holds[0],
-                                                                     glide_modotr_time, input_env,
-                                                                     tmp_input_amp_1, num_samples);
-                    }
-                    {
-                        ENV *const input_env(input_envs.getUnchecked(1));
-                        filter_data->input_smoothers[1]->process_amp(!filter_data->input_holds[1],
-                                                                     glide_modotr_time, input_env,
-                                                                     tmp_input_amp_2, num_samples);
-                    }
-                    {
-                        ENV *const input_env(input_envs.getUnchecked(2));
-                        filter_data->input_smoothers[2]->process_amp(!filter_data->input_holds[2],
-                                                                     glide_modotr_time, input_env,
-                                                                     tmp_input_amp_3, num_samples);
-                    }
-
-                    float *const filter_input_buffer =
-                        data_buffer->filter_input_samples.getWritePointer(
-                            0 + SUM_INPUTS_PER_FILTER * FILTER_3);
-                    const float *const filter_before_buffer_1 =
-                        data_buffer->filter_output_samples.getReadPointer(
-                            0 + SUM_INPUTS_PER_FILTER * FILTER_2);
-                    const float *const filter_before_buffer_2 =
-                        data_buffer->filter_output_samples.getReadPointer(
-                            1 + SUM_INPUTS_PER_FILTER * FILTER_2);
-                    const float *const filter_before_buffer_3 =
-                        data_buffer->filter_output_samples.getReadPointer(
-                            2 + SUM_INPUTS_PER_FILTER * FILTER_2);
-                    const float *const osc_input_buffer_1 =
-                        data_buffer->osc_samples.getReadPointer(0);
-                    const float *const osc_input_buffer_2 =
-                        data_buffer->osc_samples.getReadPointer(1);
-                    const float *const osc_input_buffer_3 =
-                        data_buffer->osc_samples.getReadPointer(2);
-
-                    juce::FloatVectorOperations::clear(filter_input_buffer, num_samples);
-                    for (int sid = 0; sid != num_samples; ++sid)
-                    {
-                        filter_input_buffer[sid] = sample_mix(
-                            sample_mix(tmp_input_amp_1[sid] < 0
-                                           ? osc_input_buffer_1[sid] * tmp_input_amp_1[sid] * -1
-                                           : filter_before_buffer_1[sid] * tmp_input_amp_1[sid],
-                                       tmp_input_amp_2[sid] < 0
-                                           ? osc_input_buffer_2[sid] * tmp_input_amp_2[sid] * -1
-                                           : filter_before_buffer_2[sid] * tmp_input_amp_2[sid]),
-                            tmp_input_amp_3[sid] < 0
-                                ? osc_input_buffer_3[sid] * tmp_input_amp_3[sid] * -1
-                                : filter_before_buffer_3[sid] * tmp_input_amp_3[sid]);
-                    }
-                }
-            }
-        }
-    }
-    inline void process_amp_mix(const int num_samples) noexcept
-    {
-        // ADSTR - LFO MIX
-        float *amp_mix = data_buffer->lfo_amplitudes.getWritePointer(id);
-        const float *smoothed_mix_buffer(
-            filter_data->adsr_lfo_mix_smoother.get_smoothed_value_buffer());
-        {
-            const float *env_amps = data_buffer->filter_env_amps.getReadPointer(id);
-            const float *lfo_amplitudes = data_buffer->lfo_amplitudes.getReadPointer(id);
-            for (int sid = 0; sid != num_samples; ++sid)
-            {
-                // LFO ADSR MIX - HERE TO SAVE ONE LOOP
-                const float mix = (1.0f + smoothed_mix_buffer[sid]) * 0.5f;
-                amp_mix[sid] = env_amps[sid] * (1.0f - mix) + lfo_amplitudes[sid] * mix;
-            }
-        }
-    }
-
-    static float distortion__(float x_, float distortion_power_) noexcept
-    {
-        if (distortion_power_ != 0)
-        {
-            // const float distortion_add_on = distortion_power_*0.9f;
-            // x_ = ((1.0f+distortion_add_on)*x_) - (x_*x_*x_)*distortion_add_on;
-            // (std::atan(input_and_worker_)*(1.0f/juce::MathConstants<float>::pi))*
-            // x_ = x_*(1.0f-distortion_power_) + 0.5f*soft_clipping( x_*10 )*(distortion_power_);
-
-            x_ = x_ * (1.0f - distortion_power_) + (std::atan(x_ * 20) / 6.66) * distortion_power_;
-
-            // x_ = x_*(1.0f-distortion_power_) + std::atan( x_*150 )*(1.0f/1.55)*distortion_power_;
-        }
-
-        return x_;
-    }
-
-  public:
-    //==========================================================================
-    inline void process(const int num_samples) noexcept
-    {
-        float *amp_mix = data_buffer->lfo_amplitudes.getWritePointer(id);
-        // PROCESS FILTER
-        {
-#define DISTORTION_IN(x) distortion__(x, filter_distortion)
-#define DISTORTION_OUT(x) distortion__(x, filter_distortion)
-
-            // PREPARE
-            {
-                process_amp_mix(num_samples);
-
-                filter_data->resonance_smoother.process_modulation(filter_data->modulate_resonance,
-                                                                   amp_mix, num_samples);
-                filter_data->cutoff_smoother.process_modulation(filter_data->modulate_cutoff,
-                                                                amp_mix, num_samples);
-                filter_data->distortion_smoother.process_modulation(
-                    filter_data->modulate_distortion, amp_mix, num_samples);
-                if (synth_data->is_stereo)
-                    filter_data->pan_smoother.process_modulation(filter_data->modulate_pan, amp_mix,
-                                                                 num_samples);
-            }
-
-            switch (filter_data->filter_type)
-            {
-            case LPF:
-            case LPF_2_PASS:
-            case MOOG_AND_LPF:
-            {
-                // PROCESSOR
-                struct LP2PassExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_resonance_buffer;
-                    const float *const tmp_cuttof_buffer;
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(LPF_2_PASS);
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-
-                            /*
-                                        filter.updateLow2Pass
-                                        (
-                                            tmp_resonance_buffer[sid],
-                                            ( (10180.0f * tmp_cuttof_buffer[sid]) +20 ),
-                                            tmp_gain_buffer[sid]
-                                        );
-                                        */
-
-                            filter.updateLow2Pass(tmp_resonance_buffer[sid],
-                                                  tmp_cuttof_buffer[sid]);
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processLow2Pass(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    LP2PassExecuter(FilterProcessor *const processor_, int num_samples__,
-                                    int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_resonance_buffer(processor_->filter_data->resonance_smoother
-                                                   .get_smoothed_value_buffer()),
-                          tmp_cuttof_buffer(
-                              processor_->filter_data->cutoff_smoother.get_smoothed_value_buffer()),
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        LP2PassExecuter(this, num_samples, 0).exec();
-                        LP2PassExecuter(this, num_samples, 1).exec();
-                        LP2PassExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        LP2PassExecuter(this, num_samples, 0).exec();
-                    }
-                }
-            }
-            break;
-            case HPF:
-            case HIGH_2_PASS:
-            {
-                // PROCESSOR
-                struct HP2PassExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_resonance_buffer;
-                    const float *const tmp_cuttof_buffer;
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(HIGH_2_PASS);
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-                            filter.updateHigh2Pass(tmp_resonance_buffer[sid],
-                                                   tmp_cuttof_buffer[sid]);
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processHigh2Pass(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    HP2PassExecuter(FilterProcessor *const processor_, int num_samples__,
-                                    int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_resonance_buffer(processor_->filter_data->resonance_smoother
-                                                   .get_smoothed_value_buffer()),
-                          tmp_cuttof_buffer(
-                              processor_->filter_data->cutoff_smoother.get_smoothed_value_buffer()),
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        HP2PassExecuter(this, num_samples, 0).exec();
-                        HP2PassExecuter(this, num_samples, 1).exec();
-                        HP2PassExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        HP2PassExecuter(this, num_samples, 0).exec();
-                    }
-                }
-            }
-            break;
-            case BPF:
-            {
-                // PROCESSOR
-                struct BandExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_resonance_buffer;
-                    const float *const tmp_cuttof_buffer;
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(BPF);
-
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-                            filter.updateBand(tmp_resonance_buffer[sid], tmp_cuttof_buffer[sid]);
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processBand(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    BandExecuter(FilterProcessor *const processor_, int num_samples__,
-                                 int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_resonance_buffer(processor_->filter_data->resonance_smoother
-                                                   .get_smoothed_value_buffer()),
-                          tmp_cuttof_buffer(
-                              processor_->filter_data->cutoff_smoother.get_smoothed_value_buffer()),
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        BandExecuter(this, num_samples, 0).exec();
-                        BandExecuter(this, num_samples, 1).exec();
-                        BandExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        BandExecuter(this, num_samples, 0).exec();
-                    }
-                }
-            }
-            break;
-            default: //  PASS
-            {
-                // PROCESSOR
-                struct PassExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(PASS);
-
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processPass(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    PassExecuter(FilterProcessor *const processor_, int num_samples__,
-                                 int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        PassExecuter(this, num_samples, 0).exec();
-                        PassExecuter(this, num_samples, 1).exec();
-                        PassExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        PassExecuter(this, num_samples, 0).exec();
-                        ;
-                    }
-                }
-            }
-            break;
-            }
-        }
-
-        // COLLECT RESULTS
-        float *const this_filter_output_buffer =
-            data_buffer->filter_output_samples_l_r.getWritePointer(id);
-        {
-            const float *const smoothed_distortion_buffer(
-                filter_data->distortion_smoother.get_smoothed_value_buffer());
-            {
-                filter_data->output_smoother.process_modulation(filter_data->modulate_output,
-                                                                amp_mix, num_samples);
-                const float *const smoothed_output_buffer =
-                    filter_data->output_smoother.get_smoothed_value_buffer();
-                if (id != FILTER_3)
-                {
-                    float *const out_buffer_1(data_buffer->filter_output_samples.getWritePointer(
-                        0 + SUM_INPUTS_PER_FILTER * id));
-                    float *const out_buffer_2(data_buffer->filter_output_samples.getWritePointer(
-                        1 + SUM_INPUTS_PER_FILTER * id));
-                    float *const out_buffer_3(data_buffer->filter_output_samples.getWritePointer(
-                        2 + SUM_INPUTS_PER_FILTER * id));
-                    for (int sid = 0; sid != num_samples; ++sid)
-                    {
-                        // OUTPUT MIX AND DISTORTION
-                        {
-                            const float amp = smoothed_output_buffer[sid];
-                            float shape_power = smoothed_distortion_buffer[sid];
-                            const float result =
-                                sample_mix(sample_mix(out_buffer_1[sid], out_buffer_2[sid]),
-                                           out_buffer_3[sid]) *
-                                amp * 2;
-
-                            this_filter_output_buffer[sid] =
-                                sample_mix(result * (1.0f - shape_power),
-                                           soft_clipping(result * 5) * 1.5 * (shape_power));
-                        }
-                    }
-                }
-                else
-                {
-                    float *const out_buffer(data_buffer->filter_output_samples.getWritePointer(
-                        0 + SUM_INPUTS_PER_FILTER * FILTER_3));
-                    for (int sid = 0; sid != num_samples; ++sid)
-                    {
-                        // OUTPUT MIX AND DISTORTION
-                        {
-                            const float amp = smoothed_output_buffer[sid];
-                            float shape_power = smoothed_distortion_buffer[sid];
-                            const float result = out_buffer[sid] * amp * 2;
-
-                            this_filter_output_buffer[sid] =
-                                sample_mix(result * (1.0f - shape_power),
-                                           soft_clipping(result * 5) * 1.5 * (shape_power));
-                        }
-                    }
-                }
-            }
-        }
-
-// PAN & MIX
-#ifdef POLY
-        if (synth_data->is_stereo)
-#endif
-        {
-            const float *const pan_buffer = filter_data->pan_smoother.get_smoothed_value_buffer();
-            float *const left_and_input_output_buffer =
-                data_buffer->filter_output_samples_l_r.getWritePointer(id);
-            float *const right_output_buffer =
-                data_buffer->filter_output_samples_l_r.getWritePointer(SUM_FILTERS + id);
-#ifdef POLY
-            const bool calculate_tracking[SUM_FILTERS] = {synth_data->keytrack_filter_volume[0],
-                                                          synth_data->keytrack_filter_volume[1],
-                                                          synth_data->keytrack_filter_volume[2]};
-            const float *const env_tracking_buffer =
-                data_buffer->filter_env_tracking.getReadPointer(id);
-#endif
-            // const float multiplyer = id == FILTER_3 ? 1.5f : 1;
-            for (int sid = 0; sid != num_samples; ++sid)
-            {
-                const float pan = pan_buffer[sid];
-                const float output_sample = left_and_input_output_buffer[sid];
-#ifdef POLY
-                right_output_buffer[sid] =
-                    output_sample * left_pan(pan, sin_lookup) *
-                    (calculate_tracking[id]
-                         ? env_tracking_buffer[sid] *
-                                   (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
-                               synth_data->keytrack_filter_volume_offset[id]
-                         : 1);
-                left_and_input_output_buffer[sid] =
-                    output_sample * right_pan(pan, cos_lookup) *
-                    (calculate_tracking[id]
-                         ? env_tracking_buffer[sid] *
-                                   (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
-                               synth_data->keytrack_filter_volume_offset[id]
-                         : 1);
-#else
-                right_output_buffer[sid] = output_sample * left_pan(pan, sin_lookup);
-                left_and_input_output_buffer[sid] = output_sample * right_pan(pan, cos_lookup);
-#endif
-            }
-
-            // VISUALIZE
-            if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
-            {
-                amp_painter->add_filter_env(id, amp_mix, num_samples);
-                amp_painter->add_filter(id, right_output_buffer, left_and_input_output_buffer,
-                                        num_samples);
-            }
-        }
-#ifdef POLY
-        else // NOTE just a reduced copy of the function before
-        {
-            float *const left_and_input_output_buffer =
-                data_buffer->filter_output_samples_l_r.getWritePointer(id);
-            const bool calculate_tracking[SUM_FILTERS] = {synth_data->keytrack_filter_volume[0],
-                                                          synth_data->keytrack_filter_volume[1],
-                                                          synth_data->keytrack_filter_volume[2]};
-            const float *const env_tracking_buffer =
-                data_buffer->filter_env_tracking.getReadPointer(id);
-            // const float multiplyer = id == FILTER_3 ? 1.5f : 1;
-            for (int sid = 0; sid != num_samples; ++sid)
-            {
-                const float output_sample = left_and_input_output_buffer[sid];
-                left_and_input_output_buffer[sid] =
-                    output_sample *
-                    (calculate_tracking[id]
-                         ? env_tracking_buffer[sid] *
-                                   (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
-                               synth_data->keytrack_filter_volume_offset[id]
-                         : 1);
-            }
-
-            // VISUALIZE
-            if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
-            {
-                amp_painter->add_filter_env(id, amp_mix, num_samples);
-                amp_painter->add_filter(id, left_and_input_output_buffer,
-                                        left_and_input_output_buffer, num_samples);
-            }
-        }
-#endif
-
-        // COLLECT THE FINAL OUTPUT
-        if (id == FILTER_3)
-        {
-            if (synth_data->is_stereo)
-            {
-                float *const master_left_output_buffer =
-                    data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
-                float *const master_right_output_buffer =
-                    data_buffer->filter_stereo_output_samples.getWritePointer(RIGHT);
-                const float *const left_output_buffer_flt1 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(0);
-                const float *const right_output_buffer_flt1 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS);
-                const float *const left_output_buffer_flt2 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(1);
-                const float *const right_output_buffer_flt2 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS + 1);
-                const float *const left_output_buffer_flt3 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(2);
-                const float *const right_output_buffer_flt3 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS + 2);
-                const float *const smoothed_distortion =
-                    synth_data->distortion_smoother.get_smoothed_value_buffer();
-                const float *const smoothed_fx_bypass_buffer =
-                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
-
-                for (int sid = 0; sid != num_samples; ++sid)
-                {
-                    const float left = sample_mix(
-                        sample_mix(left_output_buffer_flt1[sid], left_output_buffer_flt2[sid]),
-                        left_output_buffer_flt3[sid]);
-                    const float right = sample_mix(
-                        sample_mix(right_output_buffer_flt1[sid], right_output_buffer_flt2[sid]),
-                        right_output_buffer_flt3[sid]);
-                    const float left_add = left_output_buffer_flt1[sid] +
-                                           left_output_buffer_flt2[sid] +
-                                           left_output_buffer_flt3[sid];
-                    const float right_add = right_output_buffer_flt1[sid] +
-                                            right_output_buffer_flt2[sid] +
-                                            right_output_buffer_flt3[sid];
-                    const float distortion =
-                        smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
-
-                    master_left_output_buffer[sid] =
-                        left * (1.0f - distortion) +
-                        1.33f * soft_clipping(left_add * 10) * (distortion);
-                    master_right_output_buffer[sid] =
-                        right * (1.0f - distortion) +
-                        1.33f * soft_clipping(right_add * 10) * (distortion);
-                }
-            }
-            else // NOTE just a reduced copy of the function before
-            {
-                float *const master_left_output_buffer =
-                    data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
-                const float *const left_output_buffer_flt1 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(0);
-                const float *const left_output_buffer_flt2 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(1);
-                const float *const left_output_buffer_flt3 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(2);
-                const float *const smoothed_distortion =
-                    synth_data->distortion_smoother.get_smoothed_value_buffer();
-                const float *const smoothed_fx_bypass_buffer =
-                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
-
-                for (int sid = 0; sid != num_samples; ++sid)
-                {
-                    const float left = sample_mix(
-                        sample_mix(left_output_buffer_flt1[sid], left_output_buffer_flt2[sid]),
-                        left_output_buffer_flt3[sid]);
-                    const float left_add = left_output_buffer_flt1[sid] +
-                                           left_output_buffer_flt2[sid] +
-                                           left_output_buffer_flt3[sid];
-                    const float distortion =
-                        smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
-
-                    master_left_output_buffer[sid] =
-                        left * (1.0f - distortion) +
-                        1.33f * soft_clipping(left_add * 10) * (distortion);
-                }
-            }
-        }
-    }
-
-  public:
-    //==============================================================================
-    COLD FilterProcessor(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
-                         int id_, const float *const sine_lookup_, const float *const cos_lookup_,
-                         const float *const exp_lookup_) noexcept
-        : env(new ENV(notifyer_, synth_data_, synth_data_->filter_datas[id_]->env_data,
-                      sine_lookup_, cos_lookup_, exp_lookup_)),
-          input_envs(),
-
-          id(id_),
-
-          synth_data(synth_data_), filter_data(synth_data_->filter_datas[id_]),
-          data_buffer(synth_data_->data_buffer),
-
-          sin_lookup(synth_data->sine_lookup), cos_lookup(synth_data->cos_lookup)
-    {
-        for (int i = 0; i != SUM_INPUTS_PER_FILTER; ++i)
-        {
-            double_filter.add(new DoubleAnalogFilter(notifyer_));
-
-            ENVData *input_env_data(synth_data_->filter_datas[id_]->input_envs[i]);
-            input_env_datas.add(input_env_data);
-            input_envs.add(new ENV(notifyer_, synth_data_, input_env_data, sine_lookup_,
-                                   cos_lookup_, exp_lookup_));
-        }
-    }
-    COLD ~FilterProcessor() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FilterProcessor)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-static inline float get_low_pass_band_frequency(int band_id_, double sample_rate_) noexcept
-{
-    switch (band_id_)
-    {
-    case 0:
-        return 82.41;
-    case 1:
-        return 164.81;
-    case 2:
-        return 329.63;
-    case 3:
-        return 659.25;
-    case 4:
-        return 1318.51;
-    case 5:
-        return 2637.02;
-    default:
-        // return 2637.02;
-        return sample_rate_ / 2;
-    }
-}
-static inline float get_high_pass_band_frequency(int band_id_) noexcept
-{
-    switch (band_id_)
-    {
-    case 0:
-        return 20.60;
-    case 1:
-        return 82.41;
-    case 2:
-        return 164.81;
-    case 3:
-        return 329.63;
-    case 4:
-        return 659.25;
-    case 5:
-        return 1318.51;
-    default:
-        return 2637.02;
-    }
-}
-class EQProcessor : public RuntimeListener
-{
-    friend class EQProcessorStereo;
-
-    float frequency_low_pass[SUM_EQ_BANDS];
-    float frequency_high_pass[SUM_EQ_BANDS];
-
-    juce::OwnedArray<AnalogFilter> filters;
-    juce::IIRFilter high_pass_filters[SUM_EQ_BANDS];
-
-    friend class mono_ParameterOwnerStore;
-
-    const MoniqueSynthData *const synth_data;
-    const EQData *const eq_data;
-    DataBuffer *const data_buffer;
-
-  public:
-    //==============================================================================
-    inline void reset() noexcept
-    {
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            filters[band_id]->reset();
-            high_pass_filters[band_id].reset();
-        }
-    }
-
-    void sample_rate_or_block_changed() noexcept override
-    {
-        reset();
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            frequency_low_pass[band_id] = get_low_pass_band_frequency(band_id, sample_rate);
-            high_pass_filters[band_id].setCoefficients(
-                juce::IIRCoefficients::makeHighPass(sample_rate, frequency_high_pass[band_id]));
-        }
-    }
-
-    //==============================================================================
-    inline void process(float *io_buffer_, int num_samples_) noexcept
-    {
-        {
-            struct BandExecuter
-            {
-                const int band_id;
-
-                const int num_samples_;
-                const float *const smoothed_shape_buffer;
-
-                const float filter_frequency;
-                juce::IIRFilter &high_pass_filter;
-                AnalogFilter &filter;
-
-                const float *const filter_in_samples;
-                float *const band_out_buffer;
-                const float *const env_buffer;
-
-                inline void exec() noexcept { exec_default(); }
-                /*
-inline void exec_first() noexcept
-{
-    // PROCESS
-    for( int sid = 0 ; sid != num_samples_ ; ++sid )
-    {
-        const float shape = smoothed_shape_buffer[sid];
-        const float amp = env_buffer[sid];
-        const float in = filter_in_samples[sid] * amp;
-        filter.update_with_fixed_cutoff( shape*0.8f, filter_frequency );
-        float output = filter.processLowResonance(in);
-        band_out_buffer[sid] = output*4;
-    }
-}
-                */
-                inline void exec_default() noexcept
-                {
-                    // PROCESS
-                    for (int sid = 0; sid != num_samples_; ++sid)
-                    {
-                        const float shape = smoothed_shape_buffer[sid];
-                        const float amp = env_buffer[sid];
-                        const float in = filter_in_samples[sid] * amp;
-                        filter.update_with_fixed_cutoff(shape * 0.8f, filter_frequency);
-                        float output =
-                            high_pass_filter.processSingleSampleRaw(filter.processLowResonance(in));
-                        band_out_buffer[sid] = output * 4;
-                    }
-                }
-                /*
-inline void exec_last() noexcept
-{
-    // PROCESS
-    for( int sid = 0 ; sid != num_samples_ ; ++sid )
-    {
-        const float shape = smoothed_shape_buffer[sid];
-        const float amp = env_buffer[sid];
-        const float in = filter_in_samples[sid] * amp;
-        filter.update_with_fixed_cutoff( shape*0.8f, filter_frequency );
-        float output = high_pass_filter.processSingleSampleRaw ( filter.processHighResonance(in) );
-        band_out_buffer[sid] = output*1.5;
-    }
-}
-                */
-                BandExecuter(EQProcessor *const processor_, float *in_buffer_, int num_samples__,
-                             int band_id_) noexcept
-                    : band_id(band_id_),
-
-                      num_samples_(num_samples__),
-                      smoothed_shape_buffer(
-                          processor_->synth_data->shape_smoother.get_smoothed_value_buffer()),
-
-                      filter_frequency(processor_->frequency_low_pass[band_id_]),
-                      high_pass_filter(processor_->high_pass_filters[band_id_]),
-                      filter(*processor_->filters.getUnchecked(band_id_)),
-
-                      filter_in_samples(in_buffer_),
-                      band_out_buffer(
-                          processor_->data_buffer->band_out_buffers.getWritePointer(band_id_)),
-                      env_buffer(
-                          processor_->data_buffer->band_env_buffers.getWritePointer(band_id_))
-                {
-                }
-            };
-
-            for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-            {
-                BandExecuter(this, io_buffer_, num_samples_, band_id).exec();
-            }
-        }
-        // EO MULTITHREADED
-
-        // FINAL MIX - SINGLE THREADED ( NOT REALLY OPTIMIZED )
-        {
-            const float *const buffer_1(data_buffer->band_out_buffers.getReadPointer(0));
-            const float *const buffer_2(data_buffer->band_out_buffers.getReadPointer(1));
-            const float *const buffer_3(data_buffer->band_out_buffers.getReadPointer(2));
-            const float *const buffer_4(data_buffer->band_out_buffers.getReadPointer(3));
-            const float *const buffer_5(data_buffer->band_out_buffers.getReadPointer(4));
-            const float *const buffer_6(data_buffer->band_out_buffers.getReadPointer(5));
-            const float *const buffer_7(data_buffer->band_out_buffers.getReadPointer(6));
-
-            // const float* const smoothed_distortion =
-            // synth_data->final_clipping_smoother.get_smoothed_modulated_value_buffer() ;
-            const float *const smoothed_distortion =
-                synth_data->distortion_smoother.get_smoothed_value_buffer();
-            const float *const smoothed_fx_bypass_buffer =
-                synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
-            const float *const smoothed_bypass =
-                eq_data->bypass_smoother.get_smoothed_value_buffer();
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                const float distortion = smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
-                const float bypass = smoothed_bypass[sid];
-                if (bypass > 0)
-                {
-                    float sum = sample_mix(
-                        sample_mix(sample_mix(sample_mix(sample_mix(sample_mix(buffer_7[sid],
-                                                                               buffer_6[sid]),
-                                                                    buffer_5[sid]),
-                                                         buffer_4[sid]),
-                                              buffer_3[sid]),
-                                   buffer_2[sid]),
-                        buffer_1[sid] * -1);
-
-                    // MONO_SNAP_TO_ZERO(sum)
-                    float mix = sum * bypass + io_buffer_[sid] * (1.0f - bypass);
-                    io_buffer_[sid] = soft_clipp_greater_1_2(
-                        mix * (1.0f - distortion) + (std::atan(mix * 10) * 0.7f) * distortion);
-                    // io_buffer_[sid] = soft_clipp_greater_1_2(sample_mix(mix*(1.0f-distortion),
-                    // sample_mix( mix, mix )*distortion));
-                }
-                else
-                {
-                    io_buffer_[sid] = soft_clipp_greater_1_2(
-                        io_buffer_[sid] * (1.0f - distortion) +
-                        (std::atan(io_buffer_[sid] * 10) * 0.7f) * distortion);
-                }
-            }
-        }
-    }
-
-  public:
-    //==============================================================================
-    COLD EQProcessor(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_) noexcept
-        : RuntimeListener(notifyer_),
-
-          synth_data(synth_data_), eq_data(synth_data_->eq_data.get()),
-          data_buffer(synth_data_->data_buffer)
-    {
-#ifdef JUCE_DEBUG
-        std::cout << "MONIQUE: init EQ L OR R" << std::endl;
-#endif
-
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            filters.add(new AnalogFilter(notifyer_));
-
-            frequency_low_pass[band_id] = get_low_pass_band_frequency(band_id, sample_rate);
-            frequency_high_pass[band_id] = get_high_pass_band_frequency(band_id);
-        }
-        sample_rate_or_block_changed();
-    }
-    COLD ~EQProcessor() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EQProcessor)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class EQProcessorStereo
-{
-    MoniqueSynthData *const synth_data;
-
-    EQProcessor *const left_processor;
-    EQProcessor *const right_processor;
-
-    EQData *const eq_data;
-    DataBuffer *const data_buffer;
-
-  public:
-    juce::OwnedArray<ENV> envs;
-
-  public:
-    //==============================================================================
-    inline void start_attack() noexcept
-    {
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            envs.getUnchecked(band_id)->start_attack();
-        }
-    }
-    inline void start_release() noexcept
-    {
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            envs.getUnchecked(band_id)->set_to_release();
-        }
-    }
-    inline void reset() noexcept
-    {
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            envs.getUnchecked(band_id)->reset();
-        }
-        left_processor->reset();
-        if (synth_data->is_stereo)
-            right_processor->reset();
-    }
-
-    //==============================================================================
-    inline void process(int num_samples_) noexcept
-    {
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            ENV *env(envs.getUnchecked(band_id));
-            eq_data->velocity_smoothers[band_id]->process_amp(
-                !eq_data->hold[band_id], synth_data->glide_motor_time, env,
-                data_buffer->band_env_buffers.getWritePointer(band_id), num_samples_);
-        }
-
-        left_processor->process(data_buffer->filter_stereo_output_samples.getWritePointer(LEFT),
-                                num_samples_);
-        if (synth_data->is_stereo)
-            right_processor->process(
-                data_buffer->filter_stereo_output_samples.getWritePointer(RIGHT), num_samples_);
-
-        if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
-        {
-            amp_painter->add_eq(data_buffer->filter_stereo_output_samples.getWritePointer(LEFT),
-                                num_samples_);
-        }
-    }
-
-  public:
-    //==========================================================================
-    COLD EQProcessorStereo(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_,
-                           const float *const sine_lookup_, const float *const cos_lookup_,
-                           const float *const exp_lookup_) noexcept
-        : synth_data(synth_data_), left_processor(new EQProcessor(notifyer_, synth_data_)),
-          right_processor(new EQProcessor(notifyer_, synth_data_)),
-          eq_data(synth_data_->eq_data.get()), data_buffer(synth_data_->data_buffer)
-    {
-#ifdef JUCE_DEBUG
-        std::cout << "MONIQUE: init EQ" << std::endl;
-#endif
-
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            envs.add(new ENV(notifyer_, synth_data_,
-                             synth_data_->eq_data->envs.getUnchecked(band_id), sine_lookup_,
-                             cos_lookup_, exp_lookup_));
-        }
-    }
-    COLD ~EQProcessorStereo() noexcept
-    {
-        delete right_processor;
-        delete left_processor;
-    }
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EQProcessorStereo)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class AllPassFilter
-{
-    juce::HeapBlock<float> buffer;
-    int bufferSize, bufferIndex;
-
-  public:
-    //==============================================================================
-    inline float process(const float input) noexcept
-    {
-        const float bufferedValue = buffer[bufferIndex];
-        float temp = input + (bufferedValue * 0.5f);
-        JUCE_UNDENORMALISE(temp);
-        buffer[bufferIndex] = temp;
-        bufferIndex = (bufferIndex + 1) % bufferSize;
-
-        return bufferedValue - input;
-    }
-
-    //==============================================================================
-    COLD void setSize(const int size)
-    {
-        if (size != bufferSize)
-        {
-            bufferIndex = 0;
-            buffer.malloc((size_t)size);
-            bufferSize = size;
-        }
-
-        clear();
-    }
-    COLD void clear() noexcept { buffer.clear((size_t)bufferSize); }
-
-  public:
-    //==============================================================================
-    COLD AllPassFilter() noexcept : bufferSize(0), bufferIndex(0) {}
-    COLD ~AllPassFilter() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AllPassFilter)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_Chorus : public RuntimeListener
-{
-    MoniqueSynthData *const synth_data;
-    ChorusData *const chorus_data;
-
-    mono_SineWaveAutonom osc_1;
-    mono_SineWaveAutonom osc_2;
-    mono_SineWaveAutonom osc_3;
-    mono_SineWaveAutonom osc_4;
-    mono_SineWaveAutonom osc_5;
-
-    int buffer_size;
-    int index;
-    mono_AudioSampleBuffer<2> data_buffer;
-    float *current_left_buffer;
-    float *current_right_buffer;
-
-    const float *const sin_lookup;
-    const float *const cos_lookup;
-
-  public:
-#define SUM_DELAY_LINES 4
-    inline void process(float *left_in_, float *right_in_, float *left_out_, float *right_out_,
-                        int num_samples_) noexcept
-    {
-        const float *const chorus_env_buffer(
-            chorus_data->modulation_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_pan_buffer(
-            chorus_data->pan_smoother.get_smoothed_value_buffer());
-
-        const float e_samples = sample_rate / 164.81; // 82.41;
-        const float e2_samples = sample_rate / 165.91;
-        for (int sid = 0; sid != num_samples_; ++sid)
-        {
-            // const float power = (exp( (chorus_env_buffer[sid] *0.85f) *2)-1)/6.38906;
-            const float power = chorus_env_buffer[sid] * 0.8f;
-            const float amps[SUM_DELAY_LINES] = {
-                ((osc_1.tick() * 0.7f + osc_2.tick() * 0.3f) + 1) * 0.5f,
-                ((osc_1.lastOut_with_phase_offset(0.25f) * 0.3f + osc_3.tick() * 0.6f) + 1) * 0.5f,
-                ((osc_1.lastOut_with_phase_offset(0.5f) * 0.4f + osc_4.tick() * 0.5f) + 1) * 0.5f,
-                ((osc_1.lastOut_with_phase_offset(0.75f) * 0.6f + osc_5.tick() * 0.4f) + 1) * 0.5f};
-            const float pan = smoothed_pan_buffer[sid];
-
-#define CHECK_MAKE_INDEX_VALID(floated_index_, size_)                                              \
-    if (floated_index_ >= size_)                                                                   \
-    {                                                                                              \
-        floated_index_ -= size_;                                                                   \
-    }                                                                                              \
-    else if (floated_index_ < 0)                                                                   \
-    {                                                                                              \
-        floated_index_ += size_;                                                                   \
-    }
-#define CHECK_MAKE_INDEX_VALID_upper_only(floated_index_, size_)                                   \
-    if (floated_index_ >= size_)                                                                   \
-    {                                                                                              \
-        floated_index_ -= size_;                                                                   \
-    }
-            // L
-            const float fade_in = 1.0f - (juce::jmin(1.0f, power * 2));
-            const float fade_effect = (juce::jmin(1.0f, power * 2));
-            {
-                float result_l = 0;
-                for (int i = 0; i != SUM_DELAY_LINES; ++i)
-                {
-                    float delay = (power * 0.9 + 0.1) * e_samples * amps[i];
-                    float float_index = float(index) - delay + 1;
-                    CHECK_MAKE_INDEX_VALID(float_index, buffer_size)
-
-                    const int index_1 = std::floor(float_index);
-                    int index_2 = index_1 + 1;
-                    CHECK_MAKE_INDEX_VALID_upper_only(index_2, buffer_size) const float delta =
-                        float_index - index_1;
-
-                    result_l += (current_left_buffer[index_1] * (1.0f - delta) +
-                                 current_left_buffer[index_2] * delta) /
-                                (i + 2);
-                }
-                {
-                    current_left_buffer[index] =
-                        sample_mix(left_in_[sid], result_l * power * left_pan(pan, sin_lookup));
-                    left_out_[sid] = left_in_[sid] * fade_in + result_l * fade_effect;
-                }
-            }
-            // R
-            if (synth_data->is_stereo)
-            {
-                float result_r = 0;
-                for (int i = 0; i != SUM_DELAY_LINES; ++i)
-                {
-                    float delay = (power * 0.9 + 0.1) * e2_samples * amps[i];
-                    float float_index = float(index) - delay + 1;
-                    CHECK_MAKE_INDEX_VALID(float_index, buffer_size)
-
-                    const int index_1 = std::floor(float_index);
-                    int index_2 = index_1 + 1;
-                    CHECK_MAKE_INDEX_VALID_upper_only(index_2, buffer_size) const float delta =
-                        float_index - index_1;
-
-                    result_r += (current_right_buffer[index_1] * (1.0f - delta) +
-                                 current_right_buffer[index_2] * delta) /
-                                (i + 2);
-                }
-                {
-                    current_right_buffer[index] =
-                        sample_mix(right_in_[sid], result_r * power * right_pan(pan, cos_lookup));
-                    right_out_[sid] = right_in_[sid] * fade_in + result_r * fade_effect;
-                }
-            }
-
-            index = (index + 1) % buffer_size;
-        }
-    }
-
-    inline void reset() noexcept { data_buffer.clear(); }
-    //==============================================================================
-    COLD void sample_rate_or_block_changed() noexcept override
-    {
-        buffer_size = sample_rate / 82.41;
-        data_buffer.setSize(buffer_size, false);
-        data_buffer.clear();
-
-        current_left_buffer = data_buffer.getWritePointer(LEFT);
-        current_right_buffer = data_buffer.getWritePointer(RIGHT);
-    }
-
-  public:
-    //==============================================================================
-    COLD mono_Chorus(RuntimeNotifyer *const notifyer_, MoniqueSynthData *const synth_data_) noexcept
-        : RuntimeListener(notifyer_),
-
-          synth_data(synth_data_),
-
-          chorus_data(synth_data_->chorus_data.get()), osc_1(notifyer_, synth_data_->sine_lookup),
-          osc_2(notifyer_, synth_data_->sine_lookup), osc_3(notifyer_, synth_data_->sine_lookup),
-          osc_4(notifyer_, synth_data_->sine_lookup),
-
-          osc_5(notifyer_, synth_data_->sine_lookup), buffer_size(1), index(0),
-
-          data_buffer(buffer_size),
-
-          sin_lookup(synth_data_->sine_lookup), cos_lookup(synth_data_->cos_lookup)
-    {
-        sample_rate_or_block_changed();
-        osc_1.set_frequency(0.4);
-        osc_2.set_frequency(0.6);
-        osc_3.set_frequency(0.55);
-        osc_4.set_frequency(0.5);
-        osc_5.set_frequency(0.45);
-    }
-    COLD ~mono_Chorus() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Chorus)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_Delay : public RuntimeListener
-{
-    const MoniqueSynthData *synth_data;
-    RuntimeInfo *info;
-
-    double last_bmp_in;
-
-    int reflexion_write_index;
-    int last_in_reflexion_size;
-    int reflexion;
-    int current_reflexion;
-    int reflexion_buffer_size;
-    int current_reflexion_buffer_size;
-    mono_AudioSampleBuffer<2> reflexion_buffer;
-    float *active_left_reflexion_buffer;
-    float *active_right_reflexion_buffer;
-
-    int record_index;
-    int last_in_record_size;
-    int record_buffer_size;
-    int real_record_buffer_size;
-    int num_records_to_write;
-    mono_AudioSampleBuffer<2> record_buffer;
-    float *active_left_record_buffer;
-    float *active_right_record_buffer;
-    bool force_clear;
-
-    LinearSmootherMinMax<0, 1> record_switch_smoother;
-
-    const float *const sin_lookup;
-    const float *const cos_lookup;
-
-  public:
-    //==============================================================================
-    inline void set_reflexion_size(int reflexion_in_size_, int record_buffer_size_,
-                                   int glide_time_in_ms_, double bpm_) noexcept
-    {
-        // SETUP THE REFLEXION BUFFER
-        if (bpm_ < 20)
-        {
-            return;
-        }
-
-        bool bpm_changed = last_bmp_in != bpm_;
-        last_bmp_in = bpm_;
-
-        if (bpm_changed || last_in_reflexion_size != reflexion_in_size_)
-        {
-            last_in_reflexion_size = reflexion_in_size_;
-            update_reflexion_stuff(bpm_);
-        }
-        if (bpm_changed || last_in_record_size != record_buffer_size_)
-        {
-            last_in_record_size = record_buffer_size_;
-            update_record_stuff(bpm_);
-        }
-
-        // TODO ATTENTION FIX, do not clear! -> but if not crash on sample rate changes
-        /*
-        if( bpm_changed )
-        {
-            reflexion_write_index = 0;
-            current_reflexion = reflexion;
-            reflexion_buffer.clear();
-            record_buffer.clear();
-            record_switch_smoother.set_value(0);
-            record_switch_smoother.reset_glide_countdown();
-            record_switch_smoother.reset(sample_rate,glide_time_in_ms_);
-        }
-        */
-
-        record_switch_smoother.reset_coefficients(sample_rate, juce::jmax(200, glide_time_in_ms_));
-    }
-
-    //==============================================================================
-  private:
-    inline void update_reflexion_stuff(double bpm_) noexcept
-    {
-        // CALCULATE THE NEEDED SIZE
-        {
-            const double speed_multi = delay_multi(last_in_reflexion_size);
-            const double bars_per_sec = bpm_ / 4 / 60;
-            const double samples_per_bar = (1.0f / bars_per_sec) * sample_rate;
-            reflexion_buffer_size = floor(samples_per_bar);
-            reflexion = samples_per_bar * speed_multi;
-        }
-        if (reflexion_buffer.get_size() < reflexion_buffer_size)
-        {
-            reflexion_buffer.setSize(reflexion_buffer_size, true);
-            active_left_reflexion_buffer = reflexion_buffer.getWritePointer(LEFT);
-            active_right_reflexion_buffer = reflexion_buffer.getWritePointer(RIGHT);
-        }
-    }
-    inline void update_record_stuff(double bpm_) noexcept
-    {
-        // CALCULATE THE NEEDED SIZE
-        {
-            num_records_to_write = delay_multi(last_in_record_size); // 1, 2 or 4
-            const double bars_per_sec = bpm_ / 4 / 60;
-            const double samples_per_bar = (1.0f / bars_per_sec) * sample_rate;
-            real_record_buffer_size = samples_per_bar * 4;
-            record_buffer_size = samples_per_bar;
-            // TODO change the record index only on zero
-        }
-        if (record_buffer.get_size() < real_record_buffer_size)
-        {
-            record_buffer.setSize(real_record_buffer_size, true);
-            active_left_record_buffer = record_buffer.getWritePointer(LEFT);
-            active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
-        }
-    }
-
-  private:
-    //==============================================================================
-    inline int update_get_reflexion_read_index() noexcept
-    {
-        if (current_reflexion < reflexion)
-        {
-            current_reflexion += 2;
-            if (current_reflexion > reflexion)
-            {
-                current_reflexion = reflexion;
-            }
-        }
-        else if (current_reflexion > reflexion)
-        {
-            --current_reflexion;
-        }
-
-        if (current_reflexion_buffer_size < reflexion_buffer_size)
-        {
-            current_reflexion_buffer_size += 2;
-            if (current_reflexion_buffer_size > reflexion_buffer_size)
-            {
-                current_reflexion_buffer_size = reflexion_buffer_size;
-            }
-        }
-        else if (current_reflexion_buffer_size > reflexion_buffer_size)
-        {
-            --current_reflexion_buffer_size;
-        }
-
-        int read_index = reflexion_write_index - current_reflexion;
-        while (read_index < 0)
-        {
-            read_index += current_reflexion_buffer_size;
-        }
-        return read_index;
-    }
-
-  public:
-    //==============================================================================
-    inline void process(float *const io_l, float *const io_r, const float *smoothed_power_,
-                        const float *smoothed_pan_buffer_, const float *record_release_buffer_,
-                        bool record_, const int num_samples_) noexcept
-    {
-        // PREPARE RECORDING
-        record_ = force_clear ? false : record_;
-        if (!record_)
-        {
-            record_switch_smoother.set_value(false);
-            record_switch_smoother.reset_glide_countdown();
-        }
-
-        // CURRENT INPUT AND REFLEXION OF USER SIZE
-        if (synth_data->is_stereo)
-        {
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                // REFLEXION AND INPUT
-                const int reflexion_read_index = update_get_reflexion_read_index();
-
-                const float left_reflexion_and_input_mix =
-                    sample_mix(active_left_reflexion_buffer[reflexion_read_index], io_l[sid]);
-                const float right_reflexion_and_input_mix =
-                    sample_mix(active_right_reflexion_buffer[reflexion_read_index], io_r[sid]);
-                {
-                    const float pan = smoothed_pan_buffer_[sid];
-                    const float power = smoothed_power_[sid];
-
-                    const float left = left_pan(pan, sin_lookup);
-                    const float right = right_pan(pan, cos_lookup);
-                    // SWAPPED L AND R HERE - Must be wrong somethere else
-                    active_left_reflexion_buffer[reflexion_write_index] =
-                        left_reflexion_and_input_mix * power * right;
-                    active_right_reflexion_buffer[reflexion_write_index] =
-                        right_reflexion_and_input_mix * power * left;
-                }
-
-                // RECORD AND MIX BEFORE
-                {
-                    float record_power = 0;
-                    if (record_)
-                    {
-                        record_power = record_switch_smoother.glide_tick(true);
-                    }
-                    else if (!record_switch_smoother.is_up_to_date())
-                    {
-                        record_power = record_switch_smoother.tick();
-                    }
-
-                    const float left_record = active_left_record_buffer[record_index];
-                    const float right_record = active_right_record_buffer[record_index];
-                    if (record_power > 0)
-                    {
-                        const float record_release = record_release_buffer_[sid];
-                        const float left_record_feedback =
-                            left_reflexion_and_input_mix * record_power;
-                        const float right_record_feedback =
-                            right_reflexion_and_input_mix * record_power;
-                        if (num_records_to_write > 2)
-                        {
-                            active_left_record_buffer[record_index] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                            active_right_record_buffer[record_index] =
-                                sample_mix(right_record, right_record_feedback) * record_release;
-                        }
-                        else if (num_records_to_write == 1)
-                        {
-                            const int record_index_1 = record_index;
-                            int record_index_2 = record_index_1 + record_buffer_size;
-                            if (record_index_2 >= real_record_buffer_size)
-                            {
-                                record_index_2 -= real_record_buffer_size;
-                            }
-                            int record_index_3 = record_index_2 + record_buffer_size;
-                            if (record_index_3 >= real_record_buffer_size)
-                            {
-                                record_index_3 -= real_record_buffer_size;
-                            }
-                            int record_index_4 = record_index_3 + record_buffer_size;
-                            if (record_index_4 >= real_record_buffer_size)
-                            {
-                                record_index_4 -= real_record_buffer_size;
-                            }
-
-                            active_left_record_buffer[record_index_1] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                            active_right_record_buffer[record_index_1] =
-                                sample_mix(right_record, right_record_feedback) * record_release;
-                            active_left_record_buffer[record_index_2] =
-                                sample_mix(active_left_record_buffer[record_index_2],
-                                           left_record_feedback) *
-                                record_release;
-                            active_right_record_buffer[record_index_2] =
-                                sample_mix(active_right_record_buffer[record_index_2],
-                                           right_record_feedback) *
-                                record_release;
-                            active_left_record_buffer[record_index_3] =
-                                sample_mix(active_left_record_buffer[record_index_3],
-                                           left_record_feedback) *
-                                record_release;
-                            active_right_record_buffer[record_index_3] =
-                                sample_mix(active_right_record_buffer[record_index_3],
-                                           right_record_feedback) *
-                                record_release;
-                            active_left_record_buffer[record_index_4] =
-                                sample_mix(active_left_record_buffer[record_index_4],
-                                           left_record_feedback) *
-                                record_release;
-                            active_right_record_buffer[record_index_4] =
-                                sample_mix(active_right_record_buffer[record_index_4],
-                                           right_record_feedback) *
-                                record_release;
-                        }
-                        else // if( num_records_to_write == 2 )
-                        {
-                            int record_index_2 = record_index + record_buffer_size * 2;
-                            if (record_index_2 >= real_record_buffer_size)
-                            {
-                                record_index_2 -= real_record_buffer_size;
-                            }
-
-                            active_left_record_buffer[record_index] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                            active_right_record_buffer[record_index] =
-                                sample_mix(right_record, right_record_feedback) * record_release;
-                            active_left_record_buffer[record_index_2] =
-                                sample_mix(active_left_record_buffer[record_index_2],
-                                           left_record_feedback) *
-                                record_release;
-                            active_right_record_buffer[record_index_2] =
-                                sample_mix(active_right_record_buffer[record_index_2],
-                                           right_record_feedback) *
-                                record_release;
-                        }
-                    }
-                    else if (force_clear)
-                    {
-                        record_buffer.clear();
-                        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
-                        active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
-                        force_clear = false;
-                    }
-
-                    io_l[sid] = sample_mix(left_record, left_reflexion_and_input_mix);
-                    io_r[sid] = sample_mix(right_record, right_reflexion_and_input_mix);
-                }
-
-                // UPDATE INDEX
-                {
-                    reflexion_write_index =
-                        (reflexion_write_index + 1) % current_reflexion_buffer_size;
-                    record_index = (record_index + 1) % real_record_buffer_size;
-                }
-            }
-        }
-        else // NOTE just a reduced copy of the function before
-        {
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                // REFLEXION AND INPUT
-                const int reflexion_read_index = update_get_reflexion_read_index();
-                const float left_reflexion_and_input_mix =
-                    sample_mix(active_left_reflexion_buffer[reflexion_read_index], io_l[sid]);
-                {
-                    active_left_reflexion_buffer[reflexion_write_index] =
-                        left_reflexion_and_input_mix * smoothed_power_[sid];
-                }
-
-                // RECORD AND MIX BEFORE
-                {
-                    float record_power = 0;
-                    if (record_)
-                    {
-                        record_power = record_switch_smoother.glide_tick(true);
-                    }
-                    else if (!record_switch_smoother.is_up_to_date())
-                    {
-                        record_power = record_switch_smoother.tick();
-                    }
-
-                    const float left_record = active_left_record_buffer[record_index];
-                    if (record_power > 0)
-                    {
-                        const float record_release = record_release_buffer_[sid];
-                        const float left_record_feedback =
-                            left_reflexion_and_input_mix * record_power;
-                        if (num_records_to_write > 2)
-                        {
-                            active_left_record_buffer[record_index] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                        }
-                        else if (num_records_to_write == 1)
-                        {
-                            const int record_index_1 = record_index;
-                            int record_index_2 = record_index_1 + record_buffer_size;
-                            if (record_index_2 >= real_record_buffer_size)
-                            {
-                                record_index_2 -= real_record_buffer_size;
-                            }
-                            int record_index_3 = record_index_2 + record_buffer_size;
-                            if (record_index_3 >= real_record_buffer_size)
-                            {
-                                record_index_3 -= real_record_buffer_size;
-                            }
-                            int record_index_4 = record_index_3 + record_buffer_size;
-                            if (record_index_4 >= real_record_buffer_size)
-                            {
-                                record_index_4 -= real_record_buffer_size;
-                            }
-
-                            active_left_record_buffer[record_index_1] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                            active_left_record_buffer[record_index_2] =
-                                sample_mix(active_left_record_buffer[record_index_2],
-                                           left_record_feedback) *
-                                record_release;
-                            active_left_record_buffer[record_index_3] =
-                                sample_mix(active_left_record_buffer[record_index_3],
-                                           left_record_feedback) *
-                                record_release;
-                            active_left_record_buffer[record_index_4] =
-                                sample_mix(active_left_record_buffer[record_index_4],
-                                           left_record_feedback) *
-                                record_release;
-                        }
-                        else // if( num_records_to_write == 2 )
-                        {
-                            int record_index_2 = record_index + record_buffer_size * 2;
-                            if (record_index_2 >= real_record_buffer_size)
-                            {
-                                record_index_2 -= real_record_buffer_size;
-                            }
-
-                            active_left_record_buffer[record_index] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                            active_left_record_buffer[record_index_2] =
-                                sample_mix(active_left_record_buffer[record_index_2],
-                                           left_record_feedback) *
-                                record_release;
-                        }
-                    }
-                    else if (force_clear)
-                    {
-                        record_buffer.clear();
-                        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
-                        force_clear = false;
-                    }
-
-                    io_l[sid] = sample_mix(left_record, left_reflexion_and_input_mix);
-                }
-
-                // UPDATE INDEX
-                {
-                    reflexion_write_index =
-                        (reflexion_write_index + 1) % current_reflexion_buffer_size;
-                    record_index = (record_index + 1) % real_record_buffer_size;
-                }
-            }
-        }
-    }
-
-    //==============================================================================
-    inline void reset() noexcept { sample_rate_or_block_changed(); }
-
-    //==============================================================================
-    inline void clear_record_buffer() noexcept
-    {
-        force_clear = true;
-        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
-        active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
-    }
-
-    inline int get_max_duration() const noexcept { return real_record_buffer_size; }
-
-  private:
-    //==============================================================================
-    COLD void sample_rate_or_block_changed() noexcept override
-    {
-        update_record_stuff(last_bmp_in);
-        update_reflexion_stuff(last_bmp_in);
-    }
-
-  public:
-    //==============================================================================
-    COLD mono_Delay(RuntimeNotifyer *notifyer_, MoniqueSynthData *synth_data_) noexcept
-        : RuntimeListener(notifyer_),
-
-          synth_data(synth_data_),
-
-          last_bmp_in(20),
-
-          reflexion_write_index(0), last_in_reflexion_size(0), reflexion(0), current_reflexion(0),
-          reflexion_buffer_size(1), current_reflexion_buffer_size(1),
-          reflexion_buffer(reflexion_buffer_size),
-          active_left_reflexion_buffer(reflexion_buffer.getWritePointer(LEFT)),
-          active_right_reflexion_buffer(reflexion_buffer.getWritePointer(RIGHT)),
-
-          record_index(0), last_in_record_size(0), record_buffer_size(1),
-          real_record_buffer_size(record_buffer_size), num_records_to_write(1),
-          record_buffer(real_record_buffer_size),
-          active_left_record_buffer(record_buffer.getWritePointer(LEFT)),
-          active_right_record_buffer(record_buffer.getWritePointer(RIGHT)), force_clear(false),
-
-          record_switch_smoother(),
-
-          sin_lookup(synth_data_->sine_lookup), cos_lookup(synth_data_->sine_lookup)
-    {
-        sample_rate_or_block_changed();
-        record_switch_smoother.set_value(0);
-    }
-    COLD ~mono_Delay() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Delay)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class CombFilter
-{
-    juce::HeapBlock<float> buffer;
-    float last;
-    int bufferSize, bufferIndex;
-
-  public:
-    //==============================================================================
-    inline float process(const float input, const float feedbackLevel) noexcept
-    {
-#define REVERB_DAMP 0
-        last = buffer[bufferIndex];
-        // last = (output * (1.0f - REVERB_DAMP)) + (last * REVERB_DAMP);
-        // JUCE_UNDENORMALISE (last);
-
-        float temp = input + (last * feedbackLevel);
-        JUCE_UNDENORMALISE(temp);
-        buffer[bufferIndex] = temp;
-        bufferIndex = (bufferIndex + 1) % bufferSize;
-
-        return last;
-    }
-
-    //==============================================================================
-    COLD void setSize(const int size)
-    {
-        if (size != bufferSize)
-        {
-            bufferIndex = 0;
-            buffer.malloc((size_t)size);
-            bufferSize = size;
-        }
-
-        clear();
-    }
-    COLD void clear() noexcept
-    {
-        last = 0;
-        buffer.clear((size_t)bufferSize);
-    }
-
-  public:
-    //==============================================================================
-    COLD CombFilter() noexcept : last(0), bufferSize(0), bufferIndex(0) {}
-    COLD ~CombFilter() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CombFilter)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class LinearSmoothedValue
-{
-    float currentValue, target, step, lastValue;
-    int countdown, stepsToTarget;
-
-  public:
-    //==========================================================================
-    inline float getNextValue() noexcept
-    {
-        if (countdown <= 0)
-        {
-            lastValue = target;
-        }
-        else
-        {
-            --countdown;
-            currentValue += step;
-
-            lastValue = currentValue;
-        }
-
-        return lastValue;
-    }
-    //==========================================================================
-    inline float getLastValue() noexcept { return lastValue; }
-
-    inline void setValue(float newValue) noexcept
-    {
-        if (target != newValue)
-        {
-            target = newValue;
-            countdown = stepsToTarget;
-
-            if (countdown <= 0)
-            {
-                currentValue = target;
-            }
-            else
-            {
-                step = (target - currentValue) / countdown;
-            }
-        }
-    }
-
-    //==============================================================================
-    COLD void reset(float sampleRate, float fadeLengthSeconds) noexcept
-    {
-        stepsToTarget = std::floor(fadeLengthSeconds * sampleRate);
-        currentValue = target;
-        countdown = 0;
-    }
-
-  public:
-    //==============================================================================
-    COLD LinearSmoothedValue() noexcept
-        : currentValue(0), target(0), step(0), lastValue(0), countdown(0), stepsToTarget(0)
-    {
-    }
-
-    COLD ~LinearSmoothedValue() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LinearSmoothedValue)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_Reverb;
-struct ReverbParameters
-{
-    float roomSize; /**< Room size, 0 to 1.0, where 1.0 is big, 0 is small. */
-    float wetLevel; /**< Wet level, 0 to 1.0 */
-    float dryLevel; /**< Dry level, 0 to 1.0 */
-    float width;    /**< mono_Reverb width, 0 to 1.0, where 1.0 is very wide. */
-
-  private:
-    //==============================================================================
-    friend class mono_Reverb;
-    COLD ReverbParameters() noexcept : roomSize(0.5f), wetLevel(0.33f), dryLevel(0.4f), width(1.0f)
-    {
-    }
-    COLD ~ReverbParameters() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReverbParameters)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_Reverb : RuntimeListener
-{
-    const bool left_or_right;
-
-    enum
-    {
-        numCombs = 8,
-        numAllPasses = 4
-    };
-
-    CombFilter comb[numCombs];
-    AllPassFilter allPass[numAllPasses];
-
-    ReverbParameters parameters;
-#define REVERB_GAIN 0.013f
-
-    float wetGain1, wetGain2, feedback; // dryGain,  feedback
-
-  public:
-    //==========================================================================
-    inline float processSingleSampleRaw(float in) noexcept
-    {
-        float out = 0;
-        {
-            const float input = in * REVERB_GAIN;
-            for (int j = 0; j != numCombs; ++j) // accumulate the comb filters in parallel
-            {
-                out += comb[j].process(input, feedback);
-            }
-        }
-        for (int j = 0; j != numAllPasses; ++j) // run the allpass filters in series
-        {
-            out = allPass[j].process(out);
-        }
-
-        return out * wetGain1 + out * wetGain2 + in * parameters.dryLevel;
-    }
-
-    //==========================================================================
-    inline ReverbParameters &get_parameters() noexcept { return parameters; }
-    inline void update_parameters() noexcept
-    {
-#define ROOM_SCALE 1.0f
-#define WET_SCALE_FACTOR 3.0f
-#define DRY_SCALE_FACTOR 1.0f
-#define ROOM_SCALE_FACTOR (0.28f * ROOM_SCALE)
-#define ROOM_OFFSET (1.0f - 0.28f * ROOM_SCALE - 0.02f)
-        const float wet = parameters.wetLevel * WET_SCALE_FACTOR;
-        // dryGain.setValue (parameters.dryLevel * DRY_SCALE_FACTOR);
-        wetGain1 = 0.5f * wet * (1.0f + parameters.width);
-        wetGain2 = 0.5f * wet * (1.0f - parameters.width);
-        feedback = parameters.roomSize * ROOM_SCALE_FACTOR + ROOM_OFFSET;
-    }
-
-    //==============================================================================
-    COLD void sample_rate_or_block_changed() noexcept override
-    {
-        static const int combTunings[] = {1116, 1188, 1277, 1356,
-                                          1422, 1491, 1557, 1617}; // (at 44100Hz)
-        static const int allPassTunings[] = {556, 441, 341, 225};
-        const int stereoSpread = 23;
-        const int intSampleRate = (int)sample_rate;
-
-        for (int i = 0; i < numCombs; ++i)
-        {
-            if (left_or_right == LEFT)
-            {
-                comb[i].setSize((intSampleRate * combTunings[i] * ROOM_SCALE) / 44100);
-            }
-            else
-            {
-                comb[i].setSize(
-                    (intSampleRate * (combTunings[i] * ROOM_SCALE + stereoSpread * ROOM_SCALE)) /
-                    44100);
-            }
-        }
-        for (int i = 0; i < numAllPasses; ++i)
-        {
-            if (left_or_right == LEFT)
-            {
-                allPass[i].setSize((intSampleRate * allPassTunings[i] * ROOM_SCALE) / 44100);
-            }
-            else
-            {
-                allPass[i].setSize(
-                    (intSampleRate * (allPassTunings[i] * ROOM_SCALE + stereoSpread * ROOM_SCALE)) /
-                    44100);
-            }
-        }
-    }
-    COLD void reset() noexcept
-    {
-        for (int i = 0; i < numCombs; ++i)
-        {
-            comb[i].clear();
-        }
-
-        for (int i = 0; i < numAllPasses; ++i)
-        {
-            allPass[i].clear();
-        }
-    }
-
-  public:
-    //==========================================================================
-    COLD mono_Reverb(RuntimeNotifyer *const notifyer_, bool left_or_right_) noexcept
-        : RuntimeListener(notifyer_), left_or_right(left_or_right_), wetGain1(0), wetGain2(0),
-          feedback(0)
-    {
-        update_parameters();
-        sample_rate_or_block_changed();
-    }
-    COLD ~mono_Reverb() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Reverb)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class ZeroInCounter
-{
-    int count_zeros;
-
-  public:
-    //==============================================================================
-    void add(float value) noexcept
-    {
-        if (value > -0.0001 && value < 0.0001)
-        {
-            count_zeros++;
-        }
-        else
-        {
-            count_zeros = 0;
-        }
-    }
-
-    int get_num_zeros() const noexcept { return count_zeros; }
-
-    void reset() noexcept { count_zeros = 0; }
-
-  public:
-    //==============================================================================
-    COLD ZeroInCounter() noexcept : count_zeros(0) {}
-    COLD ~ZeroInCounter() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ZeroInCounter)
-};
-class FXProcessor
-{
-    // DELAY
-    mono_Delay delay;
-
-    // REVERB
-    mono_Reverb reverb_l;
-    mono_Reverb reverb_r;
-
-    // CHORUS
-    mono_Chorus chorus;
-    friend class mono_ParameterOwnerStore;
-
-    // FINAL ENV
-    friend class MoniqueSynthesiserVoice;
-    std::unique_ptr<ENV> final_env;
-
-  public:
-    Smoother velocity_smoother;
-    int zero_samples_counter;
-    LinearSmootherMinMax<false, true> *const bypass_smoother;
-
-  private:
-    const MoniqueSynthData *const synth_data;
-    DataBuffer *const data_buffer;
-    const ReverbData *const reverb_data;
-    ChorusData *const chorus_data;
-
-    const float *const sin_lookup;
-    const float *const cos_lookup;
-
-  public:
-    //==========================================================================
-    inline void process(juce::AudioSampleBuffer &output_buffer_, const float *velocity_,
-                        const int start_sample_final_out_, const int num_samples_) noexcept
-    {
-        velocity_smoother.set_size_in_ms(synth_data->velocity_glide_time);
-
-        if (synth_data->is_stereo)
-        {
-            // COLLECT BUFFERS
-            float *left_input_buffer =
-                data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
-            float *right_input_buffer =
-                data_buffer->filter_stereo_output_samples.getWritePointer(RIGHT);
-
-            float *left_out_buffer = &output_buffer_.getWritePointer(LEFT)[start_sample_final_out_];
-            const bool is_stereo = output_buffer_.getNumChannels() > 1;
-            float *right_out_buffer =
-                is_stereo ? &output_buffer_.getWritePointer(RIGHT)[start_sample_final_out_]
-                          : data_buffer->second_mono_buffer.getWritePointer();
-
-            // PREPARE
-            {
-                float *const final_env_amp = data_buffer->final_env.getWritePointer();
-                final_env->process(final_env_amp, num_samples_);
-
-                for (int sid = 0; sid != num_samples_; ++sid)
-                {
-                    const float gain =
-                        final_env_amp[sid] * velocity_smoother.add_and_get_average(velocity_[sid]);
-                    left_input_buffer[sid] *= gain;
-                    right_input_buffer[sid] *= gain;
-                }
-            }
-
-            // STEREO CHORUS
-            {
-                chorus.process(left_input_buffer, right_input_buffer, left_out_buffer,
-                               right_out_buffer, num_samples_);
-            }
-
-            // DELAY
-            {
-                delay.set_reflexion_size(synth_data->delay_refexion, synth_data->delay_record_size,
-                                         synth_data->glide_motor_time,
-                                         is_standalone() ? synth_data->speed
-                                                         : synth_data->runtime_info->bpm);
-
-                delay.process(left_out_buffer, right_out_buffer,
-                              synth_data->delay_smoother.get_smoothed_value_buffer(),
-                              synth_data->delay_pan_smoother.get_smoothed_value_buffer(),
-                              synth_data->delay_record_release_smoother.get_smoothed_value_buffer(),
-                              synth_data->delay_record, num_samples_);
-            }
-
-            // REVERB
-            {
-                const float *const smoothed_pan_buffer(
-                    reverb_data->pan_smoother.get_smoothed_value_buffer());
-                const float *const smoothed_bypass_buffer =
-                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
-
-                const float *const smoothed_room_buffer =
-                    reverb_data->room_smoother.get_smoothed_value_buffer();
-                const float *const smoothed_with_buffer =
-                    reverb_data->width_smoother.get_smoothed_value_buffer();
-                const float *const smoothed_dry_wet_mix_buffer =
-                    reverb_data->dry_wet_mix_smoother.get_smoothed_value_buffer();
-                ReverbParameters &rever_params_l = reverb_l.get_parameters();
-                ReverbParameters &rever_params_r = reverb_r.get_parameters();
-                for (int sid = 0; sid != num_samples_; ++sid)
-                {
-                    {
-                        const float reverb_room = smoothed_room_buffer[sid];
-                        const float reverb_dry_wet_mix = 1.0f - smoothed_dry_wet_mix_buffer[sid];
-                        const float reverb_width = smoothed_with_buffer[sid];
-                        if (rever_params_l.roomSize != reverb_room ||
-                            rever_params_l.dryLevel != reverb_dry_wet_mix
-                            //|| rever_params_r.wetLevel != r_params.wetLevel
-                            || rever_params_l.width != reverb_width)
-                        {
-                            rever_params_l.roomSize = reverb_room;
-                            rever_params_l.dryLevel = reverb_dry_wet_mix;
-                            rever_params_l.wetLevel = 1.0f - reverb_dry_wet_mix;
-                            rever_params_l.width = reverb_width;
-
-                            rever_params_r.roomSize = rever_params_l.roomSize;
-                            rever_params_r.dryLevel = rever_params_l.dryLevel;
-                            rever_params_r.wetLevel = rever_params_l.wetLevel;
-                            rever_params_r.width = rever_params_l.width;
-
-                            reverb_l.update_parameters();
-                            reverb_r.update_parameters();
-                        }
-
-                        const float in_l = left_out_buffer[sid];
-                        const float in_r = right_out_buffer[sid];
-                        float sample_l = reverb_l.processSingleSampleRaw(in_l);
-                        float sample_r = reverb_r.processSingleSampleRaw(in_r);
-
-                        const float pan = smoothed_pan_buffer[sid];
-                        const float left = left_pan(pan, sin_lookup);
-                        const float right = right_pan(pan, cos_lookup);
-                        const float bypass = smoothed_bypass_buffer[sid];
-                        left_out_buffer[sid] =
-                            sample_mix((sample_l * left + in_l * (1.0f - left)) * bypass,
-                                       left_input_buffer[sid] * (1.0f - bypass));
-                        right_out_buffer[sid] =
-                            sample_mix((sample_r * right + in_r * (1.0f - right)) * bypass,
-                                       right_input_buffer[sid] * (1.0f - bypass));
-                    }
-                }
-            }
-
-            // PROCESS
-            {
-                // FINAL MIX
-                {
-                    const float *const smoothed_volume_buffer =
-                        synth_data->volume_smoother.get_smoothed_value_buffer();
-                    if (is_stereo)
-                    {
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            float left_in = left_out_buffer[sid];
-                            float right_in = right_out_buffer[sid];
-#define MONO_UNDENORMALISE_OUTPUT(n)                                                               \
-    if (!(n < -1.0e-3f || n > 1.0e-3f))                                                            \
-        n = 0;
-                            MONO_UNDENORMALISE_OUTPUT(left_in);
-                            MONO_UNDENORMALISE_OUTPUT(right_in);
-                            if (left_in != 0 || right_in != 0)
-                            {
-                                zero_samples_counter = 0;
-                            }
-                            else
-                            {
-                                zero_samples_counter++;
-                            }
-
-                            const float volume =
-                                smoothed_volume_buffer[sid] * bypass_smoother->tick();
-                            left_out_buffer[sid] *= volume * 2;
-                            right_out_buffer[sid] *= volume * 2;
-                        }
-                    }
-                    else
-                    {
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            float left_in = left_out_buffer[sid];
-                            float right_in = right_out_buffer[sid];
-                            MONO_UNDENORMALISE_OUTPUT(left_in);
-                            MONO_UNDENORMALISE_OUTPUT(right_in);
-                            if (left_in != 0 || right_in != 0)
-                            {
-                                zero_samples_counter = 0;
-                            }
-                            else
-                            {
-                                zero_samples_counter++;
-                            }
-
-                            const float volume =
-                                smoothed_volume_buffer[sid] * bypass_smoother->tick();
-                            left_out_buffer[sid] *= sample_mix(left_out_buffer[sid] * volume * 2,
-                                                               right_out_buffer[sid] * volume * 2);
-                        }
-                    }
-
-                    // VISUALIZE BEFORE FONAL OUT
-                    if (Monique_Ui_SegmentedMeter *meter = synth_data->audio_processor->peak_meter)
-                    {
-                        juce::ScopedLock locked(synth_data->audio_processor->peak_meter_lock);
-                        meter->process(left_out_buffer, num_samples_);
-                    }
-                    if (is_stereo)
-                    {
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            left_out_buffer[sid] = soft_clipp_greater_0_9(left_out_buffer[sid]);
-                            right_out_buffer[sid] = soft_clipp_greater_0_9(right_out_buffer[sid]);
-                        }
-                    }
-                    else
-                    {
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            left_out_buffer[sid] = soft_clipp_greater_0_9(left_out_buffer[sid]);
-                        }
-                    }
-
-                    // VISUALIZE
-                    if (Monique_Ui_AmpPainter *amp_painter =
-                            synth_data->audio_processor->amp_painter)
-                    {
-                        amp_painter->add_out(left_out_buffer, right_out_buffer, num_samples_);
-                        amp_painter->add_out_env(data_buffer->final_env.getReadPointer(),
-                                                 num_samples_);
-                    }
-                }
-            }
-        }
-        else // NOTE just a reduced copy of the function before
-        {
-            // COLLECT BUFFERS
-            float *left_input_buffer =
-                data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
-
-            float *left_out_buffer = &output_buffer_.getWritePointer(LEFT)[start_sample_final_out_];
-            const bool is_stereo = output_buffer_.getNumChannels() > 1;
-            float *right_out_buffer =
-                is_stereo ? &output_buffer_.getWritePointer(RIGHT)[start_sample_final_out_]
-                          : data_buffer->second_mono_buffer.getWritePointer();
-
-            // PREPARE
-            {
-                float *const final_env_amp = data_buffer->final_env.getWritePointer();
-                final_env->process(final_env_amp, num_samples_);
-
-                for (int sid = 0; sid != num_samples_; ++sid)
-                {
-                    const float gain =
-                        final_env_amp[sid] * velocity_smoother.add_and_get_average(velocity_[sid]);
-                    left_input_buffer[sid] *= gain;
-                }
-            }
-
-            // STEREO CHORUS
-            {
-                chorus.process(left_input_buffer, nullptr, left_out_buffer, nullptr, num_samples_);
-            }
-
-            // DELAY
-            {
-                delay.set_reflexion_size(
-                    synth_data->delay_refexion, synth_data->delay_record_size,
-                    synth_data->glide_motor_time,
-                    is_standalone() ? synth_data->speed // // NOT POSSIBLE TO SYNC <- old comment
-                                    : synth_data->runtime_info->bpm);
-
-                delay.process(left_out_buffer, nullptr,
-                              synth_data->delay_smoother.get_smoothed_value_buffer(),
-                              synth_data->delay_pan_smoother.get_smoothed_value_buffer(),
-                              synth_data->delay_record_release_smoother.get_smoothed_value_buffer(),
-                              synth_data->delay_record, num_samples_);
-            }
-
-            // REVERB
-            {
-                const float *const smoothed_bypass_buffer =
-                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
-
-                const float *const smoothed_room_buffer =
-                    reverb_data->room_smoother.get_smoothed_value_buffer();
-                const float *const smoothed_with_buffer =
-                    reverb_data->width_smoother.get_smoothed_value_buffer();
-                const float *const smoothed_dry_wet_mix_buffer =
-                    reverb_data->dry_wet_mix_smoother.get_smoothed_value_buffer();
-                ReverbParameters &rever_params_l = reverb_l.get_parameters();
-                for (int sid = 0; sid != num_samples_; ++sid)
-                {
-                    {
-                        const float reverb_room = smoothed_room_buffer[sid];
-                        const float reverb_dry_wet_mix = 1.0f - smoothed_dry_wet_mix_buffer[sid];
-                        const float reverb_width = smoothed_with_buffer[sid];
-                        if (rever_params_l.roomSize != reverb_room ||
-                            rever_params_l.dryLevel != reverb_dry_wet_mix
-                            //|| rever_params_r.wetLevel != r_params.wetLevel
-                            || rever_params_l.width != reverb_width)
-                        {
-                            rever_params_l.roomSize = reverb_room;
-                            rever_params_l.dryLevel = reverb_dry_wet_mix;
-                            rever_params_l.wetLevel = 1.0f - reverb_dry_wet_mix;
-                            rever_params_l.width = reverb_width;
-
-                            reverb_l.update_parameters();
-                        }
-
-                        const float in_l = left_out_buffer[sid];
-                        float sample_l = reverb_l.processSingleSampleRaw(in_l);
-
-                        const float bypass = smoothed_bypass_buffer[sid];
-                        left_out_buffer[sid] = sample_mix(sample_l + in_l * bypass,
-                                                          left_input_buffer[sid] * (1.0f - bypass));
-                    }
-                }
-            }
-
-            // PROCESS
-            {
-                // FINAL MIX
-                {
-                    const float *const smoothed_volume_buffer =
-                        synth_data->volume_smoother.get_smoothed_value_buffer();
-                    {
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            float left_in = left_out_buffer[sid];
-                            MONO_UNDENORMALISE_OUTPUT(left_in);
-                            if (left_in != 0)
-                            {
-                                zero_samples_counter = 0;
-                            }
-                            else
-                            {
-                                zero_samples_counter++;
-                            }
-
-                            const float volume =
-                                smoothed_volume_buffer[sid] * bypass_smoother->tick();
-                            left_out_buffer[sid] = left_out_buffer[sid] * volume * 2;
-                        }
-                    }
-
-                    // VISUALIZE BEFORE FONAL OUT
-                    if (Monique_Ui_SegmentedMeter *meter = synth_data->audio_processor->peak_meter)
-                    {
-                        juce::ScopedLock locked(synth_data->audio_processor->peak_meter_lock);
-                        meter->process(left_out_buffer, num_samples_);
-                    }
-                    {
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            right_out_buffer[sid] = left_out_buffer[sid] =
-                                soft_clipp_greater_0_9(left_out_buffer[sid]);
-                        }
-                    }
-
-                    // VISUALIZE
-                    if (Monique_Ui_AmpPainter *amp_painter =
-                            synth_data->audio_processor->amp_painter)
-                    {
-                        amp_painter->add_out(left_out_buffer, right_out_buffer, num_samples_);
-                        amp_painter->add_out_env(data_buffer->final_env.getReadPointer(),
-                                                 num_samples_);
-                    }
-                }
-            }
-        }
-    }
-
-    //==========================================================================
-    void start_attack() noexcept
-    {
-        zero_samples_counter = 0;
-        final_env->start_attack();
-    }
-    void start_release(bool is_sustain_pedal_down_, bool is_sostenuto_pedal_down_) noexcept
-    {
-        if (!is_sostenuto_pedal_down_)
-        {
-            // chorus_modulation_env->set_to_release();
-        }
-        if (!is_sustain_pedal_down_)
-        {
-            final_env->set_to_release();
-        }
-    }
-
-    //==========================================================================
-    void reset() noexcept
-    {
-        delay.reset();
-        reverb_l.reset();
-        reverb_r.reset();
-        chorus.reset();
-
-        final_env->reset();
-
-        zero_samples_counter = 0;
-        velocity_smoother.reset(0);
-    }
-
-  public:
-    //==============================================================================
-    COLD FXProcessor(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_,
-                     LinearSmootherMinMax<false, true> *bypass_smoother_,
-                     const float *const sine_lookup_, const float *const cos_lookup_,
-                     const float *const exp_lookup_) noexcept
-        :
-
-          delay(notifyer_, synth_data_),
-
-          reverb_l(notifyer_, LEFT), reverb_r(notifyer_, RIGHT),
-
-          chorus(notifyer_, synth_data_),
-
-          final_env(new ENV(notifyer_, synth_data_, synth_data_->env_data.get(), sine_lookup_,
-                            cos_lookup_, exp_lookup_)),
-
-          velocity_smoother(notifyer_, synth_data_->velocity_glide_time), zero_samples_counter(0),
-          bypass_smoother(bypass_smoother_),
-
-          synth_data(synth_data_), data_buffer(synth_data_->data_buffer),
-          reverb_data(synth_data_->reverb_data.get()), chorus_data(synth_data_->chorus_data.get()),
-
-          sin_lookup(synth_data_->sine_lookup), cos_lookup(synth_data_->cos_lookup)
-    {
-#ifdef JUCE_DEBUG
-        std::cout << "MONIQUE: init FX" << std::endl;
-#endif
-    }
-
-    COLD ~FXProcessor() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FXProcessor)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class ArpSequencer : public RuntimeListener
-{
-    RuntimeInfo *const info;
-    const ArpSequencerData *const data;
-
-    friend class MoniqueSynthesiserVoice;
-
-    int current_step;
-    int next_step_on_hold;
-    int step_at_sample_current_buffer;
-
-    int shuffle_to_back_counter;
-    bool found_a_step;
-
-    std::int64_t user_arp_start_point_in_samples;
-
-    juce::OwnedArray<Step> steps_on_hold;
-
-  public:
-    //==============================================================================
-    // RETURNS THE NUMBER OF SAMPLES TO THE NEXT STEP
-    // RETURN NUM SAMPLES IF THERE IS NO STEP IN THE BUFFER
-    inline int process_samples_to_next_step(int start_sample_, int num_samples_) noexcept
-    {
-        const std::int64_t samples_since_start =
-            info->relative_samples_since_start - user_arp_start_point_in_samples;
-        double samples_per_min = sample_rate * 60;
-        double speed_multi = ArpSequencerData::speed_multi_to_value(data->speed_multi);
-        double steps_per_min = info->bpm * 4 / 1.0 * speed_multi;
-        double steps_per_sample = steps_per_min / samples_per_min;
-        int samples_offset = 0;
-        const int fine = data->fine_offset.get_value();
-        if (0 != fine)
-        {
-            float multi = 1;
-            switch (fine)
-            {
-            case -5:
-                multi = -1.5;
-                break;
-            case -4:
-                multi = -2;
-                break;
-            case -3:
-                multi = -3;
-                break;
-            case -2:
-                multi = -6;
-                break;
-            case -1:
-                multi = -8;
-                break;
-            case 1:
-                multi = 8;
-                break;
-            case 2:
-                multi = 6;
-                break;
-            case 3:
-                multi = 3;
-                break;
-            case 4:
-                multi = 2;
-                break;
-            case 5:
-                multi = 1.5;
-                break;
-            }
-            const float samples_per_step = 1.0f / steps_per_sample;
-            samples_offset = floor(samples_per_step / multi);
-        }
-        std::int64_t sync_sample_pos = samples_since_start + start_sample_ + samples_offset;
-        std::int64_t step = next_step_on_hold;
-        step_at_sample_current_buffer = -1;
-
-        double samples_per_step =
-            samples_per_min / steps_per_min; // WILL BE OVERRIDDEN IN STANDALONE!
-
-        bool is_extern_synced = false;
-        if (is_standalone())
-        {
-            is_extern_synced = info->standalone_features_pimpl->is_extern_synced;
-        }
-
-        for (int i = 0; i < num_samples_; ++i)
-        {
-            if (++sync_sample_pos < 0)
-            {
-                continue;
-            }
-
-            if (is_standalone() && is_extern_synced)
-            {
-                juce::OwnedArray<Step> &steps_in_block(
-                    info->standalone_features_pimpl->steps_in_block);
-                if (steps_in_block.size())
-                {
-                    Step &step__(*steps_in_block.getFirst());
-                    if (step__.at_absolute_sample == sync_sample_pos - samples_offset)
-                    {
-                        if (samples_offset > 0)
-                        {
-                            steps_on_hold.add(new Step(step__.step_id,
-                                                       step__.at_absolute_sample + samples_offset,
-                                                       step__.samples_per_step));
-                        }
-                        else if (samples_offset < 0)
-                        {
-                            steps_on_hold.add(new Step(step__.step_id + 1,
-                                                       step__.at_absolute_sample +
-                                                           (samples_per_step + samples_offset),
-                                                       step__.samples_per_step));
-                        }
-                        else
-                        {
-                            step = step__.step_id;
-                            samples_per_step = step__.samples_per_step;
-                            steps_in_block.remove(0, true);
-                        }
-                    }
-                }
-                if (steps_on_hold.size())
-                {
-                    for (int i = 0; i < steps_on_hold.size(); ++i)
-                    {
-                        Step &step__(*steps_on_hold.getUnchecked(i));
-                        if (step__.at_absolute_sample == sync_sample_pos - samples_offset)
-                        {
-                            step = step__.step_id;
-                            samples_per_step = step__.samples_per_step;
-                            steps_on_hold.remove(i, true);
-                            i--;
-                        }
-                        // CLEAN
-                        else if (step__.at_absolute_sample < sync_sample_pos - samples_offset)
-                        {
-                            steps_on_hold.remove(i, true);
-                            i--;
-                        }
-                    }
-                }
-            }
-            else
-            {
-                step = std::floor(steps_per_sample *
-                                  sync_sample_pos); //+1; // +1 for future processing
-                if (step < 0)
-                {
-                    step = 0;
-                }
-            }
-
-            // step += data->step_offset.get_value();
-
-            --shuffle_to_back_counter;
-
-            if (step != next_step_on_hold)
-            {
-                next_step_on_hold = step;
-
-                if (current_step % 2 == 0)
-                {
-                    shuffle_to_back_counter = std::floor(
-                        samples_per_step * ArpSequencerData::shuffle_to_value(data->shuffle));
-                }
-                else
-                {
-                    shuffle_to_back_counter = 0;
-                }
-
-                found_a_step = true;
-            }
-
-            if (found_a_step && shuffle_to_back_counter == 0)
-            {
-                step_at_sample_current_buffer = i;
-                current_step = next_step_on_hold;
-                return i;
-            }
-        }
-
-        return num_samples_;
-    }
-
-    //==============================================================================
-    inline int get_current_step() const noexcept
-    {
-        return int(current_step + data->step_offset.get_value()) % SUM_ENV_ARP_STEPS;
-    }
-    inline int get_current_absolute_step() const noexcept
-    {
-        return int(current_step + data->step_offset.get_value());
-    }
-    inline int get_step_before() const noexcept
-    {
-        if (int(current_step + data->step_offset.get_value()) > 0)
-            return (int(current_step + data->step_offset.get_value()) - 1) % SUM_ENV_ARP_STEPS;
-        else
-            return 0;
-    }
-    inline float get_current_tune() const noexcept
-    {
-        return data->tune[get_current_step()].get_value();
-    }
-    inline bool found_last_process_a_step() const noexcept
-    {
-        return step_at_sample_current_buffer != -1;
-    }
-    inline bool last_found_step_is_enabled() const noexcept
-    {
-        bool success = false;
-        if (found_last_process_a_step())
-        {
-            if (data->step[get_current_step()])
-            {
-                success = true;
-            }
-        }
-
-        return success;
-    }
-    inline void reset() noexcept
-    {
-        current_step = 0;
-        next_step_on_hold = 0;
-        shuffle_to_back_counter = 0;
-        steps_on_hold.clear(true);
-        step_at_sample_current_buffer = data->step[0] ? 0 : -1;
-    }
-
-    void sample_rate_or_block_changed() noexcept override {}
-
-    void set_user_arp_start_point_in_samples(std::int64_t user_arp_start_point_in_samples_) noexcept
-    {
-        user_arp_start_point_in_samples = user_arp_start_point_in_samples_;
-    }
-
-  public:
-    //==============================================================================
-    COLD ArpSequencer(RuntimeNotifyer *const notifyer_, RuntimeInfo *info_,
-                      const ArpSequencerData *data_) noexcept
-        : RuntimeListener(notifyer_),
-
-          info(info_), data(data_), current_step(0), next_step_on_hold(0),
-          step_at_sample_current_buffer(-1),
-
-          shuffle_to_back_counter(0), found_a_step(false),
-
-          user_arp_start_point_in_samples(0)
-    {
-#ifdef JUCE_DEBUG
-        std::cout << "MONIQUE: init SEQUENCER" << std::endl;
-#endif
-    }
-
-    COLD ~ArpSequencer() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ArpSequencer)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-COLD MoniqueSynthesiserVoice::MoniqueSynthesiserVoice(MoniqueAudioProcessor *const audio_processor_,
-                                                      MoniqueSynthData *const synth_data_,
-                                                      RuntimeNotifyer *const notifyer_,
-                                                      RuntimeInfo *const info_,
-                                                      DataBuffer *data_buffer_) noexcept
-    : audio_processor(audio_processor_), synth_data(synth_data_),
-
-      info(info_), data_buffer(data_buffer_),
-
-      arp_sequencer(new ArpSequencer(notifyer_, info, synth_data_->arp_sequencer_data.get())),
-      eq_processor(new EQProcessorStereo(notifyer_, synth_data_, synth_data_->sine_lookup,
-                                         synth_data_->cos_lookup, synth_data_->exp_lookup)),
-      bypass_smoother(0),
-      fx_processor(new FXProcessor(notifyer_, synth_data_, &bypass_smoother,
-                                   synth_data_->sine_lookup, synth_data_->cos_lookup,
-                                   synth_data_->exp_lookup)),
-
-      current_note(-1), pitch_offset(0),
-
-      is_sostenuto_pedal_down(false), stopped_and_sostenuto_pedal_was_down(false),
-      is_soft_pedal_down(false), was_soft_pedal_down_on_note_start(false),
-      is_sustain_pedal_down(false), stopped_and_sustain_pedal_was_down(false),
-
-      current_velocity(0), current_step(0), current_running_arp_step(0),
-      an_arp_note_is_already_running(false), sample_position_for_restart_arp(-1)
-{
-#ifdef JUCE_DEBUG
-    std::cout << "MONIQUE: init BUFFERS's" << std::endl;
-
-    std::cout << "MONIQUE: init OSC's" << std::endl;
-#endif
-
-    master_osc = new MasterOSC(notifyer_, synth_data_, synth_data_->sine_lookup);
-    second_osc = new SecondOSC(notifyer_, synth_data_, 1, synth_data_->sine_lookup);
-    third_osc = new SecondOSC(notifyer_, synth_data_, 2, synth_data_->sine_lookup);
-
-#ifdef JUCE_DEBUG
-    std::cout << "MONIQUE: init LFO's" << std::endl;
-#endif
-
-    lfos = new LFO *[SUM_LFOS];
-    for (int i = 0; i != SUM_LFOS; ++i)
-    {
-        lfos[i] =
-            new LFO(notifyer_, synth_data_, synth_data->lfo_datas[i], synth_data_->sine_lookup);
-    }
-
-    mfos = new LFO *[SUM_MORPHER_GROUPS];
-    for (int i = 0; i != SUM_MORPHER_GROUPS; ++i)
-    {
-        mfos[i] =
-            new LFO(notifyer_, synth_data_, synth_data->mfo_datas[i], synth_data_->sine_lookup);
-    }
-
-#ifdef JUCE_DEBUG
-    std::cout << "MONIQUE: init FILTERS & ENVELOPES" << std::endl;
-#endif
-
-    filter_processors = new FilterProcessor *[SUM_FILTERS];
-#ifdef POLY
-    filter_volume_tracking_envs = new ENV *[SUM_FILTERS];
-#endif
-    for (int i = 0; i != SUM_FILTERS; ++i)
-    {
-        filter_processors[i] =
-            new FilterProcessor(notifyer_, synth_data_, i, synth_data_->sine_lookup,
-                                synth_data_->cos_lookup, synth_data_->exp_lookup);
-#ifdef POLY
-        filter_volume_tracking_envs[i] =
-            new ENV(notifyer_, synth_data_, synth_data_->env_data, synth_data_->sine_lookup,
-                    synth_data_->cos_lookup, synth_data_->exp_lookup);
-#endif
-    }
-}
-COLD MoniqueSynthesiserVoice::~MoniqueSynthesiserVoice() noexcept
-{
-#ifdef JUCE_DEBUG
-    std::cout << "~MoniqueSynthesiserVoice" << std::endl;
-#endif
-    for (int i = SUM_FILTERS - 1; i > -1; --i)
-    {
-#ifdef POLY
-        delete filter_volume_tracking_envs[i];
-#endif
-        delete filter_processors[i];
-    }
-    delete[] filter_processors;
-    for (int i = SUM_LFOS - 1; i > -1; --i)
-    {
-        delete lfos[i];
-    }
-    delete[] lfos;
-    for (int i = SUM_MORPHER_GROUPS - 1; i > -1; --i)
-    {
-        delete mfos[i];
-    }
-    delete[] mfos;
-
-    delete third_osc;
-    delete second_osc;
-    delete master_osc;
-
-    delete arp_sequencer;
-    delete eq_processor;
-    delete fx_processor;
-}
-
-//==============================================================================
-void MoniqueSynthesiserVoice::startNote(int midi_note_number_, float velocity_,
-                                        juce::SynthesiserSound * /*sound*/, int pitch_)
-{
-    start_internal(midi_note_number_, velocity_, 0, true);
-}
-void MoniqueSynthesiserVoice::start_internal(int midi_note_number_, float velocity_,
-                                             int sample_number_, bool is_human_event_,
-                                             bool trigger_envelopes_, bool isNoteOff) noexcept
-{
-    stopped_and_sostenuto_pedal_was_down = false;
-    stopped_and_sustain_pedal_was_down = false;
-    was_soft_pedal_down_on_note_start = is_soft_pedal_down;
-
-    current_velocity =
-        (1.0f - synth_data->env_data->velosivity) * velocity_ + synth_data->env_data->velosivity;
-
-    // OSCS
-    MoniqueSynthesizer::NoteDownStore *tmp_note_down_store =
-        reinterpret_cast<MoniqueSynthesizer::NoteDownStore *>(note_down_store);
-    const int keys_down = tmp_note_down_store->size();
-    const bool step_automation_is_on =
-        (synth_data->arp_sequencer_data->is_on &&
-         (!synth_data->keep_arp_always_off || synth_data->keep_arp_always_on)) ||
-        synth_data->keep_arp_always_on;
-    bool start_up = (step_automation_is_on && keys_down == 1) ||
-                    (step_automation_is_on &&
-                     (synth_data->arp_sequencer_data->is_sequencer && current_note != -1) &&
-                     !is_human_event_) ||
-                    (step_automation_is_on && keys_down > 0 && !is_human_event_) ||
-                    (!step_automation_is_on && is_human_event_);
-    if (synth_data->arp_sequencer_data->is_sequencer)
-    {
-        if (is_human_event_)
-        {
-            arp_sequencer->set_user_arp_start_point_in_samples(0);
-        }
-    }
-#ifdef POLY
-    if (an_arp_note_is_already_running && step_automation_is_on
-        //|| arp_sequencer->data->connect && keys_down > 1 && step_automation_is_on == false
-        //|| step_automation_is_on && is_human_event_
-    )
-    {
-        trigger_envelopes_ = false;
-    }
-#else
-    if ((arp_sequencer->data->connect && an_arp_note_is_already_running && step_automation_is_on) ||
-        (arp_sequencer->data->connect && keys_down > 1 && step_automation_is_on == false) ||
-        (step_automation_is_on && is_human_event_))
-    {
-        trigger_envelopes_ = false;
-    }
-#endif
-    // KEYTRACK OR NOTE PLAYBACK
-    const float arp_offset = ((step_automation_is_on ||
-                               (step_automation_is_on &&
-                                synth_data->arp_sequencer_data->is_sequencer && current_note != -1))
-                                  ? arp_sequencer->get_current_tune()
-                                  : 0);
-    {
-        // FIRST KEY DOWN
-        const bool first_key_down_event = is_human_event_ && keys_down == 1;
-
-        if (!synth_data->arp_sequencer_data->is_sequencer)
-        {
-            if (keys_down > 0 && is_human_event_ && step_automation_is_on)
-            {
-                // LEGATO ARP - TURN THIS FIRST BLOCK OF TO HAVE IT NORMAL
-#ifndef POLY
-                if ((isNoteOff && arp_sequencer->data->connect) ||
-                    (keys_down > 1 && arp_sequencer->data->connect))
-                    trigger_envelopes_ = false;
-                else
-#endif
-                {
-                    arp_sequencer->set_user_arp_start_point_in_samples(info->samples_since_start +
-                                                                       sample_number_);
-                    arp_sequencer->reset();
-                    an_arp_note_is_already_running = synth_data->arp_sequencer_data->step[0];
-                    start_up = an_arp_note_is_already_running;
-                    trigger_envelopes_ = start_up;
-                }
-            }
-        }
-        else
-        {
-            if (keys_down == 1 && is_human_event_)
-            {
-                arp_sequencer->set_user_arp_start_point_in_samples(0);
-            }
-        }
-
-        const juce::MidiMessage *last_message = tmp_note_down_store->get_last();
-        int last_note = -1;
-        int last_note_id = -1;
-        int current_note_id = -2;
-        if (last_message)
-        {
-            last_note = tmp_note_down_store->get_last()->getNoteNumber();
-            last_note_id = tmp_note_down_store->get_id(last_note);
-        }
-        if (is_human_event_)
-        {
-            current_note_id = tmp_note_down_store->get_id(midi_note_number_);
-        }
-#ifdef POLY
-        int reorder_allowed = synth_data->keytrack_osci[0] + synth_data->keytrack_osci[1] +
-                              synth_data->keytrack_osci[2];
-#else
-        const int reorder_allowed = 0;
-#endif
-        if (!reorder_allowed)
-        {
-            current_note = midi_note_number_;
-        }
-        /*
-        else
-        {
-            if( synth_data->keytrack_osci[0] )
-            {
-                if( keys_down == 1 )
-                {
-                    current_note = midi_note_number_;
-                }
-            }
-            else
-            {
-                current_note = midi_note_number_;
-            }
-        }
-        */
-
-        // INSERT
-        if (current_note_id >= 0 && current_note_id <= 2)
-        {
-            int trigger_again_note_0 = false;
-            int trigger_again_note_1 = false;
-            int trigger_again_note_2 = false;
-            const int incoming_note_value = midi_note_number_;
-            const juce::MidiMessage *message_0 = tmp_note_down_store->get_at(0);
-            const juce::MidiMessage *message_1 = tmp_note_down_store->get_at(1);
-            const juce::MidiMessage *message_2 = tmp_note_down_store->get_at(2);
-            bool trigger_again_note_0_was_running = false;
-            bool trigger_again_note_1_was_running = false;
-            bool trigger_again_note_2_was_running = false;
-
-            if (tmp_note_down_store->size() > 1)
-            {
-                bool done = false;
-
-                // PLAYBACK MODE
-                struct compary
-                {
-                    virtual bool compare(int left_, int right_) const noexcept = 0;
-                    virtual int get_compare_default() const noexcept = 0;
-                    virtual ~compary(){};
-                };
-                struct low_last_compary : public compary
-                {
-                    bool compare(int left_, int right_) const noexcept override
-                    {
-                        return left_ < right_;
-                    }
-                    int get_compare_default() const noexcept override { return -1; }
-                };
-                struct high_last_compary : public compary
-                {
-                    bool compare(int left_, int right_) const noexcept override
-                    {
-                        return left_ > right_;
-                    }
-                    int get_compare_default() const noexcept override { return 999; }
-                };
-#ifdef POLY
-                std::unique_ptr<compary> comparier;
-                std::unique_ptr<compary> comparier2;
-                bool first_and_second_swapped = false;
-                if (synth_data->keytrack_osci_play_mode == 1)
-                {
-                    comparier = new high_last_compary();
-                }
-                if (synth_data->keytrack_osci_play_mode == 0)
-                {
-                    comparier = new low_last_compary();
-                }
-                if (synth_data->keytrack_osci_play_mode == 2 || reorder_allowed == false)
-                {
-                    comparier = nullptr;
-                }
-                if (synth_data->keytrack_osci_play_mode == 3 || reorder_allowed == false)
-                {
-                    comparier = new high_last_compary();
-                    comparier2 = new low_last_compary();
-                }
-#else
-                auto comparier = std::make_unique<low_last_compary>();
-#endif
-
-                int note_0_value = 0;
-                int note_1_value = 0;
-                int note_2_value = 0;
-                if (comparier)
-                {
-                    note_0_value = note_1_value = note_2_value = comparier->get_compare_default();
-                }
-
-                if (message_0)
-                {
-                    note_0_value = message_0->getNoteNumber();
-                }
-                if (message_1)
-                {
-                    note_1_value = message_1->getNoteNumber();
-                }
-                if (message_2)
-                {
-                    note_2_value = message_2->getNoteNumber();
-                }
-
-                if (comparier)
-                {
-                    trigger_again_note_0_was_running = tmp_note_down_store->size() > 1;
-                    trigger_again_note_1_was_running = tmp_note_down_store->size() > 2;
-                    trigger_again_note_2_was_running = tmp_note_down_store->size() > 3;
-
-                    if (comparier->compare(note_0_value, note_1_value))
-                    {
-                        if (comparier->compare(note_0_value, note_2_value))
-                        {
-                            tmp_note_down_store->swap(0, 1);
-                            tmp_note_down_store->swap(1, 2);
-
-                            trigger_again_note_0 = note_1_value;
-                            trigger_again_note_1 = note_2_value;
-                            trigger_again_note_2 = note_0_value;
-
-                            if (current_note_id == 0)
-                            {
-                                current_note_id = 2;
-                                trigger_again_note_2 = false;
-                            }
-                            else if (current_note_id == 1)
-                            {
-                                current_note_id = 0;
-                                trigger_again_note_0 = false;
-                            }
-                            else if (current_note_id == 2)
-                            {
-                                current_note_id = 1;
-                                trigger_again_note_1 = false;
-                            }
-                        }
-                        else
-                        {
-                            tmp_note_down_store->swap(0, 1);
-
-                            trigger_again_note_0 = note_1_value;
-                            trigger_again_note_1 = note_0_value;
-                            trigger_again_note_2 = note_2_value;
-
-                            if (current_note_id == 0)
-                            {
-                                current_note_id = 1;
-                                trigger_again_note_1 = false;
-                            }
-                            else if (current_note_id == 1)
-                            {
-                                current_note_id = 0;
-                                trigger_again_note_0 = false;
-                            }
-                            else if (current_note_id == 2)
-                            {
-                                current_note_id = 2;
-                                trigger_again_note_2 = false;
-                            }
-                        }
-                    }
-                    else if (comparier->compare(note_0_value, note_2_value))
-                    {
-                        if (comparier->compare(note_1_value, note_2_value))
-                        {
-                            tmp_note_down_store->swap(0, 2);
-                            tmp_note_down_store->swap(1, 2);
-
-                            trigger_again_note_0 = note_2_value;
-                            trigger_again_note_1 = note_0_value;
-                            trigger_again_note_2 = note_1_value;
-
-                            if (current_note_id == 0)
-                            {
-                                current_note_id = 1;
-                                trigger_again_note_1 = false;
-                            }
-                            else if (current_note_id == 1)
-                            {
-                                current_note_id = 2;
-                                trigger_again_note_2 = false;
-                            }
-                            else if (current_note_id == 2)
-                            {
-                                current_note_id = 0;
-                                trigger_again_note_0 = false;
-                            }
-                        }
-                        else
-                        {
-                            tmp_note_down_store->swap(0, 2);
-
-                            trigger_again_note_0 = note_2_value;
-                            trigger_again_note_1 = note_1_value;
-                            trigger_again_note_2 = note_0_value;
-
-                            if (current_note_id == 0)
-                            {
-                                current_note_id = 2;
-                                trigger_again_note_2 = false;
-                            }
-                            else if (current_note_id == 1)
-                            {
-                                current_note_id = 1;
-                                trigger_again_note_1 = false;
-                            }
-                            else if (current_note_id == 2)
-                            {
-                                current_note_id = 0;
-                                trigger_again_note_0 = false;
-                            }
-                        }
-                    }
-                    else if (comparier->compare(note_1_value, note_2_value))
-                    {
-                        tmp_note_down_store->swap(1, 2);
-
-                        trigger_again_note_0 = note_0_value;
-                        trigger_again_note_1 = note_2_value;
-                        trigger_again_note_2 = note_1_value;
-
-                        if (current_note_id == 0)
-                        {
-                            current_note_id = 0;
-                            trigger_again_note_0 = false;
-                        }
-                        else if (current_note_id == 1)
-                        {
-                            current_note_id = 2;
-                            trigger_again_note_2 = false;
-                        }
-                        else if (current_note_id == 2)
-                        {
-                            current_note_id = 1;
-                            trigger_again_note_1 = false;
-                        }
-                    }
-                    else
-                    {
-                        if (current_note_id == 0 ||
-                            (note_0_value != comparier->get_compare_default() &&
-                             note_0_value != current_note))
-                        {
-                            trigger_again_note_1 = note_1_value;
-                            trigger_again_note_2 = note_2_value;
-                        }
-                        if (current_note_id == 0)
-                            trigger_again_note_0_was_running = false;
-                        else if (current_note_id == 1)
-                            trigger_again_note_1_was_running = false;
-                        else if (current_note_id == 2)
-                            trigger_again_note_2_was_running = false;
-                    }
-
-                    if (trigger_again_note_0 == comparier->get_compare_default())
-                        trigger_again_note_0 = false;
-                    if (trigger_again_note_1 == comparier->get_compare_default())
-                        trigger_again_note_1 = false;
-                    if (trigger_again_note_2 == comparier->get_compare_default())
-                        trigger_again_note_2 = false;
-                }
-            }
-
-            // PROCESSING
-            const juce::MidiMessage *message = tmp_note_down_store->get_at(current_note_id);
-            if (message)
-            {
-                int note_number = message->getNoteNumber();
-                if (current_note_id == 0 || trigger_again_note_0 != false)
-                {
-                    const int note_to_use =
-                        trigger_again_note_0 != false ? trigger_again_note_0 : note_number;
-                    // OSC TRACKING 1 - SWAP ROOT NOTe
-                    {
-                        current_note = note_to_use;
-                    }
-#ifdef POLY
-                    // CUTOFF TRACKING 1
-                    if (synth_data->keytrack_cutoff[0])
-                    {
-                        // synth_data->filter_datas[0]->cutoff.set_value(
-                        // reverse_cutoff_to_slider_value(
-                        // synth_data->tuning->midiNoteToFrequency(note_to_use+arp_offset) ) );
-                    }
-                    if (trigger_envelopes_)
-                    {
-                        if (!trigger_again_note_0_was_running && !step_automation_is_on)
-                        {
-                            // ENV TRACKING 1
-                            if (synth_data->keytrack_filter_env[0])
-                            {
-                                filter_processors[0]->start_env();
-                            }
-                            // INPUT ENV TRACKING 1
-                            if (synth_data->keytrack_filter_inputs[0])
-                            {
-                                filter_processors[0]->start_input_env(0);
-                            }
-                            if (synth_data->keytrack_filter_inputs[3])
-                            {
-                                filter_processors[1]->start_input_env(0);
-                            }
-                            if (synth_data->keytrack_filter_inputs[6])
-                            {
-                                filter_processors[2]->start_input_env(0);
-                            }
-                            // VOLUME TRACKING 3
-                            if (synth_data->keytrack_filter_volume[0])
-                            {
-                                filter_volume_tracking_envs[0]->start_attack();
-                            }
-                        }
-                    }
-#else
-                    if (trigger_envelopes_)
-                    {
-                        if (!trigger_again_note_0_was_running && !step_automation_is_on)
-                        {
-                            filter_processors[0]->start_env();
-                            filter_processors[1]->start_env();
-                            filter_processors[2]->start_env();
-                            filter_processors[0]->start_input_env(0);
-                            filter_processors[1]->start_input_env(0);
-                            filter_processors[2]->start_input_env(0);
-                            filter_processors[0]->start_input_env(1);
-                            filter_processors[1]->start_input_env(1);
-                            filter_processors[2]->start_input_env(1);
-                            filter_processors[0]->start_input_env(2);
-                            filter_processors[1]->start_input_env(2);
-                            filter_processors[2]->start_input_env(2);
-                        }
-                    }
-#endif
-                }
-                /*else*/ if (current_note_id == 1 || trigger_again_note_1 != false)
-                {
-#ifdef POLY
-                    // OSC TRACKING 2
-                    if (synth_data->keytrack_osci[1])
-                    {
-                        const int note_to_use =
-                            trigger_again_note_1 > false ? trigger_again_note_1 : note_number;
-                        synth_data->osc_datas[1]->tune.set_value(
-                            (note_to_use + synth_data->keytrack_osci_octave_offset[1] * 12) -
-                            current_note);
-                    }
-
-                    if (trigger_envelopes_)
-                    {
-                        if ((!trigger_again_note_1_was_running && !step_automation_is_on) ||
-                            (!trigger_again_note_2_was_running && step_automation_is_on &&
-                             !synth_data->arp_sequencer_data->is_sequencer && is_human_event_))
-                        {
-                            // ENV TRACKING 2
-                            if (synth_data->keytrack_filter_env[1])
-                            {
-                                filter_processors[1]->start_env();
-                            }
-                            // VOLUME TRACKING 2
-                            if (synth_data->keytrack_filter_volume[1])
-                            {
-                                filter_volume_tracking_envs[1]->start_attack();
-                            }
-                            // INPUT ENV TRACKING 2
-                            if (synth_data->keytrack_filter_inputs[0 + 1])
-                            {
-                                filter_processors[0]->start_input_env(0 + 1);
-                            }
-                            if (synth_data->keytrack_filter_inputs[3 + 1])
-                            {
-                                filter_processors[1]->start_input_env(0 + 1);
-                            }
-                            if (synth_data->keytrack_filter_inputs[6 + 1])
-                            {
-                                filter_processors[2]->start_input_env(0 + 1);
-                            }
-                        }
-                    }
-#endif
-                }
-                /*else*/ if (current_note_id == 2 || trigger_again_note_2 != false)
-                {
-#ifdef POLY
-                    // OSC TRACKING 3
-                    if (synth_data->keytrack_osci[2])
-                    {
-                        const int note_to_use =
-                            trigger_again_note_2 > false ? trigger_again_note_2 : note_number;
-                        synth_data->osc_datas[2]->tune.set_value(
-                            (note_to_use + synth_data->keytrack_osci_octave_offset[2] * 12) -
-                            current_note);
-                    }
-
-                    if (trigger_envelopes_)
-                    {
-                        if ((!trigger_again_note_2_was_running && !step_automation_is_on) ||
-                            (!trigger_again_note_2_was_running && step_automation_is_on &&
-                             !synth_data->arp_sequencer_data->is_sequencer && is_human_event_))
-                        {
-                            // ENV TRACKING 3
-                            if (synth_data->keytrack_filter_env[2])
-                            {
-                                filter_processors[2]->start_env();
-                            }
-                            // INPUT ENV TRACKING 3
-                            if (synth_data->keytrack_filter_inputs[0 + 2])
-                            {
-                                filter_processors[0]->start_input_env(0 + 2);
-                            }
-                            if (synth_data->keytrack_filter_inputs[3 + 2])
-                            {
-                                filter_processors[1]->start_input_env(0 + 2);
-                            }
-                            if (synth_data->keytrack_filter_inputs[6 + 2])
-                            {
-                                filter_processors[2]->start_input_env(0 + 2);
-                            }
-                            // VOLUME TRACKING 3
-                            if (synth_data->keytrack_filter_volume[2])
-                            {
-                                filter_volume_tracking_envs[2]->start_attack();
-                            }
-                        }
-                    }
-#endif
-                }
-            }
-            else
-            {
-                DBG("key tracking note select bug");
-            }
-        }
-        else if (current_note_id == -2) // AUTOMATED TUNE OFFSETS
-        {
-            // TODO REPLACE LAST ONE
-        }
-    }
-
-    // WHEN TO TRIGGER THE PROCESSORS
-    if (start_up)
-    {
-        // ROOTS
-        if (trigger_envelopes_)
-        {
-            eq_processor->start_attack();
-            fx_processor->start_attack();
-        }
-
-        // NOTES
-        {
-            master_osc->update(current_note + arp_offset + pitch_offset, sample_number_);
-            second_osc->update(current_note + arp_offset + pitch_offset, sample_number_);
-            third_osc->update(current_note + arp_offset + pitch_offset, sample_number_);
-        }
-
-        // CUTOFF
-        {
-#ifdef POLY
-            if (synth_data->keytrack_cutoff[0])
-            {
-                const int note_0 =
-                    current_note + synth_data->keytrack_cutoff_octave_offset[0] * 12 + arp_offset;
-                synth_data->filter_datas[0]->cutoff.set_value(reverse_cutoff_to_slider_value(
-                    synth_data->tuning->midiNoteToFrequency(note_0)));
-            }
-            if (synth_data->keytrack_cutoff[1])
-            {
-                const int note_1 = current_note + synth_data->osc_datas[1]->tune +
-                                   synth_data->keytrack_cutoff_octave_offset[1] * 12 + arp_offset;
-                synth_data->filter_datas[1]->cutoff.set_value(reverse_cutoff_to_slider_value(
-                    synth_data->tuning->midiNoteToFrequency(note_1)));
-            }
-            if (synth_data->keytrack_cutoff[2])
-            {
-                const int note_2 = current_note + synth_data->osc_datas[2]->tune +
-                                   synth_data->keytrack_cutoff_octave_offset[2] * 12 + arp_offset;
-                synth_data->filter_datas[2]->cutoff.set_value(reverse_cutoff_to_slider_value(
-                    synth_data->tuning->midiNoteToFrequency(note_2)));
-            }
-#endif
-        }
-        // todo trigger if key down - like you ask is_key_x_down
-        // ENVELOPES
-#ifdef POLY
-        for (int i = 0; i != SUM_FILTERS; ++i)
-        {
-            const bool trigger =
-                trigger_envelopes_ &&
-                ((step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer) ||
-                 (step_automation_is_on && !synth_data->arp_sequencer_data->is_sequencer &&
-                  keys_down > i));
-
-            // FILTER ENV TRACKING
-            if (!synth_data->keytrack_filter_env[i] || trigger)
-            {
-                filter_processors[i]->start_env();
-            }
-            // FILTER INPUT ENV TRACKING
-            if (!synth_data->keytrack_filter_inputs[i * SUM_OSCS + 0] || trigger)
-            {
-                filter_processors[i]->start_input_env(0);
-            }
-            if (!synth_data->keytrack_filter_inputs[i * SUM_OSCS + 1] || trigger)
-            {
-                filter_processors[i]->start_input_env(1);
-            }
-            if (!synth_data->keytrack_filter_inputs[i * SUM_OSCS + 2] || trigger)
-            {
-                filter_processors[i]->start_input_env(2);
-            }
-            // FILTER OUT TRACKING
-            if (!synth_data->keytrack_filter_volume[i] || trigger)
-            {
-                filter_volume_tracking_envs[i]->start_attack();
-            }
-        }
-#else
-        const bool trigger =
-            trigger_envelopes_ &&
-            ((step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer) ||
-             (step_automation_is_on && !synth_data->arp_sequencer_data->is_sequencer && keys_down));
-        for (int i = 0; i != SUM_FILTERS; ++i)
-        {
-            // FILTER ENV TRACKING
-            if (trigger)
-            {
-                filter_processors[i]->start_env();
-            }
-            // FILTER INPUT ENV TRACKING
-            if (trigger)
-            {
-                filter_processors[i]->start_input_env(0);
-            }
-            if (trigger)
-            {
-                filter_processors[i]->start_input_env(1);
-            }
-            if (trigger)
-            {
-                filter_processors[i]->start_input_env(2);
-            }
-        }
-#endif
-
-        // KEY SYNC
-        if (synth_data->osc_datas[MASTER_OSC]->sync && trigger_envelopes_)
-        {
-            master_osc->reset();
-            second_osc->reset();
-            third_osc->reset();
-        }
-    }
-}
-
-void MoniqueSynthesiserVoice::stop_arp_controlled(bool force)
-{
-    MoniqueSynthesizer::NoteDownStore *tmp_note_down_store =
-        reinterpret_cast<MoniqueSynthesizer::NoteDownStore *>(note_down_store);
-    const bool step_automation_is_on =
-        synth_data->arp_sequencer_data->is_on &&
-        (!synth_data->keep_arp_always_off || synth_data->keep_arp_always_on);
-    const int keys_down = tmp_note_down_store->size();
-#ifdef POLY
-    for (int i = 0; i != SUM_FILTERS; ++i)
-    {
-        // FILTER ENV TRACKING
-        if (!synth_data->keytrack_filter_env[i] || (step_automation_is_on && keys_down > i) ||
-            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
-        {
-            filter_processors[i]->start_env_release();
-        }
-        // FILTER INPUT TRACKING
-        if (!synth_data->keytrack_filter_inputs[0 * SUM_OSCS + i] ||
-            (step_automation_is_on && keys_down > i) ||
-            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
-        {
-            filter_processors[0]->start_input_env_release(i);
-        }
-        if (!synth_data->keytrack_filter_inputs[1 * SUM_OSCS + i] ||
-            (step_automation_is_on && keys_down > i) ||
-            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
-        {
-            filter_processors[1]->start_input_env_release(i);
-        }
-        if (!synth_data->keytrack_filter_inputs[2 * SUM_OSCS + i] ||
-            (step_automation_is_on && keys_down > i) ||
-            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
-        {
-            filter_processors[2]->start_input_env_release(i);
-        }
-        // FILTER OUT TRACKING
-        if (!synth_data->keytrack_filter_volume[i] || (step_automation_is_on && keys_down > i) ||
-            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
-        {
-            filter_volume_tracking_envs[i]->set_to_release();
-        }
-    }
-    eq_processor->start_release();
-    fx_processor->start_release(false, false);
-#else
-    for (int i = 0; i != SUM_FILTERS; ++i)
-    {
-        // FILTER ENV TRACKING
-        if (force ||
-            (step_automation_is_on && keys_down == 0 && synth_data->arp_sequencer_data->connect) ||
-            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
-        {
-            filter_processors[i]->start_env_release();
-        }
-        // FILTER INPUT TRACKING
-        if (force ||
-            (step_automation_is_on && keys_down == 0 && synth_data->arp_sequencer_data->connect) ||
-            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
-        {
-            filter_processors[0]->start_input_env_release(i);
-        }
-        if (force ||
-            (step_automation_is_on && keys_down == 0 && synth_data->arp_sequencer_data->connect) ||
-            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
-        {
-            filter_processors[1]->start_input_env_release(i);
-        }
-        if (force ||
-            (step_automation_is_on && keys_down == 0 && synth_data->arp_sequencer_data->connect) ||
-            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
-        {
-            filter_processors[2]->start_input_env_release(i);
-        }
-    }
-    if (force ||
-        (step_automation_is_on && keys_down == 0 && synth_data->arp_sequencer_data->connect) ||
-        (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
-    {
-        eq_processor->start_release();
-        fx_processor->start_release(false, false);
-    }
-#endif
-}
-void MoniqueSynthesiserVoice::stop_controlled(const juce::MidiMessage &m_, int sample_pos_)
-{
-    MoniqueSynthesizer::NoteDownStore *tmp_note_down_store =
-        reinterpret_cast<MoniqueSynthesizer::NoteDownStore *>(note_down_store);
-    const int note_id = tmp_note_down_store->get_id(m_.getNoteNumber());
-    const bool step_automation_is_on =
-        synth_data->arp_sequencer_data->is_on &&
-        (!synth_data->keep_arp_always_off || synth_data->keep_arp_always_on);
-    const int keys_down = tmp_note_down_store->size();
-
-    // PARTIAL STOP
-    if (note_id >= 0 && note_id <= 2)
-    {
-        for (int i = 0; i != 3; ++i)
-        {
-#ifdef POLY
-            if (note_id == i)
-            {
-                // FILTER ENV TRACKING
-                if (synth_data->keytrack_filter_env[i])
-                {
-                    filter_processors[i]->start_env_release();
-                }
-                // FILTER INPUT TRACKING
-                if (synth_data->keytrack_filter_inputs[0 * SUM_OSCS + i])
-                {
-                    filter_processors[0]->start_input_env_release(i);
-                }
-                if (synth_data->keytrack_filter_inputs[1 * SUM_OSCS + i])
-                {
-                    filter_processors[1]->start_input_env_release(i);
-                }
-                if (synth_data->keytrack_filter_inputs[2 * SUM_OSCS + i])
-                {
-                    filter_processors[2]->start_input_env_release(i);
-                }
-                // FILTER OUT TRACKING
-                if (synth_data->keytrack_filter_volume[i])
-                {
-                    filter_volume_tracking_envs[i]->set_to_release();
-                }
-            }
-#endif
-        }
-    }
-    // REMOVE NOTe AND RESTART IF REQUIRED
-    if (tmp_note_down_store->size())
-    {
-#ifdef POLY
-        const int reorder_allowed = synth_data->keytrack_osci[0] + synth_data->keytrack_osci[1] +
-                                    synth_data->keytrack_osci[2];
-        const int play_mode =
-            synth_data->keytrack_osci_play_mode == 2 ? PLAY_MODES::FIFO : PLAY_MODES::LIFO;
-#else
-        const int reorder_allowed = 0;
-        const int play_mode = PLAY_MODES::LIFO;
-#endif
-        if (const juce::MidiMessage *replacement =
-                tmp_note_down_store->remove_note(m_, play_mode, reorder_allowed))
-        {
-            start_internal(replacement->getNoteNumber(), replacement->getFloatVelocity(),
-                           sample_pos_, true, false, true);
-        }
-        // RESTART LAST
-        else if (tmp_note_down_store->get_last() && !reorder_allowed)
-        {
-            const juce::MidiMessage *message = tmp_note_down_store->get_last();
-            start_internal(message->getNoteNumber(), message->getFloatVelocity(), sample_pos_, true,
-                           false, true);
-        }
-        // FULL STOP
-        else if (!tmp_note_down_store->size())
-        {
-            eq_processor->start_release();
-            fx_processor->start_release(false, false);
-
-            for (int i = 0; i != 3; ++i)
-            {
-                filter_processors[i]->start_env_release();
-                filter_processors[i]->start_input_env_release(0);
-                filter_processors[i]->start_input_env_release(1);
-                filter_processors[i]->start_input_env_release(2);
-#ifdef POLY
-                filter_volume_tracking_envs[i]->set_to_release();
-#endif
-            }
-        }
-
-        if (not(synth_data->arp_sequencer_data->is_sequencer &&
-                synth_data->arp_sequencer_data->is_on &&
-                (!synth_data->keep_arp_always_off || synth_data->keep_arp_always_on)) &&
-            tmp_note_down_store->size() == 0)
-        {
-            current_note = -1;
-        }
-    }
-}
-
-void MoniqueSynthesiserVoice::stopNote(float note_number_, bool allowTailOff) {}
-void MoniqueSynthesiserVoice::stop_internal() noexcept
-{
-    stopped_and_sostenuto_pedal_was_down = is_sostenuto_pedal_down;
-    stopped_and_sustain_pedal_was_down = is_sustain_pedal_down;
-
-    if (!is_sostenuto_pedal_down)
-    {
-        eq_processor->start_release();
-        for (int voice_id = 0; voice_id != SUM_FILTERS; ++voice_id)
-        {
-            filter_processors[voice_id]->start_release();
-        }
-    }
-    fx_processor->start_release(is_sustain_pedal_down, is_sostenuto_pedal_down);
-}
-
-//==============================================================================
-void MoniqueSynthesiserVoice::release_if_inactive() noexcept
-{
-    bool is_arp_on = synth_data->arp_sequencer_data->is_on || synth_data->keep_arp_always_on;
-    if (synth_data->keep_arp_always_off)
-    {
-        is_arp_on = false;
-    }
-
-    if (fx_processor->final_env->get_current_stage() == END_ENV &&
-        !synth_data->audio_processor->amp_painter)
-    {
-        bool has_steps_enabled = false;
-        for (int i = 0; i != SUM_ENV_ARP_STEPS; ++i)
-        {
-            if (synth_data->arp_sequencer_data->step[i])
-            {
-                has_steps_enabled = true;
-                break;
-            }
-        }
-        if ((is_arp_on && !has_steps_enabled) || !is_arp_on)
-        {
-            if (fx_processor->zero_samples_counter > fx_processor->delay.get_max_duration() + 10)
-            {
-                current_note = -1;
-                clearCurrentNote();
-            }
-        }
-    }
-    else
-    {
-        fx_processor->zero_samples_counter = 0;
-    }
-}
-
-//==============================================================================
-void MoniqueSynthesiserVoice::renderNextBlock(juce::AudioSampleBuffer &output_buffer_,
-                                              int start_sample_, int num_samples_)
-{
-    // GET POSITION INFOS
-    if (is_standalone())
-    {
-        if (synth_data->sync)
-        {
-            if (info->standalone_features_pimpl->is_extern_synced)
-            {
-                info->bpm = audio_processor->get_current_pos_info().bpm;
-            }
-            else
-            {
-                info->bpm = synth_data->speed;
-            }
-        }
-        else
-        {
-            info->standalone_features_pimpl->is_extern_synced = false;
-            info->bpm = synth_data->speed;
-        }
-    }
-    else
-    {
-        if (synth_data->sync)
-        {
-            info->bpm = audio_processor->get_current_pos_info().bpm;
-        }
-        else
-        {
-            info->bpm = synth_data->speed;
-        }
-    }
-
-    info->samples_since_start = audio_processor->get_current_pos_info().timeInSamples;
-    if (audio_processor->get_current_pos_info().isPlaying)
-    {
-        info->relative_samples_since_start = info->samples_since_start;
-    }
-
-    int count_start_sample = start_sample_;
-    int counted_samples = num_samples_;
-    bool is_a_step = false;
-    const bool connect = synth_data->arp_sequencer_data->connect;
-    bool is_arp_on = synth_data->arp_sequencer_data->is_on ||
-                     (synth_data->keep_arp_always_on && !synth_data->keep_arp_always_off);
-    if (synth_data->keep_arp_always_off)
-    {
-        is_arp_on = false;
-    }
-    while (counted_samples > 0)
-    {
-        // SEARCH FOR STEPS (16ths) IN THE CURRENT BUFFER RANGE
-        int samples_to_next_arp_step_in_this_buffer =
-            arp_sequencer->process_samples_to_next_step(count_start_sample, counted_samples);
-        counted_samples -= samples_to_next_arp_step_in_this_buffer;
-
-        // RENDER THE NEXT BLOCK
-        int step_id = arp_sequencer->get_current_step();
-
-        // FORCE AN ARP RESTART
-        if (sample_position_for_restart_arp > -1)
-        {
-            if (step_id == 0)
-            {
-                start_internal(current_note, current_velocity, counted_samples + start_sample_,
-                               false);
-                an_arp_note_is_already_running = true;
-                sample_position_for_restart_arp = -1;
-            }
-        }
-        else if (is_arp_on && current_note == -1)
-        {
-            // current_note = arp_info.current_note != -1 ? arp_info.current_note :
-            // 60+synth_data->note_offset.get_value()-24; current_velocity =
-            // arp_info.current_velocity != 0 ? arp_info.current_velocity : 1;
-
-            // AUTO START
-            {
-                // current_note = 60+synth_data->note_offset.get_value()-24;
-                // current_velocity = 1;
-            }
-        }
-
-        // HANDLE RETIGGERS
-        is_a_step = arp_sequencer->found_last_process_a_step();
-        bool is_step_enabled = arp_sequencer->last_found_step_is_enabled();
-        if (is_a_step && an_arp_note_is_already_running &&
-            (!connect || !is_arp_on || !is_step_enabled))
-        {
-            stop_arp_controlled();
-            an_arp_note_is_already_running = false;
-        }
-
-        const bool is_a_new_arp_step_to_start = (is_arp_on && is_a_step && is_step_enabled);
-        if (is_a_new_arp_step_to_start)
-        {
-            current_running_arp_step = step_id;
-            start_internal(current_note, current_velocity, counted_samples + start_sample_, false);
-            an_arp_note_is_already_running = true;
-        }
-
-        if (samples_to_next_arp_step_in_this_buffer > 0)
-        {
-            render_block(output_buffer_, is_a_step ? step_id : -1,
-                         arp_sequencer->get_current_absolute_step(), count_start_sample,
-                         samples_to_next_arp_step_in_this_buffer);
-        }
-        count_start_sample += samples_to_next_arp_step_in_this_buffer;
-    }
-
-    // FREE IT
-    release_if_inactive();
-
-    if (!audio_processor->get_current_pos_info().isPlaying)
-    {
-        info->relative_samples_since_start += num_samples_;
-    }
-}
-
-inline void SmoothManager::smooth_and_morph(bool force_by_load_, bool is_automated_morph_,
-                                            const float *morph_power_buffer_, int num_samples_,
-                                            int smooth_motor_time_in_ms_,
-                                            int morph_motor_time_in_ms_,
-                                            MorphGroup *morph_group_) noexcept
-{
-    // PROCESS THE MORPH
-    for (int i = 0; i != smoothers.size(); ++i)
-    {
-        SmoothedParameter *param = smoothers.getUnchecked(i);
-        const int index = morph_group_->indexOf(param->param_to_smooth);
-        if (index != -1)
-        {
-            if (param->param_to_smooth->get_runtime_info().smoothing_is_enabled)
-            {
-                const Parameter *left_param = morph_group_->get_left_param(index);
-                const Parameter *right_param = morph_group_->get_right_param(index);
-                param->smooth_and_morph(force_by_load_, is_automated_morph_,
-                                        smooth_motor_time_in_ms_, morph_motor_time_in_ms_,
-                                        morph_power_buffer_, morph_group_->last_power_of_right,
-                                        left_param, right_param, num_samples_);
-            }
-        }
-    }
-}
-
-#ifdef JUCE_DEBUG
-#define DEBUG_CHECK_MIN_MAX(x)                                                                     \
-    if (x > max_value)                                                                             \
-    {                                                                                              \
-        std::cout << "x to large: " << x << " max: " << max_value << std::endl;                    \
-    }                                                                                              \
-    else if (x < min_value)                                                                        \
-    {                                                                                              \
-        std::cout << "x to small: " << x << " max: " << min_value << std::endl;                    \
-    }
-#else
-#define DEBUG_CHECK_MIN_MAX(x)
-#endif
-
-// TOOPT
-#define FORCE_MIN_MAX(x) juce::jmax(juce::jmin(x, max_value), min_value)
-
-void SmoothedParameter::simple_smooth(int smooth_motor_time_in_ms_, int num_samples_) noexcept
-{
-    simple_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-    simple_smoother.set_value(param_to_smooth->get_value());
-    float *const target = values.getWritePointer();
-    if (!simple_smoother.is_up_to_date())
-    {
-
-        for (int sid = 0; sid != num_samples_; ++sid)
-        {
-            target[sid] = FORCE_MIN_MAX(simple_smoother.tick());
-        }
-
-        simple_smoother.set_info_flag(false);
-    }
-    else
-    {
-        if (!simple_smoother.get_info_flag())
-        {
-            juce::FloatVectorOperations::fill(target, simple_smoother.get_last_value(), block_size);
-
-            simple_smoother.set_info_flag(true);
-        }
-    }
-
-    param_to_smooth->get_runtime_info().set_last_value_state(target[num_samples_ - 1]);
-}
-// TOOPD FloatVectorOperations
-void SmoothedParameter::smooth_and_morph(bool force_by_load_, bool is_automated_morph_,
-                                         int smooth_motor_time_in_ms_, int morph_motor_time_in_ms_,
-                                         const float *morph_amp_buffer_, float morph_slider_state_,
-                                         const Parameter *left_source_param_,
-                                         const Parameter *right_source_param_,
-                                         int num_samples_) noexcept
-{
-    left_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-    right_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-    morph_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-
-    left_modulation_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-    right_modulation_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-
-    // LOOKING FORWART TO PROCESS MODUALATION AND AMP MODUALATION
-    modulation_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-    amp_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-
-    if (force_by_load_)
-    {
-        morph_power_smoother.set_value(morph_power_smoother.get_last_value());
-        // right_morph_smoother.reset( sample_rate, smooth_motor_time_in_ms_ );
-        // left_morph_smoother.reset( sample_rate, smooth_motor_time_in_ms_ );
-    }
-
-    const bool is_modulateable = has_modulation(param_to_smooth);
-    float *const target = values.getWritePointer();
-    if (!is_modulateable)
-    {
-        left_morph_smoother.set_value(left_source_param_->get_value());
-        right_morph_smoother.set_value(right_source_param_->get_value());
-
-        // AUTOMATED MORPH
-        if (is_automated_morph_)
-        {
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                const float power_of_right_ =
-                    morph_power_smoother.glide_tick(morph_amp_buffer_[sid]);
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right_) +
-                                            right_morph_smoother.tick() * power_of_right_);
-            }
-        }
-        // USER MORPH
-        else
-        {
-            morph_power_smoother.set_value(morph_slider_state_);
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                const float power_of_right = morph_power_smoother.tick();
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right) +
-                                            right_morph_smoother.tick() * power_of_right);
-            }
-
-            // KEEP UP TO DATE FOR A SWITCH
-            morph_power_smoother.reset_glide_countdown();
-        }
-    }
-    // ITS A COPY OF THE PROCESS ABOVE BUT WITH MODULATION
-    else
-    {
-        left_morph_smoother.set_value(left_source_param_->get_value());
-        right_morph_smoother.set_value(right_source_param_->get_value());
-
-        left_modulation_morph_smoother.set_value(left_source_param_->get_modulation_amount());
-        right_modulation_morph_smoother.set_value(right_source_param_->get_modulation_amount());
-
-        // AUTOMATED MORPH
-        float *const target_modulation = modulation_power.getWritePointer();
-        if (is_automated_morph_)
-        {
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                const float power_of_right_ =
-                    morph_power_smoother.glide_tick(morph_amp_buffer_[sid]);
-
-                // VALUE
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right_) +
-                                            right_morph_smoother.tick() * power_of_right_);
-                // MODULATION
-                target_modulation[sid] =
-                    left_modulation_morph_smoother.tick() * (1.0f - power_of_right_) +
-                    right_modulation_morph_smoother.tick() * power_of_right_;
-            }
-        }
-        // USER MORPH
-        else
-        {
-            morph_power_smoother.set_value(morph_slider_state_);
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                const float power_of_right = morph_power_smoother.tick();
-                // VALUE BLOCK
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right) +
-                                            right_morph_smoother.tick() * power_of_right);
-                // MODULATION BLOCK
-                target_modulation[sid] =
-                    left_modulation_morph_smoother.tick() * (1.0f - power_of_right) +
-                    right_modulation_morph_smoother.tick() * power_of_right;
-            }
-
-            // KEEP UP TO DATE FOR A SWITCH
-            morph_power_smoother.reset_glide_countdown();
-        }
-        param_to_smooth->get_runtime_info().set_last_modulation_state(
-            target_modulation[num_samples_ - 1]);
-    }
-
-    param_to_smooth->get_runtime_info().set_last_value_state(target[num_samples_ - 1]);
-}
-// TOOPD FloatVectorOperations
-inline void SmoothedParameter::process_modulation(const bool is_modulated_,
-                                                  const float *modulator_power_buffer_,
-                                                  int num_samples_) noexcept
-{
-    // modulation_power_smoother.reset_coefficients( sample_rate, glide_motor_time_in_ms_ ); <---
-    // NOTE: DONE BY SMOOTH_AND_MORPH
-
-    float *const source_and_target = values.getWritePointer();
-    const float *const modulation = modulation_power.getReadPointer();
-    if (is_modulated_)
-    {
-        float current_modulation_power;
-        for (int sid = 0; sid != num_samples_; ++sid)
-        {
-            current_modulation_power = modulation[sid] * modulation_power_smoother.glide_tick(
-                                                             modulator_power_buffer_[sid]);
-            const float in = source_and_target[sid];
-            if (current_modulation_power > 0)
-            {
-                source_and_target[sid] = in + (max_value - in) * current_modulation_power;
-                DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
-            }
-            else
-            {
-                source_and_target[sid] = in + (in - min_value) * current_modulation_power;
-                DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
-            }
-        }
-
-        param_to_smooth->get_runtime_info().set_last_modulation_amount(current_modulation_power);
-    }
-    else
-    {
-        modulation_power_smoother.set_value(0);
-        float current_modulation_power = 0;
-
-        if (!modulation_power_smoother.is_up_to_date())
-        {
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                current_modulation_power = modulation[sid] * modulation_power_smoother.tick();
-                const float in = source_and_target[sid];
-                if (current_modulation_power < 0)
-                {
-                    source_and_target[sid] = in + (in - min_value) * current_modulation_power;
-                    DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
-                }
-                else
-                {
-                    source_and_target[sid] = in + (max_value - in) * current_modulation_power;
-                    DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
-                }
-            }
-        }
-
-        param_to_smooth->get_runtime_info().set_last_modulation_amount(current_modulation_power);
-
-        // KEEP UP TO DATE FOR A SWITCH
-        modulation_power_smoother.reset_glide_countdown();
-    }
-}
-// TOOPD FloatVectorOperations
-void SmoothedParameter::process_amp(bool use_env_, int glide_time_in_ms_, ENV *env_,
-                                    float *amp_buffer_, int num_samples_) noexcept
-{
-    const float *source = values.getReadPointer();
-    if (use_env_)
-    {
-        env_->process(amp_buffer_, num_samples_);
-
-        for (int sid = 0; sid != num_samples_; ++sid)
-        {
-            const float current_amp_power = amp_power_smoother.glide_tick(amp_buffer_[sid]);
-            amp_buffer_[sid] = source[sid] * current_amp_power;
-            DEBUG_CHECK_MIN_MAX(amp_buffer_[sid]);
-        }
-
-        param_to_smooth->get_runtime_info().set_last_modulation_amount(
-            amp_buffer_[num_samples_ - 1]);
-
-        amp_power_smoother.set_info_flag(false);
-    }
-    else
-    {
-        if (!amp_power_smoother.get_info_flag())
-        {
-            amp_power_smoother.set_value(1);
-            amp_power_smoother.set_info_flag(true);
-        }
-        if (!amp_power_smoother.is_up_to_date())
-        {
-            env_->process(amp_buffer_, num_samples_);
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                amp_buffer_[sid] = source[sid] * amp_power_smoother.tick();
-                DEBUG_CHECK_MIN_MAX(amp_buffer_[sid]);
-            }
-        }
-        else
-        {
-            juce::FloatVectorOperations::copy(amp_buffer_, source, num_samples_);
-
-            // RESET ENVELOP TO BE UP TO DATE ON A SWITCH
-            env_->overwrite_current_value(amp_buffer_[num_samples_ - 1]);
-        }
-
-        param_to_smooth->get_runtime_info().set_last_modulation_amount(
-            amp_buffer_[num_samples_ - 1]);
-
-        // KEEP UP TO DATE FOR A SWITCH
-        amp_power_smoother.reset_glide_countdown();
-    }
-}
-void MoniqueSynthesiserVoice::render_block(juce::AudioSampleBuffer &output_buffer_,
-                                           int step_number_, int absolute_step_number_,
-                                           int start_sample_, int num_samples_) noexcept
-{
-    const bool render_anything = current_note != -1 || synth_data->audio_processor->amp_painter;
-
-    const int num_samples = num_samples_;
-    if (num_samples == 0)
-    {
-        return;
-    }
-
-    if (step_number_ != -1)
-    {
-        current_step = step_number_;
-    }
-
-    if (Monique_Ui_AmpPainter *amp_painter = synth_data->audio_processor->amp_painter)
-    {
-        amp_painter->calc_new_cycle();
-    }
-
-    // CHECK POSSIBLE BYPASS
-    bool must_process = !bypass_smoother.is_up_to_date() || render_anything;
-    if (!must_process)
-    {
-        must_process =
-            fx_processor->zero_samples_counter < fx_processor->delay.get_max_duration() + 10;
-    }
-    if (!must_process)
-    {
-        must_process = fx_processor->final_env->get_current_stage() != END_ENV;
-    }
-    if (must_process)
-    {
-        const int glide_motor_time = synth_data->glide_motor_time;
-        const int morph_motor_time = synth_data->morph_motor_time;
-
-        // WORKAROUND TO UPDATE THE MORPH GROUPS
-        const bool force_by_load = synth_data->force_morph_update__load_flag;
-        synth_data->force_morph_update__load_flag = false;
-        /*
-        if( synth_data->force_morph_update__load_flag )
-               {
-                   synth_data->force_morph_update__load_flag = false;
-                   synth_data->morhp_states[0].notify_value_listeners();
-                   synth_data->morhp_states[1].notify_value_listeners();
-                   synth_data->morhp_states[2].notify_value_listeners();
-                   synth_data->morhp_states[3].notify_value_listeners();
-                   synth_data->morhp_switch_states[0].notify_value_listeners();
-                   synth_data->morhp_switch_states[1].notify_value_listeners();
-                   synth_data->morhp_switch_states[2].notify_value_listeners();
-                   synth_data->morhp_switch_states[3].notify_value_listeners();
-               }
-               */
-        synth_data->delay_record_release_smoother.simple_smooth(glide_motor_time, num_samples);
-#ifdef POLY
-        if (synth_data->keytrack_filter_volume[0])
-            filter_volume_tracking_envs[0]->process(
-                synth_data->data_buffer->filter_env_tracking.getWritePointer(0), num_samples);
-        else
-            filter_volume_tracking_envs[0]->reset();
-        if (synth_data->keytrack_filter_volume[1])
-            filter_volume_tracking_envs[1]->process(
-                synth_data->data_buffer->filter_env_tracking.getWritePointer(1), num_samples);
-        else
-            filter_volume_tracking_envs[1]->reset();
-        if (synth_data->keytrack_filter_volume[2])
-            filter_volume_tracking_envs[2]->process(
-                synth_data->data_buffer->filter_env_tracking.getWritePointer(2), num_samples);
-        else
-            filter_volume_tracking_envs[2]->reset();
-#endif
-        {
-            struct SmoothExecuter
-            {
-                float *const mfo_buffer;
-                float *const lfo_buffer;
-
-                LFO *const mfo;
-                LFO *const lfo;
-                MasterOSC *const master_osc;
-                SecondOSC *const second_osc;
-                ENV *const filter_env;
-                float *const filter_env_buffer;
-
-                MoniqueSynthesiserVoice *const voice;
-                SmoothManager *const smooth_manager;
-                MorphGroup *const morph_group;
-                LFOData *const mfo_data;
-                MoniqueSynthData *const synth_data;
-                const bool is_modulated;
-
-                const int step_number;
-                const int absolute_step_number;
-                const int start_sample;
-                const int num_samples;
-
-                const int glide_motor_time;
-                const int morph_motor_time;
-
-                const bool force_by_load;
-
-                void exec() noexcept
-                {
-                    mfo_data->wave_smoother.simple_smooth(glide_motor_time, num_samples);
-                    mfo_data->phase_shift_smoother.simple_smooth(glide_motor_time, num_samples);
-
-                    mfo->process(mfo_buffer, step_number, absolute_step_number, start_sample,
-                                 num_samples);
-                    synth_data->smooth_manager->smooth_and_morph(
-                        force_by_load, is_modulated, mfo_buffer, num_samples, glide_motor_time,
-                        morph_motor_time, morph_group);
-
-                    if (lfo)
-                    {
-                        lfo->process(lfo_buffer, step_number, absolute_step_number, start_sample,
-                                     num_samples);
-                    }
-                    if (master_osc)
-                    {
-                        master_osc->process(synth_data->data_buffer, num_samples); // NEED LFO 0
-                    }
-                    if (second_osc)
-                    {
-                        second_osc->process(synth_data->data_buffer, num_samples); // NEED LFO 0
-                    }
-                    if (filter_env)
-                    {
-                        filter_env->process(filter_env_buffer, num_samples); // NEED LFO 0
-                    }
-                }
-
-                SmoothExecuter(MoniqueSynthesiserVoice *const voice_, float *const mfo_buffer_,
-                               float *const lfo_buffer_,
-
-                               LFO *const mfo_, LFO *const lfo_, MasterOSC *const master_osc_,
-                               SecondOSC *const second_osc_, ENV *const filter_env_,
-                               float *const filter_env_buffer_,
-
-                               MorphGroup *const morph_group_, LFOData *const mfo_data_,
-                               MoniqueSynthData *const synth_data_, const bool is_modulated_,
-
-                               int step_number_, int absolute_step_number_, int start_sample_,
-                               int num_samples_,
-
-                               int glide_motor_time_, int morph_motor_time_,
-
-                               bool force_by_load_
-
-                               ) noexcept
-                    : mfo_buffer(mfo_buffer_), lfo_buffer(lfo_buffer_),
-
-                      mfo(mfo_), lfo(lfo_), master_osc(master_osc_), second_osc(second_osc_),
-                      filter_env(filter_env_), filter_env_buffer(filter_env_buffer_),
-
-                      voice(voice_), smooth_manager(synth_data_->smooth_manager),
-                      morph_group(morph_group_), mfo_data(mfo_data_), synth_data(synth_data_),
-
-                      is_modulated(is_modulated_),
-
-                      step_number(step_number_), absolute_step_number(absolute_step_number_),
-                      start_sample(start_sample_), num_samples(num_samples_),
-
-                      glide_motor_time(glide_motor_time_), morph_motor_time(morph_motor_time_),
-
-                      force_by_load(force_by_load_)
-                {
-                }
-                ~SmoothExecuter() noexcept {}
-            };
-
-            // MASTER THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(0),
-                           data_buffer->lfo_amplitudes.getWritePointer(0),
-
-                           mfos[0], lfos[0], master_osc, nullptr,
-
-                           filter_processors[0]->env.get(), // FIRST WILL BE DONE BY THE LAST THREAD
-                           data_buffer->filter_env_amps.getWritePointer(0),
-
-                           synth_data->morph_group_1.get(), synth_data->mfo_datas[0], synth_data,
-
-                           synth_data->is_morph_modulated[0],
-
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
-
-                           glide_motor_time, morph_motor_time,
-
-                           force_by_load)
-                .exec();
-
-            // OPTIONAL THREAD WITH FILTER 1
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(1),
-                           data_buffer->lfo_amplitudes.getWritePointer(1),
-
-                           mfos[1], lfos[1], nullptr,
-                           second_osc, // NEED OSC
-
-                           filter_processors[1]->env.get(), // FIRST WILL BE DONE BY THE LAST THREAD
-                           data_buffer->filter_env_amps.getWritePointer(1),
-
-                           synth_data->morph_group_2.get(), synth_data->mfo_datas[1], synth_data,
-
-                           synth_data->is_morph_modulated[1],
-
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
-
-                           glide_motor_time, morph_motor_time,
-
-                           force_by_load)
-                .exec();
-
-            // OPTIONAL THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(2),
-                           data_buffer->lfo_amplitudes.getWritePointer(2),
-
-                           mfos[2], lfos[2], nullptr,
-                           third_osc, // NEED OSC 0
-
-                           filter_processors[2]->env.get(),
-                           data_buffer->filter_env_amps.getWritePointer(2),
-
-                           synth_data->morph_group_3.get(), synth_data->mfo_datas[2], synth_data,
-
-                           synth_data->is_morph_modulated[2],
-
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
-
-                           glide_motor_time, morph_motor_time,
-
-                           force_by_load)
-                .exec();
-
-            // MASTER THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(3), nullptr,
-
-                           mfos[3], nullptr, nullptr, nullptr,
-
-                           nullptr, nullptr,
-
-                           synth_data->morph_group_4.get(), synth_data->mfo_datas[3], synth_data,
-
-                           synth_data->is_morph_modulated[3],
-
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
-
-                           glide_motor_time, morph_motor_time,
-
-                           force_by_load)
-                .exec();
-
-            // WITH THREADING INSIDE
-            filter_processors[0]->process(num_samples);
-            filter_processors[1]->process(num_samples);
-            filter_processors[2]->process(num_samples);
-
-            eq_processor->process(num_samples);
-        }
-
-        float velocity_to_use = current_velocity;
-        bool is_arp_on = synth_data->arp_sequencer_data->is_on || synth_data->keep_arp_always_on;
-        if (synth_data->keep_arp_always_off)
-        {
-            is_arp_on = false;
-        }
-        float *const velocity_buffer = data_buffer->velocity_buffer.getWritePointer();
-        if (is_arp_on)
-        {
-            const float *const smoothed_arp_step_velocity =
-                synth_data->arp_sequencer_data->velocity_smoothers[current_running_arp_step]
-                    ->get_smoothed_value_buffer();
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                velocity_buffer[sid] = velocity_to_use * smoothed_arp_step_velocity[sid];
-            }
-        }
-        else
-        {
-            juce::FloatVectorOperations::fill(velocity_buffer, velocity_to_use, num_samples_);
-        }
-
-        fx_processor->process(output_buffer_, velocity_buffer, start_sample_, num_samples_);
-
-        bypass_smoother.set_info_flag(false);
-    }
-    else
-    {
-        const int glide_motor_time = synth_data->glide_motor_time;
-        const int morph_motor_time = synth_data->morph_motor_time;
-
-        // WORKAROUND TO UPDATE THE MORPH GROUPS
-        const bool force_by_load = synth_data->force_morph_update__load_flag;
-        synth_data->force_morph_update__load_flag = false;
-        /*
-        if( synth_data->force_morph_update__load_flag )
-               {
-                   synth_data->force_morph_update__load_flag = false;
-                   synth_data->morhp_states[0].notify_value_listeners();
-                   synth_data->morhp_states[1].notify_value_listeners();
-                   synth_data->morhp_states[2].notify_value_listeners();
-                   synth_data->morhp_states[3].notify_value_listeners();
-                   synth_data->morhp_switch_states[0].notify_value_listeners();
-                   synth_data->morhp_switch_states[1].notify_value_listeners();
-                   synth_data->morhp_switch_states[2].notify_value_listeners();
-                   synth_data->morhp_switch_states[3].notify_value_listeners();
-               }
-               */
-
-        synth_data->delay_record_release_smoother.simple_smooth(glide_motor_time, num_samples);
-
-        {
-            struct SmoothExecuter
-            {
-                float *const mfo_buffer;
-                float *const lfo_buffer;
-
-                LFO *const mfo;
-                LFO *const lfo;
-                MasterOSC *const master_osc;
-                SecondOSC *const second_osc;
-                ENV *const filter_env;
-                float *const filter_env_buffer;
-
-                MoniqueSynthesiserVoice *const voice;
-                SmoothManager *const smooth_manager;
-                MorphGroup *const morph_group;
-                LFOData *const mfo_data;
-                MoniqueSynthData *const synth_data;
-                const bool is_modulated;
-
-                const int step_number;
-                const int absolute_step_number;
-                const int start_sample;
-                const int num_samples;
-
-                const int glide_motor_time;
-                const int morph_motor_time;
-
-                const bool force_by_load;
-
-                void exec() noexcept
-                {
-                    mfo_data->wave_smoother.simple_smooth(glide_motor_time, num_samples);
-                    mfo_data->phase_shift_smoother.simple_smooth(glide_motor_time, num_samples);
-
-                    mfo->process(mfo_buffer, step_number, absolute_step_number, start_sample,
-                                 num_samples);
-                    synth_data->smooth_manager->smooth_and_morph(
-                        force_by_load, is_modulated, mfo_buffer, num_samples, glide_motor_time,
-                        morph_motor_time, morph_group);
-                    /*
-                    if( lfo )
-                    {
-                        lfo->process( lfo_buffer, step_number, absolute_step_number, start_sample,
-                    num_samples );
-                    }
-                    if( master_osc )
-                    {
-                        master_osc->process( synth_data->data_buffer, num_samples ); // NEED LFO 0
-                    }
-                    if( second_osc )
-                    {
-                        second_osc->process( synth_data->data_buffer, num_samples ); // NEED LFO 0
-                    }
-                    if( filter_env )
-                    {
-                        filter_env->process( filter_env_buffer, num_samples ); // NEED LFO 0
-                    }
-                    */
-                }
-
-                SmoothExecuter(MoniqueSynthesiserVoice *const voice_, float *const mfo_buffer_,
-                               float *const lfo_buffer_,
-
-                               LFO *const mfo_, LFO *const lfo_, MasterOSC *const master_osc_,
-                               SecondOSC *const second_osc_, ENV *const filter_env_,
-                               float *const filter_env_buffer_,
-
-                               MorphGroup *const morph_group_, LFOData *const mfo_data_,
-                               MoniqueSynthData *const synth_data_, const bool is_modulated_,
-
-                               int step_number_, int absolute_step_number_, int start_sample_,
-                               int num_samples_,
-
-                               int glide_motor_time_, int morph_motor_time_,
-
-                               bool force_by_load_
-
-                               ) noexcept
-                    : mfo_buffer(mfo_buffer_), lfo_buffer(lfo_buffer_),
-
-                      mfo(mfo_), lfo(lfo_), master_osc(master_osc_), second_osc(second_osc_),
-                      filter_env(filter_env_), filter_env_buffer(filter_env_buffer_),
-
-                      voice(voice_), smooth_manager(synth_data_->smooth_manager),
-                      morph_group(morph_group_), mfo_data(mfo_data_), synth_data(synth_data_),
-
-                      is_modulated(is_modulated_),
-
-                      step_number(step_number_), absolute_step_number(absolute_step_number_),
-                      start_sample(start_sample_), num_samples(num_samples_),
-
-                      glide_motor_time(glide_motor_time_), morph_motor_time(morph_motor_time_),
-
-                      force_by_load(force_by_load_)
-                {
-                }
-                ~SmoothExecuter() noexcept {}
-            };
-
-            // MASTER THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(0),
-                           data_buffer->lfo_amplitudes.getWritePointer(0),
-
-                           mfos[0], lfos[0], master_osc, nullptr,
-
-                           filter_processors[0]->env.get(), // FIRST WILL BE DONE BY THE LAST THREAD
-                           data_buffer->filter_env_amps.getWritePointer(0),
-
-                           synth_data->morph_group_1.get(), synth_data->mfo_datas[0], synth_data,
-
-                           synth_data->is_morph_modulated[0],
-
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
-
-                           glide_motor_time, morph_motor_time,
-
-                           force_by_load)
-                .exec();
-
-            // OPTIONAL THREAD WITH FILTER 1
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(1),
-                           data_buffer->lfo_amplitudes.getWritePointer(1),
-
-                           mfos[1], lfos[1], nullptr,
-                           second_osc, // NEED OSC
-
-                           filter_processors[1]->env.get(), // FIRST WILL BE DONE BY THE LAST THREAD
-                           data_buffer->filter_env_amps.getWritePointer(1),
-
-                           synth_data->morph_group_2.get(), synth_data->mfo_datas[1], synth_data,
-
-                           synth_data->is_morph_modulated[1],
-
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
-
-                           glide_motor_time, morph_motor_time,
-
-                           force_by_load)
-                .exec();
-
-            // OPTIONAL THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(2),
-                           data_buffer->lfo_amplitudes.getWritePointer(2),
-
-                           mfos[2], lfos[2], nullptr,
-                           third_osc, // NEED OSC 0
-
-                           filter_processors[2]->env.get(),
-                           data_buffer->filter_env_amps.getWritePointer(2),
-
-                           synth_data->morph_group_3.get(), synth_data->mfo_datas[2], synth_data,
-
-                           synth_data->is_morph_modulated[2],
-
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
-
-                           glide_motor_time, morph_motor_time,
-
-                           force_by_load)
-                .exec();
-
-            // MASTER THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(3), nullptr,
-
-                           mfos[3], nullptr, nullptr, nullptr,
-
-                           nullptr, nullptr,
-
-                           synth_data->morph_group_4.get(), synth_data->mfo_datas[3], synth_data,
-
-                           synth_data->is_morph_modulated[3],
-
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
-
-                           glide_motor_time, morph_motor_time,
-
-                           force_by_load)
-                .exec();
-        }
-
-        if (!bypass_smoother.get_info_flag())
-        {
-            master_osc->reset();
-            second_osc->reset();
-            third_osc->reset();
-            for (int i = 0; i != SUM_LFOS; ++i)
-            {
-                lfos[i]->reset();
-            }
-            for (int i = 0; i != SUM_MORPHER_GROUPS; ++i)
-            {
-                mfos[i]->reset();
-            }
-            for (int i = 0; i != SUM_FILTERS; ++i)
-            {
-                filter_processors[i]->reset();
-            }
-
-            bypass_smoother.set_info_flag(true);
-        }
-    }
-
-    // VISUALIZE
-    if (Monique_Ui_AmpPainter *amp_painter = synth_data->audio_processor->amp_painter)
-    {
-        amp_painter->add_master_osc(data_buffer->osc_samples.getReadPointer(0),
-                                    data_buffer->osc_switchs.getReadPointer(0), num_samples_);
-        amp_painter->add_osc(1, data_buffer->osc_samples.getReadPointer(1), num_samples_);
-        amp_painter->add_osc(2, data_buffer->osc_samples.getReadPointer(2), num_samples_);
-    }
-
-    // UI INFORMATION
-    for (int i = 0; i != SUM_OSCS; ++i)
-    {
-        synth_data->osc_datas[i]->last_modulation_value =
-            data_buffer->lfo_amplitudes.getReadPointer(i)[num_samples - 1];
-    }
-}
-
-void MoniqueSynthesiserVoice::pitchWheelMoved(int pitch_)
-{
-    pitch_offset =
-        (pitch_ > 0x2000 ? 2.0f / 0x2000 * (pitch_ - 0x2000) : -2.0f / 0x2000 * (0x2000 - pitch_));
-
-    bool is_arp_on = synth_data->arp_sequencer_data->is_on || synth_data->keep_arp_always_on;
-    if (synth_data->keep_arp_always_off)
-    {
-        is_arp_on = false;
-    }
-    float arp_offset = is_arp_on ? arp_sequencer->get_current_tune() : 0;
-    master_osc->update(current_note + arp_offset + pitch_offset, 0);
-    second_osc->update(current_note + arp_offset + pitch_offset, 0);
-    third_osc->update(current_note + arp_offset + pitch_offset, 0);
-}
-
-//==============================================================================
-void MoniqueSynthesiserVoice::reset(bool force) noexcept
-{
-    if (current_note != -1 || force)
-    {
-        current_note = -1;
-        reset_internal();
-        clearCurrentNote();
-    }
-}
-void MoniqueSynthesiserVoice::reset_internal() noexcept
-{
-    arp_sequencer->reset();
-    for (int voice_id = 0; voice_id != SUM_FILTERS; ++voice_id)
-    {
-        filter_processors[voice_id]->reset();
-    }
-    eq_processor->reset();
-    fx_processor->reset();
-    /*
-        master_osc->reset();
-        second_osc->reset();
-        third_osc->reset();
-        */
-}
-void MoniqueSynthesiserVoice::handle_sustain_pedal(bool down_) noexcept
-{
-    is_sustain_pedal_down = down_;
-    if (!down_)
-    {
-        if (stopped_and_sustain_pedal_was_down)
-        {
-            stop_internal();
-        }
-    }
-}
-void MoniqueSynthesiserVoice::handle_sostueno_pedal(bool down_) noexcept
-{
-    is_sostenuto_pedal_down = down_;
-    if (!down_)
-    {
-        if (stopped_and_sostenuto_pedal_was_down)
-        {
-            stop_internal();
-        }
-    }
-}
-void MoniqueSynthesiserVoice::handle_soft_pedal(bool down_) noexcept { is_soft_pedal_down = down_; }
-
-//==============================================================================
-void MoniqueSynthesiserVoice::clear_record_buffer() noexcept
-{
-    fx_processor->delay.clear_record_buffer();
-}
-float MoniqueSynthesiserVoice::get_filter_env_amp(int filter_id_) const noexcept
-{
-    return filter_processors[filter_id_]->env->get_amp();
-}
-float MoniqueSynthesiserVoice::get_lfo_amp(int lfo_id_) const noexcept
-{
-    return lfos[lfo_id_]->get_current_amp();
-}
-float MoniqueSynthesiserVoice::get_mfo_amp(int lfo_id_) const noexcept
-{
-    return mfos[lfo_id_]->get_current_amp();
-}
-float MoniqueSynthesiserVoice::get_arp_sequence_amp(int step_) const noexcept
-{
-    if (arp_sequencer->get_current_step() == step_)
-    {
-        return fx_processor->final_env->get_amp() * 0.99f + 0.01f;
-    }
-
-    return 0;
-}
-float MoniqueSynthesiserVoice::get_current_frequency() const noexcept
-{
-    return juce::MidiMessage::getMidiNoteInHertz(current_note + arp_sequencer->get_current_tune());
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-void MoniqueSynthesizer::handleSustainPedal(int, bool isDown)
-{
-    voice->handle_sustain_pedal(isDown);
-}
-
-void MoniqueSynthesizer::handleSostenutoPedal(int, bool isDown)
-{
-    voice->handle_sostueno_pedal(isDown);
-}
-
-void MoniqueSynthesizer::handleSoftPedal(int, bool isDown) { voice->handle_soft_pedal(isDown); }
-void MoniqueSynthesizer::handleBankSelect(int controllerValue) noexcept
-{
-    synth_data->set_current_bank(juce::jmin(25, controllerValue));
-}
-void MoniqueSynthesizer::handleProgramChange(int midiChannel, int programNumber)
-{
-    if (programNumber != synth_data->get_current_program())
-    {
-        synth_data->set_current_program(programNumber);
-        if (programNumber == synth_data->get_current_program())
-        {
-            synth_data->load(true, true);
-        }
-    }
-}
-
-void MoniqueSynthesizer::handleController(int midiChannel, int cc_number_, int cc_value_)
-{
-    switch (cc_number_)
-    {
-    case 0:
-        // FIXME on program change from gui we generate a lot of MIDI CC in messages
-        //       one of these message is a bank select @ channel 12 (0:12:XXX)
-        //       as hot fix bank selects via MIDI CC are disabled for now
-        // handleBankSelect (cc_value_);
-        break;
-    case 0x40:
-        handleSustainPedal(midiChannel, cc_value_ >= 64);
-        break;
-    case 0x42:
-        handleSostenutoPedal(midiChannel, cc_value_ >= 64);
-        break;
-    case 0x43:
-        handleSoftPedal(midiChannel, cc_value_ >= 64);
-        break;
-    default:
-    {
-        Parameter *const learing_param = midi_control_handler->is_learning();
-        juce::Array<Parameter *> &paramters = synth_data->get_all_parameters();
-
-        if (cc_number_ == -99)
-        {
-            cc_number_ = 0; // WE NOW USE PROGRAM CHANGE
-        }
-
-        // CONTROL
-        if (!learing_param)
-        {
-            for (int i = 0; i != paramters.size(); ++i)
-            {
-                Parameter *const param = paramters.getUnchecked(i);
-                if (param->midi_control->read_from_if_you_listen(
-                        midiChannel == 2 ? cc_number_ + 128 : cc_number_, cc_value_,
-                        synth_data->midi_pickup_offset))
-                {
-                    break;
-                }
-            }
-        }
-        // TRAIN
-        else
-        {
-            if (midi_control_handler->handle_incoming_message(midiChannel == 2 ? cc_number_ + 128
-                                                                               : cc_number_))
-            {
-                // CLEAR SIBLINGS IF WE HAVE SOMETHING SUCCESSFUL TRAINED
-                juce::String learning_param_name = learing_param->get_info().name;
-                for (int i = 0; i != paramters.size(); ++i)
-                {
-                    Parameter *const param = paramters.getUnchecked(i);
-                    if (param != learing_param)
-                    {
-                        if (param->midi_control->get_is_ctrl_version_of_name() !=
-                            learning_param_name)
-                        {
-                            if (param->midi_control->is_listen_to(
-                                    midiChannel == 2 ? cc_number_ + 128 : cc_number_))
-                            {
-                                param->midi_control->clear();
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
-    }
-}
-void MoniqueSynthesizer::handlePitchWheel(int /*midiChannel*/, int wheelValue)
-{
-    voice->pitchWheelMoved(wheelValue);
-}
-
-//==============================================================================
-void MoniqueSynthesizer::NoteDownStore::add_note(const juce::MidiMessage &midi_message_,
-                                                 int play_mode_) noexcept
-{
-    if (!notes_down.contains(midi_message_))
-    {
-        notes_down.add(NoteDownStore::MidiMessageCompareable(midi_message_));
-        bool success = false;
-        for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
-        {
-            if (notes_down_order.getUnchecked(i) == nullptr)
-            {
-                notes_down_order.getReference(i) =
-                    new NoteDownStore::MidiMessageCompareable(midi_message_);
-                success = true;
-                break;
-            }
-        }
-        // REPLACE FIRST
-        if (!success)
-        {
-            juce::Array<MidiMessageCompareable *> messages;
-            juce::Array<MidiMessageCompareable *> messagesToKill;
-            for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
-            {
-                if (MidiMessageCompareable *message = notes_down_order.getUnchecked(i))
-                {
-                    messages.add(message);
-                }
-            }
-
-            if (messages.size())
-            {
-                if (play_mode_ == PLAY_MODES::LOW)
-                {
-                    int higest_note = -1;
-                    if (messages.size() == 2)
-                    {
-                        higest_note =
-                            juce::jmax(messages[0]->getNoteNumber(), messages[1]->getNoteNumber());
-                    }
-                    else if (messages.size() == 3)
-                    {
-                        higest_note =
-                            juce::jmax(messages[0]->getNoteNumber(), messages[1]->getNoteNumber(),
-                                       messages[2]->getNoteNumber());
-                    }
-                    else
-                    {
-                        higest_note = messages[0]->getNoteNumber();
-                    }
-                    if (higest_note > midi_message_.getNoteNumber())
-                    {
-                        for (int i = 0; i != messages.size(); ++i)
-                        {
-                            if (messages[i]->getNoteNumber() == higest_note)
-                            {
-                                int working_index = notes_down_order.indexOf(messages[i]);
-                                messagesToKill.add(notes_down_order.getUnchecked(working_index));
-                                notes_down_order.getReference(working_index) =
-                                    new NoteDownStore::MidiMessageCompareable(midi_message_);
-                                break;
-                            }
-                        }
-                    }
-                }
-                else if (play_mode_ == PLAY_MODES::HIGH)
-                {
-                    int lowest_note = 999;
-                    if (messages.size() == 2)
-                    {
-                        lowest_note =
-                            juce::jmax(messages[0]->getNoteNumber(), messages[1]->getNoteNumber());
-                    }
-                    else if (messages.size() == 3)
-                    {
-                        lowest_note =
-                            juce::jmax(messages[0]->getNoteNumber(), messages[1]->getNoteNumber(),
-                                       messages[2]->getNoteNumber());
-                    }
-                    else
-                    {
-                        lowest_note = messages[0]->getNoteNumber();
-                    }
-                    if (lowest_note < midi_message_.getNoteNumber())
-                    {
-                        for (int i = 0; i != messages.size(); ++i)
-                        {
-                            if (messages[i]->getNoteNumber() == lowest_note)
-                            {
-                                int working_index = notes_down_order.indexOf(messages[i]);
-                                messagesToKill.add(notes_down_order.getUnchecked(working_index));
-                                notes_down_order.getReference(working_index) =
-                                    new NoteDownStore::MidiMessageCompareable(midi_message_);
-                                break;
-                            }
-                        }
-                    }
-                }
-                else if (play_mode_ == PLAY_MODES::LIFO)
-                {
-                    for (int i = notes_down.size() - 1; i >= 0; --i)
-                    {
-                        for (int k = 0; k != messages.size(); ++k)
-                        {
-                            if (notes_down.getUnchecked(i).getNoteNumber() ==
-                                messages.getUnchecked(k)->getNoteNumber())
-                            {
-                                int working_index = notes_down_order.indexOf(messages[k]);
-                                messagesToKill.add(notes_down_order.getUnchecked(working_index));
-                                notes_down_order.getReference(working_index) =
-                                    new NoteDownStore::MidiMessageCompareable(midi_message_);
-                                i = -1;
-                                break;
-                            }
-                        }
-                    }
-                }
-                else if (play_mode_ == PLAY_MODES::FIFO)
-                {
-                    for (int i = 0; i < notes_down.size(); ++i)
-                    {
-                        for (int k = 0; k != messages.size(); ++k)
-                        {
-                            if (notes_down.getReference(i).getNoteNumber() ==
-                                messages.getUnchecked(k)->getNoteNumber())
-                            {
-                                int working_index = notes_down_order.indexOf(messages[k]);
-                                messagesToKill.add(notes_down_order.getUnchecked(working_index));
-                                notes_down_order.getReference(working_index) =
-                                    new NoteDownStore::MidiMessageCompareable(midi_message_);
-                                i = notes_down.size();
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-
-            for (int i = 0; i != messagesToKill.size(); ++i)
-            {
-                delete messagesToKill.getUnchecked(i);
-            }
-        }
-    }
-}
-const juce::MidiMessage *
-MoniqueSynthesizer::NoteDownStore::remove_note(const juce::MidiMessage &midi_message_,
-                                               int play_mode_, bool reorder_allowed_) noexcept
-{
-    notes_down.removeFirstMatchingValue(midi_message_);
-    for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
-    {
-        if (juce::MidiMessage *message = notes_down_order.getUnchecked(i))
-        {
-            if (message->getNoteNumber() == midi_message_.getNoteNumber())
-            {
-                if (reorder_allowed_)
-                {
-                    notes_down_order.getReference(i) = get_replacement(*message, play_mode_, i);
-                }
-                else
-                {
-                    notes_down_order.getReference(i) = nullptr;
-                }
-                delete message;
-                return notes_down_order.getUnchecked(i);
-            }
-        }
-    }
-
-    return nullptr;
-}
-MoniqueSynthesizer::NoteDownStore::MidiMessageCompareable *
-MoniqueSynthesizer::NoteDownStore::get_replacement(const juce::MidiMessage &message_,
-                                                   int play_mode_, int index_) noexcept
-{
-    juce::Array<MidiMessageCompareable *> messages;
-    if (MidiMessageCompareable *message = notes_down_order.getUnchecked(0))
-    {
-        messages.add(message);
-    }
-    if (MidiMessageCompareable *message = notes_down_order.getUnchecked(1))
-    {
-        messages.add(message);
-    }
-    if (MidiMessageCompareable *message = notes_down_order.getUnchecked(2))
-    {
-        messages.add(message);
-    }
-
-    int index_of_return = -1;
-    if (play_mode_ == PLAY_MODES::LOW)
-    {
-        int lowest_note = 999;
-        for (int i = 0; i != notes_down.size(); ++i)
-        {
-            const MidiMessageCompareable &message = notes_down.getReference(i);
-            if (message.getNoteNumber() < lowest_note)
-            {
-                bool contains = false;
-                for (int k = 0; k != messages.size(); ++k)
-                {
-                    if (messages.getUnchecked(k)->getNoteNumber() == message.getNoteNumber())
-                    {
-                        contains = true;
-                        break;
-                    }
-                }
-                if (!contains)
-                {
-                    lowest_note = message.getNoteNumber();
-                    index_of_return = i;
-                }
-            }
-        }
-    }
-    else if (play_mode_ == PLAY_MODES::HIGH)
-    {
-        int higest_note = -999;
-        for (int i = 0; i != notes_down.size(); ++i)
-        {
-            const MidiMessageCompareable &message = notes_down.getReference(i);
-            if (message.getNoteNumber() > higest_note)
-            {
-                bool contains = false;
-                for (int k = 0; k != messages.size(); ++k)
-                {
-                    if (messages.getUnchecked(k)->getNoteNumber() == message.getNoteNumber())
-                    {
-                        contains = true;
-                        break;
-                    }
-                }
-                if (!contains)
-                {
-                    higest_note = message.getNoteNumber();
-                    index_of_return = i;
-                }
-            }
-        }
-    }
-    else if (play_mode_ == PLAY_MODES::LIFO)
-    {
-        for (int i = notes_down.size() - 1; i >= 0; --i)
-        {
-            bool contains = false;
-            for (int k = 0; k != messages.size(); ++k)
-            {
-                if (notes_down.getReference(i).getNoteNumber() ==
-                    messages.getUnchecked(k)->getNoteNumber())
-                {
-                    contains = true;
-                    break;
-                }
-            }
-            if (!contains)
-            {
-                index_of_return = i;
-                break;
-            }
-        }
-    }
-    else if (play_mode_ == PLAY_MODES::FIFO)
-    {
-        for (int i = notes_down.size() - 1; i >= 0; --i)
-        {
-            bool contains = false;
-            for (int k = 0; k != messages.size(); ++k)
-            {
-                if (notes_down.getReference(i).getNoteNumber() ==
-                    messages.getUnchecked(k)->getNoteNumber())
-                {
-                    contains = true;
-                    break;
-                }
-            }
-            if (!contains)
-            {
-                index_of_return = i;
-                break;
-            }
-        }
-    }
-
-    if (index_of_return > -1)
-    {
-        return new NoteDownStore::MidiMessageCompareable(notes_down.getUnchecked(index_of_return));
-    }
-    else
-    {
-        return nullptr;
-    }
-}
-void MoniqueSynthesizer::NoteDownStore::reset() noexcept
-{
-    notes_down.clearQuick();
-    for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
-    {
-        if (juce::MidiMessage *message = notes_down_order.getUnchecked(i))
-        {
-            delete message;
-            notes_down_order.getReference(i) = nullptr;
-        }
-    }
-}
-bool MoniqueSynthesizer::NoteDownStore::is_empty() const noexcept { return notes_down.size() == 0; }
-const juce::MidiMessage *MoniqueSynthesizer::NoteDownStore::get_last() const noexcept
-{
-    if (notes_down.size() > 0)
-    {
-        return &notes_down.getReference(notes_down.size() - 1);
-    }
-    else
-    {
-        return nullptr;
-    }
-}
-const int
-MoniqueSynthesizer::NoteDownStore::get_id(const juce::MidiMessage &message_) const noexcept
-{
-    for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
-    {
-        if (juce::MidiMessage *message = notes_down_order.getUnchecked(i))
-        {
-            if (message_.getNoteNumber() == message->getNoteNumber())
-            {
-                return i;
-            }
-        }
-    }
-
-    return -1;
-}
-const int MoniqueSynthesizer::NoteDownStore::get_id(int note_number_) const noexcept
-{
-    for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
-    {
-        if (juce::MidiMessage *message = notes_down_order.getUnchecked(i))
-        {
-            if (note_number_ == message->getNoteNumber())
-            {
-                return i;
-            }
-        }
-    }
-
-    return -1;
-}
-const juce::MidiMessage *MoniqueSynthesizer::NoteDownStore::get_at(int index_) const noexcept
-{
-    if (index_ < 0 || index_ >= notes_down_order.size())
-    {
-        return nullptr;
-    }
-    else
-    {
-        return notes_down_order.getUnchecked(index_);
-    }
-}
-void MoniqueSynthesizer::NoteDownStore::swap(int index_a_, int index_b_) noexcept
-{
-    notes_down_order.swap(index_a_, index_b_);
-}
-MoniqueSynthesizer::NoteDownStore::NoteDownStore(MoniqueSynthData *const synth_data_) noexcept
-    : synth_data(synth_data_)
-{
-    for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
-    {
-        notes_down_order.add(nullptr);
-    }
-}
-MoniqueSynthesizer::NoteDownStore::~NoteDownStore() noexcept {}
-
-void MoniqueSynthesizer::render_next_block(juce::AudioBuffer<float> &outputAudio,
-                                           const juce::MidiBuffer &inputMidi, int startSample,
-                                           int numSamples) noexcept
-{
-    process_next_block(outputAudio, inputMidi, startSample, numSamples);
-}
-void MoniqueSynthesizer::render_next_block(juce::AudioBuffer<double> &outputAudio,
-                                           const juce::MidiBuffer &inputMidi, int startSample,
-                                           int numSamples) noexcept
-{
-    // NOT USED
-}
-void MoniqueSynthesizer::process_next_block(juce::AudioBuffer<float> &outputAudio,
-                                            const juce::MidiBuffer &inputMidi, int startSample,
-                                            int numSamples)
-{
-    juce::MidiBuffer::Iterator midiIterator(inputMidi);
-    midiIterator.setNextSamplePosition(startSample);
-
-    int midiEventPos;
-    juce::MidiMessage m;
-
-    const juce::ScopedLock sl(lock);
-
-    int program_chnage_counter_temp = synth_data->changed_programm;
-    if (program_chnage_counter_temp != program_chnage_counter)
-    {
-        program_chnage_counter = program_chnage_counter_temp;
-        if (synth_data->arp_was_on_before_change)
-        {
-            // voice->reset_internal();
-
-            voice->eq_processor->start_release();
-            voice->fx_processor->start_release(false, false);
-
-            for (int i = 0; i != 3; ++i)
-            {
-                voice->filter_processors[i]->start_env_release();
-                voice->filter_processors[i]->start_input_env_release(0);
-                voice->filter_processors[i]->start_input_env_release(1);
-                voice->filter_processors[i]->start_input_env_release(2);
-#ifdef POLY
-                voice->filter_volume_tracking_envs[i]->set_to_release();
-#endif
-            }
-        }
-        // synth_data->arp_was_on_before_change = false;
-        // int note_before_change = synth_data->current_note_before_change;
-        // synth_data->current_note_before_change = -1;
-        // if (synth_data->keep_arp_always_on == false && arp_was_on_before_change&&
-        // synth_data->arp_sequencer_data->is_on == false)
-        //{
-        //		voice->reset();
-        //}
-        // else if (arp_was_on_before_change && note_before_change == -1)
-        //{
-        //	bool is_any_step_on = false;
-        //	for (int i = 0; i != 16; ++i)
-        //	{
-        //		bool is_on = synth_data->arp_sequencer_data->step[i];
-        //		if (is_on)
-        //		{
-        //			is_any_step_on = true;
-        //			break;
-        //		}
-        //	}
-        //	if (is_any_step_on )
-        //	{
-        //		//voice->reset_internal();
-        //	}
-        //	//voice->reset();
-        //}
-        // else
-        //{
-        //	if (note_down_store.size() == 0 )
-        //	{
-        //		voice->reset();
-        //	}
-        //	else
-        //	{
-        //		bool is_any_step_on = false;
-        //		for (int i = 0; i != 16; ++i)
-        //		{
-        //			bool is_on = synth_data->arp_sequencer_data->step[i];
-        //			if (is_on)
-        //			{
-        //				is_any_step_on = true;
-        //				break;
-        //			}
-        //		}
-        //		if (is_any_step_on )
-        //		{
-        //			voice->reset_internal();
-        //		}
-        //	}
-        //}
-    }
-
-    while (numSamples > 0)
-    {
-        if (!midiIterator.getNextEvent(m, midiEventPos))
-        {
-            renderVoices(outputAudio, startSample, numSamples);
-            return;
-        }
-
-        const int samplesToNextMidiMessage = midiEventPos - startSample;
-
-        if (samplesToNextMidiMessage >= numSamples)
-        {
-            renderVoices(outputAudio, startSample, numSamples);
-            handle_midi_event(m, midiEventPos);
-            break;
-        }
-
-        // FIXME - what was the intent here?
-        {
-            static bool fix_oss_port_issue = false;
-            jassert(fix_oss_port_issue);
-            fix_oss_port_issue = true;
-        }
-        // if (samplesToNextMidiMessage < minimumSubBlockSize)
-        {
-            handle_midi_event(m, midiEventPos);
-            continue;
-        }
-
-        renderVoices(outputAudio, startSample, samplesToNextMidiMessage);
-        handle_midi_event(m, midiEventPos);
-        startSample += samplesToNextMidiMessage;
-        numSamples -= samplesToNextMidiMessage;
-    }
-
-    while (midiIterator.getNextEvent(m, midiEventPos))
-    {
-        handle_midi_event(m, midiEventPos);
-    }
-}
-
-void MoniqueSynthesizer::handle_midi_event(const juce::MidiMessage &m, int pos_in_buffer_)
-{
-    const int channel = m.getChannel();
-
-    if (m.isNoteOn())
-    {
-#ifdef POLY
-        const int play_mode =
-            synth_data->keytrack_osci_play_mode == 2 ? PLAY_MODES::FIFO : PLAY_MODES::LIFO;
-#else
-        const int play_mode = PLAY_MODES::LIFO;
-#endif
-        note_down_store.add_note(m, play_mode);
-        noteOn(channel, m.getNoteNumber(), m.getFloatVelocity());
-
-        /* RETUNE
-            if( note_down_store.size() == 1 )
-            {
-                noteOn (channel, m.getNoteNumber(), m.getFloatVelocity());
-            }
-            else if( note_down_store.size() == 2 )
-            {
-                const bool is_arp_on = synth_data->arp_sequencer_data->is_on ||
-           synth_data->keep_arp_always_on; const float arp_offset = is_arp_on ?
-           voice->arp_sequencer->get_current_tune() : 0;
-                synth_data->osc_datas[1]->tune.set_value((voice->current_note-m.getNoteNumber())*-1);
-                const float note = voice->current_note + synth_data->osc_datas[1]->tune
-           +arp_offset+voice->pitch_offset; voice->second_osc->update( note, pos_in_buffer_ );
-            }
-            else if( note_down_store.size() == 3 )
-            {
-                const bool is_arp_on = synth_data->arp_sequencer_data->is_on ||
-           synth_data->keep_arp_always_on; const float arp_offset = is_arp_on ?
-           voice->arp_sequencer->get_current_tune() : 0;
-                synth_data->osc_datas[2]->tune.set_value((voice->current_note-m.getNoteNumber())*-1);
-                const float note = voice->current_note + synth_data->osc_datas[2]->tune
-           +arp_offset+voice->pitch_offset; voice->third_osc->update( note, pos_in_buffer_ );
-            }
-            */
-    }
-    else if (m.isNoteOff())
-    {
-        voice->stop_controlled(m, pos_in_buffer_);
-    }
-    else if (m.isAllNotesOff() || m.isAllSoundOff())
-    {
-        allNotesOff(channel, true);
-    }
-    else if (m.isPitchWheel())
-    {
-        const int wheelPos = m.getPitchWheelValue();
-        lastPitchWheelValues[channel - 1] = wheelPos;
-        handlePitchWheel(channel, wheelPos);
-    }
-    else if (m.isAftertouch())
-    {
-        handleAftertouch(channel, m.getNoteNumber(), m.getAfterTouchValue());
-    }
-    else if (m.isChannelPressure())
-    {
-        handleChannelPressure(channel, m.getChannelPressureValue());
-    }
-    else if (m.isController())
-    {
-        handleController(channel, m.getControllerNumber(), m.getControllerValue());
-    }
-    else if (m.isProgramChange())
-    {
-        handleProgramChange(channel, m.getProgramChangeNumber());
-    }
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-COLD MoniqueSynthesiserSound::MoniqueSynthesiserSound() noexcept {}
-COLD MoniqueSynthesiserSound::~MoniqueSynthesiserSound() noexcept {}
-
-//==============================================================================
-bool MoniqueSynthesiserSound::appliesToNote(int) { return true; }
-bool MoniqueSynthesiserSound::appliesToChannel(int) { return true; }
-
-//==============================================================================
-void MoniqueSynthData::get_full_adstr(ENVData &env_data_, juce::Array<float> &curve) noexcept
-{
-    ENV env(runtime_notifyer, this, &env_data_, sine_lookup, cos_lookup, exp_lookup);
-    env.start_attack();
-    const float sample_rate = runtime_notifyer->get_sample_rate();
-    int count_sustain = msToSamplesFast(1000, sample_rate);
-    // optimize that like below!
-    while (env.get_current_stage() != END_ENV)
-    {
-        float sample;
-        env.process(&sample, 1);
-        curve.add(sample);
-
-        if (env.get_current_stage() == SUSTAIN)
-        {
-            // if( !env.is_endless() )
-            {
-                if (--count_sustain <= 0)
-                {
-                    env.set_to_release();
-                }
-            }
-        }
-    }
-}
-void MoniqueSynthData::get_full_mfo(LFOData &mfo_data_, juce::Array<float> &curve,
-                                    MoniqueSynthData *data_) noexcept
-{
-    LFO mfo(runtime_notifyer, this, &mfo_data_, sine_lookup);
-    int count_time =
-        runtime_notifyer->get_sample_rate() * 2; // msToSamplesFast( 44100, sample_rate );
-    int i = 0;
-    const int blocksize = runtime_notifyer->get_block_size() / 2;
-    float *buffer = new float[blocksize];
-    curve.ensureStorageAllocated(count_time + blocksize);
-
-    juce::Array<RuntimeInfo::standalone_features::ClockSync::SyncPosPair> clock_sync_information;
-    if (is_standalone())
-    {
-        clock_sync_information =
-            runtime_info->standalone_features_pimpl->clock_sync_information.get_a_working_copy();
-    }
-    while (i * blocksize < count_time)
-    {
-        mfo.process(buffer, -1, 1, 1 + i * blocksize, blocksize, false, &clock_sync_information);
-        if (i > 10)
-        {
-            for (int sid = 0; sid != blocksize; ++sid)
-            {
-                curve.add(buffer[sid]);
-            }
-        }
-        i++;
-    }
-    delete[] buffer;
-}
-bool MoniqueSynthData::is_key_down(int id) const noexcept
-{
-    return reinterpret_cast<MoniqueSynthesizer::NoteDownStore *>(voice->note_down_store)
-        ->get_at(id);
-}
-float MoniqueSynthData::get_tracking_env_state(int id) const noexcept
-{
-#ifdef POLY
-    return voice->filter_volume_tracking_envs[id]->get_amp();
-#else
-    return 0;
-#endif
-}
-
-//==============================================================================
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_core_Synth.h"
+
+#include "monique_core_Datastructures.h"
+#include "monique_core_Processor.h"
+#include "ui/monique_ui_AmpPainter.h"
+#include "ui/monique_ui_SegmentedMeter.h"
+
+#include <memory>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MONIQUE_EQ_SSE 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define MONIQUE_EQ_NEON 1
+#endif
+
+// SAW AND SQUARE FROM BAND LIMITED TABLES (1) OR FROM THE ORIGINAL BLIT (0)
+#ifndef MONIQUE_BANDLIMITED_TABLE_OSCILLATORS
+#define MONIQUE_BANDLIMITED_TABLE_OSCILLATORS 1
+#endif
+
+// PAN LAW OF THE FILTER, DELAY, CHORUS AND REVERB PANS
+#define MONIQUE_PAN_LAW_CONSTANT_POWER 0 // -3 dB IN THE CENTER
+#define MONIQUE_PAN_LAW_COMPROMISE 1     // -4.5 dB IN THE CENTER
+#define MONIQUE_PAN_LAW_LINEAR 2         // -6 dB IN THE CENTER
+#ifndef MONIQUE_PAN_LAW
+#define MONIQUE_PAN_LAW MONIQUE_PAN_LAW_CONSTANT_POWER
+#endif
+
+// SAMPLES BETWEEN TWO FILTER COEFFICIENT CALCULATIONS, LINEAR RAMPS IN BETWEEN (1: EVERY SAMPLE)
+#ifndef MONIQUE_FILTER_CONTROL_RATE
+#define MONIQUE_FILTER_CONTROL_RATE 16
+#endif
+static_assert(MONIQUE_FILTER_CONTROL_RATE >= 1, "MONIQUE_FILTER_CONTROL_RATE must be at least 1");
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// s1 + s2 - s1 * s2 IF BOTH ARE POSITIVE, s1 + s2 + s1 * s2 IF BOTH ARE NEGATIVE, ELSE s1 + s2
+// Branch free (the product is only positive if both have the same sign) to let the compiler
+// vectorize the loops using it.
+static inline float sample_mix(float s1_, float s2_) noexcept
+{
+    const float product = s1_ * s2_;
+    const bool is_same_sign = product > 0;
+    const float signed_product = s1_ > 0 ? product : -product;
+    return s1_ + s2_ - (is_same_sign ? signed_product : 0);
+}
+static inline void sample_mix(float *dest_, const float *s1_, const float *s2_,
+                              int num_samples_) noexcept
+{
+    for (int sid = 0; sid != num_samples_; ++sid)
+    {
+        dest_[sid] = sample_mix(s1_[sid], s2_[sid]);
+    }
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// PAN LAW TABLES, SHARED BY ALL INSTANCES AND BUILT ONCE AT STARTUP
+// pan -1 (left) .. 1 (right), linear interpolated between the table points
+class PanLaw
+{
+  public:
+    static constexpr int TABLE_SIZE = 512;
+
+  private:
+
+    // + THE END POINT + A GUARD FOR pan == 1
+    float left_table[TABLE_SIZE + 2];
+    float right_table[TABLE_SIZE + 2];
+
+  public:
+    //==========================================================================
+    inline void get(float pan_, float &left_, float &right_) const noexcept
+    {
+        const float position =
+            juce::jlimit(0.0f, float(TABLE_SIZE), (pan_ + 1) * 0.5f * float(TABLE_SIZE));
+        const int index = int(position);
+        const float delta = position - index;
+        left_ = left_table[index] + (left_table[index + 1] - left_table[index]) * delta;
+        right_ = right_table[index] + (right_table[index + 1] - right_table[index]) * delta;
+    }
+    inline float left(float pan_) const noexcept
+    {
+        float left_gain, right_gain;
+        get(pan_, left_gain, right_gain);
+        return left_gain;
+    }
+    inline float right(float pan_) const noexcept
+    {
+        float left_gain, right_gain;
+        get(pan_, left_gain, right_gain);
+        return right_gain;
+    }
+    inline void get(const float *pans_, float *lefts_, float *rights_,
+                    int num_samples_) const noexcept
+    {
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            get(pans_[sid], lefts_[sid], rights_[sid]);
+        }
+    }
+
+  public:
+    //==========================================================================
+    // THE LAW ITSELF, position_ 0 (left) .. 1 (right)
+    static inline void get_exact(double position_, double &left_, double &right_) noexcept
+    {
+#if MONIQUE_PAN_LAW == MONIQUE_PAN_LAW_LINEAR
+        left_ = position_;
+        right_ = 1.0 - position_;
+#else
+        const double angle = position_ * juce::MathConstants<double>::halfPi;
+#if MONIQUE_PAN_LAW == MONIQUE_PAN_LAW_COMPROMISE
+        left_ = std::sqrt(position_ * std::sin(angle));
+        right_ = std::sqrt((1.0 - position_) * std::cos(angle));
+#else
+        left_ = std::sin(angle);
+        right_ = std::cos(angle);
+#endif
+#endif
+        left_ = juce::jmax(left_, 0.00001);
+        right_ = juce::jmax(right_, 0.00001);
+    }
+
+  public:
+    //==========================================================================
+    COLD PanLaw() noexcept
+    {
+        for (int i = 0; i <= TABLE_SIZE; ++i)
+        {
+            double left_gain, right_gain;
+            get_exact(double(i) / TABLE_SIZE, left_gain, right_gain);
+            left_table[i] = float(left_gain);
+            right_table[i] = float(right_gain);
+        }
+        left_table[TABLE_SIZE + 1] = left_table[TABLE_SIZE];
+        right_table[TABLE_SIZE + 1] = right_table[TABLE_SIZE];
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PanLaw)
+};
+static const PanLaw pan_law;
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+COLD SmoothedParameter::SmoothedParameter(SmoothManager *const smooth_manager_,
+                                          Parameter *const param_to_smooth_) noexcept
+    : RuntimeListener(smooth_manager_ ? smooth_manager_->notifyer : nullptr),
+      smooth_manager(smooth_manager_),
+
+      values(block_size), modulation_power(block_size),
+
+      is_settled(false), settled_value(0), is_modulation_settled(false), settled_modulation(0),
+      coefficients_time_in_ms(-1),
+
+      param_to_smooth(param_to_smooth_),
+
+      max_value(param_to_smooth_->get_info().max_value),
+      min_value(param_to_smooth_->get_info().min_value),
+
+      simple_smoother(0.001), left_morph_smoother(0.001), right_morph_smoother(0.001),
+      left_modulation_morph_smoother(0.001), right_modulation_morph_smoother(0.001),
+      morph_power_smoother(0.001), modulation_power_smoother(0.001), amp_power_smoother(0.001)
+{
+    if (smooth_manager)
+    {
+        smooth_manager->smoothers.add(this);
+        param_to_smooth_->get_runtime_info().my_smoother = this;
+    }
+
+    sample_rate_or_block_changed();
+}
+COLD SmoothedParameter::~SmoothedParameter() noexcept
+{
+    if (smooth_manager)
+    {
+        // param_to_smooth->get_runtime_info().my_smoother = nullptr;
+        smooth_manager->smoothers.removeFirstMatchingValue(this);
+    }
+}
+COLD void SmoothedParameter::set_offline() noexcept
+{
+    if (smooth_manager)
+    {
+        smooth_manager->smoothers.removeFirstMatchingValue(this);
+        param_to_smooth->get_runtime_info().my_smoother = nullptr;
+    }
+}
+
+//==============================================================================
+COLD void SmoothedParameter::sample_rate_or_block_changed() noexcept
+{
+    values.setSize(block_size);
+    modulation_power.setSize(block_size);
+    is_settled = false;
+    is_modulation_settled = false;
+    coefficients_time_in_ms = -1;
+
+    simple_smoother.set_value(morph_power_smoother.get_last_value());
+    simple_smoother.reset_coefficients(sample_rate, 0);
+
+    left_morph_smoother.set_value(morph_power_smoother.get_last_value());
+    left_morph_smoother.reset_coefficients(sample_rate, 0);
+
+    right_morph_smoother.set_value(morph_power_smoother.get_last_value());
+    right_morph_smoother.reset_coefficients(sample_rate, 0);
+
+    left_modulation_morph_smoother.set_value(morph_power_smoother.get_last_value());
+    left_modulation_morph_smoother.reset_coefficients(sample_rate, 0);
+
+    right_modulation_morph_smoother.set_value(morph_power_smoother.get_last_value());
+    right_modulation_morph_smoother.reset_coefficients(sample_rate, 0);
+
+    morph_power_smoother.set_value(morph_power_smoother.get_last_value());
+    morph_power_smoother.reset_coefficients(sample_rate, 0);
+
+    modulation_power_smoother.set_value(morph_power_smoother.get_last_value());
+    modulation_power_smoother.reset_coefficients(sample_rate, 0);
+
+    amp_power_smoother.set_value(morph_power_smoother.get_last_value());
+    amp_power_smoother.reset_coefficients(sample_rate, 0);
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class Smoother : RuntimeListener
+{
+    int pos;
+    float sum;
+    int size_in_ms;
+    int size;
+    mono_AudioSampleBuffer<1> buffer;
+    float *ptr_to_buffer;
+
+  public:
+    //==========================================================================
+    inline void add(float val_) noexcept
+    {
+        sum -= ptr_to_buffer[pos];
+        ptr_to_buffer[pos] = val_;
+        sum += val_;
+
+        if (++pos >= size)
+        {
+            pos = 0;
+        }
+    }
+    inline float add_and_get_average(float val_) noexcept
+    {
+        add(val_);
+        return get_average();
+    }
+    inline float get_average() const noexcept { return sum * (1.0f / size); }
+    inline void reset(float value_) noexcept
+    {
+        sum = 0;
+        for (int i = 0; i != size; ++i)
+        {
+            ptr_to_buffer[i] = value_;
+            sum += value_;
+        }
+    }
+    void set_size_in_ms(int size_in_ms_, bool force_ = false) noexcept
+    {
+        if (size_in_ms != size_in_ms_ || force_)
+        {
+            float last_average = get_average();
+
+            size_in_ms = size_in_ms_;
+            size = juce::jmax(3, msToSamplesFast(size_in_ms_, sample_rate));
+            buffer.setSize(size, false);
+            ptr_to_buffer = buffer.getWritePointer();
+
+            if (pos > size)
+            {
+                pos = 0;
+            }
+
+            sum = 0;
+            for (int i = 0; i != size; ++i)
+            {
+                ptr_to_buffer[i] = last_average;
+                sum += last_average;
+            }
+        }
+    }
+
+  private:
+    virtual void sample_rate_or_block_changed() noexcept override
+    {
+        set_size_in_ms(size_in_ms, true);
+    };
+
+  public:
+    //==========================================================================
+    COLD Smoother(RuntimeNotifyer *const notifyer_, int init_size_in_ms_) noexcept
+        : RuntimeListener(notifyer_), pos(0), sum(0), size_in_ms(init_size_in_ms_),
+          size(juce::jmax(3, msToSamplesFast(init_size_in_ms_, sample_rate))), buffer(size),
+          ptr_to_buffer(buffer.getWritePointer())
+    {
+        reset(0);
+    }
+    COLD ~Smoother() {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Smoother)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+// atan lookup???
+static inline float soft_clipping(float input_and_worker_) noexcept
+{
+    return (std::atan(input_and_worker_) * (1.0f / juce::MathConstants<float>::pi)) * 1.5;
+}
+
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+static inline float lfo2amp(float sample_) noexcept { return (sample_ + 1.0f) * 0.5f; }
+
+//==============================================================================
+static inline float distortion(float input_and_worker_, float distortion_power_) noexcept
+{
+    if (distortion_power_ != 0)
+    {
+        const float distortion_add_on = distortion_power_ * 0.9f;
+        input_and_worker_ =
+            ((1.0f + distortion_add_on) * input_and_worker_) -
+            (input_and_worker_ * input_and_worker_ * input_and_worker_) * distortion_add_on;
+    }
+
+    return input_and_worker_;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+static inline float clipp_to_0_and_1(float input_and_worker_) noexcept
+{
+    if (input_and_worker_ > 1)
+    {
+        input_and_worker_ = 1;
+    }
+    else if (input_and_worker_ < 0)
+    {
+        input_and_worker_ = 0;
+    }
+
+    return input_and_worker_;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+static inline float soft_clipp_greater_1_2(float x) noexcept
+{
+    if (x > 1)
+    {
+        x = 1.0f + soft_clipping(x - 1.0f);
+    }
+    else if (x < -1)
+    {
+        x = -1.0f + soft_clipping(x + 1.0f);
+    }
+
+    if (x > 1.2)
+    {
+        x = 1.2;
+    }
+    else if (x < -1.2)
+    {
+        x = -1.2;
+    }
+
+    return x;
+}
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+static inline float soft_clipp_greater_0_9(float x) noexcept
+{
+    if (x > 0.9f)
+    {
+        x = 0.9f + soft_clipping(x - 0.9f);
+    }
+    else if (x < -0.9f)
+    {
+        x = -0.9f + soft_clipping(x + 0.9f);
+    }
+
+    if (x > 1)
+    {
+        x = 1;
+    }
+    else if (x < -1)
+    {
+        x = -1;
+    }
+
+    return x;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+static inline float hard_clipper_1(float x) noexcept
+{
+    if (x > 1)
+    {
+        x = 1;
+    }
+    else if (x < -1)
+    {
+        x = -1;
+    }
+
+    return x;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// replace with juce table lookup
+static float inline lookup(const float *table_, float x) noexcept
+{
+    return table_[int(x * TABLESIZE_MULTI) % LOOKUP_TABLE_SIZE];
+}
+//==============================================================================
+COLD DataBuffer::DataBuffer(int init_buffer_size_) noexcept
+    : size(init_buffer_size_),
+
+      band_env_buffers(init_buffer_size_), band_sum_buffers(init_buffer_size_),
+
+      lfo_amplitudes(init_buffer_size_), mfo_amplitudes(init_buffer_size_),
+      filter_output_samples_l_r(init_buffer_size_), filter_stereo_output_samples(init_buffer_size_),
+
+      osc_samples(init_buffer_size_), osc_switchs(init_buffer_size_),
+      osc_sync_switchs(init_buffer_size_), modulator_samples(init_buffer_size_),
+
+      final_env(init_buffer_size_),
+#ifdef POLY
+      filter_env_tracking(init_buffer_size_),
+#endif
+      chorus_env(init_buffer_size_),
+
+      filter_input_samples(init_buffer_size_), filter_input_env_amps(init_buffer_size_),
+      filter_output_samples(init_buffer_size_), filter_env_amps(init_buffer_size_),
+
+      tmp_buffer(init_buffer_size_),
+
+      second_mono_buffer(init_buffer_size_),
+
+      velocity_buffer(init_buffer_size_)
+{
+}
+COLD DataBuffer::~DataBuffer() noexcept {}
+
+//==============================================================================
+COLD void DataBuffer::resize_buffer_if_required(int size_) noexcept
+{
+    if (size_ != size)
+    {
+        size = size_;
+
+        band_env_buffers.setSize(size_);
+        band_sum_buffers.setSize(size_);
+
+        lfo_amplitudes.setSize(size_);
+        mfo_amplitudes.setSize(size_);
+        filter_stereo_output_samples.setSize(size_);
+        filter_output_samples_l_r.setSize(size_);
+
+        osc_samples.setSize(size_);
+        osc_switchs.setSize(size_);
+        osc_sync_switchs.setSize(size_);
+        modulator_samples.setSize(size_);
+
+        final_env.setSize(size_);
+#ifdef POLY
+        filter_env_tracking.setSize(size_);
+#endif
+        chorus_env.setSize(size_);
+
+        filter_input_samples.setSize(size_);
+        filter_input_env_amps.setSize(size_);
+        filter_output_samples.setSize(size_);
+        filter_env_amps.setSize(size_);
+
+        tmp_buffer.setSize(size_);
+
+        second_mono_buffer.setSize(size_);
+
+        velocity_buffer.setSize(size_);
+    }
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class PerfectCycleCounter : RuntimeListener
+{
+    //==========================================================================
+    double frequency;
+
+    double delta;
+    double angle;
+
+    double rate;
+    double phase;
+
+    double cylces_per_sec;
+
+    bool new_cycle;
+
+  public:
+    //==========================================================================
+    inline void set_frequency(double frequency_) noexcept
+    {
+        if (frequency != frequency_)
+        {
+            frequency = frequency_;
+            cylces_per_sec = sample_rate / frequency_;
+
+            delta = frequency_ / sample_rate *
+                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+            rate = (1.0 / cylces_per_sec) * juce::MathConstants<double>::pi;
+        }
+    }
+    inline void tick() noexcept
+    {
+        new_cycle = false;
+
+        angle += delta;
+        phase += rate;
+        if (angle > (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
+        {
+            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+            phase -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+            new_cycle = true;
+        }
+    }
+    inline double get_last_angle() const noexcept { return angle; }
+    inline double get_last_phase() const noexcept { return phase; }
+
+    inline double get_cylces_per_sec() const noexcept { return cylces_per_sec; }
+    inline bool is_new_cycle() const noexcept { return new_cycle; }
+    inline bool is_clean() const noexcept { return angle == 0 && new_cycle && phase == 0; }
+
+    //==========================================================================
+    void reset() noexcept
+    {
+        angle = 0;
+        new_cycle = true;
+        phase = 0;
+    }
+
+    //==========================================================================
+    void sample_rate_or_block_changed() noexcept override
+    {
+        float frequency_old = frequency;
+        frequency = 0;
+        set_frequency(frequency_old);
+    }
+
+  public:
+    //==========================================================================
+    COLD PerfectCycleCounter(RuntimeNotifyer *const notifyer_) noexcept
+        : RuntimeListener(notifyer_), frequency(0), delta(0), angle(0), rate(0), phase(0),
+          cylces_per_sec(0), new_cycle(true)
+    {
+    }
+    COLD ~PerfectCycleCounter() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PerfectCycleCounter)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_BlitSaw
+{
+    float phase_offset;
+    double last_tick_value;
+    double p_;
+    double C2_;
+    double phase_correction;
+    double a_;
+    double state_;
+
+    unsigned int m_;
+
+  public:
+    //==========================================================================
+    inline float tick(double phase_) noexcept
+    {
+        double tmp;
+        {
+            const double working_phase_ = (phase_ + phase_offset) - phase_correction;
+
+            // Avoid a divide by zero, or use of a denormalized divisor
+            // at the sinc peak, which has a limiting value of m_ / p_.
+            const double denominator = std::sin(working_phase_);
+            if (std::fabs(denominator) <= std::numeric_limits<double>::epsilon())
+            {
+                tmp = a_;
+            }
+            else
+            {
+                tmp = sin(working_phase_ * m_) / (p_ * denominator);
+            }
+        }
+
+        tmp += (state_ - C2_);
+        state_ = tmp * 0.995;
+
+        return last_tick_value = tmp;
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_phase_offset(float offset_) noexcept
+    {
+        phase_offset = offset_ * juce::MathConstants<float>::pi;
+    }
+    inline void updateHarmonics(double p) noexcept
+    {
+        p_ = p;
+        C2_ = 1.0 / p;
+        phase_correction = C2_ * (juce::MathConstants<double>::pi * 0.5) / 0.9;
+        m_ = 2 * floor(0.5 * p) + 1;
+        a_ = p / p;
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        state_ = 0;
+        last_tick_value = 0;
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_BlitSaw() noexcept
+        : phase_offset(0), last_tick_value(0), p_(0), C2_(0), phase_correction(0), a_(0), state_(0),
+          m_(0)
+    {
+    }
+    COLD ~mono_BlitSaw() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_BlitSaw)
+};
+
+//==============================================================================
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_BlitSquare
+{
+    float last_tick_value;
+    float phase_offset;
+    double a_;
+    double p_;
+    double phase_correction;
+    double lastBlitOutput_;
+    double dcbState_;
+
+    unsigned int m_;
+
+  public:
+    //==========================================================================
+    inline float tick(double phase_) noexcept
+    {
+        // OUTPUT PROCESS
+        float out;
+        {
+            const double temp = lastBlitOutput_;
+            {
+                const double current_phase = (phase_ + phase_offset) - phase_correction;
+
+                // Avoid a divide by zero, or use of a denomralized divisor
+                // at the sinc peak, which has a limiting value of 1.0.
+                {
+
+                    const double denominator = std::sin(current_phase);
+                    if (std::fabs(denominator) < std::numeric_limits<double>::epsilon())
+                    {
+                        // Inexact comparison safely distinguishes between *close to zero*, and
+                        // *close to PI*.
+                        if (current_phase < 0.0001 ||
+                            current_phase > (juce::MathConstants<double>::pi +
+                                             juce::MathConstants<double>::pi) -
+                                                0.0001)
+                        {
+                            lastBlitOutput_ = a_;
+                        }
+                        else
+                        {
+                            lastBlitOutput_ = -a_;
+                        }
+                    }
+                    else
+                    {
+                        lastBlitOutput_ = std::sin(current_phase * m_) / (p_ * denominator);
+                    }
+                }
+            }
+
+            lastBlitOutput_ += temp;
+
+            // Now apply DC blocker.
+            out = lastBlitOutput_ - dcbState_ + 0.999f * last_tick_value;
+            dcbState_ = lastBlitOutput_;
+        }
+
+        return last_tick_value = out;
+    }
+    inline float lastOut(void) const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_phase_offset(float offset_) noexcept
+    {
+        phase_offset = offset_ * juce::MathConstants<float>::pi;
+    }
+    inline void updateHarmonics(double p) noexcept
+    {
+        p_ = p * 0.5;
+        m_ = (floor(0.5 * p_) + 1) * 2;
+        a_ = p / p;
+
+        phase_correction = (1.0 / p) * juce::MathConstants<double>::pi;
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        last_tick_value = 0;
+        dcbState_ = 0;
+        lastBlitOutput_ = 0;
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_BlitSquare() noexcept
+        : last_tick_value(0), phase_offset(0), a_(0), p_(0), phase_correction(0),
+          lastBlitOutput_(0), dcbState_(0), m_(0)
+    {
+    }
+    COLD ~mono_BlitSquare() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_BlitSquare)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// BAND LIMITED SAW AND SQUARE TABLES, SHARED BY ALL INSTANCES
+// One mip level per quarter octave of harmonics. The partials are tilted by x/sin(x), the
+// response of the sampled BLIT sum at the nominal cycle length of the level. Under 16kHz the
+// table oscillators stay below -40dB from the BLIT output up to 2kHz fundamentals, the error
+// grows above (the dsp check osc-tables has the bounds). Only the top quarter octave below
+// nyquist is dropped.
+#if MONIQUE_BANDLIMITED_TABLE_OSCILLATORS
+class mono_BandlimitedTables
+{
+  public:
+    enum
+    {
+        MAX_HARMONICS = 1024,
+        MIN_TABLE_SIZE = 256,
+        MAX_TABLE_SIZE = 4096
+    };
+
+    struct Level
+    {
+        const float *saw;
+        const float *square;
+        int size;
+
+        inline float read(const float *table_, double position_) const noexcept
+        {
+            const double index = position_ * size;
+            const juce::int64 truncated_index = juce::int64(index);
+            const juce::int64 floored_index = truncated_index - (index < double(truncated_index));
+            const float fraction = float(index - floored_index);
+            const float *const sample = table_ + (floored_index & (size - 1));
+            return sample[0] + (sample[1] - sample[0]) * fraction;
+        }
+    };
+
+  private:
+    juce::HeapBlock<float> saw_data;
+    juce::HeapBlock<float> square_data;
+    juce::Array<Level> levels;
+    juce::uint8 level_for_harmonics[MAX_HARMONICS + 1];
+
+  public:
+    //==========================================================================
+    inline const Level &get_level(double samples_per_cycle_) const noexcept
+    {
+        const int harmonics = juce::jlimit(
+            1, int(MAX_HARMONICS), int(juce::jmin(samples_per_cycle_ * 0.5, double(MAX_HARMONICS))));
+        return levels.getReference(level_for_harmonics[harmonics]);
+    }
+
+    static const mono_BandlimitedTables &get() noexcept
+    {
+        static const mono_BandlimitedTables tables;
+        return tables;
+    }
+
+  private:
+    //==========================================================================
+    COLD mono_BandlimitedTables() noexcept
+    {
+        juce::Array<int> harmonics_per_level;
+        juce::Array<int> sizes;
+        int sum_samples = 0;
+        for (int i = 0;; ++i)
+        {
+            const int harmonics = int(std::pow(2.0, i * 0.25));
+            if (harmonics > MAX_HARMONICS)
+            {
+                break;
+            }
+            if (harmonics_per_level.getLast() != harmonics)
+            {
+                int size = MIN_TABLE_SIZE;
+                while (size < harmonics * 16 && size < MAX_TABLE_SIZE)
+                {
+                    size *= 2;
+                }
+
+                harmonics_per_level.add(harmonics);
+                sizes.add(size);
+                sum_samples += size + 1;
+            }
+        }
+
+        saw_data.allocate(sum_samples, true);
+        square_data.allocate(sum_samples, true);
+
+        juce::HeapBlock<double> sine(MAX_TABLE_SIZE);
+        for (int i = 0; i != MAX_TABLE_SIZE; ++i)
+        {
+            sine[i] = std::sin(juce::MathConstants<double>::twoPi * i / MAX_TABLE_SIZE);
+        }
+
+        juce::HeapBlock<double> saw_sum(MAX_TABLE_SIZE);
+        juce::HeapBlock<double> square_sum(MAX_TABLE_SIZE);
+        int offset = 0;
+        int h = 0;
+        for (int l = 0; l != harmonics_per_level.size(); ++l)
+        {
+            const int harmonics = harmonics_per_level[l];
+            const int size = sizes[l];
+            const int stride = MAX_TABLE_SIZE / size;
+            const double nominal_samples_per_cycle =
+                2.0 * (l + 1 < harmonics_per_level.size()
+                           ? std::sqrt(double(harmonics) * harmonics_per_level[l + 1])
+                           : harmonics);
+
+            juce::FloatVectorOperations::clear(saw_sum.get(), size);
+            juce::FloatVectorOperations::clear(square_sum.get(), size);
+            for (int k = 1; k <= harmonics; ++k)
+            {
+                const double x = k * juce::MathConstants<double>::pi / nominal_samples_per_cycle;
+                const double saw_amp = (x / std::sin(x)) / (k * juce::MathConstants<double>::pi);
+                const double square_amp = (k & 1) ? saw_amp * 2 : 0;
+                for (int i = 0; i != size; ++i)
+                {
+                    const double partial = sine[(k * i * stride) & (MAX_TABLE_SIZE - 1)];
+                    saw_sum[i] += partial * saw_amp;
+                    square_sum[i] += partial * square_amp;
+                }
+            }
+
+            float *const saw = saw_data + offset;
+            float *const square = square_data + offset;
+            for (int i = 0; i != size; ++i)
+            {
+                saw[i] = float(saw_sum[i]);
+                square[i] = float(square_sum[i]);
+            }
+            saw[size] = saw[0];
+            square[size] = square[0];
+
+            levels.add(Level{saw, square, size});
+            offset += size + 1;
+
+            for (; h <= harmonics; ++h)
+            {
+                level_for_harmonics[h] = juce::uint8(juce::jmax(0, l - 1));
+            }
+            level_for_harmonics[harmonics] = juce::uint8(l);
+        }
+        for (; h <= MAX_HARMONICS; ++h)
+        {
+            level_for_harmonics[h] = juce::uint8(levels.size() - 1);
+        }
+    }
+
+    JUCE_DECLARE_NON_COPYABLE(mono_BandlimitedTables)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// Reads the ideal band limited wave and runs it through the same leak as the BLIT integrator
+// (saw, 0.995) or DC blocker (square, 0.999). The table itself has no state, so a generator
+// can pause while the wave mix does not use it and is primed again on its next tick.
+class mono_TableWave
+{
+    const mono_BandlimitedTables::Level *level;
+    const bool is_saw;
+    const float leak;
+
+    float phase_offset;
+    double phase_correction;
+    float last_tick_value;
+    float last_table_value;
+    bool is_running;
+
+  public:
+    //==========================================================================
+    inline float tick(double cycles_) noexcept
+    {
+        const float table_value = level->read(is_saw ? level->saw : level->square,
+                                              cycles_ + phase_offset - phase_correction);
+        if (!is_running)
+        {
+            last_table_value = table_value;
+            last_tick_value = table_value;
+            is_running = true;
+        }
+
+        last_tick_value = table_value - last_table_value + leak * last_tick_value;
+        last_table_value = table_value;
+
+        return last_tick_value;
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+    inline void pause() noexcept { is_running = false; }
+
+    //==========================================================================
+    inline void set_phase_offset(float offset_in_cycles_) noexcept
+    {
+        phase_offset = offset_in_cycles_;
+    }
+    inline void updateHarmonics(double p) noexcept
+    {
+        level = &mono_BandlimitedTables::get().get_level(p);
+
+        // BLIT CORRECTION MINUS THE HALF SAMPLE THE SAMPLED INTEGRATION ADDS
+        phase_correction = is_saw ? (1.0 / p) * (0.5 / 0.9 - 0.5) : 0;
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        last_tick_value = 0;
+        is_running = false;
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_TableWave(bool is_saw_) noexcept
+        : level(&mono_BandlimitedTables::get().get_level(100)), is_saw(is_saw_),
+          leak(is_saw_ ? 0.995f : 0.999f), phase_offset(0), phase_correction(0),
+          last_tick_value(0), last_table_value(0), is_running(false)
+    {
+    }
+    COLD ~mono_TableWave() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_TableWave)
+};
+#endif
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_SineWave
+{
+    const float *const sine_lookup;
+
+    float last_tick_value;
+    float phase_offset;
+
+  public:
+    //==========================================================================
+    inline float tick(double angle_) noexcept
+    {
+        return last_tick_value = lookup(sine_lookup, angle_ + phase_offset);
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_phase_offset(float offset_) noexcept
+    {
+        phase_offset = offset_ * juce::MathConstants<float>::pi;
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_SineWave(const float *sine_lookup_) noexcept
+        : sine_lookup(sine_lookup_), last_tick_value(0), phase_offset(0)
+    {
+    }
+    COLD ~mono_SineWave() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWave)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_SineWaveAutonom : public RuntimeListener
+{
+    const float *const sine_lookup;
+
+    double frequency;
+
+    double delta;
+    double angle;
+
+    bool new_cycle;
+
+    float last_tick_value;
+
+  public:
+    //==========================================================================
+    inline float tick() noexcept
+    {
+        new_cycle = false;
+
+        angle += delta;
+        if (angle > (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
+        {
+            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+            new_cycle = true;
+        }
+
+        return last_tick_value = lookup(sine_lookup, angle);
+    }
+    inline float lastOut_with_phase_offset(float offset_) noexcept
+    {
+        return lookup(sine_lookup, angle + offset_ * (juce::MathConstants<double>::pi +
+                                                      juce::MathConstants<double>::pi));
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_frequency(double frequency_) noexcept
+    {
+        if (frequency != frequency_)
+        {
+            frequency = frequency_;
+            delta = frequency_ / sample_rate *
+                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+        }
+    }
+    inline void overwrite_angle(float angle_) noexcept { angle = angle_; }
+
+    //==========================================================================
+    inline bool is_new_cycle() const noexcept { return new_cycle; }
+
+    inline void sample_rate_or_block_changed() noexcept override
+    {
+        float frequency_old = frequency;
+        frequency = 0;
+        set_frequency(frequency_old);
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_SineWaveAutonom(RuntimeNotifyer *const notifyer_,
+                              const float *const sine_lookup_) noexcept
+        : RuntimeListener(notifyer_),
+
+          sine_lookup(sine_lookup_), frequency(0),
+
+          delta(0), angle(0),
+
+          new_cycle(0),
+
+          last_tick_value(0)
+    {
+    }
+    COLD ~mono_SineWaveAutonom() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWaveAutonom)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_SineWaveAutonomShifted : public RuntimeListener
+{
+    const float *const sine_lookup;
+
+    double frequency;
+
+    double delta;
+    double angle;
+
+    bool new_cycle;
+
+    float last_tick_value;
+
+  public:
+    //==========================================================================
+    inline float tick() noexcept
+    {
+        new_cycle = false;
+
+        angle += delta;
+        if (angle - (juce::MathConstants<double>::pi * 0.5) >
+            (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
+        {
+            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+            new_cycle = true;
+        }
+
+        return last_tick_value = (lookup(sine_lookup, angle) * -1 + 1) * 0.5;
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_frequency(double frequency_) noexcept
+    {
+        if (frequency != frequency_)
+        {
+            frequency = frequency_;
+            delta = frequency_ / sample_rate *
+                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+        }
+    }
+
+    //==========================================================================
+    inline bool is_new_cycle() const noexcept { return new_cycle; }
+
+    //==========================================================================
+    inline void sample_rate_or_block_changed() noexcept override
+    {
+        float frequency_old = frequency;
+        frequency = 0;
+        set_frequency(frequency_old);
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_SineWaveAutonomShifted(RuntimeNotifyer *const notifyer_,
+                                     const float *const sine_lookup_) noexcept
+        : RuntimeListener(notifyer_),
+
+          sine_lookup(sine_lookup_), frequency(0),
+
+          delta(0), angle(juce::MathConstants<double>::pi * 0.5),
+
+          new_cycle(0),
+
+          last_tick_value(0)
+    {
+    }
+    COLD ~mono_SineWaveAutonomShifted() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWaveAutonomShifted)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_Noise
+{
+    juce::Random random;
+    float last_tick_value;
+
+  public:
+    //==========================================================================
+    inline float tick() noexcept { return last_tick_value = random.nextFloat() * 2 - 1; }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+  public:
+    //==========================================================================
+    COLD mono_Noise() noexcept : last_tick_value(0) {}
+    COLD ~mono_Noise() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Noise)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// THE SINE - SQUARE - SAW - NOISE MORPH OF THE MASTER AND SECOND OSCS
+// Renders block wise: every wave gets its own pass over the block, then the passes are cross
+// faded. A wave is only read at the samples the wave form mixes it in.
+class mono_OscWaves
+{
+    enum WORKERS
+    {
+        SINE,
+        SQUARE,
+        SAW,
+        NOISE,
+        TMP,
+
+        SUM_WORKERS
+    };
+
+  public:
+#if MONIQUE_BANDLIMITED_TABLE_OSCILLATORS
+    // THE TABLES ONLY RUN AT THE SAMPLES THEY ARE HEARD
+    static constexpr bool has_stateful_waves = false;
+#else
+    // THE BLIT INTEGRATORS NEED EVERY SAMPLE THE CYCLE COUNTER TICKS
+    static constexpr bool has_stateful_waves = true;
+#endif
+
+  private:
+#if MONIQUE_BANDLIMITED_TABLE_OSCILLATORS
+    mono_TableWave saw_generator;
+    mono_TableWave square_generator;
+
+    // THE TABLES READ CYCLES, THE SAW PHASE RUNS AT HALF SPEED
+    static constexpr double saw_phase_scale = 1.0 / juce::MathConstants<double>::pi;
+    static constexpr double square_phase_scale = 1.0 / juce::MathConstants<double>::twoPi;
+    static constexpr float square_offset_scale = 0.5f;
+#else
+    mono_BlitSaw saw_generator;
+    mono_BlitSquare square_generator;
+
+    static constexpr double saw_phase_scale = 1;
+    static constexpr double square_phase_scale = 1;
+    static constexpr float square_offset_scale = 1;
+#endif
+    mono_SineWave sine_generator;
+    mono_Noise noise;
+
+    double saw_samples_per_cycle;
+    double square_samples_per_cycle;
+
+    mono_AudioSampleBuffer<SUM_WORKERS> workers;
+
+    //==========================================================================
+    static inline bool is_sine_used(float wave_form_) noexcept { return wave_form_ < 1; }
+    static inline bool is_square_used(float wave_form_) noexcept
+    {
+        return wave_form_ > 0 && wave_form_ < 2;
+    }
+    static inline bool is_saw_used(float wave_form_) noexcept { return wave_form_ > 1; }
+    static inline bool is_noise_used(float wave_form_) noexcept { return wave_form_ > 2; }
+
+#if MONIQUE_BANDLIMITED_TABLE_OSCILLATORS
+    static inline void pause(mono_TableWave &generator_) noexcept { generator_.pause(); }
+#else
+    template <class generator_t> static inline void pause(generator_t &) noexcept {}
+#endif
+    static inline bool is_any_sample_running(const bool *holds_, int num_samples_) noexcept
+    {
+        if (holds_)
+        {
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                if (!holds_[sid])
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+        return true;
+    }
+
+    //==========================================================================
+    inline void render_sine(float *dest_, const double *angles_, const float *phase_offsets_,
+                            int num_samples_) noexcept
+    {
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            sine_generator.set_phase_offset(phase_offsets_ ? phase_offsets_[sid] : 0);
+            dest_[sid] = sine_generator.tick(angles_[sid]);
+        }
+    }
+    inline void render_square(float *dest_, const float *wave_forms_, const double *angles_,
+                              const float *phase_offsets_, const double *samples_per_cycle_,
+                              const bool *holds_, int num_samples_) noexcept
+    {
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            if (samples_per_cycle_[sid] != square_samples_per_cycle)
+            {
+                square_samples_per_cycle = samples_per_cycle_[sid];
+                square_generator.updateHarmonics(square_samples_per_cycle);
+            }
+
+            if (holds_ && holds_[sid])
+            {
+                dest_[sid] = square_generator.lastOut();
+            }
+            else if (!has_stateful_waves && !is_square_used(wave_forms_[sid]))
+            {
+                pause(square_generator);
+                dest_[sid] = 0;
+            }
+            else
+            {
+                square_generator.set_phase_offset(
+                    phase_offsets_ ? phase_offsets_[sid] * square_offset_scale : 0);
+                dest_[sid] = square_generator.tick(angles_[sid] * square_phase_scale);
+            }
+        }
+    }
+    inline void render_saw(float *dest_, const float *wave_forms_, const double *phases_,
+                           const float *phase_offsets_, const double *samples_per_cycle_,
+                           const bool *holds_, int num_samples_) noexcept
+    {
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            if (samples_per_cycle_[sid] != saw_samples_per_cycle)
+            {
+                saw_samples_per_cycle = samples_per_cycle_[sid];
+                saw_generator.updateHarmonics(saw_samples_per_cycle);
+            }
+
+            if (holds_ && holds_[sid])
+            {
+                dest_[sid] = saw_generator.lastOut();
+            }
+            else if (!has_stateful_waves && !is_saw_used(wave_forms_[sid]))
+            {
+                pause(saw_generator);
+                dest_[sid] = 0;
+            }
+            else
+            {
+                saw_generator.set_phase_offset(phase_offsets_ ? phase_offsets_[sid] : 0);
+                dest_[sid] = saw_generator.tick(phases_[sid] * saw_phase_scale);
+            }
+        }
+    }
+    inline void render_noise(float *dest_, const float *wave_forms_, const bool *holds_,
+                             int num_samples_) noexcept
+    {
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            if (holds_ && holds_[sid])
+            {
+                dest_[sid] = noise.lastOut();
+            }
+            else
+            {
+                dest_[sid] = is_noise_used(wave_forms_[sid]) ? noise.tick() : 0;
+            }
+        }
+    }
+
+    //==========================================================================
+    // dest_ = a_ * (1 - mix) + b_ * mix, mix = wave_forms_ - offset_
+    inline void crossfade(float *dest_, const float *a_, bool use_a_, const float *b_,
+                          bool use_b_, const float *wave_forms_, float offset_,
+                          int num_samples_) noexcept
+    {
+        if (!use_b_)
+        {
+            juce::FloatVectorOperations::copy(dest_, a_, num_samples_);
+        }
+        else if (!use_a_)
+        {
+            juce::FloatVectorOperations::copy(dest_, b_, num_samples_);
+        }
+        else
+        {
+            float *const mix = workers.getWritePointer(TMP);
+            juce::FloatVectorOperations::add(mix, wave_forms_, -offset_, num_samples_);
+            juce::FloatVectorOperations::subtract(dest_, b_, a_, num_samples_);
+            juce::FloatVectorOperations::multiply(dest_, mix, num_samples_);
+            juce::FloatVectorOperations::add(dest_, a_, num_samples_);
+        }
+    }
+
+  public:
+    //==========================================================================
+    // phase_offsets_ may be nullptr for no offset, holds_ (may be nullptr) marks the samples the
+    // waves keep their last value.
+    inline void process(float *dest_, const float *wave_forms_, const double *phases_,
+                        const double *angles_, const double *samples_per_cycle_,
+                        const float *phase_offsets_, const bool *holds_,
+                        int num_samples_) noexcept
+    {
+        const juce::Range<float> wave_range(
+            juce::FloatVectorOperations::findMinAndMax(wave_forms_, num_samples_));
+        const float min_wave = wave_range.getStart();
+        const float max_wave = wave_range.getEnd();
+
+        float *const sine = workers.getWritePointer(SINE);
+        float *const square = workers.getWritePointer(SQUARE);
+        float *const saw = workers.getWritePointer(SAW);
+        float *const noises = workers.getWritePointer(NOISE);
+
+        // RENDER - A SKIPPED WAVE STOPS IF ANY SAMPLE WOULD HAVE TICKED IT
+        const bool is_running = is_any_sample_running(holds_, num_samples_);
+        if (is_sine_used(min_wave))
+        {
+            render_sine(sine, angles_, phase_offsets_, num_samples_);
+        }
+        if (has_stateful_waves || (min_wave < 2 && max_wave > 0))
+        {
+            render_square(square, wave_forms_, angles_, phase_offsets_, samples_per_cycle_,
+                          holds_, num_samples_);
+        }
+        else if (is_running)
+        {
+            pause(square_generator);
+        }
+        if (has_stateful_waves || is_saw_used(max_wave))
+        {
+            render_saw(saw, wave_forms_, phases_, phase_offsets_, samples_per_cycle_, holds_,
+                       num_samples_);
+        }
+        else if (is_running)
+        {
+            pause(saw_generator);
+        }
+        if (is_noise_used(max_wave))
+        {
+            render_noise(noises, wave_forms_, holds_, num_samples_);
+        }
+
+        // MIX
+        // SINE - SQUARE
+        if (max_wave <= 1)
+        {
+            crossfade(dest_, sine, min_wave < 1, square, max_wave > 0, wave_forms_, 0,
+                      num_samples_);
+        }
+        // SQUARE - SAW
+        else if (min_wave >= 1 && max_wave <= 2)
+        {
+            crossfade(dest_, square, min_wave < 2, saw, max_wave > 1, wave_forms_, 1,
+                      num_samples_);
+        }
+        // SAW - RAND
+        else if (min_wave > 2)
+        {
+            crossfade(dest_, saw, min_wave < 3, noises, true, wave_forms_, 2, num_samples_);
+        }
+        // MORPH OVER MORE THAN ONE PAIR
+        else
+        {
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                const float wave_form = wave_forms_[sid];
+                if (wave_form <= 1)
+                {
+                    const float multi = wave_form;
+                    dest_[sid] = (multi != 1 ? sine[sid] * (1.0f - multi) : 0) +
+                                 (multi != 0 ? square[sid] * multi : 0);
+                }
+                else if (wave_form <= 2)
+                {
+                    const float multi = wave_form - 1;
+                    dest_[sid] =
+                        (multi != 1 ? square[sid] * (1.0f - multi) : 0) + saw[sid] * multi;
+                }
+                else
+                {
+                    const float multi = wave_form - 2;
+                    dest_[sid] = saw[sid] * (1.0f - multi) + noises[sid] * multi;
+                }
+            }
+        }
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        saw_generator.reset();
+        square_generator.reset();
+    }
+    COLD void set_block_size(int block_size_) noexcept { workers.setSize(block_size_); }
+
+  public:
+    //==========================================================================
+    COLD mono_OscWaves(const float *const sine_lookup_, int block_size_) noexcept
+        :
+#if MONIQUE_BANDLIMITED_TABLE_OSCILLATORS
+          saw_generator(true), square_generator(false),
+#else
+          saw_generator(), square_generator(),
+#endif
+          sine_generator(sine_lookup_), noise(), saw_samples_per_cycle(0),
+          square_samples_per_cycle(0), workers(block_size_)
+    {
+    }
+    COLD ~mono_OscWaves() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_OscWaves)
+};
+
+//==============================================================================
+// sample = (1 - fm) * sample + fm * ((1 - shape) * sample * mod + shape * mod^3 * sample)
+static inline void add_fm(float *samples_, const float *modulator_, const float *fm_amounts_,
+                          const float *fm_shapes_, int num_samples_) noexcept
+{
+    const juce::Range<float> fm_range(
+        juce::FloatVectorOperations::findMinAndMax(fm_amounts_, num_samples_));
+    if (fm_range.getStart() == 0 && fm_range.getEnd() == 0)
+    {
+        return;
+    }
+
+    for (int sid = 0; sid != num_samples_; ++sid)
+    {
+        const float modulator_sample = modulator_[sid];
+        const float fm_amount = fm_amounts_[sid];
+        const float phase_move = fm_shapes_[sid];
+        samples_[sid] *=
+            (1.0f - fm_amount) +
+            fm_amount * modulator_sample *
+                ((1.0f - phase_move) + phase_move * modulator_sample * modulator_sample);
+    }
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_OnePole
+{
+    float last_tick_value;
+    float gain;
+    float a1, b;
+
+  public:
+    //==========================================================================
+    inline float tick(float input) noexcept
+    {
+        return last_tick_value = b * gain * input - a1 * last_tick_value;
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void setPole(float thePole) noexcept
+    {
+        if (thePole > 0)
+        {
+            b = 1.0f - thePole;
+        }
+        else
+        {
+            b = 1.0f + thePole;
+        }
+
+        a1 = -thePole;
+    }
+    inline void setGain(float gain_) noexcept { gain = gain_; }
+
+  public:
+    //==========================================================================
+    COLD mono_OnePole(float thePole = 0.9) noexcept : last_tick_value(0), gain(0), a1(0), b(0)
+    {
+        this->setPole(thePole);
+    }
+    COLD ~mono_OnePole() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_OnePole)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_Modulate : public RuntimeListener
+{
+    const float *const sine_lookup;
+
+    mono_SineWaveAutonomShifted vibrato;
+    mono_SineWaveAutonom swing;
+    mono_OnePole filter;
+    mono_Noise noise;
+
+    float last_tick_value;
+    float last_swing_frequency;
+    unsigned int noiseRate;
+    unsigned int noiseCounter;
+
+  public:
+    //==========================================================================
+    inline float tick() noexcept
+    {
+        // Compute periodic and random modulations.
+        last_tick_value = vibrato.tick();
+        if (++noiseCounter > noiseRate)
+        {
+            noise.tick();
+            noiseCounter = 0;
+        }
+        last_tick_value += filter.tick(noise.lastOut());
+
+        return last_tick_value * swing.tick();
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_vibrato_frequency(float frequency_) noexcept
+    {
+        vibrato.set_frequency(frequency_);
+    }
+    inline void set_swing_frequency(float frequency_) noexcept
+    {
+        if (last_swing_frequency != frequency_)
+        {
+            if (frequency_ == 0)
+            {
+                swing.overwrite_angle(juce::MathConstants<float>::pi * 0.5);
+            }
+
+            last_swing_frequency = frequency_;
+            swing.set_frequency(frequency_);
+        }
+    }
+    inline bool is_next_a_new_cycle() const noexcept { return vibrato.is_new_cycle(); }
+
+    //==========================================================================
+    inline void reset() noexcept { last_tick_value = 0; }
+
+    void sample_rate_or_block_changed() noexcept override
+    {
+        noiseRate = (unsigned int)(330.0 * sample_rate / 22050.0);
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_Modulate(RuntimeNotifyer *const notifyer_, const float *const sine_lookup_) noexcept
+        : RuntimeListener(notifyer_),
+
+          sine_lookup(sine_lookup_),
+
+          vibrato(notifyer_, sine_lookup_), swing(notifyer_, sine_lookup_),
+
+          filter(), noise(),
+
+          last_tick_value(0), last_swing_frequency(0), noiseRate(0), noiseCounter(0)
+    {
+        vibrato.set_frequency(6.0);
+        swing.set_frequency(0);
+        swing.overwrite_angle(juce::MathConstants<float>::pi * 0.5);
+
+        noiseRate = (unsigned int)(330.0 * sample_rate / 22050.0);
+        noiseCounter = noiseRate;
+
+        filter.setPole(0.999);
+        filter.setGain(0.05);
+    }
+    COLD ~mono_Modulate() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Modulate)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class LFO : public RuntimeListener
+{
+    const float *const sine_lookup;
+
+    float delta;
+    float angle;
+    int last_samples_per_clock;
+
+    int last_speed;
+    float last_out;
+
+    float glide_samples;
+    int glide_counter;
+    float glide_value;
+
+    DataBuffer *const data_buffer;
+    const LFOData *const lfo_data;
+    const RuntimeInfo *const runtime_info;
+
+    //==============================================================================
+    inline void calculate_delta(const int samples_per_clock_, const float speed_multi_,
+                                const std::int64_t sync_sample_pos_) noexcept
+    {
+        if (last_samples_per_clock != samples_per_clock_)
+        {
+            {
+                const float samples_per_bar = samples_per_clock_ * 96;
+                const float samples_per_cylce = samples_per_bar * speed_multi_;
+                delta = (1.0f / samples_per_cylce);
+            }
+
+            last_samples_per_clock = samples_per_clock_;
+        }
+    }
+
+  public:
+    inline void process(float *dest_, int step_number_, int absoloute_step_number_,
+                        int start_pos_in_buffer_, int num_samples_, bool use_process_sample = true,
+                        juce::Array<RuntimeInfo::standalone_features::ClockSync::SyncPosPair>
+                            *clock_infos_ = nullptr) noexcept
+    {
+        // USER SPEED
+        const int speed(lfo_data->speed);
+        const float speed_multi(get_lfo_speed_multi(speed));
+        if (speed != last_speed)
+        {
+            glide_samples = glide_counter = sample_rate / 1000;
+            glide_value = last_out;
+            last_speed = speed;
+        }
+
+        // TO MIDI CLOCK SYNC
+        std::int64_t sync_sample_pos =
+            (runtime_info->relative_samples_since_start + start_pos_in_buffer_);
+        if (!use_process_sample)
+        {
+            sync_sample_pos = start_pos_in_buffer_;
+        }
+
+        bool same_samples_per_block_for_buffer = true;
+        if (is_standalone() && runtime_info->standalone_features_pimpl->is_extern_synced)
+        {
+            auto &runtime_info_standalone_features = *runtime_info->standalone_features_pimpl;
+
+            juce::Array<RuntimeInfo::standalone_features::ClockSync::SyncPosPair>
+                clock_informations =
+                    clock_infos_ ? *clock_infos_
+                                 : runtime_info_standalone_features.clock_sync_information
+                                       .get_a_working_copy();
+
+            if (!runtime_info_standalone_features.clock_sync_information.has_clocks_inside())
+            {
+                same_samples_per_block_for_buffer = true;
+                calculate_delta(runtime_info_standalone_features.clock_sync_information
+                                    .get_last_samples_per_clock(),
+                                speed_multi, sync_sample_pos);
+            }
+            else
+            {
+                same_samples_per_block_for_buffer = false;
+            }
+
+            if (sync_sample_pos <= 0)
+            {
+                angle = 0;
+            }
+
+            // FORCE SYNC
+            if (step_number_ != -1)
+            {
+                bool should_smooth = false;
+                if (fmod(absoloute_step_number_, speed_multi * 16) == 0)
+                {
+                    should_smooth = angle != 0;
+                    angle = 0;
+                }
+
+                if (should_smooth && glide_counter <= 0)
+                {
+                    glide_samples = glide_counter = juce::jmax(10.0, sample_rate / 1000);
+                    glide_value = last_out;
+                }
+            }
+
+            // PROCESS
+            {
+                const float *smoothed_wave_buffer(
+                    lfo_data->wave_smoother.get_smoothed_value_buffer());
+                const float *smoothed_offset_buffer(
+                    lfo_data->phase_shift_smoother.get_smoothed_value_buffer());
+                for (int sid = 0; sid != num_samples_; ++sid)
+                {
+                    if (++sync_sample_pos < 0)
+                    {
+                        continue;
+                    }
+
+                    {
+                        float amp;
+                        {
+                            // CURRENT ANGLE
+                            {
+                                if (!same_samples_per_block_for_buffer)
+                                {
+                                    calculate_delta(
+                                        runtime_info_standalone_features.clock_sync_information
+                                            .get_samples_per_clock(start_pos_in_buffer_ + sid,
+                                                                   clock_informations),
+                                        speed_multi, sync_sample_pos);
+                                }
+                                angle += delta;
+                                angle = angle - floor(angle);
+                            }
+
+                            // AMP
+                            {
+                                const float sine_amp =
+                                    lookup(sine_lookup, angle * juce::MathConstants<double>::twoPi +
+                                                            smoothed_offset_buffer[sid] *
+                                                                juce::MathConstants<double>::twoPi);
+                                const float wave = smoothed_wave_buffer[sid];
+                                amp = sine_amp * (1.0f - wave) +
+                                      (std::atan(sine_amp * 250 * juce::jmax(speed_multi, 1.0f)) *
+                                       (1.0f / 1.55)) *
+                                          wave;
+                                if (amp > 1)
+                                {
+                                    amp = 1;
+                                }
+                                else if (amp < -1)
+                                {
+                                    amp = -1;
+                                }
+                                amp = lfo2amp(amp);
+                            }
+                        }
+
+                        if (--glide_counter > 0)
+                        {
+                            float glide = (1.0f / glide_samples * glide_counter);
+                            amp = amp * (1.0f - glide) + glide_value * glide;
+                        }
+
+                        dest_[sid] = amp;
+                    }
+                }
+                last_out = dest_[num_samples_ - 1];
+            }
+        }
+        else
+        // PERFECT SYNC
+        {
+            const float bars_per_sec = runtime_info->bpm / 4 / 60;
+            const float samples_per_bar = (1.0f / bars_per_sec) * sample_rate;
+            const float samples_per_cylce = samples_per_bar * speed_multi;
+            const float cycles_per_sample = (1.0 / samples_per_cylce);
+
+            // PROCESS
+            {
+                const float *smoothed_wave_buffer(
+                    lfo_data->wave_smoother.get_smoothed_value_buffer());
+                const float *smoothed_offset_buffer(
+                    lfo_data->phase_shift_smoother.get_smoothed_value_buffer());
+                for (int sid = 0; sid != num_samples_; ++sid)
+                {
+                    float amp;
+                    {
+                        angle = cycles_per_sample * sync_sample_pos;
+                        angle = angle - floor(angle);
+
+                        // AMP
+                        {
+                            const float sine_amp =
+                                lookup(sine_lookup, angle * juce::MathConstants<double>::twoPi +
+                                                        smoothed_offset_buffer[sid] *
+                                                            juce::MathConstants<double>::twoPi);
+                            const float wave = smoothed_wave_buffer[sid];
+                            amp = sine_amp * (1.0f - wave) +
+                                  (std::atan(sine_amp * 250 * juce::jmax(speed_multi, 1.0f)) *
+                                   (1.0f / 1.55)) *
+                                      wave;
+                            if (amp > 1)
+                            {
+                                amp = 1;
+                            }
+                            else if (amp < -1)
+                            {
+                                amp = -1;
+                            }
+                            amp = lfo2amp(amp);
+                        }
+                    }
+
+                    if (glide_counter > 0 && false)
+                    {
+                        --glide_counter;
+                        float glide = (1.0f / glide_samples * glide_counter);
+                        amp = amp * (1.0f - glide) + glide_value * glide;
+                    }
+
+                    dest_[sid] = amp;
+
+                    ++sync_sample_pos;
+                }
+                last_out = dest_[num_samples_ - 1];
+            }
+        }
+    }
+
+    void sample_rate_or_block_changed() noexcept override { last_speed = -1; }
+
+    // THE POPUP PREVIEWS RUN WITHOUT A NOTIFYER AT THEIR OWN RATE
+    COLD void set_preview_sample_rate(double sample_rate_) noexcept { sample_rate = sample_rate_; }
+
+    //==========================================================================
+    float get_current_amp() const noexcept { return last_out; }
+
+    //==========================================================================
+    void reset() noexcept { last_out = 0; }
+
+  public:
+    //==========================================================================
+    LFO(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_, LFOData *lfo_data_,
+        const float *const sine_lookup_)
+    noexcept
+        : RuntimeListener(notifyer_),
+
+          sine_lookup(sine_lookup_),
+
+          delta(0), angle(0), last_samples_per_clock(-1),
+
+          last_speed(0), last_out(0),
+
+          glide_samples(0), glide_counter(0), glide_value(0),
+
+          data_buffer(synth_data_->data_buffer), lfo_data(lfo_data_),
+          runtime_info(synth_data_->runtime_info)
+    {
+    }
+    ~LFO() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LFO)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class MasterOSC : public RuntimeListener
+{
+    // RUNTIME
+    //==============================================================================
+    int freq_glide_samples_left;
+    float freq_glide_delta;
+
+    float sync_glide_samples;
+    int sync_glide_samples_left;
+    float last_value;
+    float last_modulator_value;
+    float sync_value;
+    float sync_modulator_value;
+
+    float root_note;
+
+    float last_root_note;
+    float last_frequency;
+
+    float last_modulator_frequency;
+    int modulator_sync_cylces;
+    int modulator_run_circle;
+    bool modulator_waits_for_sync_cycle;
+
+    // RAW OSCILATORS
+    //==============================================================================
+    PerfectCycleCounter cycle_counter;
+    mono_OscWaves waves;
+
+    // BLOCK BUFFERS
+    //==============================================================================
+    juce::HeapBlock<double> phases;
+    juce::HeapBlock<double> angles;
+    juce::HeapBlock<double> samples_per_cycle;
+
+    mono_Modulate modulator;
+
+    // DATA SOURCE
+    //==============================================================================
+    DataBuffer *const data_buffer;
+    const MoniqueSynthData *const synth_data;
+    FMOscData *const fm_osc_data;
+    OSCData *const osc_data;
+
+  public:
+    //==============================================================================
+    inline void process(DataBuffer *data_buffer_, const int num_samples_) noexcept
+    {
+        float *const output_buffer(data_buffer->osc_samples.getWritePointer(MASTER_OSC));
+
+        float *const switch_buffer(data_buffer->osc_switchs.getWritePointer());
+        float *const modulator_buffer(data_buffer->modulator_samples.getWritePointer(MASTER_OSC));
+        const float *const lfo_amps((data_buffer->lfo_amplitudes.getReadPointer(MASTER_OSC)));
+
+        const bool is_lfo_modulated = osc_data->is_lfo_modulated;
+        const bool fm_sync = fm_osc_data->sync;
+
+        fm_osc_data->master_shift_smoother.process_modulation(is_lfo_modulated, lfo_amps,
+                                                              num_samples_);
+
+        // const float*const smoothed_tune_buffer(
+        // osc_data->tune_smoother.get_smoothed_modulated_value_buffer() );
+        const float *const smoothed_fm_amount_buffer(
+            osc_data->fm_amount_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_wave_buffer(
+            osc_data->wave_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_fm_freq_buffer(
+            fm_osc_data->fm_freq_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_fm_swing_buffer(
+            fm_osc_data->fm_swing_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_fm_phaser(
+            fm_osc_data->fm_shape_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_phase_offset(
+            fm_osc_data->master_shift_smoother.get_smoothed_value_buffer());
+
+        // TUNE, PHASE AND MODULATOR
+        for (int sid = 0; sid < num_samples_; ++sid)
+        {
+            // BASE FREQUENCY
+            bool base_frequency_changed = false;
+            if (freq_glide_samples_left > 0 || last_root_note != root_note)
+            {
+                if (freq_glide_samples_left > 0)
+                {
+                    --freq_glide_samples_left;
+                }
+
+                last_root_note = root_note;
+
+                const float new_frequence = juce::jmax(
+                    5.0f, synth_data->tuning->midiNoteToFrequency(
+                              root_note + freq_glide_delta * freq_glide_samples_left));
+                if (new_frequence != last_frequency)
+                {
+                    cycle_counter.set_frequency(new_frequence);
+
+                    last_frequency = new_frequence;
+                }
+
+                base_frequency_changed = true;
+            }
+
+            // MODULATOR FREQUENCY
+            {
+                const float modulator_freq = smoothed_fm_freq_buffer[sid];
+                if (base_frequency_changed || modulator_freq != last_modulator_frequency)
+                {
+                    modulator.set_vibrato_frequency(last_frequency +
+                                                    last_frequency * (modulator_freq * 6 + 1.01));
+                    modulator_sync_cylces = std::floor(modulator_freq * 6 + 1);
+
+                    last_modulator_frequency = modulator_freq;
+                }
+            }
+
+            // TICK
+            cycle_counter.tick();
+            phases[sid] = cycle_counter.get_last_phase();
+            angles[sid] = cycle_counter.get_last_angle();
+            samples_per_cycle[sid] = cycle_counter.get_cylces_per_sec();
+
+            // FORCE SYNC OF THE SINE AT THE NEXT SID
+            const bool is_last_sample_of_cycle = cycle_counter.is_new_cycle();
+            switch_buffer[sid] = is_last_sample_of_cycle;
+
+            // MODULATOR SYNC AND PROCESSING
+            float modulator_sample = 0;
+            if (!modulator_waits_for_sync_cycle)
+            {
+                modulator_sample = modulator.tick();
+            }
+
+            const bool is_last_sample_of_modulator_cycle = modulator.is_next_a_new_cycle();
+
+            // STOP THE MODULATOR IF IN SYNC // IGNORED IF SHOT IS ENABLED
+            if (modulator_run_circle > modulator_sync_cylces && fm_sync)
+            {
+                modulator_waits_for_sync_cycle = !is_last_sample_of_cycle;
+                modulator_run_circle = 0;
+            }
+            else if (is_last_sample_of_cycle)
+            {
+                modulator_waits_for_sync_cycle = false;
+                modulator_run_circle = 0;
+            }
+
+            // COUNT CYCLES AND CLEAR STATE IF NOT WAITING FOR SYNC
+            if (is_last_sample_of_modulator_cycle && !modulator_waits_for_sync_cycle)
+            {
+                ++modulator_run_circle;
+            }
+
+            // UPDATE SWING
+            if (is_last_sample_of_modulator_cycle)
+            {
+                modulator.set_swing_frequency(smoothed_fm_swing_buffer[sid] * 5);
+            }
+
+            modulator_buffer[sid] = modulator_sample;
+        }
+
+        // WAVES
+        const SmoothedParameter &master_shift_smoother = fm_osc_data->master_shift_smoother;
+        const bool has_phase_offset =
+            !master_shift_smoother.is_constant() || master_shift_smoother.get_constant_value() != 0;
+        waves.process(output_buffer, smoothed_wave_buffer, phases, angles, samples_per_cycle,
+                      has_phase_offset ? smoothed_phase_offset : nullptr, nullptr, num_samples_);
+
+        // ADD FM TO THE OUTPUT
+        const SmoothedParameter &fm_amount_smoother = osc_data->fm_amount_smoother;
+        if (!fm_amount_smoother.is_constant() || fm_amount_smoother.get_constant_value() != 0)
+        {
+            add_fm(output_buffer, modulator_buffer, smoothed_fm_amount_buffer, smoothed_fm_phaser,
+                   num_samples_);
+        }
+
+        // GLIDE IN AFTER A RESET
+        if (sync_glide_samples_left > 1)
+        {
+            const int glide_samples = juce::jmin(num_samples_, sync_glide_samples_left - 1);
+            for (int sid = 0; sid < glide_samples; ++sid)
+            {
+                const float power =
+                    1.0f / sync_glide_samples * (sync_glide_samples_left - 1 - sid);
+                output_buffer[sid] = output_buffer[sid] * (1.0f - power) + sync_value * power;
+                modulator_buffer[sid] =
+                    modulator_buffer[sid] * (1.0f - power) + sync_modulator_value * power;
+            }
+        }
+        sync_glide_samples_left = juce::jmax(0, sync_glide_samples_left - num_samples_);
+
+        last_value = output_buffer[num_samples_ - 1];
+        last_modulator_value = modulator_buffer[num_samples_ - 1];
+    }
+
+    //==============================================================================
+    inline void update(float root_note_, int sample_pos_) noexcept
+    {
+        root_note_ += synth_data->octave_offset * 12;
+        const float glide = synth_data->glide_smoother.get_smoothed_value_buffer()[sample_pos_];
+        if (glide != 0 && (root_note != root_note_ || freq_glide_samples_left > 0))
+        {
+            root_note_ = juce::jmax(1.0f, juce::jmin(127.0f, root_note_));
+
+            const float rest_glide = freq_glide_delta * freq_glide_samples_left;
+            freq_glide_samples_left = juce::jmax(10.0f, float(sample_rate * 0.5) * glide);
+            const float glide_notes_diverence = root_note - root_note_;
+            if (freq_glide_samples_left > 0)
+            {
+                freq_glide_delta = (glide_notes_diverence + rest_glide) / freq_glide_samples_left;
+            }
+            else
+            {
+                freq_glide_delta = 0;
+            }
+        }
+
+        root_note = root_note_;
+    }
+    inline void reset() noexcept
+    {
+        cycle_counter.reset();
+        waves.reset();
+        modulator.reset();
+
+        freq_glide_delta = 0;
+        freq_glide_samples_left = 0;
+
+        sync_value = last_value;
+        sync_modulator_value = last_modulator_value;
+        sync_glide_samples = juce::jmax(10, msToSamplesFast(1, sample_rate));
+        sync_glide_samples_left = sync_glide_samples;
+    }
+
+    void sample_rate_or_block_changed() noexcept override
+    {
+        phases.realloc(block_size);
+        angles.realloc(block_size);
+        samples_per_cycle.realloc(block_size);
+        waves.set_block_size(block_size);
+    }
+
+  public:
+    //==============================================================================
+    COLD MasterOSC(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
+                   const float *const sine_lookup_) noexcept
+        : RuntimeListener(notifyer_),
+
+          freq_glide_samples_left(0), freq_glide_delta(0),
+
+          sync_glide_samples(0), sync_glide_samples_left(0), last_value(0), last_modulator_value(0),
+          sync_value(0), sync_modulator_value(0),
+
+          root_note(60),
+
+          last_root_note(0), last_frequency(0),
+
+          last_modulator_frequency(0), modulator_sync_cylces(0), modulator_run_circle(0),
+          modulator_waits_for_sync_cycle(false),
+
+          cycle_counter(notifyer_), waves(sine_lookup_, block_size),
+
+          phases(block_size), angles(block_size), samples_per_cycle(block_size),
+
+          modulator(notifyer_, sine_lookup_),
+
+          data_buffer(synth_data_->data_buffer), synth_data(synth_data_),
+          fm_osc_data(synth_data_->fm_osc_data.get()), osc_data(synth_data_->osc_datas[MASTER_OSC])
+    {
+    }
+    COLD ~MasterOSC() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MasterOSC)
+};
+
+//===================================================================================
+//===================================================================================
+//===================================================================================
+class SecondOSC : public RuntimeListener
+{
+    const int id;
+
+    // RUNTIME
+    //==============================================================================
+    int freq_glide_samples_left;
+    float freq_glide_delta;
+
+    float sync_glide_samples;
+    int sync_glide_samples_left;
+    float last_value;
+    float sync_value;
+
+    float root_note;
+    float last_root_note;
+    float last_tune;
+    float last_frequency;
+
+    bool wait_for_new_master_cycle;
+    float last_sync_was_to_tune;
+
+    // RAW OSCILATORS
+    //==============================================================================
+    PerfectCycleCounter cycle_counter;
+    mono_OscWaves waves;
+
+    // BLOCK BUFFERS
+    //==============================================================================
+    juce::HeapBlock<double> phases;
+    juce::HeapBlock<double> angles;
+    juce::HeapBlock<double> samples_per_cycle;
+    juce::HeapBlock<bool> holds;
+    juce::HeapBlock<float> gates;
+
+    // DATA SOURCE
+    //==============================================================================
+    DataBuffer *const data_buffer;
+    const MoniqueSynthData *const synth_data;
+    OSCData *const osc_data;
+    OSCData *const master_osc_data;
+    FMOscData *const fm_osc_data;
+
+  public:
+    //==============================================================================
+    static inline bool is_syncanble_by_tune(float tune_) noexcept
+    {
+        bool syncable = false;
+        if (tune_ == 0)
+        {
+            syncable = true;
+        }
+        else if (tune_ == 0 + 24)
+        {
+            syncable = true;
+        }
+        else if (tune_ == 0 - 24)
+        {
+            syncable = true;
+        }
+
+        return syncable;
+    }
+
+    //==============================================================================
+    inline void process(DataBuffer *data_buffer_, const int num_samples_) noexcept
+    {
+        float *const output_buffer(data_buffer->osc_samples.getWritePointer(id));
+
+        const float *const switch_buffer(data_buffer->osc_switchs.getWritePointer());
+        const float *const modulator_buffer(
+            data_buffer->modulator_samples.getWritePointer(MASTER_OSC));
+        const float *const lfo_amps((data_buffer->lfo_amplitudes.getReadPointer(id)));
+
+        const bool is_lfo_modulated = osc_data->is_lfo_modulated;
+
+        const bool sync_to_master = osc_data->sync;
+        osc_data->tune_smoother.process_modulation(is_lfo_modulated, lfo_amps, num_samples_);
+        const float *const smoothed_tune_buffer(
+            osc_data->tune_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_fm_amount_buffer(
+            osc_data->fm_amount_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_wave_buffer(
+            osc_data->wave_smoother.get_smoothed_value_buffer());
+        // const float*const smoothed_fm_swing_buffer(
+        // fm_osc_data->fm_swing_smoother.get_smoothed_modulated_value_buffer() );
+        const float *const smoothed_fm_phaser(
+            fm_osc_data->fm_shape_smoother.get_smoothed_value_buffer());
+
+        // TUNE, PHASE AND SYNC TO THE MASTER
+        for (int sid = 0; sid < num_samples_; ++sid)
+        {
+            // SETUP TUNE
+            const float tune = smoothed_tune_buffer[sid];
+            {
+                // FREQUENCY
+                if (freq_glide_samples_left > 0 || tune != last_tune || last_root_note != root_note)
+                {
+                    if (freq_glide_samples_left > 0)
+                    {
+                        --freq_glide_samples_left;
+                    }
+
+                    {
+                        last_tune = tune;
+                        last_root_note = root_note;
+
+                        const float new_frequence =
+                            juce::jmax(5.0f, synth_data->tuning->midiNoteToFrequency(
+                                                 root_note + tune +
+                                                 freq_glide_delta * freq_glide_samples_left));
+                        if (new_frequence != last_frequency)
+                        {
+                            cycle_counter.set_frequency(new_frequence);
+                        }
+                    }
+                }
+            }
+
+            // TICK THE CYCLE COUNTER
+            const bool is_last_sample_of_master_cycle = switch_buffer[sid];
+            const bool was_waiting_for_new_master_cycle = wait_for_new_master_cycle;
+            if (!wait_for_new_master_cycle)
+            {
+                cycle_counter.tick();
+            }
+            phases[sid] = cycle_counter.get_last_phase();
+            angles[sid] = cycle_counter.get_last_angle();
+            samples_per_cycle[sid] = cycle_counter.get_cylces_per_sec();
+
+            // FORCE SYNC OF THE SINE AT THE NEXT SID
+            if (cycle_counter.is_new_cycle())
+            {
+                const bool syncanble_by_tune = is_syncanble_by_tune(tune);
+                if (!syncanble_by_tune)
+                {
+                    last_sync_was_to_tune = -25;
+                }
+                if (sync_to_master)
+                {
+                    if (!is_lfo_modulated && !syncanble_by_tune && last_sync_was_to_tune != tune)
+                    {
+                        wait_for_new_master_cycle = true;
+                    }
+                }
+                else
+                {
+                    if (!is_lfo_modulated && freq_glide_samples_left <= 0)
+                    {
+                        if (syncanble_by_tune && last_sync_was_to_tune != tune)
+                        {
+                            wait_for_new_master_cycle = true;
+                            last_sync_was_to_tune = tune;
+                        }
+                    }
+                }
+            }
+            if (is_last_sample_of_master_cycle)
+            {
+                wait_for_new_master_cycle = false;
+            }
+
+            // SILENT WHILE WAITING FOR THE MASTER
+            gates[sid] = !wait_for_new_master_cycle;
+            holds[sid] = mono_OscWaves::has_stateful_waves ? was_waiting_for_new_master_cycle
+                                                           : wait_for_new_master_cycle;
+        }
+
+        // WAVES
+        waves.process(output_buffer, smoothed_wave_buffer, phases, angles, samples_per_cycle,
+                      nullptr, holds, num_samples_);
+        juce::FloatVectorOperations::multiply(output_buffer, gates, num_samples_);
+
+        // ADD FM TO THE OUTPUT
+        add_fm(output_buffer, modulator_buffer, smoothed_fm_amount_buffer, smoothed_fm_phaser,
+               num_samples_);
+
+        // GLIDE IN AFTER A RESET
+        if (sync_glide_samples_left > 1)
+        {
+            const int glide_samples = juce::jmin(num_samples_, sync_glide_samples_left - 1);
+            for (int sid = 0; sid < glide_samples; ++sid)
+            {
+                const float power =
+                    1.0f / sync_glide_samples * (sync_glide_samples_left - 1 - sid);
+                output_buffer[sid] = output_buffer[sid] * (1.0f - power) + sync_value * power;
+            }
+        }
+        sync_glide_samples_left = juce::jmax(0, sync_glide_samples_left - num_samples_);
+
+        last_value = output_buffer[num_samples_ - 1];
+    }
+
+    //==============================================================================
+    inline void update(float root_note_, int sample_pos_) noexcept
+    {
+        root_note_ += synth_data->octave_offset * 12;
+        const float glide = synth_data->glide_smoother.get_smoothed_value_buffer()[sample_pos_];
+        if (glide != 0 && (root_note != root_note_ || freq_glide_samples_left > 0))
+        {
+            root_note_ = juce::jmax(1.0f, juce::jmin(127.0f, root_note_));
+
+            const float rest_glide = freq_glide_delta * freq_glide_samples_left;
+            freq_glide_samples_left = (sample_rate * 0.5) * glide;
+            const float glide_notes_diverence = root_note - root_note_;
+            if (freq_glide_samples_left > 0)
+            {
+                freq_glide_delta = (glide_notes_diverence + rest_glide) / freq_glide_samples_left;
+            }
+            else
+            {
+                freq_glide_delta = 0;
+            }
+        }
+
+        root_note = root_note_;
+    }
+    inline void reset() noexcept
+    {
+        cycle_counter.reset();
+        waves.reset();
+
+        freq_glide_delta = 0;
+        freq_glide_samples_left = 0;
+
+        wait_for_new_master_cycle = false;
+
+        sync_value = last_value;
+        sync_glide_samples = juce::jmax(10, msToSamplesFast(1, sample_rate));
+        sync_glide_samples_left = sync_glide_samples;
+    }
+    void sample_rate_or_block_changed() noexcept override
+    {
+        phases.realloc(block_size);
+        angles.realloc(block_size);
+        samples_per_cycle.realloc(block_size);
+        holds.realloc(block_size);
+        gates.realloc(block_size);
+        waves.set_block_size(block_size);
+    }
+
+  public:
+    //==============================================================================
+    COLD SecondOSC(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_, int id_,
+                   const float *const sine_lookup_) noexcept
+        : RuntimeListener(notifyer_),
+
+          id(id_),
+
+          freq_glide_samples_left(0), freq_glide_delta(0),
+
+          sync_glide_samples(0), sync_glide_samples_left(0), last_value(0), sync_value(0),
+
+          root_note(60), last_root_note(0), last_tune(-25), last_frequency(0),
+
+          wait_for_new_master_cycle(false), last_sync_was_to_tune(-25),
+
+          cycle_counter(notifyer_), waves(sine_lookup_, block_size),
+
+          phases(block_size), angles(block_size), samples_per_cycle(block_size),
+          holds(block_size), gates(block_size),
+
+          data_buffer(synth_data_->data_buffer), synth_data(synth_data_),
+          osc_data(synth_data_->osc_datas[id_]),
+          master_osc_data(synth_data_->osc_datas[MASTER_OSC]),
+          fm_osc_data(synth_data_->fm_osc_data.get())
+    {
+    }
+    COLD ~SecondOSC() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SecondOSC)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_ENVOsccilator : public RuntimeListener
+{
+    const float *const sine_lookup;
+    const float *const cos_lookup;
+    const float *const exp_lookup;
+
+    float start_amp;
+    float out_amp;
+    float target_amp;
+    enum TYPE
+    {
+        ATTACK,
+        RELEASE,
+        KEEP
+    };
+    TYPE type;
+
+    float delta;
+    float angle;
+    float sine_angle_start;
+
+    float shape;
+    float time_in_samples;
+    int sample_counter;
+    bool is_unlimited;
+
+  public:
+    //==========================================================================
+    // SHAPE 0 - sine-, 1 - linear, 2 - sine+
+    inline void set_process_values(float start_value_, float end_value_, float shape_,
+                                   float time_in_samples_) noexcept
+    {
+        start_amp = start_value_;
+        target_amp = end_value_;
+        shape = ((shape_ + 1) * 0.5f) * 0.9f + 0.1;
+        time_in_samples = time_in_samples_;
+    }
+    inline void calculate_attack_coeffecients() noexcept
+    {
+        sample_counter = time_in_samples;
+        angle = 0;
+        sine_angle_start = juce::MathConstants<float>::pi * 1.5f;
+        type = TYPE::ATTACK;
+        is_unlimited = false;
+        delta = juce::MathConstants<float>::pi / sample_counter;
+    }
+    inline void calculate_release_coeffecients() noexcept
+    {
+        sample_counter = time_in_samples;
+        angle = 0;
+        sine_angle_start = juce::MathConstants<float>::pi * 1.5f;
+        type = TYPE::RELEASE;
+        is_unlimited = false;
+        delta = juce::MathConstants<float>::pi / sample_counter;
+    }
+    inline void calculate_keep_coeffecients() noexcept
+    {
+        sample_counter = time_in_samples;
+        delta = 0;
+        angle = 0;
+        type = TYPE::KEEP;
+        is_unlimited = false;
+    }
+    inline void calculate_unlimited_coeffecients() noexcept
+    {
+        sample_counter = 0;
+        delta = 0;
+        angle = 0;
+        type = TYPE::KEEP;
+        is_unlimited = true;
+    }
+    inline void only_calculate_new_target(float target_) noexcept
+    {
+        // start_amp = out_amp;
+        target_amp = target_;
+        // sample_counter = time_in_samples;
+        // delta = (juce::MathConstants<float>::pi) / sample_counter;
+        // angle = 0;
+    }
+
+    //==========================================================================
+    void sample_rate_or_block_changed() noexcept override
+    {
+        // AUTO RESET ON NEXT CYCLE
+    }
+
+  public:
+    //==========================================================================
+    inline float tick() noexcept
+    {
+        if (--sample_counter > 0)
+        {
+            if (delta != 0)
+            {
+                angle += delta;
+                /*shape*(angle-cos_for_angle)*/
+                const float angle_drift =
+                    lookup(exp_lookup, angle) * angle * shape +
+                    (angle + lookup(cos_lookup, angle + sine_angle_start)) * (1.0f - shape);
+                if (type == TYPE::ATTACK)
+                {
+                    out_amp = start_amp +
+                              ((lookup(sine_lookup, angle_drift + sine_angle_start) + 1) * 0.5f) *
+                                  (target_amp - start_amp);
+                }
+                else if (type == TYPE::RELEASE)
+                {
+                    out_amp = start_amp -
+                              ((lookup(sine_lookup, angle_drift + sine_angle_start) + 1) * 0.5f) *
+                                  (start_amp - target_amp);
+                }
+            }
+        }
+        else
+        {
+            out_amp = target_amp;
+        }
+
+        return out_amp;
+    }
+
+  public:
+    //==========================================================================
+    inline float last_out() const noexcept { return out_amp; }
+    inline void overwrite_current_value(float amp_) noexcept { out_amp = amp_; }
+
+    //==========================================================================
+    inline bool is_finished() const noexcept { return is_endless() && sample_counter <= 0; }
+    inline bool is_endless() const noexcept { return !is_unlimited; }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        sample_counter = 0;
+        start_amp = 0;
+        out_amp = 0;
+        type = KEEP;
+        target_amp = 0;
+        delta = 0;
+        angle = 0;
+        time_in_samples = 0;
+        sample_counter = 0;
+        is_unlimited = false;
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_ENVOsccilator(RuntimeNotifyer *const notifyer_, const float *const sine_lookup_,
+                            const float *const cos_lookup_, const float *const exp_lookup_) noexcept
+
+        : RuntimeListener(notifyer_), sine_lookup(sine_lookup_), cos_lookup(cos_lookup_),
+          exp_lookup(exp_lookup_),
+
+          start_amp(0), out_amp(0), target_amp(0), type(KEEP),
+
+          delta(0), angle(0), sine_angle_start(0),
+
+          shape(0),
+
+          time_in_samples(0), sample_counter(0), is_unlimited(false)
+    {
+    }
+    COLD ~mono_ENVOsccilator() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_ENVOsccilator)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+enum STAGES
+{
+    END_ENV = false,
+    ATTACK = true,
+    DECAY,
+    SUSTAIN,
+    RELEASE,
+    TRIGGER_START
+};
+class ENV : RuntimeListener
+{
+    mono_ENVOsccilator env_osc;
+
+    STAGES current_stage;
+
+    const MoniqueSynthData *const synth_data;
+    float last_sustain;
+    bool goes_to_sustain;
+    bool is_sustain;
+
+  public:
+    ENVData *const env_data;
+
+  public:
+    //==========================================================================
+    inline void process(float *dest_, const int num_samples_) noexcept
+    {
+        const float *smoothed_sustain_buffer =
+            env_data->sustain_smoother.get_smoothed_value_buffer();
+        for (int sid = 0; sid < num_samples_; ++sid)
+        {
+            const float sustain = smoothed_sustain_buffer[sid];
+            if (last_sustain != sustain)
+            {
+                last_sustain = sustain;
+                if (goes_to_sustain)
+                {
+                    env_osc.only_calculate_new_target(last_sustain);
+                }
+                else if (is_sustain)
+                {
+                    env_osc.overwrite_current_value(last_sustain);
+                }
+            }
+            dest_[sid] = env_osc.tick();
+
+            if (env_osc.is_finished())
+            {
+                update_stage(sid);
+            }
+        }
+    }
+
+  private:
+    inline void update_stage(int sid_, bool force_relese_ = false) noexcept
+    {
+        const float *smoothed_sustain_buffer =
+            env_data->sustain_smoother.get_smoothed_value_buffer();
+        const float *smoothed_shape_buffer = env_data->shape_smoother.get_smoothed_value_buffer();
+        switch (current_stage)
+        {
+        case TRIGGER_START: // --> ATTACK
+        {
+            if (env_data->decay > 0)
+            {
+                env_osc.set_process_values(env_osc.last_out(), 1, smoothed_shape_buffer[sid_],
+                                           get_env_samples(env_data->attack, sample_rate));
+                goes_to_sustain = false;
+                is_sustain = false;
+            }
+            else
+            {
+                env_osc.set_process_values(env_osc.last_out(), smoothed_sustain_buffer[sid_],
+                                           smoothed_shape_buffer[sid_],
+                                           get_env_samples(env_data->attack, sample_rate));
+                goes_to_sustain = true;
+                is_sustain = false;
+            }
+
+            env_osc.calculate_attack_coeffecients();
+            current_stage = ATTACK;
+
+            break;
+        }
+        case ATTACK: // --> DECAY
+        {
+            const float decay = env_data->decay;
+            if (decay > 0)
+            {
+                env_osc.set_process_values(env_osc.last_out(), smoothed_sustain_buffer[sid_],
+                                           smoothed_shape_buffer[sid_],
+                                           get_env_samples(decay, sample_rate));
+                goes_to_sustain = true;
+                is_sustain = false;
+                env_osc.calculate_release_coeffecients();
+
+                current_stage = DECAY;
+
+                break;
+            }
+            // ELSE FALL TO DECAY AND START SUSTAIN LEVEL
+            [[fallthrough]];
+        }
+        case DECAY: // --> SUSTAIN
+        {
+            const float sustain_time = env_data->sustain_time;
+            const float sustain_level = smoothed_sustain_buffer[sid_];
+            if (sustain_time >= 1)
+            {
+                env_osc.set_process_values(env_osc.last_out(), sustain_level,
+                                           smoothed_shape_buffer[sid_],
+                                           get_env_samples(sustain_time, sample_rate));
+                env_osc.calculate_unlimited_coeffecients();
+                is_sustain = true;
+                goes_to_sustain = false;
+            }
+            else
+            {
+                env_osc.set_process_values(
+                    env_osc.last_out(), sustain_level, smoothed_shape_buffer[sid_],
+                    juce::jmax(20.0f, get_env_samples(sustain_time, sample_rate)));
+                env_osc.calculate_release_coeffecients();
+                is_sustain = true;
+                goes_to_sustain = false;
+            }
+            current_stage = SUSTAIN;
+
+            break;
+        }
+        case SUSTAIN: // --> RELEASE or RETRIGGER
+        {
+            const float sustain_time = env_data->sustain_time;
+            if (force_relese_)
+            {
+                env_osc.set_process_values(env_osc.last_out(), 0, smoothed_shape_buffer[sid_],
+                                           get_env_samples(env_data->release, sample_rate));
+                goes_to_sustain = false;
+                is_sustain = false;
+                env_osc.calculate_release_coeffecients();
+
+                current_stage = RELEASE;
+            }
+            // RETRIGGER
+            else
+            {
+                start_attack();
+            }
+
+            break;
+        }
+        case RELEASE: // --> RELEASE
+        {
+            goes_to_sustain = false;
+            is_sustain = false;
+            current_stage = END_ENV;
+
+            break;
+        }
+        default:
+        {
+            goes_to_sustain = false;
+            is_sustain = false;
+            current_stage = END_ENV;
+        }
+        }
+    }
+
+  public:
+    //==========================================================================
+    inline void start_attack() noexcept
+    {
+        current_stage = TRIGGER_START;
+        update_stage(0);
+    }
+    inline void set_to_release() noexcept
+    {
+        current_stage = SUSTAIN;
+        update_stage(0, true);
+    }
+    inline void reset() noexcept
+    {
+        current_stage = END_ENV;
+
+        last_sustain = 0;
+        goes_to_sustain = false;
+        is_sustain = false;
+        env_osc.reset();
+    }
+
+    //==============================================================================
+    inline STAGES get_current_stage() const noexcept { return current_stage; }
+    inline void set_current_stage(STAGES current_stage_) noexcept
+    {
+        current_stage = current_stage_;
+    }
+    inline void overwrite_current_value(float amp_) noexcept
+    {
+        env_osc.overwrite_current_value(amp_);
+        last_sustain = amp_;
+    }
+    inline bool is_endless() noexcept { return env_osc.is_endless(); }
+
+    //==============================================================================
+    inline float get_amp() const noexcept { return env_osc.last_out(); }
+
+    //==============================================================================
+    void sample_rate_or_block_changed() noexcept override {}
+
+    // THE POPUP PREVIEWS RUN WITHOUT A NOTIFYER AT THEIR OWN RATE
+    COLD void set_preview_sample_rate(double sample_rate_) noexcept { sample_rate = sample_rate_; }
+
+  public:
+    //==============================================================================
+    inline ENV(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
+               ENVData *env_data_, const float *const sine_lookup_, const float *const cos_lookup_,
+               const float *const exp_lookup_) noexcept
+        : RuntimeListener(notifyer_), env_osc(notifyer_, sine_lookup_, cos_lookup_, exp_lookup_),
+
+          current_stage(END_ENV),
+
+          synth_data(synth_data_),
+
+          last_sustain(0), goes_to_sustain(false), is_sustain(false),
+
+          env_data(env_data_)
+    {
+    }
+    inline ~ENV() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ENV)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+template <int smooth_samples> class AmpSmoother
+{
+    float current_value;
+    float target_value;
+    float delta;
+    int counter;
+
+  private:
+    inline void glide_tick() noexcept;
+
+  public:
+    inline float add_get(float in_) noexcept;
+    bool is_up_to_date() const noexcept;
+    inline float add_get_and_keep_current_time(float in_) noexcept;
+    inline void reset(float value_ = 0) noexcept;
+    inline float get_current_value() const noexcept;
+
+    COLD AmpSmoother(float start_value_ = 0) noexcept;
+    COLD ~AmpSmoother() noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AmpSmoother)
+};
+
+//==============================================================================
+template <int smooth_samples>
+COLD AmpSmoother<smooth_samples>::AmpSmoother(float start_value_) noexcept
+    : current_value(0), target_value(start_value_), delta(0), counter(0)
+{
+}
+template <int smooth_samples> COLD AmpSmoother<smooth_samples>::~AmpSmoother() noexcept {}
+
+//==============================================================================
+template <int smooth_samples> inline float AmpSmoother<smooth_samples>::add_get(float in_) noexcept
+{
+    if (current_value != in_ || target_value != in_)
+    {
+        // ONLY UPDATE IF WE HAVE A NEW VALUE
+        if (target_value != in_)
+        {
+            counter = smooth_samples;
+            delta = (in_ - current_value) / smooth_samples;
+            target_value = in_;
+        }
+
+        glide_tick();
+    }
+
+    return current_value;
+}
+template <int smooth_samples> bool AmpSmoother<smooth_samples>::is_up_to_date() const noexcept
+{
+    return target_value == current_value;
+}
+template <int smooth_samples> inline void AmpSmoother<smooth_samples>::reset(float value_) noexcept
+{
+    current_value = value_;
+    delta = 0;
+    counter = 0;
+}
+template <int smooth_samples>
+inline float AmpSmoother<smooth_samples>::add_get_and_keep_current_time(float in_) noexcept
+{
+    if (current_value != in_ || target_value != in_)
+    {
+        // ONLY UPDATE IF WE HAVE A NEW VALUE
+        if (target_value != in_)
+        {
+            delta = (in_ - current_value) / counter;
+            target_value = in_;
+        }
+
+        glide_tick();
+    }
+
+    return current_value;
+}
+template <int smooth_samples> inline void AmpSmoother<smooth_samples>::glide_tick() noexcept
+{
+    if (--counter <= 0)
+        current_value = target_value;
+    else
+    {
+        current_value += delta;
+        if (current_value > 1 || current_value < 0)
+        {
+            current_value = target_value;
+            counter = 0;
+        }
+    }
+}
+template <int smooth_samples>
+inline float AmpSmoother<smooth_samples>::get_current_value() const noexcept
+{
+    return current_value;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// THE INPUTS OF A FILTER RUN THROUGH THE SAME LADDER WITH THE SAME CUTOFF AND RESONANCE, SO
+// THEY ARE PROCESSED TOGETHER AS THE LANES OF ONE FRAME (ONE SSE/NEON REGISTER). THE LANE LOOPS
+// ARE KEPT FREE OF BRANCHES AND CALLS FOR THE AUTO VECTORIZER. DENORMALS ARE FLUSHED BY FTZ/DAZ
+// FOR THE WHOLE PROCESS BLOCK (juce::ScopedNoDenormals IN MoniqueAudioProcessor::process).
+static constexpr int FILTER_LANES = 4;
+static_assert(FILTER_LANES >= SUM_INPUTS_PER_FILTER, "all filter inputs need a lane");
+
+class AnalogFilterLanes : public RuntimeListener
+{
+    friend class DoubleAnalogFilter;
+    alignas(16) float p[FILTER_LANES];
+    alignas(16) float k[FILTER_LANES];
+    alignas(16) float r[FILTER_LANES];
+    alignas(16) float y1[FILTER_LANES];
+    alignas(16) float y2[FILTER_LANES];
+    alignas(16) float y3[FILTER_LANES];
+    alignas(16) float y4[FILTER_LANES];
+    alignas(16) float oldx[FILTER_LANES];
+    alignas(16) float oldy1[FILTER_LANES];
+    alignas(16) float oldy2[FILTER_LANES];
+    alignas(16) float oldy3[FILTER_LANES];
+
+    float cutoff, res, res_original;
+
+    // COEFFICIENT RAMP TO THE END OF THE CURRENT CONTROL SEGMENT
+    float p_target, k_target, r_target, res_target;
+    float p_delta, k_delta, r_delta, res_delta;
+    int ramp_samples_left;
+
+    bool force_update;
+    int zero_counter;
+
+  public:
+    //==========================================================================
+    // RETURNS TRUE ON COFF CHANGED
+    inline bool update(float resonance_, float cutoff_) noexcept
+    {
+        bool success = false;
+        if (force_update || (cutoff != cutoff_ || res_original != resonance_))
+        {
+            cutoff = cutoff_;
+            res_original = resonance_;
+            res_target = juce::jmax(0.00001f, resonance_ *= 0.99999);
+            success = true;
+
+            force_update = false;
+        }
+        return success;
+    }
+    //==========================================================================
+    inline void copy_coefficient_from(const AnalogFilterLanes &other_) noexcept
+    {
+        cutoff = other_.cutoff;
+        res = other_.res;
+
+        for (int lane = 0; lane != FILTER_LANES; ++lane)
+        {
+            p[lane] = other_.p[lane];
+            k[lane] = other_.k[lane];
+            r[lane] = other_.r[lane];
+        }
+
+        p_target = other_.p_target;
+        k_target = other_.k_target;
+        r_target = other_.r_target;
+        res_target = other_.res_target;
+        p_delta = other_.p_delta;
+        k_delta = other_.k_delta;
+        r_delta = other_.r_delta;
+        res_delta = other_.res_delta;
+        ramp_samples_left = other_.ramp_samples_left;
+    }
+    inline void copy_state_from(const AnalogFilterLanes &other_) noexcept
+    {
+        for (int lane = 0; lane != FILTER_LANES; ++lane)
+        {
+            oldx[lane] = other_.oldx[lane];
+            oldy1[lane] = other_.oldy1[lane];
+            oldy2[lane] = other_.oldy2[lane];
+            oldy3[lane] = other_.oldy3[lane];
+            y1[lane] = other_.y1[lane];
+            y2[lane] = other_.y2[lane];
+            y3[lane] = other_.y3[lane];
+            y4[lane] = other_.y4[lane];
+        }
+    }
+
+  private:
+    //==========================================================================
+    // THE LAST STEP LANDS EXACTLY ON THE TARGET
+    inline void step_coefficients() noexcept
+    {
+        if (ramp_samples_left > 0)
+        {
+            --ramp_samples_left;
+            const float ramp_steps = float(ramp_samples_left);
+            const float lp = p_target - p_delta * ramp_steps;
+            const float lk = k_target - k_delta * ramp_steps;
+            const float lr = r_target - r_delta * ramp_steps;
+            for (int lane = 0; lane != FILTER_LANES; ++lane)
+            {
+                p[lane] = lp;
+                k[lane] = lk;
+                r[lane] = lr;
+            }
+            res = res_target - res_delta * ramp_steps;
+        }
+    }
+    // TRUE AFTER 50 SAMPLES WITHOUT INPUT AND OUTPUT ON ALL USED LANES
+    template <int num_lanes_> inline bool is_silent(const float *in_) noexcept
+    {
+        float peak = 0;
+        for (int lane = 0; lane != num_lanes_; ++lane)
+        {
+            peak = juce::jmax(peak, std::abs(in_[lane]), std::abs(y4[lane]));
+        }
+        if (peak < 1.0e-8f)
+        {
+            ++zero_counter;
+        }
+        else
+        {
+            zero_counter = 0;
+        }
+
+        return zero_counter >= 50;
+    }
+    // io_ IN: THE INPUT, OUT: THE INPUT MINUS THE FEEDBACK
+    template <int num_lanes_> inline void process_ladder(float *io_) noexcept
+    {
+        for (int lane = 0; lane != num_lanes_; ++lane)
+        {
+            const float in = io_[lane] - r[lane] * y4[lane];
+            const float lp = p[lane];
+            const float lk = k[lane];
+
+            // Four cascaded onepole filters (bilinear transform)
+            const float s1 = in * lp + oldx[lane] * lp - lk * y1[lane];
+            const float s2 = s1 * lp + oldy1[lane] * lp - lk * y2[lane];
+            const float s3 = s2 * lp + oldy2[lane] * lp - lk * y3[lane];
+            float s4 = s3 * lp + oldy3[lane] * lp - lk * y4[lane];
+
+            // Clipper band limited sigmoid
+            s4 -= (s4 * s4 * s4) / 6;
+
+            y1[lane] = s1;
+            y2[lane] = s2;
+            y3[lane] = s3;
+            y4[lane] = s4;
+            oldx[lane] = in;
+            oldy1[lane] = s1;
+            oldy2[lane] = s2;
+            oldy3[lane] = s3;
+            io_[lane] = in;
+        }
+    }
+
+  public:
+    //==========================================================================
+    template <int num_lanes_> inline void processLowResonance(float *io_) noexcept
+    {
+        step_coefficients();
+        if (!is_silent<num_lanes_>(io_))
+        {
+            process_ladder<num_lanes_>(io_);
+            for (int lane = 0; lane != num_lanes_; ++lane)
+            {
+                io_[lane] = soft_clipp_greater_1_2(sample_mix(y4[lane], y3[lane] * res));
+            }
+        }
+    }
+    template <int num_lanes_> inline void processHighResonance(float *io_) noexcept
+    {
+        step_coefficients();
+        if (!is_silent<num_lanes_>(io_))
+        {
+            process_ladder<num_lanes_>(io_);
+            for (int lane = 0; lane != num_lanes_; ++lane)
+            {
+                io_[lane] = hard_clipper_1(io_[lane] - y4[lane]);
+            }
+        }
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        for (int lane = 0; lane != FILTER_LANES; ++lane)
+        {
+            y1[lane] = y2[lane] = y3[lane] = y4[lane] = 0;
+            oldx[lane] = oldy1[lane] = oldy2[lane] = oldy3[lane] = 0;
+        }
+        zero_counter = 0;
+    }
+
+    //==========================================================================
+    // CALCULATES THE COEFFICIENTS FOR THE LAST SAMPLE OF THE NEXT num_samples_ AND RAMPS THERE,
+    // num_samples_ 1 SETS THEM FOR THE NEXT SAMPLE
+    inline void calc_coefficients(float cutoff_, int num_samples_) noexcept
+    {
+        {
+            float f = cutoff_ / sample_rate;
+            p_target = f * (1.8f - 0.8f * f);
+            k_target = p_target * 2 - 1;
+        }
+        {
+            float t = (1.0f - p_target) * 1.386249f;
+            const float t2 = 12.0f + t * t;
+            r_target = res_target * (t2 + 6.0f * t) / (t2 - 6.0f * t);
+        }
+
+        const float ramp_steps = float(num_samples_);
+        p_delta = (p_target - p[0]) / ramp_steps;
+        k_delta = (k_target - k[0]) / ramp_steps;
+        r_delta = (r_target - r[0]) / ramp_steps;
+        res_delta = (res_target - res) / ramp_steps;
+        ramp_samples_left = num_samples_;
+    }
+    // JUMP, NO RAMP
+    inline void set_coefficients(float cutoff_) noexcept
+    {
+        calc_coefficients(cutoff_, 1);
+        step_coefficients();
+    }
+
+  private:
+    //==========================================================================
+    COLD void sample_rate_or_block_changed() noexcept override
+    {
+        reset();
+        ramp_samples_left = 0;
+        force_update = true;
+    }
+
+  public:
+    //==========================================================================
+    COLD AnalogFilterLanes(RuntimeNotifyer *const notifyer_) noexcept
+        : RuntimeListener(notifyer_),
+
+          cutoff(1000), res(1), res_original(0.99999),
+
+          p_target(1), k_target(1), r_target(1), res_target(1), p_delta(0), k_delta(0),
+          r_delta(0), res_delta(0), ramp_samples_left(0),
+
+          force_update(true), zero_counter(0)
+    {
+        for (int lane = 0; lane != FILTER_LANES; ++lane)
+        {
+            p[lane] = k[lane] = r[lane] = 1;
+        }
+        sample_rate_or_block_changed();
+    }
+    COLD ~AnalogFilterLanes() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalogFilterLanes)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+#define FILTER_CHANGE_GLIDE_TIME_MS (msToSamplesFast(200, flt_1.sample_rate) + 50)
+class DoubleAnalogFilter
+{
+    AnalogFilterLanes flt_1;
+    AnalogFilterLanes flt_2;
+
+    DoubleAnalogFilter *smooth_filter;
+
+    FILTER_TYPS last_filter_type;
+    FILTER_TYPS smooth_filter_type;
+    int glide_time_4_filters;
+
+    template <int num_lanes_>
+    static inline void copy_frame(float *dest_, const float *src_) noexcept
+    {
+        for (int lane = 0; lane != num_lanes_; ++lane)
+        {
+            dest_[lane] = src_[lane];
+        }
+    }
+
+  public:
+    // THE UPDATES TAKE THE SMOOTHED VALUES OF THE NEXT CONTROL SEGMENT (num_samples_), THE
+    // COEFFICIENTS RAMP TO THE VALUES OF ITS LAST SAMPLE. AFTER A FORCED UPDATE THEY JUMP TO THE
+    // VALUES OF THE FIRST SAMPLE BEFORE.
+    // ALL PROCESS FUNCTIONS WORK IN PLACE ON A FRAME OF num_lanes_ (<= FILTER_LANES) SAMPLES
+    // LP
+    //==========================================================================
+    inline void updateLow2Pass(const float *resonance_, const float *cutoff_,
+                               int num_samples_) noexcept
+    {
+        const int last = num_samples_ - 1;
+        if (flt_2.force_update && last > 0)
+        {
+            flt_2.update(resonance_[0], cutoff_[0]);
+            flt_2.set_coefficients(get_cutoff(cutoff_[0]));
+        }
+        if (flt_2.update(resonance_[last], cutoff_[last]))
+        {
+            flt_2.calc_coefficients(get_cutoff(cutoff_[last]), num_samples_);
+            flt_1.copy_coefficient_from(flt_2);
+        }
+    }
+    template <int num_lanes_> inline void processLow2Pass(float *io_) noexcept
+    {
+        alignas(16) float in[FILTER_LANES];
+        copy_frame<num_lanes_>(in, io_);
+        flt_2.processLowResonance<num_lanes_>(io_);
+        alignas(16) float low[FILTER_LANES];
+        copy_frame<num_lanes_>(low, io_);
+        flt_1.processLowResonance<num_lanes_>(low);
+        for (int lane = 0; lane != num_lanes_; ++lane)
+        {
+            //(out+low)*(1.0f-gain) + resonance_clipping(out+low)*gain
+            io_[lane] = sample_mix(io_[lane], low[lane]);
+        }
+
+        process_filter_change<num_lanes_>(in, io_);
+    }
+
+    // 1 PASS HP
+    //==========================================================================
+    inline void updateHigh2Pass(const float *resonance_, const float *cutoff_,
+                                int num_samples_) noexcept
+    {
+        const int last = num_samples_ - 1;
+        if (flt_1.force_update && last > 0)
+        {
+            flt_1.update(resonance_[0], cutoff_[0]);
+            flt_1.set_coefficients(get_cutoff(cutoff_[0]));
+        }
+        if (flt_1.update(resonance_[last], cutoff_[last]))
+        {
+            flt_1.calc_coefficients(get_cutoff(cutoff_[last]), num_samples_);
+        }
+    }
+    template <int num_lanes_> inline void processHigh2Pass(float *io_) noexcept
+    {
+        alignas(16) float in[FILTER_LANES];
+        for (int lane = 0; lane != num_lanes_; ++lane)
+        {
+            in[lane] = io_[lane] = soft_clipp_greater_1_2(io_[lane]);
+        }
+        flt_1.processHighResonance<num_lanes_>(io_);
+
+        process_filter_change<num_lanes_>(in, io_);
+    }
+
+    // BAND
+    //==========================================================================
+    inline void updateBand(const float *resonance_, const float *cutoff_, int num_samples_) noexcept
+    {
+        const int last = num_samples_ - 1;
+        if (flt_1.force_update && last > 0)
+        {
+            flt_1.update(resonance_[0], cutoff_[0] + cutoff_[0] * 0.02);
+            flt_1.set_coefficients(get_cutoff(cutoff_[0]));
+            flt_2.copy_coefficient_from(flt_1);
+        }
+        float cutoff_2 = cutoff_[last] + cutoff_[last] * 0.02;
+        if (flt_1.update(resonance_[last], cutoff_2))
+        {
+            flt_1.calc_coefficients(get_cutoff(cutoff_[last]), num_samples_);
+            flt_2.update(resonance_[last], cutoff_[last]);
+            flt_2.copy_coefficient_from(flt_1);
+        }
+    }
+    template <int num_lanes_> inline void processBand(float *io_) noexcept
+    {
+        alignas(16) float in[FILTER_LANES];
+        copy_frame<num_lanes_>(in, io_);
+        flt_2.processHighResonance<num_lanes_>(io_);
+        flt_1.processLowResonance<num_lanes_>(io_);
+        for (int lane = 0; lane != num_lanes_; ++lane)
+        {
+            io_[lane] *= 2;
+        }
+
+        process_filter_change<num_lanes_>(in, io_);
+    }
+
+    // PASS
+    //==========================================================================
+    template <int num_lanes_> inline void processPass(float *io_) noexcept
+    {
+        alignas(16) float in[FILTER_LANES];
+        copy_frame<num_lanes_>(in, io_);
+        process_filter_change<num_lanes_>(in, io_);
+    }
+
+    // BY TYPE
+    //==========================================================================
+    inline void update_filter_to(FILTER_TYPS type_) noexcept
+    {
+        if (last_filter_type != type_)
+        {
+            if (smooth_filter)
+            {
+                // SET THE SECOND FILTER TO THE OLD COMPLETE STATE
+                if (last_filter_type != PASS)
+                {
+                    smooth_filter->flt_1.copy_coefficient_from(flt_1);
+                    smooth_filter->flt_1.copy_state_from(flt_1);
+                    flt_1.force_update = true;
+
+                    smooth_filter->flt_2.copy_coefficient_from(flt_2);
+                    smooth_filter->flt_2.copy_state_from(flt_2);
+                    flt_2.force_update = true;
+                }
+                else
+                {
+                    flt_1.reset();
+                    flt_2.reset();
+                }
+                flt_1.force_update = true;
+                flt_2.force_update = true;
+
+                glide_time_4_filters = FILTER_CHANGE_GLIDE_TIME_MS;
+
+                smooth_filter->last_filter_type = last_filter_type;
+                smooth_filter_type = last_filter_type;
+            }
+
+            last_filter_type = type_;
+        }
+    }
+    template <int num_lanes_>
+    inline void process_filter_change(const float *original_in_, float *io_) noexcept
+    {
+        if (glide_time_4_filters > 0)
+        {
+            // if( smooth_filter ) IS TRUE IF glide_time_4_filters != 0
+            {
+                alignas(16) float smooth_out[FILTER_LANES];
+                copy_frame<num_lanes_>(smooth_out, original_in_);
+                smooth_filter->processByType<num_lanes_>(smooth_out, smooth_filter_type);
+
+                const float mix = 1.0f / float(FILTER_CHANGE_GLIDE_TIME_MS) * glide_time_4_filters;
+                for (int lane = 0; lane != num_lanes_; ++lane)
+                {
+                    io_[lane] = io_[lane] * (1.0f - mix) + smooth_out[lane] * mix;
+                }
+            }
+            --glide_time_4_filters;
+        }
+    }
+    template <int num_lanes_> inline void processByType(float *io_, FILTER_TYPS type_) noexcept
+    {
+        switch (type_)
+        {
+        case LPF:
+        case LPF_2_PASS:
+            processLow2Pass<num_lanes_>(io_);
+            break;
+        case HPF:
+        case HIGH_2_PASS:
+            processHigh2Pass<num_lanes_>(io_);
+            break;
+        case BPF:
+            processBand<num_lanes_>(io_);
+            break;
+        default /* PASS & UNKNOWN */:; // io_ = filter_hard_clipper(io_);
+        }
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        last_filter_type = UNKNOWN;
+        smooth_filter_type = UNKNOWN;
+        glide_time_4_filters = 0;
+        if (smooth_filter)
+        {
+            smooth_filter->reset();
+        }
+        flt_1.reset();
+        flt_2.reset();
+    }
+
+  public:
+    //==============================================================================
+    COLD DoubleAnalogFilter(RuntimeNotifyer *const notifyer_,
+                            bool create_smooth_filter = true) noexcept
+        : flt_1(notifyer_), flt_2(notifyer_),
+
+          smooth_filter(nullptr),
+
+          last_filter_type(UNKNOWN), smooth_filter_type(UNKNOWN),
+
+          glide_time_4_filters(0)
+    {
+        if (create_smooth_filter)
+        {
+            smooth_filter = new DoubleAnalogFilter(notifyer_, false);
+        }
+    }
+    COLD ~DoubleAnalogFilter() noexcept
+    {
+        if (smooth_filter)
+        {
+            delete smooth_filter;
+        }
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DoubleAnalogFilter)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class FilterProcessor
+{
+    DoubleAnalogFilter double_filter;
+    friend class mono_ParameterOwnerStore;
+
+  public:
+    std::unique_ptr<ENV> env;
+    juce::Array<ENVData *> input_env_datas;
+    juce::OwnedArray<ENV> input_envs;
+
+  private:
+    const int id;
+
+    const MoniqueSynthData *const synth_data;
+    FilterData *const filter_data;
+    DataBuffer *const data_buffer;
+
+  public:
+    //==========================================================================
+    inline void start_attack() noexcept
+    {
+        start_env();
+        start_input_env(0);
+        start_input_env(1);
+        start_input_env(2);
+    }
+    inline void start_env() noexcept { env->start_attack(); }
+    inline void start_input_env(int id_) noexcept { input_envs.getUnchecked(id_)->start_attack(); }
+    inline void start_release() noexcept
+    {
+        start_env_release();
+        start_input_env_release(0);
+        start_input_env_release(1);
+        start_input_env_release(2);
+    }
+    inline void start_env_release() noexcept { env->set_to_release(); }
+    inline void start_input_env_release(int id_) noexcept
+    {
+        input_envs.getUnchecked(id_)->set_to_release();
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        env->reset();
+        for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+        {
+            input_envs.getUnchecked(input_id)->reset();
+        }
+
+        // double_filter[0]->reset();
+        // double_filter[1]->reset();
+        // double_filter[2]->reset();
+    }
+
+  private:
+    //==========================================================================
+    // THE INPUT ENVELOPS DEPEND ONLY ON THEIR OWN DATA, THE FILTER BEFORE IS NOT NEEDED
+    inline void process_input_amps(const int num_samples) noexcept
+    {
+        const int glide_modotr_time = synth_data->glide_motor_time;
+        for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+        {
+            float *tmp_input_amp = data_buffer->filter_input_env_amps.getWritePointer(
+                input_id + SUM_INPUTS_PER_FILTER * id);
+            ENV *const input_env(input_envs.getUnchecked(input_id));
+            filter_data->input_smoothers[input_id]->process_amp(
+                !filter_data->input_holds[input_id], glide_modotr_time, input_env, tmp_input_amp,
+                num_samples);
+        }
+    }
+
+    inline void pre_process(const int input_id, const int num_samples) noexcept
+    {
+        // CALCULATE INPUTS
+        {
+            {
+                if (id == FILTER_1)
+                {
+                    const float *tmp_input_amp = data_buffer->filter_input_env_amps.getReadPointer(
+                        input_id + SUM_INPUTS_PER_FILTER * FILTER_1);
+
+                    float *filter_input_buffer =
+                        data_buffer->filter_input_samples.getWritePointer(input_id);
+                    const float *const osc_input_buffer =
+                        data_buffer->osc_samples.getReadPointer(input_id);
+                    for (int sid = 0; sid != num_samples; ++sid)
+                    {
+                        filter_input_buffer[sid] = osc_input_buffer[sid] * tmp_input_amp[sid];
+                    }
+                }
+                else if (id == FILTER_2)
+                {
+                    const float *tmp_input_amp = data_buffer->filter_input_env_amps.getReadPointer(
+                        input_id + SUM_INPUTS_PER_FILTER * FILTER_2);
+
+                    float *const filter_input_buffer =
+                        data_buffer->filter_input_samples.getWritePointer(
+                            input_id + SUM_INPUTS_PER_FILTER * FILTER_2);
+                    const float *const filter_before_buffer =
+                        data_buffer->filter_output_samples.getReadPointer(
+                            input_id + SUM_INPUTS_PER_FILTER * FILTER_1);
+                    const float *const osc_input_buffer =
+                        data_buffer->osc_samples.getReadPointer(input_id);
+                    for (int sid = 0; sid != num_samples; ++sid)
+                    {
+                        filter_input_buffer[sid] =
+                            tmp_input_amp[sid] < 0 ? osc_input_buffer[sid] * tmp_input_amp[sid] * -1
+                                                   : filter_before_buffer[sid] * tmp_input_amp[sid];
+                    }
+                }
+                else
+                {
+                    const float *tmp_input_amp_1 =
+                        data_buffer->filter_input_env_amps.getReadPointer(
+                            0 + SUM_INPUTS_PER_FILTER * FILTER_3);
+                    const float *tmp_input_amp_2 =
+                        data_buffer->filter_input_env_amps.getReadPointer(
+                            1 + SUM_INPUTS_PER_FILTER * FILTER_3);
+                    const float *tmp_input_amp_3 =
+                        data_buffer->filter_input_env_amps.getReadPointer(
+                            2 + SUM_INPUTS_PER_FILTER * FILTER_3);
+
+                    float *const filter_input_buffer =
+                        data_buffer->filter_input_samples.getWritePointer(
+                            0 + SUM_INPUTS_PER_FILTER * FILTER_3);
+                    const float *const filter_before_buffer_1 =
+                        data_buffer->filter_output_samples.getReadPointer(
+                            0 + SUM_INPUTS_PER_FILTER * FILTER_2);
+                    const float *const filter_before_buffer_2 =
+                        data_buffer->filter_output_samples.getReadPointer(
+                            1 + SUM_INPUTS_PER_FILTER * FILTER_2);
+                    const float *const filter_before_buffer_3 =
+                        data_buffer->filter_output_samples.getReadPointer(
+                            2 + SUM_INPUTS_PER_FILTER * FILTER_2);
+                    const float *const osc_input_buffer_1 =
+                        data_buffer->osc_samples.getReadPointer(0);
+                    const float *const osc_input_buffer_2 =
+                        data_buffer->osc_samples.getReadPointer(1);
+                    const float *const osc_input_buffer_3 =
+                        data_buffer->osc_samples.getReadPointer(2);
+
+                    juce::FloatVectorOperations::clear(filter_input_buffer, num_samples);
+                    for (int sid = 0; sid != num_samples; ++sid)
+                    {
+                        filter_input_buffer[sid] = sample_mix(
+                            sample_mix(tmp_input_amp_1[sid] < 0
+                                           ? osc_input_buffer_1[sid] * tmp_input_amp_1[sid] * -1
+                                           : filter_before_buffer_1[sid] * tmp_input_amp_1[sid],
+                                       tmp_input_amp_2[sid] < 0
+                                           ? osc_input_buffer_2[sid] * tmp_input_amp_2[sid] * -1
+                                           : filter_before_buffer_2[sid] * tmp_input_amp_2[sid]),
+                            tmp_input_amp_3[sid] < 0
+                                ? osc_input_buffer_3[sid] * tmp_input_amp_3[sid] * -1
+                                : filter_before_buffer_3[sid] * tmp_input_amp_3[sid]);
+                    }
+                }
+            }
+        }
+    }
+    inline void process_amp_mix(const int num_samples) noexcept
+    {
+        // ADSTR - LFO MIX
+        float *amp_mix = data_buffer->lfo_amplitudes.getWritePointer(id);
+        const float *smoothed_mix_buffer(
+            filter_data->adsr_lfo_mix_smoother.get_smoothed_value_buffer());
+        {
+            const float *env_amps = data_buffer->filter_env_amps.getReadPointer(id);
+            const float *lfo_amplitudes = data_buffer->lfo_amplitudes.getReadPointer(id);
+            for (int sid = 0; sid != num_samples; ++sid)
+            {
+                // LFO ADSR MIX - HERE TO SAVE ONE LOOP
+                const float mix = (1.0f + smoothed_mix_buffer[sid]) * 0.5f;
+                amp_mix[sid] = env_amps[sid] * (1.0f - mix) + lfo_amplitudes[sid] * mix;
+            }
+        }
+    }
+
+    static float distortion__(float x_, float distortion_power_) noexcept
+    {
+        if (distortion_power_ != 0)
+        {
+            // const float distortion_add_on = distortion_power_*0.9f;
+            // x_ = ((1.0f+distortion_add_on)*x_) - (x_*x_*x_)*distortion_add_on;
+            // (std::atan(input_and_worker_)*(1.0f/juce::MathConstants<float>::pi))*
+            // x_ = x_*(1.0f-distortion_power_) + 0.5f*soft_clipping( x_*10 )*(distortion_power_);
+
+            x_ = x_ * (1.0f - distortion_power_) + (std::atan(x_ * 20) / 6.66) * distortion_power_;
+
+            // x_ = x_*(1.0f-distortion_power_) + std::atan( x_*150 )*(1.0f/1.55)*distortion_power_;
+        }
+
+        return x_;
+    }
+
+    //==========================================================================
+    // ALL INPUTS ARE PROCESSED AS LANES OF THE SAME DOUBLE FILTER, FILTER 3 HAS ONLY ONE INPUT
+    template <FILTER_TYPS filter_type_, int num_inputs_>
+    inline void process_filter_lanes(const int num_samples) noexcept
+    {
+#define DISTORTION_IN(x) distortion__(x, filter_distortion)
+#define DISTORTION_OUT(x) distortion__(x, filter_distortion)
+
+        const float *input_buffers[SUM_INPUTS_PER_FILTER] = {};
+        float *out_buffers[SUM_INPUTS_PER_FILTER] = {};
+        for (int input_id = 0; input_id != num_inputs_; ++input_id)
+        {
+            pre_process(input_id, num_samples);
+
+            input_buffers[input_id] = data_buffer->filter_input_samples.getReadPointer(
+                input_id + SUM_INPUTS_PER_FILTER * id);
+            out_buffers[input_id] = data_buffer->filter_output_samples.getWritePointer(
+                input_id + SUM_INPUTS_PER_FILTER * id);
+        }
+        const float *const tmp_resonance_buffer =
+            filter_data->resonance_smoother.get_smoothed_value_buffer();
+        const float *const tmp_cuttof_buffer =
+            filter_data->cutoff_smoother.get_smoothed_value_buffer();
+        const float *const tmp_distortion_buffer =
+            filter_data->distortion_smoother.get_smoothed_value_buffer();
+
+        double_filter.update_filter_to(filter_type_);
+        for (int sid = 0; sid != num_samples; ++sid)
+        {
+            // COEFFICIENTS AT CONTROL RATE
+            if (sid % MONIQUE_FILTER_CONTROL_RATE == 0)
+            {
+                const int num_control_samples =
+                    juce::jmin(MONIQUE_FILTER_CONTROL_RATE, num_samples - sid);
+                switch (filter_type_)
+                {
+                case LPF_2_PASS:
+                    double_filter.updateLow2Pass(tmp_resonance_buffer + sid,
+                                                 tmp_cuttof_buffer + sid, num_control_samples);
+                    break;
+                case HIGH_2_PASS:
+                    double_filter.updateHigh2Pass(tmp_resonance_buffer + sid,
+                                                  tmp_cuttof_buffer + sid, num_control_samples);
+                    break;
+                case BPF:
+                    double_filter.updateBand(tmp_resonance_buffer + sid, tmp_cuttof_buffer + sid,
+                                             num_control_samples);
+                    break;
+                default: //  PASS
+                    break;
+                }
+            }
+
+            const float filter_distortion = tmp_distortion_buffer[sid];
+
+            alignas(16) float frame[FILTER_LANES] = {};
+            for (int input_id = 0; input_id != num_inputs_; ++input_id)
+            {
+                frame[input_id] = DISTORTION_IN(input_buffers[input_id][sid]);
+            }
+
+            switch (filter_type_)
+            {
+            case LPF_2_PASS:
+                double_filter.processLow2Pass<num_inputs_>(frame);
+                break;
+            case HIGH_2_PASS:
+                double_filter.processHigh2Pass<num_inputs_>(frame);
+                break;
+            case BPF:
+                double_filter.processBand<num_inputs_>(frame);
+                break;
+            default: //  PASS
+                double_filter.processPass<num_inputs_>(frame);
+            }
+
+            for (int input_id = 0; input_id != num_inputs_; ++input_id)
+            {
+                out_buffers[input_id][sid] = DISTORTION_OUT(frame[input_id]);
+            }
+        }
+
+#undef DISTORTION_IN
+#undef DISTORTION_OUT
+    }
+
+    template <FILTER_TYPS filter_type_> inline void process_filter(const int num_samples) noexcept
+    {
+        if (id != FILTER_3)
+        {
+            process_filter_lanes<filter_type_, SUM_INPUTS_PER_FILTER>(num_samples);
+        }
+        else
+        {
+            // 1, 2 and 3
+            process_filter_lanes<filter_type_, 1>(num_samples);
+        }
+    }
+
+  public:
+    //==========================================================================
+    // MODULATIONS AND INPUT ENVELOPS, CAN RUN BEFORE THE FILTERS BEFORE ARE DONE
+    inline void prepare(const int num_samples) noexcept
+    {
+        const float *amp_mix = data_buffer->lfo_amplitudes.getReadPointer(id);
+
+        process_amp_mix(num_samples);
+
+        filter_data->resonance_smoother.process_modulation(filter_data->modulate_resonance, amp_mix,
+                                                           num_samples);
+        filter_data->cutoff_smoother.process_modulation(filter_data->modulate_cutoff, amp_mix,
+                                                        num_samples);
+        filter_data->distortion_smoother.process_modulation(filter_data->modulate_distortion,
+                                                            amp_mix, num_samples);
+        if (synth_data->is_stereo)
+            filter_data->pan_smoother.process_modulation(filter_data->modulate_pan, amp_mix,
+                                                         num_samples);
+
+        process_input_amps(num_samples);
+    }
+
+    // NEEDS prepare() AND THE OUTPUT OF THE FILTER BEFORE
+    inline void process(const int num_samples) noexcept
+    {
+        float *amp_mix = data_buffer->lfo_amplitudes.getWritePointer(id);
+        // PROCESS FILTER
+        {
+            switch (filter_data->filter_type)
+            {
+            case LPF:
+            case LPF_2_PASS:
+            case MOOG_AND_LPF:
+                process_filter<LPF_2_PASS>(num_samples);
+                break;
+            case HPF:
+            case HIGH_2_PASS:
+                process_filter<HIGH_2_PASS>(num_samples);
+                break;
+            case BPF:
+                process_filter<BPF>(num_samples);
+                break;
+            default: //  PASS
+                process_filter<PASS>(num_samples);
+                break;
+            }
+        }
+
+        // COLLECT RESULTS
+        float *const this_filter_output_buffer =
+            data_buffer->filter_output_samples_l_r.getWritePointer(id);
+        {
+            const float *const smoothed_distortion_buffer(
+                filter_data->distortion_smoother.get_smoothed_value_buffer());
+            {
+                filter_data->output_smoother.process_modulation(filter_data->modulate_output,
+                                                                amp_mix, num_samples);
+                const float *const smoothed_output_buffer =
+                    filter_data->output_smoother.get_smoothed_value_buffer();
+                if (id != FILTER_3)
+                {
+                    float *const out_buffer_1(data_buffer->filter_output_samples.getWritePointer(
+                        0 + SUM_INPUTS_PER_FILTER * id));
+                    float *const out_buffer_2(data_buffer->filter_output_samples.getWritePointer(
+                        1 + SUM_INPUTS_PER_FILTER * id));
+                    float *const out_buffer_3(data_buffer->filter_output_samples.getWritePointer(
+                        2 + SUM_INPUTS_PER_FILTER * id));
+                    for (int sid = 0; sid != num_samples; ++sid)
+                    {
+                        // OUTPUT MIX AND DISTORTION
+                        {
+                            const float amp = smoothed_output_buffer[sid];
+                            float shape_power = smoothed_distortion_buffer[sid];
+                            const float result =
+                                sample_mix(sample_mix(out_buffer_1[sid], out_buffer_2[sid]),
+                                           out_buffer_3[sid]) *
+                                amp * 2;
+
+                            this_filter_output_buffer[sid] =
+                                sample_mix(result * (1.0f - shape_power),
+                                           soft_clipping(result * 5) * 1.5 * (shape_power));
+                        }
+                    }
+                }
+                else
+                {
+                    float *const out_buffer(data_buffer->filter_output_samples.getWritePointer(
+                        0 + SUM_INPUTS_PER_FILTER * FILTER_3));
+                    for (int sid = 0; sid != num_samples; ++sid)
+                    {
+                        // OUTPUT MIX AND DISTORTION
+                        {
+                            const float amp = smoothed_output_buffer[sid];
+                            float shape_power = smoothed_distortion_buffer[sid];
+                            const float result = out_buffer[sid] * amp * 2;
+
+                            this_filter_output_buffer[sid] =
+                                sample_mix(result * (1.0f - shape_power),
+                                           soft_clipping(result * 5) * 1.5 * (shape_power));
+                        }
+                    }
+                }
+            }
+        }
+
+// PAN & MIX
+#ifdef POLY
+        if (synth_data->is_stereo)
+#endif
+        {
+            const float *const pan_buffer = filter_data->pan_smoother.get_smoothed_value_buffer();
+            float *const left_and_input_output_buffer =
+                data_buffer->filter_output_samples_l_r.getWritePointer(id);
+            float *const right_output_buffer =
+                data_buffer->filter_output_samples_l_r.getWritePointer(SUM_FILTERS + id);
+#ifdef POLY
+            const bool calculate_tracking[SUM_FILTERS] = {synth_data->keytrack_filter_volume[0],
+                                                          synth_data->keytrack_filter_volume[1],
+                                                          synth_data->keytrack_filter_volume[2]};
+            const float *const env_tracking_buffer =
+                data_buffer->filter_env_tracking.getReadPointer(id);
+#endif
+            // const float multiplyer = id == FILTER_3 ? 1.5f : 1;
+#ifndef POLY
+            if (filter_data->pan_smoother.is_constant())
+            {
+                float left, right;
+                pan_law.get(filter_data->pan_smoother.get_constant_value(), left, right);
+                juce::FloatVectorOperations::multiply(right_output_buffer,
+                                                      left_and_input_output_buffer, left,
+                                                      num_samples);
+                juce::FloatVectorOperations::multiply(left_and_input_output_buffer, right,
+                                                      num_samples);
+            }
+            else
+#endif
+            {
+                for (int sid = 0; sid != num_samples; ++sid)
+                {
+                    const float pan = pan_buffer[sid];
+                    const float output_sample = left_and_input_output_buffer[sid];
+#ifdef POLY
+                    right_output_buffer[sid] =
+                        output_sample * pan_law.left(pan) *
+                        (calculate_tracking[id]
+                             ? env_tracking_buffer[sid] *
+                                       (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
+                                   synth_data->keytrack_filter_volume_offset[id]
+                             : 1);
+                    left_and_input_output_buffer[sid] =
+                        output_sample * pan_law.right(pan) *
+                        (calculate_tracking[id]
+                             ? env_tracking_buffer[sid] *
+                                       (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
+                                   synth_data->keytrack_filter_volume_offset[id]
+                             : 1);
+#else
+                    float left, right;
+                    pan_law.get(pan, left, right);
+                    right_output_buffer[sid] = output_sample * left;
+                    left_and_input_output_buffer[sid] = output_sample * right;
+#endif
+                }
+            }
+
+            // VISUALIZE
+            if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
+            {
+                amp_painter->add_filter_env(id, amp_mix, num_samples);
+                amp_painter->add_filter(id, right_output_buffer, left_and_input_output_buffer,
+                                        num_samples);
+            }
+        }
+#ifdef POLY
+        else // NOTE just a reduced copy of the function before
+        {
+            float *const left_and_input_output_buffer =
+                data_buffer->filter_output_samples_l_r.getWritePointer(id);
+            const bool calculate_tracking[SUM_FILTERS] = {synth_data->keytrack_filter_volume[0],
+                                                          synth_data->keytrack_filter_volume[1],
+                                                          synth_data->keytrack_filter_volume[2]};
+            const float *const env_tracking_buffer =
+                data_buffer->filter_env_tracking.getReadPointer(id);
+            // const float multiplyer = id == FILTER_3 ? 1.5f : 1;
+            for (int sid = 0; sid != num_samples; ++sid)
+            {
+                const float output_sample = left_and_input_output_buffer[sid];
+                left_and_input_output_buffer[sid] =
+                    output_sample *
+                    (calculate_tracking[id]
+                         ? env_tracking_buffer[sid] *
+                                   (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
+                               synth_data->keytrack_filter_volume_offset[id]
+                         : 1);
+            }
+
+            // VISUALIZE
+            if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
+            {
+                amp_painter->add_filter_env(id, amp_mix, num_samples);
+                amp_painter->add_filter(id, left_and_input_output_buffer,
+                                        left_and_input_output_buffer, num_samples);
+            }
+        }
+#endif
+
+        // COLLECT THE FINAL OUTPUT
+        if (id == FILTER_3)
+        {
+            if (synth_data->is_stereo)
+            {
+                float *const master_left_output_buffer =
+                    data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
+                float *const master_right_output_buffer =
+                    data_buffer->filter_stereo_output_samples.getWritePointer(RIGHT);
+                const float *const left_output_buffer_flt1 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(0);
+                const float *const right_output_buffer_flt1 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS);
+                const float *const left_output_buffer_flt2 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(1);
+                const float *const right_output_buffer_flt2 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS + 1);
+                const float *const left_output_buffer_flt3 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(2);
+                const float *const right_output_buffer_flt3 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS + 2);
+                const float *const smoothed_distortion =
+                    synth_data->distortion_smoother.get_smoothed_value_buffer();
+                const float *const smoothed_fx_bypass_buffer =
+                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
+
+                for (int sid = 0; sid != num_samples; ++sid)
+                {
+                    const float left = sample_mix(
+                        sample_mix(left_output_buffer_flt1[sid], left_output_buffer_flt2[sid]),
+                        left_output_buffer_flt3[sid]);
+                    const float right = sample_mix(
+                        sample_mix(right_output_buffer_flt1[sid], right_output_buffer_flt2[sid]),
+                        right_output_buffer_flt3[sid]);
+                    const float left_add = left_output_buffer_flt1[sid] +
+                                           left_output_buffer_flt2[sid] +
+                                           left_output_buffer_flt3[sid];
+                    const float right_add = right_output_buffer_flt1[sid] +
+                                            right_output_buffer_flt2[sid] +
+                                            right_output_buffer_flt3[sid];
+                    const float distortion =
+                        smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
+
+                    master_left_output_buffer[sid] =
+                        left * (1.0f - distortion) +
+                        1.33f * soft_clipping(left_add * 10) * (distortion);
+                    master_right_output_buffer[sid] =
+                        right * (1.0f - distortion) +
+                        1.33f * soft_clipping(right_add * 10) * (distortion);
+                }
+            }
+            else // NOTE just a reduced copy of the function before
+            {
+                float *const master_left_output_buffer =
+                    data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
+                const float *const left_output_buffer_flt1 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(0);
+                const float *const left_output_buffer_flt2 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(1);
+                const float *const left_output_buffer_flt3 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(2);
+                const float *const smoothed_distortion =
+                    synth_data->distortion_smoother.get_smoothed_value_buffer();
+                const float *const smoothed_fx_bypass_buffer =
+                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
+
+                for (int sid = 0; sid != num_samples; ++sid)
+                {
+                    const float left = sample_mix(
+                        sample_mix(left_output_buffer_flt1[sid], left_output_buffer_flt2[sid]),
+                        left_output_buffer_flt3[sid]);
+                    const float left_add = left_output_buffer_flt1[sid] +
+                                           left_output_buffer_flt2[sid] +
+                                           left_output_buffer_flt3[sid];
+                    const float distortion =
+                        smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
+
+                    master_left_output_buffer[sid] =
+                        left * (1.0f - distortion) +
+                        1.33f * soft_clipping(left_add * 10) * (distortion);
+                }
+            }
+        }
+    }
+
+  public:
+    //==============================================================================
+    COLD FilterProcessor(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
+                         int id_, const float *const sine_lookup_, const float *const cos_lookup_,
+                         const float *const exp_lookup_) noexcept
+        : double_filter(notifyer_),
+
+          env(new ENV(notifyer_, synth_data_, synth_data_->filter_datas[id_]->env_data,
+                      sine_lookup_, cos_lookup_, exp_lookup_)),
+          input_envs(),
+
+          id(id_),
+
+          synth_data(synth_data_), filter_data(synth_data_->filter_datas[id_]),
+          data_buffer(synth_data_->data_buffer)
+    {
+        for (int i = 0; i != SUM_INPUTS_PER_FILTER; ++i)
+        {
+            ENVData *input_env_data(synth_data_->filter_datas[id_]->input_envs[i]);
+            input_env_datas.add(input_env_data);
+            input_envs.add(new ENV(notifyer_, synth_data_, input_env_data, sine_lookup_,
+                                   cos_lookup_, exp_lookup_));
+        }
+    }
+    COLD ~FilterProcessor() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FilterProcessor)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+static inline float get_low_pass_band_frequency(int band_id_, double sample_rate_) noexcept
+{
+    switch (band_id_)
+    {
+    case 0:
+        return 82.41;
+    case 1:
+        return 164.81;
+    case 2:
+        return 329.63;
+    case 3:
+        return 659.25;
+    case 4:
+        return 1318.51;
+    case 5:
+        return 2637.02;
+    default:
+        // return 2637.02;
+        return sample_rate_ / 2;
+    }
+}
+static inline float get_high_pass_band_frequency(int band_id_) noexcept
+{
+    switch (band_id_)
+    {
+    case 0:
+        return 20.60;
+    case 1:
+        return 82.41;
+    case 2:
+        return 164.81;
+    case 3:
+        return 329.63;
+    case 4:
+        return 659.25;
+    case 5:
+        return 1318.51;
+    default:
+        return 2637.02;
+    }
+}
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// THE BANDS OF BOTH CHANNELS AS THE LANES OF ONE FRAME, 8 LANES PER CHANNEL. A BAND IS A RESONANT
+// LOW PASS LADDER INTO A HIGH PASS BIQUAD (THE MATH OF juce::IIRFilter). ALL BANDS SHARE THE
+// SHAPE, THE CUTOFFS ARE FIXED, SO A SHAPE CHANGE ONLY SCALES r.
+// THE LANES RUN IN GROUPS OF 4, ONE EQLaneGroup REGISTER. A GROUP WITHOUT INPUT WHOSE LANES HAVE
+// STOPPED IS SKIPPED FOR THE BLOCK.
+static constexpr int EQ_CHANNEL_LANES = 8;
+static constexpr int EQ_LANES = EQ_CHANNEL_LANES * 2;
+static constexpr int EQ_GROUP_LANES = 4;
+static constexpr int EQ_GROUPS = EQ_LANES / EQ_GROUP_LANES;
+static_assert(EQ_CHANNEL_LANES >= SUM_EQ_BANDS, "all eq bands need a lane");
+static_assert(EQ_CHANNEL_LANES % EQ_GROUP_LANES == 0, "a group belongs to one channel");
+
+// 4 FLOATS IN ONE SSE/NEON REGISTER, A PLAIN ARRAY ON OTHER TARGETS. THE COMPILERS DO NOT
+// VECTORIZE THE LADDER THEMSELF (THE SELECTS AND THE COUNTERS KEEP IT SCALAR). A MASK HAS ALL BITS
+// OF A LANE SET OR CLEARED. THE OPERATIONS ROUND LIKE THE SCALAR MATH, THE RESULTS ARE BIT EXACT.
+struct EQLaneGroup
+{
+#if MONIQUE_EQ_SSE
+    __m128 v;
+
+    static inline EQLaneGroup load(const float *src_) noexcept { return {_mm_load_ps(src_)}; }
+    static inline EQLaneGroup expand(float value_) noexcept { return {_mm_set1_ps(value_)}; }
+    inline void store(float *dest_) const noexcept { _mm_store_ps(dest_, v); }
+
+    friend inline EQLaneGroup operator+(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {_mm_add_ps(a_.v, b_.v)};
+    }
+    friend inline EQLaneGroup operator-(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {_mm_sub_ps(a_.v, b_.v)};
+    }
+    friend inline EQLaneGroup operator*(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {_mm_mul_ps(a_.v, b_.v)};
+    }
+    friend inline EQLaneGroup operator/(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {_mm_div_ps(a_.v, b_.v)};
+    }
+    friend inline EQLaneGroup operator-(EQLaneGroup a_) noexcept
+    {
+        return {_mm_xor_ps(a_.v, _mm_set1_ps(-0.0f))};
+    }
+    friend inline EQLaneGroup abs(EQLaneGroup a_) noexcept
+    {
+        return {_mm_andnot_ps(_mm_set1_ps(-0.0f), a_.v)};
+    }
+    friend inline EQLaneGroup min(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {_mm_min_ps(a_.v, b_.v)};
+    }
+
+    friend inline EQLaneGroup operator==(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {_mm_cmpeq_ps(a_.v, b_.v)};
+    }
+    friend inline EQLaneGroup operator<(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {_mm_cmplt_ps(a_.v, b_.v)};
+    }
+    friend inline EQLaneGroup operator>(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {_mm_cmpgt_ps(a_.v, b_.v)};
+    }
+    friend inline EQLaneGroup operator&(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {_mm_and_ps(a_.v, b_.v)};
+    }
+    // mask_ ? a_ : b_
+    friend inline EQLaneGroup select(EQLaneGroup mask_, EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {_mm_or_ps(_mm_and_ps(mask_.v, a_.v), _mm_andnot_ps(mask_.v, b_.v))};
+    }
+    friend inline bool is_any_set(EQLaneGroup mask_) noexcept
+    {
+        return _mm_movemask_ps(mask_.v) != 0;
+    }
+#elif MONIQUE_EQ_NEON
+    float32x4_t v;
+
+    static inline EQLaneGroup load(const float *src_) noexcept { return {vld1q_f32(src_)}; }
+    static inline EQLaneGroup expand(float value_) noexcept { return {vdupq_n_f32(value_)}; }
+    inline void store(float *dest_) const noexcept { vst1q_f32(dest_, v); }
+
+    friend inline EQLaneGroup operator+(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {vaddq_f32(a_.v, b_.v)};
+    }
+    friend inline EQLaneGroup operator-(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {vsubq_f32(a_.v, b_.v)};
+    }
+    friend inline EQLaneGroup operator*(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {vmulq_f32(a_.v, b_.v)};
+    }
+    friend inline EQLaneGroup operator/(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+#if defined(__aarch64__) || defined(_M_ARM64)
+        return {vdivq_f32(a_.v, b_.v)};
+#else
+        // ARMV7 NEON HAS NO DIVISION
+        alignas(16) float a[4];
+        alignas(16) float b[4];
+        vst1q_f32(a, a_.v);
+        vst1q_f32(b, b_.v);
+        for (int lane = 0; lane != 4; ++lane)
+        {
+            a[lane] /= b[lane];
+        }
+        return {vld1q_f32(a)};
+#endif
+    }
+    friend inline EQLaneGroup operator-(EQLaneGroup a_) noexcept { return {vnegq_f32(a_.v)}; }
+    friend inline EQLaneGroup abs(EQLaneGroup a_) noexcept { return {vabsq_f32(a_.v)}; }
+    friend inline EQLaneGroup min(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {vminq_f32(a_.v, b_.v)};
+    }
+
+    friend inline EQLaneGroup operator==(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {vreinterpretq_f32_u32(vceqq_f32(a_.v, b_.v))};
+    }
+    friend inline EQLaneGroup operator<(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {vreinterpretq_f32_u32(vcltq_f32(a_.v, b_.v))};
+    }
+    friend inline EQLaneGroup operator>(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {vreinterpretq_f32_u32(vcgtq_f32(a_.v, b_.v))};
+    }
+    friend inline EQLaneGroup operator&(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {vreinterpretq_f32_u32(
+            vandq_u32(vreinterpretq_u32_f32(a_.v), vreinterpretq_u32_f32(b_.v)))};
+    }
+    // mask_ ? a_ : b_
+    friend inline EQLaneGroup select(EQLaneGroup mask_, EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return {vbslq_f32(vreinterpretq_u32_f32(mask_.v), a_.v, b_.v)};
+    }
+    friend inline bool is_any_set(EQLaneGroup mask_) noexcept
+    {
+        const uint32x4_t mask = vreinterpretq_u32_f32(mask_.v);
+        const uint32x2_t half = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+        return (vget_lane_u32(half, 0) | vget_lane_u32(half, 1)) != 0;
+    }
+#else
+    float v[4];
+
+    static inline EQLaneGroup load(const float *src_) noexcept
+    {
+        return {{src_[0], src_[1], src_[2], src_[3]}};
+    }
+    static inline EQLaneGroup expand(float value_) noexcept
+    {
+        return {{value_, value_, value_, value_}};
+    }
+    inline void store(float *dest_) const noexcept
+    {
+        for (int lane = 0; lane != 4; ++lane)
+        {
+            dest_[lane] = v[lane];
+        }
+    }
+
+    template <class function_t>
+    static inline EQLaneGroup for_each(EQLaneGroup a_, EQLaneGroup b_, function_t f_) noexcept
+    {
+        EQLaneGroup result;
+        for (int lane = 0; lane != 4; ++lane)
+        {
+            result.v[lane] = f_(a_.v[lane], b_.v[lane]);
+        }
+        return result;
+    }
+    static inline float to_mask(bool is_set_) noexcept
+    {
+        // A NaN WITH ALL BITS SET, ONLY EVER USED BY select AND is_any_set
+        const std::uint32_t bits = is_set_ ? 0xffffffff : 0;
+        float mask;
+        std::memcpy(&mask, &bits, sizeof(float));
+        return mask;
+    }
+    static inline bool is_set(float mask_) noexcept
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &mask_, sizeof(float));
+        return bits != 0;
+    }
+
+    friend inline EQLaneGroup operator+(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return for_each(a_, b_, [](float a, float b) { return a + b; });
+    }
+    friend inline EQLaneGroup operator-(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return for_each(a_, b_, [](float a, float b) { return a - b; });
+    }
+    friend inline EQLaneGroup operator*(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return for_each(a_, b_, [](float a, float b) { return a * b; });
+    }
+    friend inline EQLaneGroup operator/(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return for_each(a_, b_, [](float a, float b) { return a / b; });
+    }
+    friend inline EQLaneGroup operator-(EQLaneGroup a_) noexcept
+    {
+        return for_each(a_, a_, [](float a, float) { return -a; });
+    }
+    friend inline EQLaneGroup abs(EQLaneGroup a_) noexcept
+    {
+        return for_each(a_, a_, [](float a, float) { return std::abs(a); });
+    }
+    friend inline EQLaneGroup min(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return for_each(a_, b_, [](float a, float b) { return a < b ? a : b; });
+    }
+
+    friend inline EQLaneGroup operator==(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return for_each(a_, b_, [](float a, float b) { return to_mask(a == b); });
+    }
+    friend inline EQLaneGroup operator<(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return for_each(a_, b_, [](float a, float b) { return to_mask(a < b); });
+    }
+    friend inline EQLaneGroup operator>(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return for_each(a_, b_, [](float a, float b) { return to_mask(a > b); });
+    }
+    friend inline EQLaneGroup operator&(EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        return for_each(a_, b_, [](float a, float b) {
+            std::uint32_t a_bits, b_bits;
+            std::memcpy(&a_bits, &a, sizeof(float));
+            std::memcpy(&b_bits, &b, sizeof(float));
+            a_bits &= b_bits;
+            std::memcpy(&a, &a_bits, sizeof(float));
+            return a;
+        });
+    }
+    // mask_ ? a_ : b_
+    friend inline EQLaneGroup select(EQLaneGroup mask_, EQLaneGroup a_, EQLaneGroup b_) noexcept
+    {
+        EQLaneGroup result;
+        for (int lane = 0; lane != 4; ++lane)
+        {
+            result.v[lane] = is_set(mask_.v[lane]) ? a_.v[lane] : b_.v[lane];
+        }
+        return result;
+    }
+    friend inline bool is_any_set(EQLaneGroup mask_) noexcept
+    {
+        bool is_any_set = false;
+        for (int lane = 0; lane != 4; ++lane)
+        {
+            is_any_set |= is_set(mask_.v[lane]);
+        }
+        return is_any_set;
+    }
+#endif
+};
+static_assert(EQ_GROUP_LANES == 4, "EQLaneGroup holds 4 lanes");
+
+class EQFilterBank : public RuntimeListener
+{
+    // LOW PASS, r = resonance * r_numerator / r_denominator
+    alignas(16) float p[EQ_LANES];
+    alignas(16) float k[EQ_LANES];
+    alignas(16) float r[EQ_LANES];
+    alignas(16) float r_numerator[EQ_LANES];
+    alignas(16) float r_denominator[EQ_LANES];
+    alignas(16) float y1[EQ_LANES];
+    alignas(16) float y2[EQ_LANES];
+    alignas(16) float y3[EQ_LANES];
+    alignas(16) float y4[EQ_LANES];
+    alignas(16) float oldx[EQ_LANES];
+    alignas(16) float oldy1[EQ_LANES];
+    alignas(16) float oldy2[EQ_LANES];
+    alignas(16) float oldy3[EQ_LANES];
+    alignas(16) float zero_counters[EQ_LANES];
+
+    // HIGH PASS
+    alignas(16) float c0[EQ_LANES];
+    alignas(16) float c1[EQ_LANES];
+    alignas(16) float c2[EQ_LANES];
+    alignas(16) float c3[EQ_LANES];
+    alignas(16) float c4[EQ_LANES];
+    alignas(16) float v1[EQ_LANES];
+    alignas(16) float v2[EQ_LANES];
+
+    float resonance;
+    bool force_update;
+
+    // A LOW PASS STOPS AFTER 50 SAMPLES WITHOUT INPUT AND OUTPUT
+    static constexpr int SILENT_SAMPLES = 50;
+
+    // MONO_SNAP_TO_ZERO WITHOUT THE BRANCH
+    static inline EQLaneGroup snap_to_zero(EQLaneGroup n_) noexcept
+    {
+        return n_ & (abs(n_) > EQLaneGroup::expand(1.0e-8f));
+    }
+    // sample_mix PER LANE
+    static inline EQLaneGroup sample_mix_lanes(EQLaneGroup s1_, EQLaneGroup s2_) noexcept
+    {
+        const EQLaneGroup zero = EQLaneGroup::expand(0);
+        const EQLaneGroup product = s1_ * s2_;
+        const EQLaneGroup signed_product = select(s1_ > zero, product, -product);
+        return s1_ + s2_ - (signed_product & (product > zero));
+    }
+
+    //==========================================================================
+    inline void update(float resonance_) noexcept
+    {
+        if (force_update || resonance != resonance_)
+        {
+            resonance = resonance_;
+            for (int lane = 0; lane != EQ_LANES; ++lane)
+            {
+                r[lane] = resonance_ * r_numerator[lane] / r_denominator[lane];
+            }
+
+            force_update = false;
+        }
+    }
+
+    //==========================================================================
+    // io_ IN: THE BAND INPUTS, OUT: THE BAND OUTPUTS OF THE GROUP
+    inline void process_group(float *io_, int first_lane_) noexcept
+    {
+        const int l = first_lane_;
+        const EQLaneGroup zero = EQLaneGroup::expand(0);
+        const EQLaneGroup silent_samples = EQLaneGroup::expand(float(SILENT_SAMPLES));
+
+        const EQLaneGroup in = snap_to_zero(EQLaneGroup::load(io_ + l));
+        const EQLaneGroup last_y1 = EQLaneGroup::load(y1 + l);
+        const EQLaneGroup last_y2 = EQLaneGroup::load(y2 + l);
+        const EQLaneGroup last_y3 = EQLaneGroup::load(y3 + l);
+        const EQLaneGroup last_y4 = EQLaneGroup::load(y4 + l);
+        const EQLaneGroup last_x = EQLaneGroup::load(oldx + l);
+        const EQLaneGroup last_oldy1 = EQLaneGroup::load(oldy1 + l);
+        const EQLaneGroup last_oldy2 = EQLaneGroup::load(oldy2 + l);
+        const EQLaneGroup last_oldy3 = EQLaneGroup::load(oldy3 + l);
+
+        const EQLaneGroup is_zero = (in == zero) & (last_y4 == zero);
+        const EQLaneGroup zero_counter =
+            min(EQLaneGroup::load(zero_counters + l) + EQLaneGroup::expand(1), silent_samples) &
+            is_zero;
+        zero_counter.store(zero_counters + l);
+        const EQLaneGroup is_active = zero_counter < silent_samples;
+
+        const EQLaneGroup lp = EQLaneGroup::load(p + l);
+        const EQLaneGroup lk = EQLaneGroup::load(k + l);
+        const EQLaneGroup feedback_in = in - EQLaneGroup::load(r + l) * last_y4;
+
+        // Four cascaded onepole filters (bilinear transform)
+        const EQLaneGroup s1 = feedback_in * lp + last_x * lp - lk * snap_to_zero(last_y1);
+        const EQLaneGroup s2 = s1 * lp + last_oldy1 * lp - lk * last_y2;
+        const EQLaneGroup s3 = s2 * lp + last_oldy2 * lp - lk * last_y3;
+        EQLaneGroup s4 = s3 * lp + last_oldy3 * lp - lk * last_y4;
+
+        // Clipper band limited sigmoid
+        s4 = snap_to_zero(s4 - (s4 * s4 * s4) / EQLaneGroup::expand(6));
+
+        // A STOPPED LANE KEEPS ITS STATE AND PASSES THE INPUT
+        select(is_active, s1, last_y1).store(y1 + l);
+        select(is_active, s2, last_y2).store(y2 + l);
+        select(is_active, s3, last_y3).store(y3 + l);
+        select(is_active, s4, last_y4).store(y4 + l);
+        select(is_active, feedback_in, last_x).store(oldx + l);
+        select(is_active, s1, last_oldy1).store(oldy1 + l);
+        select(is_active, s2, last_oldy2).store(oldy2 + l);
+        select(is_active, s3, last_oldy3).store(oldy3 + l);
+
+        EQLaneGroup out =
+            select(is_active, sample_mix_lanes(s4, s3 * EQLaneGroup::expand(resonance)), in);
+
+        // ONLY CLIPS ABOVE 1
+        if (is_any_set(abs(out) > EQLaneGroup::expand(1)))
+        {
+            out.store(io_ + l);
+            for (int lane = l; lane != l + EQ_GROUP_LANES; ++lane)
+            {
+                io_[lane] = soft_clipp_greater_1_2(io_[lane]);
+            }
+            out = EQLaneGroup::load(io_ + l);
+        }
+
+        const EQLaneGroup hp_in = snap_to_zero(out);
+        const EQLaneGroup hp_out =
+            snap_to_zero(EQLaneGroup::load(c0 + l) * hp_in + EQLaneGroup::load(v1 + l));
+        (EQLaneGroup::load(c1 + l) * hp_in - EQLaneGroup::load(c3 + l) * hp_out +
+         EQLaneGroup::load(v2 + l))
+            .store(v1 + l);
+        (EQLaneGroup::load(c2 + l) * hp_in - EQLaneGroup::load(c4 + l) * hp_out).store(v2 + l);
+
+        (hp_out * EQLaneGroup::expand(4)).store(io_ + l);
+    }
+
+    // TRUE IF THE GROUP WOULD RETURN ONLY ZEROS AND CHANGE NOTHING WITHOUT INPUT
+    inline bool is_silent(int group_) const noexcept
+    {
+        bool is_silent = true;
+        for (int lane = group_ * EQ_GROUP_LANES; lane != (group_ + 1) * EQ_GROUP_LANES; ++lane)
+        {
+            is_silent &= zero_counters[lane] == SILENT_SAMPLES && v1[lane] == 0 && v2[lane] == 0;
+        }
+        return is_silent;
+    }
+
+  public:
+    //==========================================================================
+    // band_sums_ = THE MIX OF ALL BANDS, right_in_ AND right_band_sums_ ARE nullptr IN MONO.
+    // THE LANES OF A SKIPPED GROUP STAY 0, WHAT THE FILTERS WOULD HAVE RETURNED.
+    template <int num_lanes_>
+    inline void process_bands(const float *left_in_, const float *right_in_,
+                              const float *const *band_envs_, const float *shapes_,
+                              float *left_band_sums_, float *right_band_sums_,
+                              int num_samples_) noexcept
+    {
+        bool has_input[SUM_EQ_BANDS];
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+        {
+            const juce::Range<float> env_range(
+                juce::FloatVectorOperations::findMinAndMax(band_envs_[band_id], num_samples_));
+            has_input[band_id] = env_range.getStart() != 0 || env_range.getEnd() != 0;
+        }
+
+        int active_groups[EQ_GROUPS];
+        int num_active_groups = 0;
+        for (int group = 0; group != num_lanes_ / EQ_GROUP_LANES; ++group)
+        {
+            bool is_active = !is_silent(group);
+            for (int lane = group * EQ_GROUP_LANES; lane != (group + 1) * EQ_GROUP_LANES; ++lane)
+            {
+                const int band_id = lane % EQ_CHANNEL_LANES;
+                is_active |= band_id < SUM_EQ_BANDS && has_input[band_id];
+            }
+            if (is_active)
+            {
+                active_groups[num_active_groups++] = group;
+            }
+        }
+
+        // NO BAND GETS INPUT AND ALL ARE DONE
+        if (num_active_groups == 0)
+        {
+            juce::FloatVectorOperations::clear(left_band_sums_, num_samples_);
+            if (right_band_sums_)
+            {
+                juce::FloatVectorOperations::clear(right_band_sums_, num_samples_);
+            }
+            return;
+        }
+
+        alignas(16) float bands[EQ_LANES] = {};
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            update(shapes_[sid] * 0.8f);
+
+            const float ins[2] = {left_in_[sid],
+                                  num_lanes_ > EQ_CHANNEL_LANES ? right_in_[sid] : 0.0f};
+            for (int i = 0; i != num_active_groups; ++i)
+            {
+                const int first_lane = active_groups[i] * EQ_GROUP_LANES;
+                const float in = ins[first_lane / EQ_CHANNEL_LANES];
+                for (int lane = first_lane; lane != first_lane + EQ_GROUP_LANES; ++lane)
+                {
+                    const int band_id = lane % EQ_CHANNEL_LANES;
+                    bands[lane] = band_id < SUM_EQ_BANDS ? in * band_envs_[band_id][sid] : 0;
+                }
+                process_group(bands, first_lane);
+            }
+
+            left_band_sums_[sid] = mix_bands(bands);
+            if (num_lanes_ > EQ_CHANNEL_LANES)
+            {
+                right_band_sums_[sid] = mix_bands(bands + EQ_CHANNEL_LANES);
+            }
+        }
+    }
+    static inline float mix_bands(const float *bands_) noexcept
+    {
+        return sample_mix(
+            sample_mix(
+                sample_mix(sample_mix(sample_mix(sample_mix(bands_[6], bands_[5]), bands_[4]),
+                                      bands_[3]),
+                           bands_[2]),
+                bands_[1]),
+            bands_[0] * -1);
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        for (int lane = 0; lane != EQ_LANES; ++lane)
+        {
+            y1[lane] = y2[lane] = y3[lane] = y4[lane] = 0;
+            oldx[lane] = oldy1[lane] = oldy2[lane] = oldy3[lane] = 0;
+            zero_counters[lane] = 0;
+            v1[lane] = v2[lane] = 0;
+        }
+    }
+
+  private:
+    //==========================================================================
+    COLD void sample_rate_or_block_changed() noexcept override
+    {
+        reset();
+        for (int lane = 0; lane != EQ_LANES; ++lane)
+        {
+            const int band_id = lane % EQ_CHANNEL_LANES;
+            if (band_id >= SUM_EQ_BANDS)
+            {
+                p[lane] = k[lane] = r[lane] = r_numerator[lane] = 0;
+                r_denominator[lane] = 1;
+                c0[lane] = c1[lane] = c2[lane] = c3[lane] = c4[lane] = 0;
+                continue;
+            }
+
+            {
+                float f = get_low_pass_band_frequency(band_id, sample_rate) / sample_rate;
+                p[lane] = f * (1.8f - 0.8f * f);
+                k[lane] = p[lane] * 2 - 1;
+            }
+            {
+                float t = (1.0f - p[lane]) * 1.386249f;
+                const float t2 = 12.0f + t * t;
+                r_numerator[lane] = t2 + 6.0f * t;
+                r_denominator[lane] = t2 - 6.0f * t;
+            }
+            {
+                const juce::IIRCoefficients coefficients(juce::IIRCoefficients::makeHighPass(
+                    sample_rate, get_high_pass_band_frequency(band_id)));
+                c0[lane] = coefficients.coefficients[0];
+                c1[lane] = coefficients.coefficients[1];
+                c2[lane] = coefficients.coefficients[2];
+                c3[lane] = coefficients.coefficients[3];
+                c4[lane] = coefficients.coefficients[4];
+            }
+        }
+        force_update = true;
+    }
+
+  public:
+    //==========================================================================
+    COLD EQFilterBank(RuntimeNotifyer *const notifyer_) noexcept
+        : RuntimeListener(notifyer_), resonance(0.99999), force_update(true)
+    {
+        sample_rate_or_block_changed();
+    }
+    COLD ~EQFilterBank() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EQFilterBank)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class EQProcessorStereo
+{
+    MoniqueSynthData *const synth_data;
+
+    EQFilterBank filter_bank;
+
+    EQData *const eq_data;
+    DataBuffer *const data_buffer;
+
+  public:
+    juce::OwnedArray<ENV> envs;
+
+  public:
+    //==============================================================================
+    inline void start_attack() noexcept
+    {
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+        {
+            envs.getUnchecked(band_id)->start_attack();
+        }
+    }
+    inline void start_release() noexcept
+    {
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+        {
+            envs.getUnchecked(band_id)->set_to_release();
+        }
+    }
+    inline void reset() noexcept
+    {
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+        {
+            envs.getUnchecked(band_id)->reset();
+        }
+        filter_bank.reset();
+    }
+
+  private:
+    //==============================================================================
+    // band_sums_ = THE MIX OF ALL BANDS, right_in_ AND right_band_sums_ ARE nullptr IN MONO
+    template <int num_lanes_>
+    inline void process_bands(const float *left_in_, const float *right_in_,
+                              float *left_band_sums_, float *right_band_sums_,
+                              int num_samples_) noexcept
+    {
+        const float *band_envs[SUM_EQ_BANDS];
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+        {
+            band_envs[band_id] = data_buffer->band_env_buffers.getReadPointer(band_id);
+        }
+        filter_bank.process_bands<num_lanes_>(
+            left_in_, right_in_, band_envs, synth_data->shape_smoother.get_smoothed_value_buffer(),
+            left_band_sums_, right_band_sums_, num_samples_);
+    }
+
+    //==============================================================================
+    inline void process_final_mix(float *io_buffer_, const float *band_sums_,
+                                  int num_samples_) noexcept
+    {
+        // const float* const smoothed_distortion =
+        // synth_data->final_clipping_smoother.get_smoothed_modulated_value_buffer() ;
+        const float *const smoothed_distortion =
+            synth_data->distortion_smoother.get_smoothed_value_buffer();
+        const float *const smoothed_fx_bypass_buffer =
+            synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
+        const float *const smoothed_bypass = eq_data->bypass_smoother.get_smoothed_value_buffer();
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            const float distortion = smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
+            const float bypass = smoothed_bypass[sid];
+            if (bypass > 0)
+            {
+                // MONO_SNAP_TO_ZERO(sum)
+                float mix = band_sums_[sid] * bypass + io_buffer_[sid] * (1.0f - bypass);
+                io_buffer_[sid] = soft_clipp_greater_1_2(
+                    mix * (1.0f - distortion) + (std::atan(mix * 10) * 0.7f) * distortion);
+                // io_buffer_[sid] = soft_clipp_greater_1_2(sample_mix(mix*(1.0f-distortion),
+                // sample_mix( mix, mix )*distortion));
+            }
+            else
+            {
+                io_buffer_[sid] =
+                    soft_clipp_greater_1_2(io_buffer_[sid] * (1.0f - distortion) +
+                                           (std::atan(io_buffer_[sid] * 10) * 0.7f) * distortion);
+            }
+        }
+    }
+
+  public:
+    //==============================================================================
+    inline void process(int num_samples_) noexcept
+    {
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+        {
+            ENV *env(envs.getUnchecked(band_id));
+            eq_data->velocity_smoothers[band_id]->process_amp(
+                !eq_data->hold[band_id], synth_data->glide_motor_time, env,
+                data_buffer->band_env_buffers.getWritePointer(band_id), num_samples_);
+        }
+
+        float *const left_io = data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
+        float *const left_band_sums = data_buffer->band_sum_buffers.getWritePointer(LEFT);
+        if (synth_data->is_stereo)
+        {
+            float *const right_io =
+                data_buffer->filter_stereo_output_samples.getWritePointer(RIGHT);
+            float *const right_band_sums = data_buffer->band_sum_buffers.getWritePointer(RIGHT);
+            process_bands<EQ_LANES>(left_io, right_io, left_band_sums, right_band_sums,
+                                    num_samples_);
+            process_final_mix(left_io, left_band_sums, num_samples_);
+            process_final_mix(right_io, right_band_sums, num_samples_);
+        }
+        else
+        {
+            process_bands<EQ_CHANNEL_LANES>(left_io, nullptr, left_band_sums, nullptr,
+                                            num_samples_);
+            process_final_mix(left_io, left_band_sums, num_samples_);
+        }
+
+        if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
+        {
+            amp_painter->add_eq(data_buffer->filter_stereo_output_samples.getWritePointer(LEFT),
+                                num_samples_);
+        }
+    }
+
+  public:
+    //==========================================================================
+    COLD EQProcessorStereo(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_,
+                           const float *const sine_lookup_, const float *const cos_lookup_,
+                           const float *const exp_lookup_) noexcept
+        : synth_data(synth_data_), filter_bank(notifyer_), eq_data(synth_data_->eq_data.get()),
+          data_buffer(synth_data_->data_buffer)
+    {
+#ifdef JUCE_DEBUG
+        std::cout << "MONIQUE: init EQ" << std::endl;
+#endif
+
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+        {
+            envs.add(new ENV(notifyer_, synth_data_,
+                             synth_data_->eq_data->envs.getUnchecked(band_id), sine_lookup_,
+                             cos_lookup_, exp_lookup_));
+        }
+    }
+    COLD ~EQProcessorStereo() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EQProcessorStereo)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class AllPassFilter
+{
+    juce::HeapBlock<float> buffer;
+    int bufferSize, bufferIndex;
+
+  public:
+    //==============================================================================
+    // IN PLACE. A RUN NEVER CROSSES THE BUFFER END AND EVERY SAMPLE OF IT TOUCHES ANOTHER DELAY
+    // SLOT, SO THE INNER LOOP HAS NO WRAP AND NO DEPENDENCY AND CAN BE VECTORIZED
+    inline void process(float *io_, int num_samples_) noexcept
+    {
+        while (num_samples_ > 0)
+        {
+            const int num_run = juce::jmin(num_samples_, bufferSize - bufferIndex);
+            float *const delay = buffer + bufferIndex;
+            for (int sid = 0; sid != num_run; ++sid)
+            {
+                const float input = io_[sid];
+                const float bufferedValue = delay[sid];
+                float temp = input + (bufferedValue * 0.5f);
+                JUCE_UNDENORMALISE(temp);
+                delay[sid] = temp;
+                io_[sid] = bufferedValue - input;
+            }
+
+            bufferIndex += num_run;
+            if (bufferIndex == bufferSize)
+            {
+                bufferIndex = 0;
+            }
+            io_ += num_run;
+            num_samples_ -= num_run;
+        }
+    }
+
+    //==============================================================================
+    COLD void setSize(const int size)
+    {
+        if (size != bufferSize)
+        {
+            bufferIndex = 0;
+            buffer.malloc((size_t)size);
+            bufferSize = size;
+        }
+
+        clear();
+    }
+    COLD void clear() noexcept { buffer.clear((size_t)bufferSize); }
+
+  public:
+    //==============================================================================
+    COLD AllPassFilter() noexcept : bufferSize(0), bufferIndex(0) {}
+    COLD ~AllPassFilter() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AllPassFilter)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_Chorus : public RuntimeListener
+{
+    MoniqueSynthData *const synth_data;
+    ChorusData *const chorus_data;
+
+    mono_SineWaveAutonom osc_1;
+    mono_SineWaveAutonom osc_2;
+    mono_SineWaveAutonom osc_3;
+    mono_SineWaveAutonom osc_4;
+    mono_SineWaveAutonom osc_5;
+
+    int buffer_size;
+    int index;
+    mono_AudioSampleBuffer<2> data_buffer;
+    float *current_left_buffer;
+    float *current_right_buffer;
+
+  public:
+#define SUM_DELAY_LINES 4
+    inline void process(float *left_in_, float *right_in_, float *left_out_, float *right_out_,
+                        int num_samples_) noexcept
+    {
+        const float *const chorus_env_buffer(
+            chorus_data->modulation_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_pan_buffer(
+            chorus_data->pan_smoother.get_smoothed_value_buffer());
+
+        const float e_samples = sample_rate / 164.81; // 82.41;
+        const float e2_samples = sample_rate / 165.91;
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            // const float power = (exp( (chorus_env_buffer[sid] *0.85f) *2)-1)/6.38906;
+            const float power = chorus_env_buffer[sid] * 0.8f;
+            const float amps[SUM_DELAY_LINES] = {
+                ((osc_1.tick() * 0.7f + osc_2.tick() * 0.3f) + 1) * 0.5f,
+                ((osc_1.lastOut_with_phase_offset(0.25f) * 0.3f + osc_3.tick() * 0.6f) + 1) * 0.5f,
+                ((osc_1.lastOut_with_phase_offset(0.5f) * 0.4f + osc_4.tick() * 0.5f) + 1) * 0.5f,
+                ((osc_1.lastOut_with_phase_offset(0.75f) * 0.6f + osc_5.tick() * 0.4f) + 1) * 0.5f};
+            const float pan = smoothed_pan_buffer[sid];
+
+#define CHECK_MAKE_INDEX_VALID(floated_index_, size_)                                              \
+    if (floated_index_ >= size_)                                                                   \
+    {                                                                                              \
+        floated_index_ -= size_;                                                                   \
+    }                                                                                              \
+    else if (floated_index_ < 0)                                                                   \
+    {                                                                                              \
+        floated_index_ += size_;                                                                   \
+    }
+#define CHECK_MAKE_INDEX_VALID_upper_only(floated_index_, size_)                                   \
+    if (floated_index_ >= size_)                                                                   \
+    {                                                                                              \
+        floated_index_ -= size_;                                                                   \
+    }
+            // L
+            const float fade_in = 1.0f - (juce::jmin(1.0f, power * 2));
+            const float fade_effect = (juce::jmin(1.0f, power * 2));
+            {
+                float result_l = 0;
+                for (int i = 0; i != SUM_DELAY_LINES; ++i)
+                {
+                    float delay = (power * 0.9 + 0.1) * e_samples * amps[i];
+                    float float_index = float(index) - delay + 1;
+                    CHECK_MAKE_INDEX_VALID(float_index, buffer_size)
+
+                    const int index_1 = std::floor(float_index);
+                    int index_2 = index_1 + 1;
+                    CHECK_MAKE_INDEX_VALID_upper_only(index_2, buffer_size) const float delta =
+                        float_index - index_1;
+
+                    result_l += (current_left_buffer[index_1] * (1.0f - delta) +
+                                 current_left_buffer[index_2] * delta) /
+                                (i + 2);
+                }
+                {
+                    current_left_buffer[index] =
+                        sample_mix(left_in_[sid], result_l * power * pan_law.left(pan));
+                    left_out_[sid] = left_in_[sid] * fade_in + result_l * fade_effect;
+                }
+            }
+            // R
+            if (synth_data->is_stereo)
+            {
+                float result_r = 0;
+                for (int i = 0; i != SUM_DELAY_LINES; ++i)
+                {
+                    float delay = (power * 0.9 + 0.1) * e2_samples * amps[i];
+                    float float_index = float(index) - delay + 1;
+                    CHECK_MAKE_INDEX_VALID(float_index, buffer_size)
+
+                    const int index_1 = std::floor(float_index);
+                    int index_2 = index_1 + 1;
+                    CHECK_MAKE_INDEX_VALID_upper_only(index_2, buffer_size) const float delta =
+                        float_index - index_1;
+
+                    result_r += (current_right_buffer[index_1] * (1.0f - delta) +
+                                 current_right_buffer[index_2] * delta) /
+                                (i + 2);
+                }
+                {
+                    current_right_buffer[index] =
+                        sample_mix(right_in_[sid], result_r * power * pan_law.right(pan));
+                    right_out_[sid] = right_in_[sid] * fade_in + result_r * fade_effect;
+                }
+            }
+
+            index = (index + 1) % buffer_size;
+        }
+    }
+
+    inline void reset() noexcept { data_buffer.clear(); }
+    //==============================================================================
+    COLD void sample_rate_or_block_changed() noexcept override
+    {
+        buffer_size = sample_rate / 82.41;
+        data_buffer.setSize(buffer_size, false);
+        data_buffer.clear();
+
+        current_left_buffer = data_buffer.getWritePointer(LEFT);
+        current_right_buffer = data_buffer.getWritePointer(RIGHT);
+    }
+
+  public:
+    //==============================================================================
+    COLD mono_Chorus(RuntimeNotifyer *const notifyer_, MoniqueSynthData *const synth_data_) noexcept
+        : RuntimeListener(notifyer_),
+
+          synth_data(synth_data_),
+
+          chorus_data(synth_data_->chorus_data.get()), osc_1(notifyer_, synth_data_->sine_lookup),
+          osc_2(notifyer_, synth_data_->sine_lookup), osc_3(notifyer_, synth_data_->sine_lookup),
+          osc_4(notifyer_, synth_data_->sine_lookup),
+
+          osc_5(notifyer_, synth_data_->sine_lookup), buffer_size(1), index(0),
+
+          data_buffer(buffer_size)
+    {
+        sample_rate_or_block_changed();
+        osc_1.set_frequency(0.4);
+        osc_2.set_frequency(0.6);
+        osc_3.set_frequency(0.55);
+        osc_4.set_frequency(0.5);
+        osc_5.set_frequency(0.45);
+    }
+    COLD ~mono_Chorus() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Chorus)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_Delay : public RuntimeListener, juce::AsyncUpdater
+{
+    const MoniqueSynthData *synth_data;
+    RuntimeInfo *info;
+
+    // SLOWER TEMPOS ARE IGNORED, THE BUFFERS ARE ALLOCATED FOR IT
+    static constexpr double MIN_BPM = 20;
+    static constexpr int REFLEXION_FADE_IN_MS = 20;
+
+    double last_bmp_in;
+
+    enum WORKERS
+    {
+        LEFT_MIX,
+        RIGHT_MIX,
+        LEFT_GAIN,
+        RIGHT_GAIN,
+        RECORD_POWER,
+        LEFT_RECORD,
+        RIGHT_RECORD,
+        LEFT_FEEDBACK,
+        RIGHT_FEEDBACK,
+
+        SUM_WORKERS
+    };
+    mono_AudioSampleBuffer<SUM_WORKERS> workers;
+
+    // THE REFLEXION BUFFER RUNS CIRCULAR OVER ITS FULL SIZE, A SIZE CHANGE MOVES THE READ HEAD ONLY
+    int reflexion_write_index;
+    int last_in_reflexion_size;
+    int reflexion;
+    int current_reflexion;
+    int last_reflexion;
+    int reflexion_fade_countdown;
+    int reflexion_fade_samples;
+    mono_AudioSampleBuffer<2> reflexion_buffer;
+    float *active_left_reflexion_buffer;
+    float *active_right_reflexion_buffer;
+
+    int record_index;
+    int last_in_record_size;
+    int record_buffer_size;
+    int real_record_buffer_size;
+    int used_record_buffer_size;
+    int num_records_to_write;
+    // 4 BARS AT MIN_BPM ARE ~17 MB AT 44.1 KHZ (~74 MB AT 192 KHZ), THE RECORD BUFFER IS ONLY
+    // ALLOCATED ON THE MESSAGE THREAD WHEN THE RECORD IS SWITCHED ON FOR THE FIRST TIME. UNTIL IT
+    // IS READY THE RECORD STAYS OFF. THE REFLEXION BUFFER (ONE BAR, ~4 MB) IS ALWAYS ALLOCATED.
+    std::unique_ptr<mono_AudioSampleBuffer<2>> record_buffer;
+    std::atomic_bool is_record_buffer_ready{false};
+    juce::CriticalSection record_buffer_lock;
+    float *active_left_record_buffer;
+    float *active_right_record_buffer;
+    bool force_clear;
+
+    LinearSmootherMinMax<0, 1> record_switch_smoother;
+
+  public:
+    //==============================================================================
+    inline void set_reflexion_size(int reflexion_in_size_, int record_buffer_size_,
+                                   int glide_time_in_ms_, double bpm_) noexcept
+    {
+        // SETUP THE REFLEXION BUFFER
+        if (bpm_ < MIN_BPM)
+        {
+            return;
+        }
+
+        bool bpm_changed = last_bmp_in != bpm_;
+        last_bmp_in = bpm_;
+
+        if (bpm_changed || last_in_reflexion_size != reflexion_in_size_)
+        {
+            last_in_reflexion_size = reflexion_in_size_;
+            update_reflexion_stuff(bpm_);
+        }
+        if (bpm_changed || last_in_record_size != record_buffer_size_)
+        {
+            last_in_record_size = record_buffer_size_;
+            update_record_stuff(bpm_);
+        }
+
+        record_switch_smoother.reset_coefficients(sample_rate, juce::jmax(200, glide_time_in_ms_));
+    }
+
+    //==============================================================================
+  private:
+    inline double get_samples_per_bar(double bpm_) const noexcept
+    {
+        const double bars_per_sec = bpm_ / 4 / 60;
+        return (1.0 / bars_per_sec) * sample_rate;
+    }
+    inline void update_reflexion_stuff(double bpm_) noexcept
+    {
+        // REFLEXIONS OF ONE BAR AND LONGER WRAP AT ONE BAR, LIKE THEY DID IN A BAR SIZED BUFFER
+        const double samples_per_bar = get_samples_per_bar(bpm_);
+        const int bar_size = juce::jmax(1, int(floor(samples_per_bar)));
+        const int reflexion_in_bar =
+            int(samples_per_bar * delay_multi(last_in_reflexion_size)) % bar_size;
+        reflexion = reflexion_in_bar > 0 ? reflexion_in_bar : bar_size;
+    }
+    inline void update_record_stuff(double bpm_) noexcept
+    {
+        num_records_to_write = delay_multi(last_in_record_size); // 1, 2 or 4
+        const double samples_per_bar = get_samples_per_bar(bpm_);
+        real_record_buffer_size = juce::jmax(1, int(samples_per_bar * 4));
+        record_buffer_size = samples_per_bar;
+        used_record_buffer_size = juce::jmax(used_record_buffer_size, real_record_buffer_size);
+        if (record_index >= real_record_buffer_size)
+        {
+            record_index %= real_record_buffer_size;
+        }
+    }
+
+  private:
+    //==============================================================================
+    // RETURNS THE WEIGHT OF THE LAST READ HEAD, A NEW REFLEXION STARTS TO FADE IN AS SOON AS THE
+    // RUNNING FADE IS DONE
+    inline float update_get_reflexion_fade() noexcept
+    {
+        if (reflexion_fade_countdown == 0)
+        {
+            if (current_reflexion == reflexion)
+            {
+                return 0;
+            }
+
+            last_reflexion = current_reflexion;
+            current_reflexion = reflexion;
+            reflexion_fade_countdown = reflexion_fade_samples;
+        }
+
+        return float(reflexion_fade_countdown--) / reflexion_fade_samples;
+    }
+    inline int get_reflexion_read_index(int reflexion_) const noexcept
+    {
+        const int read_index = reflexion_write_index - reflexion_;
+        return read_index < 0 ? read_index + reflexion_buffer.get_size() : read_index;
+    }
+    inline float read_reflexion(const float *reflexion_buffer_, float last_weight_) const noexcept
+    {
+        const float current = reflexion_buffer_[get_reflexion_read_index(current_reflexion)];
+        if (last_weight_ == 0)
+        {
+            return current;
+        }
+
+        const float last = reflexion_buffer_[get_reflexion_read_index(last_reflexion)];
+        return current + (last - current) * last_weight_;
+    }
+    inline void clear_used_record_buffer() noexcept
+    {
+        juce::FloatVectorOperations::clear(active_left_record_buffer, used_record_buffer_size);
+        juce::FloatVectorOperations::clear(active_right_record_buffer, used_record_buffer_size);
+        used_record_buffer_size = real_record_buffer_size;
+    }
+
+    // reflexion_buffer_ = mixes_ * powers_ * gains_, gains_ may be nullptr
+    static inline void write_reflexion(float *reflexion_buffer_, const float *mixes_,
+                                       const float *powers_, const float *gains_,
+                                       int num_samples_) noexcept
+    {
+        juce::FloatVectorOperations::multiply(reflexion_buffer_, mixes_, powers_, num_samples_);
+        if (gains_)
+        {
+            juce::FloatVectorOperations::multiply(reflexion_buffer_, gains_, num_samples_);
+        }
+    }
+    // dest_ = sample_mix(records_, feedbacks_) * releases_, records_ WHERE THE RECORD IS OFF
+    static inline void write_record(float *dest_, const float *records_, const float *feedbacks_,
+                                    const float *releases_, const float *powers_,
+                                    int num_samples_) noexcept
+    {
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            const float record = records_[sid];
+            const float recorded = sample_mix(record, feedbacks_[sid]) * releases_[sid];
+            dest_[sid] = powers_[sid] > 0 ? recorded : record;
+        }
+    }
+
+    //==============================================================================
+    // FILLS THE REFLEXION AND INPUT MIXES AND WRITES THEM BACK TO THE REFLEXION BUFFER
+    // Runs in contiguous segments which neither wrap the buffer nor read what they write, per
+    // sample only while the read heads fade. in_r_ is nullptr in mono.
+    inline void process_reflexion(const float *in_l_, const float *in_r_, const float *powers_,
+                                  const float *left_gains_, const float *right_gains_,
+                                  int num_samples_) noexcept
+    {
+        float *const left_mixes = workers.getWritePointer(LEFT_MIX);
+        float *const right_mixes = workers.getWritePointer(RIGHT_MIX);
+        const int buffer_size = reflexion_buffer.get_size();
+
+        int sid = 0;
+        while (sid != num_samples_)
+        {
+            int num_samples;
+            if (reflexion_fade_countdown > 0 || current_reflexion != reflexion)
+            {
+                const float last_reflexion_weight = update_get_reflexion_fade();
+                left_mixes[sid] =
+                    sample_mix(read_reflexion(active_left_reflexion_buffer, last_reflexion_weight),
+                               in_l_[sid]);
+                if (in_r_)
+                {
+                    right_mixes[sid] =
+                        sample_mix(read_reflexion(active_right_reflexion_buffer,
+                                                  last_reflexion_weight),
+                                   in_r_[sid]);
+                }
+                num_samples = 1;
+            }
+            else
+            {
+                const int read_index = get_reflexion_read_index(current_reflexion);
+                num_samples = juce::jmin(num_samples_ - sid, current_reflexion,
+                                         buffer_size - read_index,
+                                         buffer_size - reflexion_write_index);
+                sample_mix(left_mixes + sid, active_left_reflexion_buffer + read_index,
+                           in_l_ + sid, num_samples);
+                if (in_r_)
+                {
+                    sample_mix(right_mixes + sid, active_right_reflexion_buffer + read_index,
+                               in_r_ + sid, num_samples);
+                }
+            }
+
+            write_reflexion(active_left_reflexion_buffer + reflexion_write_index,
+                            left_mixes + sid, powers_ + sid,
+                            left_gains_ ? left_gains_ + sid : nullptr, num_samples);
+            if (in_r_)
+            {
+                write_reflexion(active_right_reflexion_buffer + reflexion_write_index,
+                                right_mixes + sid, powers_ + sid, right_gains_ + sid,
+                                num_samples);
+            }
+
+            reflexion_write_index += num_samples;
+            if (reflexion_write_index == buffer_size)
+            {
+                reflexion_write_index = 0;
+            }
+            sid += num_samples;
+        }
+    }
+
+    //==============================================================================
+    // MIXES THE RECORD INTO io_l/io_r AND RECORDS THE REFLEXION AND INPUT MIXES
+    // A segment is never longer than one record bar and wraps no tap, so no tap reads or writes
+    // what another one touched in the same segment. A clear ends the segment at the first sample
+    // without record power, after its record is read. io_r is nullptr in mono.
+    inline void process_record(float *io_l, float *io_r, const float *powers_,
+                               const float *releases_, bool is_recording_,
+                               int num_samples_) noexcept
+    {
+#if MONIQUE_DSP_CHECKS
+        if (is_per_sample_record)
+        {
+            process_record_per_sample(io_l, io_r, powers_, releases_, num_samples_);
+            return;
+        }
+#endif
+        const float *const left_mixes = workers.getReadPointer(LEFT_MIX);
+        const float *const right_mixes = workers.getReadPointer(RIGHT_MIX);
+        int clear_at = -1;
+        if (force_clear)
+        {
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                if (powers_[sid] == 0)
+                {
+                    clear_at = sid;
+                    break;
+                }
+            }
+        }
+
+        int tap_offsets[3];
+        int num_taps = 0;
+        if (num_records_to_write == 1)
+        {
+            tap_offsets[num_taps++] = record_buffer_size;
+            tap_offsets[num_taps++] = record_buffer_size * 2;
+            tap_offsets[num_taps++] = record_buffer_size * 3;
+        }
+        else if (num_records_to_write == 2)
+        {
+            tap_offsets[num_taps++] = record_buffer_size * 2;
+        }
+
+        float *const left_records = workers.getWritePointer(LEFT_RECORD);
+        float *const right_records = workers.getWritePointer(RIGHT_RECORD);
+        float *const left_feedbacks = workers.getWritePointer(LEFT_FEEDBACK);
+        float *const right_feedbacks = workers.getWritePointer(RIGHT_FEEDBACK);
+
+        int sid = 0;
+        while (sid != num_samples_)
+        {
+            int num_samples =
+                juce::jmin(num_samples_ - sid, real_record_buffer_size - record_index);
+            if (clear_at >= sid)
+            {
+                num_samples = juce::jmin(num_samples, clear_at + 1 - sid);
+            }
+            if (is_recording_)
+            {
+                int tap_indices[3];
+                num_samples = juce::jmin(num_samples, record_buffer_size);
+                for (int tap = 0; tap != num_taps; ++tap)
+                {
+                    int tap_index = record_index + tap_offsets[tap];
+                    if (tap_index >= real_record_buffer_size)
+                    {
+                        tap_index -= real_record_buffer_size;
+                    }
+                    tap_indices[tap] = tap_index;
+                    num_samples = juce::jmin(num_samples, real_record_buffer_size - tap_index);
+                }
+
+                juce::FloatVectorOperations::copy(
+                    left_records + sid, active_left_record_buffer + record_index, num_samples);
+                juce::FloatVectorOperations::multiply(left_feedbacks + sid, left_mixes + sid,
+                                                      powers_ + sid, num_samples);
+                write_record(active_left_record_buffer + record_index, left_records + sid,
+                             left_feedbacks + sid, releases_ + sid, powers_ + sid, num_samples);
+                for (int tap = 0; tap != num_taps; ++tap)
+                {
+                    float *const record = active_left_record_buffer + tap_indices[tap];
+                    write_record(record, record, left_feedbacks + sid, releases_ + sid,
+                                 powers_ + sid, num_samples);
+                }
+                if (io_r)
+                {
+                    juce::FloatVectorOperations::copy(right_records + sid,
+                                                      active_right_record_buffer + record_index,
+                                                      num_samples);
+                    juce::FloatVectorOperations::multiply(right_feedbacks + sid,
+                                                          right_mixes + sid, powers_ + sid,
+                                                          num_samples);
+                    write_record(active_right_record_buffer + record_index, right_records + sid,
+                                 right_feedbacks + sid, releases_ + sid, powers_ + sid,
+                                 num_samples);
+                    for (int tap = 0; tap != num_taps; ++tap)
+                    {
+                        float *const record = active_right_record_buffer + tap_indices[tap];
+                        write_record(record, record, right_feedbacks + sid, releases_ + sid,
+                                     powers_ + sid, num_samples);
+                    }
+                }
+
+                sample_mix(io_l + sid, left_records + sid, left_mixes + sid, num_samples);
+                if (io_r)
+                {
+                    sample_mix(io_r + sid, right_records + sid, right_mixes + sid, num_samples);
+                }
+            }
+            else
+            {
+                sample_mix(io_l + sid, active_left_record_buffer + record_index, left_mixes + sid,
+                           num_samples);
+                if (io_r)
+                {
+                    sample_mix(io_r + sid, active_right_record_buffer + record_index,
+                               right_mixes + sid, num_samples);
+                }
+            }
+
+            record_index += num_samples;
+            if (record_index == real_record_buffer_size)
+            {
+                record_index = 0;
+            }
+            sid += num_samples;
+            if (sid == clear_at + 1)
+            {
+                clear_used_record_buffer();
+                force_clear = false;
+            }
+        }
+    }
+
+#if MONIQUE_DSP_CHECKS
+  public:
+    // THE SAMPLE BY SAMPLE RECORD OF THE ORIGINAL DELAY, THE REFERENCE OF THE delay-record CHECK
+    bool is_per_sample_record = false;
+
+  private:
+    inline void process_record_per_sample(float *io_l, float *io_r, const float *powers_,
+                                          const float *releases_, int num_samples_) noexcept
+    {
+        const float *const left_mixes = workers.getReadPointer(LEFT_MIX);
+        const float *const right_mixes = workers.getReadPointer(RIGHT_MIX);
+        const int num_taps = num_records_to_write == 1 ? 3 : num_records_to_write == 2 ? 1 : 0;
+        const int tap_distance = num_records_to_write == 1 ? record_buffer_size
+                                                           : record_buffer_size * 2;
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            const float record_power = powers_[sid];
+            const float left_record = active_left_record_buffer[record_index];
+            const float right_record = io_r ? active_right_record_buffer[record_index] : 0;
+            if (record_power > 0)
+            {
+                const float release = releases_[sid];
+                const float left_feedback = left_mixes[sid] * record_power;
+                const float right_feedback = io_r ? right_mixes[sid] * record_power : 0;
+                active_left_record_buffer[record_index] =
+                    sample_mix(left_record, left_feedback) * release;
+                if (io_r)
+                {
+                    active_right_record_buffer[record_index] =
+                        sample_mix(right_record, right_feedback) * release;
+                }
+                int tap_index = record_index;
+                for (int tap = 0; tap != num_taps; ++tap)
+                {
+                    tap_index += tap_distance;
+                    if (tap_index >= real_record_buffer_size)
+                    {
+                        tap_index -= real_record_buffer_size;
+                    }
+                    active_left_record_buffer[tap_index] =
+                        sample_mix(active_left_record_buffer[tap_index], left_feedback) * release;
+                    if (io_r)
+                    {
+                        active_right_record_buffer[tap_index] =
+                            sample_mix(active_right_record_buffer[tap_index], right_feedback) *
+                            release;
+                    }
+                }
+            }
+            else if (force_clear)
+            {
+                record_buffer->clear();
+                force_clear = false;
+            }
+
+            io_l[sid] = sample_mix(left_record, left_mixes[sid]);
+            if (io_r)
+            {
+                io_r[sid] = sample_mix(right_record, right_mixes[sid]);
+            }
+            record_index = (record_index + 1) % real_record_buffer_size;
+        }
+    }
+#endif
+
+    // WITHOUT RECORD BUFFER, THE RECORD INDEX RUNS ON TO STAY IN TIME WITH THE BARS
+    inline void skip_record(float *io_l, float *io_r, int num_samples_) noexcept
+    {
+        juce::FloatVectorOperations::copy(io_l, workers.getReadPointer(LEFT_MIX), num_samples_);
+        if (io_r)
+        {
+            juce::FloatVectorOperations::copy(io_r, workers.getReadPointer(RIGHT_MIX),
+                                              num_samples_);
+        }
+        record_index = (record_index + num_samples_) % real_record_buffer_size;
+    }
+
+  public:
+    //==============================================================================
+    inline void process(float *const io_l, float *const io_r, const float *smoothed_power_,
+                        const float *smoothed_pan_buffer_, const float *record_release_buffer_,
+                        bool record_, const int num_samples_) noexcept
+    {
+        const bool is_stereo = synth_data->is_stereo;
+
+        // ALLOCATE THE RECORD BUFFER ON THE FIRST RECORD, OFFLINE AT ONCE (THERE MAY BE NO
+        // MESSAGE LOOP). NOTHING TO CLEAR WITHOUT.
+        bool has_record_buffer = is_record_buffer_ready.load(std::memory_order_acquire);
+        if (!has_record_buffer && record_)
+        {
+            if (synth_data->audio_processor->isNonRealtime())
+            {
+                make_record_buffer_ready();
+                has_record_buffer = true;
+            }
+            else
+            {
+                triggerAsyncUpdate();
+            }
+        }
+        if (!has_record_buffer)
+        {
+            record_ = false;
+            force_clear = false;
+        }
+
+        // PREPARE RECORDING
+        record_ = force_clear ? false : record_;
+        if (!record_)
+        {
+            record_switch_smoother.set_value(false);
+            record_switch_smoother.reset_glide_countdown();
+        }
+        float *const record_powers = workers.getWritePointer(RECORD_POWER);
+        float max_record_power = 0;
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            float record_power = 0;
+            if (record_)
+            {
+                record_power = record_switch_smoother.glide_tick(true);
+            }
+            else if (!record_switch_smoother.is_up_to_date())
+            {
+                record_power = record_switch_smoother.tick();
+            }
+            record_powers[sid] = record_power;
+            max_record_power = juce::jmax(max_record_power, record_power);
+        }
+
+        // CURRENT INPUT AND REFLEXION OF USER SIZE
+        if (is_stereo)
+        {
+            // SWAPPED L AND R HERE - Must be wrong somethere else
+            float *const left_gains = workers.getWritePointer(LEFT_GAIN);
+            float *const right_gains = workers.getWritePointer(RIGHT_GAIN);
+            pan_law.get(smoothed_pan_buffer_, right_gains, left_gains, num_samples_);
+            process_reflexion(io_l, io_r, smoothed_power_, left_gains, right_gains,
+                              num_samples_);
+        }
+        else
+        {
+            process_reflexion(io_l, nullptr, smoothed_power_, nullptr, nullptr, num_samples_);
+        }
+
+        // RECORD AND MIX BEFORE
+        if (has_record_buffer)
+        {
+            process_record(io_l, is_stereo ? io_r : nullptr, record_powers,
+                           record_release_buffer_, max_record_power > 0, num_samples_);
+        }
+        else
+        {
+            skip_record(io_l, is_stereo ? io_r : nullptr, num_samples_);
+        }
+    }
+
+    //==============================================================================
+    inline void reset() noexcept { sample_rate_or_block_changed(); }
+
+    //==============================================================================
+    inline void clear_record_buffer() noexcept { force_clear = true; }
+
+    inline int get_max_duration() const noexcept { return real_record_buffer_size; }
+
+  private:
+    //==============================================================================
+    // MESSAGE THREAD (AUDIO THREAD OFFLINE), SETS THE READY FLAG AFTER THE BUFFER AND ITS POINTERS
+    COLD void make_record_buffer_ready() noexcept
+    {
+        const juce::ScopedLock locked(record_buffer_lock);
+        if (!is_record_buffer_ready)
+        {
+            allocate_record_buffer();
+            is_record_buffer_ready.store(true, std::memory_order_release);
+        }
+    }
+    void handleAsyncUpdate() override { make_record_buffer_ready(); }
+    COLD void allocate_record_buffer() noexcept
+    {
+        const int max_record_buffer_size = int(ceil(get_samples_per_bar(MIN_BPM))) * 4;
+        if (!record_buffer)
+        {
+            record_buffer = std::make_unique<mono_AudioSampleBuffer<2>>(max_record_buffer_size);
+        }
+        else if (record_buffer->get_size() != max_record_buffer_size)
+        {
+            record_buffer->setSize(max_record_buffer_size);
+        }
+        active_left_record_buffer = record_buffer->getWritePointer(LEFT);
+        active_right_record_buffer = record_buffer->getWritePointer(RIGHT);
+    }
+
+    //==============================================================================
+    // ALLOCATES ONE BAR AT MIN_BPM FOR THE REFLEXION AND 4 BARS FOR THE RECORD IF IT IS IN USE,
+    // THE AUDIO THREAD CHANGES ONLY THE USED LENGTH
+    COLD void sample_rate_or_block_changed() noexcept override
+    {
+        const int max_samples_per_bar = ceil(get_samples_per_bar(MIN_BPM));
+        if (reflexion_buffer.get_size() != max_samples_per_bar)
+        {
+            reflexion_buffer.setSize(max_samples_per_bar);
+            active_left_reflexion_buffer = reflexion_buffer.getWritePointer(LEFT);
+            active_right_reflexion_buffer = reflexion_buffer.getWritePointer(RIGHT);
+            reflexion_write_index = 0;
+
+            {
+                const juce::ScopedLock locked(record_buffer_lock);
+                if (is_record_buffer_ready)
+                {
+                    allocate_record_buffer();
+                }
+            }
+            record_index = 0;
+            used_record_buffer_size = 0;
+        }
+        reflexion_fade_samples = juce::jmax(1, int(sample_rate * REFLEXION_FADE_IN_MS / 1000));
+        if (workers.get_size() != block_size)
+        {
+            workers.setSize(block_size);
+        }
+
+        update_record_stuff(last_bmp_in);
+        update_reflexion_stuff(last_bmp_in);
+        current_reflexion = reflexion;
+        last_reflexion = reflexion;
+        reflexion_fade_countdown = 0;
+    }
+
+  public:
+    //==============================================================================
+    COLD mono_Delay(RuntimeNotifyer *notifyer_, MoniqueSynthData *synth_data_) noexcept
+        : RuntimeListener(notifyer_),
+
+          synth_data(synth_data_),
+
+          last_bmp_in(MIN_BPM),
+
+          workers(block_size),
+
+          reflexion_write_index(0), last_in_reflexion_size(0), reflexion(1), current_reflexion(1),
+          last_reflexion(1), reflexion_fade_countdown(0), reflexion_fade_samples(1),
+          reflexion_buffer(1),
+          active_left_reflexion_buffer(reflexion_buffer.getWritePointer(LEFT)),
+          active_right_reflexion_buffer(reflexion_buffer.getWritePointer(RIGHT)),
+
+          record_index(0), last_in_record_size(0), record_buffer_size(1),
+          real_record_buffer_size(record_buffer_size), used_record_buffer_size(0),
+          num_records_to_write(1), active_left_record_buffer(nullptr),
+          active_right_record_buffer(nullptr), force_clear(false),
+
+          record_switch_smoother()
+    {
+        sample_rate_or_block_changed();
+        record_switch_smoother.set_value(0);
+    }
+    COLD ~mono_Delay() noexcept { cancelPendingUpdate(); }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Delay)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class CombFilter
+{
+    juce::HeapBlock<float> buffer;
+    int bufferSize, bufferIndex;
+
+  public:
+    //==============================================================================
+    // ADDS THE COMB OUTPUT TO sum_, RUNS LIKE THE ALLPASS ONE
+    inline void process(const float *input_, float *sum_, const float feedbackLevel,
+                        int num_samples_) noexcept
+    {
+#define REVERB_DAMP 0
+        while (num_samples_ > 0)
+        {
+            const int num_run = juce::jmin(num_samples_, bufferSize - bufferIndex);
+            float *const delay = buffer + bufferIndex;
+            for (int sid = 0; sid != num_run; ++sid)
+            {
+                const float last = delay[sid];
+                // last = (output * (1.0f - REVERB_DAMP)) + (last * REVERB_DAMP);
+                // JUCE_UNDENORMALISE (last);
+
+                float temp = input_[sid] + (last * feedbackLevel);
+                JUCE_UNDENORMALISE(temp);
+                delay[sid] = temp;
+                sum_[sid] += last;
+            }
+
+            bufferIndex += num_run;
+            if (bufferIndex == bufferSize)
+            {
+                bufferIndex = 0;
+            }
+            input_ += num_run;
+            sum_ += num_run;
+            num_samples_ -= num_run;
+        }
+    }
+
+    //==============================================================================
+    COLD void setSize(const int size)
+    {
+        if (size != bufferSize)
+        {
+            bufferIndex = 0;
+            buffer.malloc((size_t)size);
+            bufferSize = size;
+        }
+
+        clear();
+    }
+    COLD void clear() noexcept { buffer.clear((size_t)bufferSize); }
+
+  public:
+    //==============================================================================
+    COLD CombFilter() noexcept : bufferSize(0), bufferIndex(0) {}
+    COLD ~CombFilter() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CombFilter)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class LinearSmoothedValue
+{
+    float currentValue, target, step, lastValue;
+    int countdown, stepsToTarget;
+
+  public:
+    //==========================================================================
+    inline float getNextValue() noexcept
+    {
+        if (countdown <= 0)
+        {
+            lastValue = target;
+        }
+        else
+        {
+            --countdown;
+            currentValue += step;
+
+            lastValue = currentValue;
+        }
+
+        return lastValue;
+    }
+    //==========================================================================
+    inline float getLastValue() noexcept { return lastValue; }
+
+    inline void setValue(float newValue) noexcept
+    {
+        if (target != newValue)
+        {
+            target = newValue;
+            countdown = stepsToTarget;
+
+            if (countdown <= 0)
+            {
+                currentValue = target;
+            }
+            else
+            {
+                step = (target - currentValue) / countdown;
+            }
+        }
+    }
+
+    //==============================================================================
+    COLD void reset(float sampleRate, float fadeLengthSeconds) noexcept
+    {
+        stepsToTarget = std::floor(fadeLengthSeconds * sampleRate);
+        currentValue = target;
+        countdown = 0;
+    }
+
+  public:
+    //==============================================================================
+    COLD LinearSmoothedValue() noexcept
+        : currentValue(0), target(0), step(0), lastValue(0), countdown(0), stepsToTarget(0)
+    {
+    }
+
+    COLD ~LinearSmoothedValue() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LinearSmoothedValue)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_Reverb;
+struct ReverbParameters
+{
+    float roomSize; /**< Room size, 0 to 1.0, where 1.0 is big, 0 is small. */
+    float wetLevel; /**< Wet level, 0 to 1.0 */
+    float dryLevel; /**< Dry level, 0 to 1.0 */
+    float width;    /**< mono_Reverb width, 0 to 1.0, where 1.0 is very wide. */
+
+  private:
+    //==============================================================================
+    friend class mono_Reverb;
+    COLD ReverbParameters() noexcept : roomSize(0.5f), wetLevel(0.33f), dryLevel(0.4f), width(1.0f)
+    {
+    }
+    COLD ~ReverbParameters() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReverbParameters)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// STEREO, BOTH CHANNELS SHARE THE PARAMETERS AND ARE PROCESSED IN ONE PASS
+class mono_Reverb : RuntimeListener
+{
+    enum
+    {
+        numCombs = 8,
+        numAllPasses = 4
+    };
+
+    CombFilter comb[2][numCombs];
+    AllPassFilter allPass[2][numAllPasses];
+
+    ReverbParameters parameters;
+#define REVERB_GAIN 0.013f
+
+    float wetGain1, wetGain2, feedback; // dryGain,  feedback
+
+  public:
+    // THE PARAMETERS ARE UPDATED ONCE PER SUB BLOCK
+    static constexpr int SUB_BLOCK_SIZE = 32;
+
+    //==========================================================================
+    // out_right_ and in_right_ can be nullptr to process the left channel only,
+    // num_samples_ <= SUB_BLOCK_SIZE
+    inline void process(const float *in_left_, const float *in_right_, float *out_left_,
+                        float *out_right_, float room_, float dry_level_, float width_,
+                        int num_samples_) noexcept
+    {
+        if (parameters.roomSize != room_ || parameters.dryLevel != dry_level_ ||
+            parameters.width != width_)
+        {
+            parameters.roomSize = room_;
+            parameters.dryLevel = dry_level_;
+            parameters.wetLevel = 1.0f - dry_level_;
+            parameters.width = width_;
+
+            update_parameters();
+        }
+
+        process_channel(LEFT, in_left_, out_left_, num_samples_);
+        if (in_right_)
+        {
+            process_channel(RIGHT, in_right_, out_right_, num_samples_);
+        }
+    }
+
+  private:
+    //==========================================================================
+    inline void process_channel(int channel_, const float *in_, float *out_,
+                                int num_samples_) noexcept
+    {
+        alignas(16) float input[SUB_BLOCK_SIZE];
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            input[sid] = in_[sid] * REVERB_GAIN;
+            out_[sid] = 0;
+        }
+
+        CombFilter *const combs = comb[channel_];
+        for (int j = 0; j != numCombs; ++j) // accumulate the comb filters in parallel
+        {
+            combs[j].process(input, out_, feedback, num_samples_);
+        }
+        AllPassFilter *const allPasses = allPass[channel_];
+        for (int j = 0; j != numAllPasses; ++j) // run the allpass filters in series
+        {
+            allPasses[j].process(out_, num_samples_);
+        }
+
+        const float dry_level = parameters.dryLevel;
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            const float out = out_[sid];
+            out_[sid] = out * wetGain1 + out * wetGain2 + in_[sid] * dry_level;
+        }
+    }
+
+    //==========================================================================
+    inline void update_parameters() noexcept
+    {
+#define ROOM_SCALE 1.0f
+#define WET_SCALE_FACTOR 3.0f
+#define DRY_SCALE_FACTOR 1.0f
+#define ROOM_SCALE_FACTOR (0.28f * ROOM_SCALE)
+#define ROOM_OFFSET (1.0f - 0.28f * ROOM_SCALE - 0.02f)
+        const float wet = parameters.wetLevel * WET_SCALE_FACTOR;
+        // dryGain.setValue (parameters.dryLevel * DRY_SCALE_FACTOR);
+        wetGain1 = 0.5f * wet * (1.0f + parameters.width);
+        wetGain2 = 0.5f * wet * (1.0f - parameters.width);
+        feedback = parameters.roomSize * ROOM_SCALE_FACTOR + ROOM_OFFSET;
+    }
+
+    //==============================================================================
+    COLD void sample_rate_or_block_changed() noexcept override
+    {
+        static const int combTunings[] = {1116, 1188, 1277, 1356,
+                                          1422, 1491, 1557, 1617}; // (at 44100Hz)
+        static const int allPassTunings[] = {556, 441, 341, 225};
+        const int stereoSpread = 23;
+        const int intSampleRate = (int)sample_rate;
+
+        for (int i = 0; i < numCombs; ++i)
+        {
+            comb[LEFT][i].setSize((intSampleRate * combTunings[i] * ROOM_SCALE) / 44100);
+            comb[RIGHT][i].setSize(
+                (intSampleRate * (combTunings[i] * ROOM_SCALE + stereoSpread * ROOM_SCALE)) /
+                44100);
+        }
+        for (int i = 0; i < numAllPasses; ++i)
+        {
+            allPass[LEFT][i].setSize((intSampleRate * allPassTunings[i] * ROOM_SCALE) / 44100);
+            allPass[RIGHT][i].setSize(
+                (intSampleRate * (allPassTunings[i] * ROOM_SCALE + stereoSpread * ROOM_SCALE)) /
+                44100);
+        }
+    }
+
+  public:
+    COLD void reset() noexcept
+    {
+        for (int channel = 0; channel != 2; ++channel)
+        {
+            for (int i = 0; i < numCombs; ++i)
+            {
+                comb[channel][i].clear();
+            }
+
+            for (int i = 0; i < numAllPasses; ++i)
+            {
+                allPass[channel][i].clear();
+            }
+        }
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_Reverb(RuntimeNotifyer *const notifyer_) noexcept
+        : RuntimeListener(notifyer_), wetGain1(0), wetGain2(0), feedback(0)
+    {
+        update_parameters();
+        sample_rate_or_block_changed();
+    }
+    COLD ~mono_Reverb() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Reverb)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class ZeroInCounter
+{
+    int count_zeros;
+
+  public:
+    //==============================================================================
+    void add(float value) noexcept
+    {
+        if (value > -0.0001 && value < 0.0001)
+        {
+            count_zeros++;
+        }
+        else
+        {
+            count_zeros = 0;
+        }
+    }
+
+    int get_num_zeros() const noexcept { return count_zeros; }
+
+    void reset() noexcept { count_zeros = 0; }
+
+  public:
+    //==============================================================================
+    COLD ZeroInCounter() noexcept : count_zeros(0) {}
+    COLD ~ZeroInCounter() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ZeroInCounter)
+};
+class FXProcessor
+{
+    // DELAY
+    mono_Delay delay;
+
+    // REVERB
+    mono_Reverb reverb;
+
+    // CHORUS
+    mono_Chorus chorus;
+    friend class mono_ParameterOwnerStore;
+
+    // FINAL ENV
+    friend class MoniqueSynthesiserVoice;
+    std::unique_ptr<ENV> final_env;
+
+  public:
+    Smoother velocity_smoother;
+    int zero_samples_counter;
+    LinearSmootherMinMax<false, true> *const bypass_smoother;
+
+  private:
+    const MoniqueSynthData *const synth_data;
+    DataBuffer *const data_buffer;
+    const ReverbData *const reverb_data;
+    ChorusData *const chorus_data;
+
+  public:
+    //==========================================================================
+    inline void process(juce::AudioSampleBuffer &output_buffer_, const float *velocity_,
+                        const int start_sample_final_out_, const int num_samples_) noexcept
+    {
+        velocity_smoother.set_size_in_ms(synth_data->velocity_glide_time);
+
+        if (synth_data->is_stereo)
+        {
+            // COLLECT BUFFERS
+            float *left_input_buffer =
+                data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
+            float *right_input_buffer =
+                data_buffer->filter_stereo_output_samples.getWritePointer(RIGHT);
+
+            float *left_out_buffer = &output_buffer_.getWritePointer(LEFT)[start_sample_final_out_];
+            const bool is_stereo = output_buffer_.getNumChannels() > 1;
+            float *right_out_buffer =
+                is_stereo ? &output_buffer_.getWritePointer(RIGHT)[start_sample_final_out_]
+                          : data_buffer->second_mono_buffer.getWritePointer();
+
+            // PREPARE
+            {
+                float *const final_env_amp = data_buffer->final_env.getWritePointer();
+                final_env->process(final_env_amp, num_samples_);
+
+                for (int sid = 0; sid != num_samples_; ++sid)
+                {
+                    const float gain =
+                        final_env_amp[sid] * velocity_smoother.add_and_get_average(velocity_[sid]);
+                    left_input_buffer[sid] *= gain;
+                    right_input_buffer[sid] *= gain;
+                }
+            }
+
+            // STEREO CHORUS
+            {
+                chorus.process(left_input_buffer, right_input_buffer, left_out_buffer,
+                               right_out_buffer, num_samples_);
+            }
+
+            // DELAY
+            {
+                delay.set_reflexion_size(synth_data->delay_refexion, synth_data->delay_record_size,
+                                         synth_data->glide_motor_time,
+                                         is_standalone() ? synth_data->speed
+                                                         : synth_data->runtime_info->bpm);
+
+                delay.process(left_out_buffer, right_out_buffer,
+                              synth_data->delay_smoother.get_smoothed_value_buffer(),
+                              synth_data->delay_pan_smoother.get_smoothed_value_buffer(),
+                              synth_data->delay_record_release_smoother.get_smoothed_value_buffer(),
+                              synth_data->delay_record, num_samples_);
+            }
+
+            // REVERB
+            {
+                const float *const smoothed_pan_buffer(
+                    reverb_data->pan_smoother.get_smoothed_value_buffer());
+                const float *const smoothed_bypass_buffer =
+                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
+
+                const float *const smoothed_room_buffer =
+                    reverb_data->room_smoother.get_smoothed_value_buffer();
+                const float *const smoothed_with_buffer =
+                    reverb_data->width_smoother.get_smoothed_value_buffer();
+                const float *const smoothed_dry_wet_mix_buffer =
+                    reverb_data->dry_wet_mix_smoother.get_smoothed_value_buffer();
+                const bool is_pan_constant = reverb_data->pan_smoother.is_constant();
+                float constant_left = 1, constant_right = 1;
+                if (is_pan_constant)
+                {
+                    pan_law.get(reverb_data->pan_smoother.get_constant_value(), constant_left,
+                                constant_right);
+                }
+                for (int start_sid = 0; start_sid < num_samples_;
+                     start_sid += mono_Reverb::SUB_BLOCK_SIZE)
+                {
+                    const int num_sub_samples =
+                        juce::jmin(mono_Reverb::SUB_BLOCK_SIZE, num_samples_ - start_sid);
+                    alignas(16) float reverb_out_l[mono_Reverb::SUB_BLOCK_SIZE];
+                    alignas(16) float reverb_out_r[mono_Reverb::SUB_BLOCK_SIZE];
+                    reverb.process(left_out_buffer + start_sid, right_out_buffer + start_sid,
+                                   reverb_out_l, reverb_out_r, smoothed_room_buffer[start_sid],
+                                   1.0f - smoothed_dry_wet_mix_buffer[start_sid],
+                                   smoothed_with_buffer[start_sid], num_sub_samples);
+                    alignas(16) float lefts[mono_Reverb::SUB_BLOCK_SIZE];
+                    alignas(16) float rights[mono_Reverb::SUB_BLOCK_SIZE];
+                    if (is_pan_constant)
+                    {
+                        juce::FloatVectorOperations::fill(lefts, constant_left, num_sub_samples);
+                        juce::FloatVectorOperations::fill(rights, constant_right, num_sub_samples);
+                    }
+                    else
+                    {
+                        pan_law.get(smoothed_pan_buffer + start_sid, lefts, rights,
+                                    num_sub_samples);
+                    }
+
+                    for (int sid = start_sid; sid != start_sid + num_sub_samples; ++sid)
+                    {
+                        const float in_l = left_out_buffer[sid];
+                        const float in_r = right_out_buffer[sid];
+                        const float sample_l = reverb_out_l[sid - start_sid];
+                        const float sample_r = reverb_out_r[sid - start_sid];
+
+                        const float left = lefts[sid - start_sid];
+                        const float right = rights[sid - start_sid];
+                        const float bypass = smoothed_bypass_buffer[sid];
+                        left_out_buffer[sid] =
+                            sample_mix((sample_l * left + in_l * (1.0f - left)) * bypass,
+                                       left_input_buffer[sid] * (1.0f - bypass));
+                        right_out_buffer[sid] =
+                            sample_mix((sample_r * right + in_r * (1.0f - right)) * bypass,
+                                       right_input_buffer[sid] * (1.0f - bypass));
+                    }
+                }
+            }
+
+            // PROCESS
+            {
+                // FINAL MIX
+                {
+                    const float *const smoothed_volume_buffer =
+                        synth_data->volume_smoother.get_smoothed_value_buffer();
+                    if (is_stereo)
+                    {
+                        for (int sid = 0; sid != num_samples_; ++sid)
+                        {
+                            float left_in = left_out_buffer[sid];
+                            float right_in = right_out_buffer[sid];
+#define MONO_UNDENORMALISE_OUTPUT(n)                                                               \
+    if (!(n < -1.0e-3f || n > 1.0e-3f))                                                            \
+        n = 0;
+                            MONO_UNDENORMALISE_OUTPUT(left_in);
+                            MONO_UNDENORMALISE_OUTPUT(right_in);
+                            if (left_in != 0 || right_in != 0)
+                            {
+                                zero_samples_counter = 0;
+                            }
+                            else
+                            {
+                                zero_samples_counter++;
+                            }
+
+                            const float volume =
+                                smoothed_volume_buffer[sid] * bypass_smoother->tick();
+                            left_out_buffer[sid] *= volume * 2;
+                            right_out_buffer[sid] *= volume * 2;
+                        }
+                    }
+                    else
+                    {
+                        for (int sid = 0; sid != num_samples_; ++sid)
+                        {
+                            float left_in = left_out_buffer[sid];
+                            float right_in = right_out_buffer[sid];
+                            MONO_UNDENORMALISE_OUTPUT(left_in);
+                            MONO_UNDENORMALISE_OUTPUT(right_in);
+                            if (left_in != 0 || right_in != 0)
+                            {
+                                zero_samples_counter = 0;
+                            }
+                            else
+                            {
+                                zero_samples_counter++;
+                            }
+
+                            const float volume =
+                                smoothed_volume_buffer[sid] * bypass_smoother->tick();
+                            left_out_buffer[sid] *= sample_mix(left_out_buffer[sid] * volume * 2,
+                                                               right_out_buffer[sid] * volume * 2);
+                        }
+                    }
+
+                    // VISUALIZE BEFORE FONAL OUT
+                    if (Monique_Ui_SegmentedMeter *meter = synth_data->audio_processor->peak_meter)
+                    {
+                        juce::ScopedLock locked(synth_data->audio_processor->peak_meter_lock);
+                        meter->process(left_out_buffer, num_samples_);
+                    }
+                    if (is_stereo)
+                    {
+                        for (int sid = 0; sid != num_samples_; ++sid)
+                        {
+                            left_out_buffer[sid] = soft_clipp_greater_0_9(left_out_buffer[sid]);
+                            right_out_buffer[sid] = soft_clipp_greater_0_9(right_out_buffer[sid]);
+                        }
+                    }
+                    else
+                    {
+                        for (int sid = 0; sid != num_samples_; ++sid)
+                        {
+                            left_out_buffer[sid] = soft_clipp_greater_0_9(left_out_buffer[sid]);
+                        }
+                    }
+
+                    // VISUALIZE
+                    if (Monique_Ui_AmpPainter *amp_painter =
+                            synth_data->audio_processor->amp_painter)
+                    {
+                        amp_painter->add_out(left_out_buffer, right_out_buffer, num_samples_);
+                        amp_painter->add_out_env(data_buffer->final_env.getReadPointer(),
+                                                 num_samples_);
+                    }
+                }
+            }
+        }
+        else // NOTE just a reduced copy of the function before
+        {
+            // COLLECT BUFFERS
+            float *left_input_buffer =
+                data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
+
+            float *left_out_buffer = &output_buffer_.getWritePointer(LEFT)[start_sample_final_out_];
+            const bool is_stereo = output_buffer_.getNumChannels() > 1;
+            float *right_out_buffer =
+                is_stereo ? &output_buffer_.getWritePointer(RIGHT)[start_sample_final_out_]
+                          : data_buffer->second_mono_buffer.getWritePointer();
+
+            // PREPARE
+            {
+                float *const final_env_amp = data_buffer->final_env.getWritePointer();
+                final_env->process(final_env_amp, num_samples_);
+
+                for (int sid = 0; sid != num_samples_; ++sid)
+                {
+                    const float gain =
+                        final_env_amp[sid] * velocity_smoother.add_and_get_average(velocity_[sid]);
+                    left_input_buffer[sid] *= gain;
+                }
+            }
+
+            // STEREO CHORUS
+            {
+                chorus.process(left_input_buffer, nullptr, left_out_buffer, nullptr, num_samples_);
+            }
+
+            // DELAY
+            {
+                delay.set_reflexion_size(
+                    synth_data->delay_refexion, synth_data->delay_record_size,
+                    synth_data->glide_motor_time,
+                    is_standalone() ? synth_data->speed // // NOT POSSIBLE TO SYNC <- old comment
+                                    : synth_data->runtime_info->bpm);
+
+                delay.process(left_out_buffer, nullptr,
+                              synth_data->delay_smoother.get_smoothed_value_buffer(),
+                              synth_data->delay_pan_smoother.get_smoothed_value_buffer(),
+                              synth_data->delay_record_release_smoother.get_smoothed_value_buffer(),
+                              synth_data->delay_record, num_samples_);
+            }
+
+            // REVERB
+            {
+                const float *const smoothed_bypass_buffer =
+                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
+
+                const float *const smoothed_room_buffer =
+                    reverb_data->room_smoother.get_smoothed_value_buffer();
+                const float *const smoothed_with_buffer =
+                    reverb_data->width_smoother.get_smoothed_value_buffer();
+                const float *const smoothed_dry_wet_mix_buffer =
+                    reverb_data->dry_wet_mix_smoother.get_smoothed_value_buffer();
+                for (int start_sid = 0; start_sid < num_samples_;
+                     start_sid += mono_Reverb::SUB_BLOCK_SIZE)
+                {
+                    const int num_sub_samples =
+                        juce::jmin(mono_Reverb::SUB_BLOCK_SIZE, num_samples_ - start_sid);
+                    alignas(16) float reverb_out_l[mono_Reverb::SUB_BLOCK_SIZE];
+                    reverb.process(left_out_buffer + start_sid, nullptr, reverb_out_l, nullptr,
+                                   smoothed_room_buffer[start_sid],
+                                   1.0f - smoothed_dry_wet_mix_buffer[start_sid],
+                                   smoothed_with_buffer[start_sid], num_sub_samples);
+
+                    for (int sid = start_sid; sid != start_sid + num_sub_samples; ++sid)
+                    {
+                        const float in_l = left_out_buffer[sid];
+                        const float sample_l = reverb_out_l[sid - start_sid];
+
+                        const float bypass = smoothed_bypass_buffer[sid];
+                        left_out_buffer[sid] = sample_mix(sample_l + in_l * bypass,
+                                                          left_input_buffer[sid] * (1.0f - bypass));
+                    }
+                }
+            }
+
+            // PROCESS
+            {
+                // FINAL MIX
+                {
+                    const float *const smoothed_volume_buffer =
+                        synth_data->volume_smoother.get_smoothed_value_buffer();
+                    {
+                        for (int sid = 0; sid != num_samples_; ++sid)
+                        {
+                            float left_in = left_out_buffer[sid];
+                            MONO_UNDENORMALISE_OUTPUT(left_in);
+                            if (left_in != 0)
+                            {
+                                zero_samples_counter = 0;
+                            }
+                            else
+                            {
+                                zero_samples_counter++;
+                            }
+
+                            const float volume =
+                                smoothed_volume_buffer[sid] * bypass_smoother->tick();
+                            left_out_buffer[sid] = left_out_buffer[sid] * volume * 2;
+                        }
+                    }
+
+                    // VISUALIZE BEFORE FONAL OUT
+                    if (Monique_Ui_SegmentedMeter *meter = synth_data->audio_processor->peak_meter)
+                    {
+                        juce::ScopedLock locked(synth_data->audio_processor->peak_meter_lock);
+                        meter->process(left_out_buffer, num_samples_);
+                    }
+                    {
+                        for (int sid = 0; sid != num_samples_; ++sid)
+                        {
+                            right_out_buffer[sid] = left_out_buffer[sid] =
+                                soft_clipp_greater_0_9(left_out_buffer[sid]);
+                        }
+                    }
+
+                    // VISUALIZE
+                    if (Monique_Ui_AmpPainter *amp_painter =
+                            synth_data->audio_processor->amp_painter)
+                    {
+                        amp_painter->add_out(left_out_buffer, right_out_buffer, num_samples_);
+                        amp_painter->add_out_env(data_buffer->final_env.getReadPointer(),
+                                                 num_samples_);
+                    }
+                }
+            }
+        }
+    }
+
+    //==========================================================================
+    void start_attack() noexcept
+    {
+        zero_samples_counter = 0;
+        final_env->start_attack();
+    }
+    void start_release(bool is_sustain_pedal_down_, bool is_sostenuto_pedal_down_) noexcept
+    {
+        if (!is_sostenuto_pedal_down_)
+        {
+            // chorus_modulation_env->set_to_release();
+        }
+        if (!is_sustain_pedal_down_)
+        {
+            final_env->set_to_release();
+        }
+    }
+
+    //==========================================================================
+    void reset() noexcept
+    {
+        delay.reset();
+        reverb.reset();
+        chorus.reset();
+
+        final_env->reset();
+
+        zero_samples_counter = 0;
+        velocity_smoother.reset(0);
+    }
+
+  public:
+    //==============================================================================
+    COLD FXProcessor(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_,
+                     LinearSmootherMinMax<false, true> *bypass_smoother_,
+                     const float *const sine_lookup_, const float *const cos_lookup_,
+                     const float *const exp_lookup_) noexcept
+        :
+
+          delay(notifyer_, synth_data_),
+
+          reverb(notifyer_),
+
+          chorus(notifyer_, synth_data_),
+
+          final_env(new ENV(notifyer_, synth_data_, synth_data_->env_data.get(), sine_lookup_,
+                            cos_lookup_, exp_lookup_)),
+
+          velocity_smoother(notifyer_, synth_data_->velocity_glide_time), zero_samples_counter(0),
+          bypass_smoother(bypass_smoother_),
+
+          synth_data(synth_data_), data_buffer(synth_data_->data_buffer),
+          reverb_data(synth_data_->reverb_data.get()), chorus_data(synth_data_->chorus_data.get())
+    {
+#ifdef JUCE_DEBUG
+        std::cout << "MONIQUE: init FX" << std::endl;
+#endif
+    }
+
+    COLD ~FXProcessor() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FXProcessor)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class ArpSequencer : public RuntimeListener
+{
+    RuntimeInfo *const info;
+    const ArpSequencerData *const data;
+
+    friend class MoniqueSynthesiserVoice;
+
+    int current_step;
+    int next_step_on_hold;
+    int step_at_sample_current_buffer;
+
+    int shuffle_to_back_counter;
+    bool found_a_step;
+
+    std::int64_t user_arp_start_point_in_samples;
+
+    StepQueue steps_on_hold;
+
+  public:
+    //==============================================================================
+    // RETURNS THE NUMBER OF SAMPLES TO THE NEXT STEP
+    // RETURN NUM SAMPLES IF THERE IS NO STEP IN THE BUFFER
+    inline int process_samples_to_next_step(int start_sample_, int num_samples_) noexcept
+    {
+        const std::int64_t samples_since_start =
+            info->relative_samples_since_start - user_arp_start_point_in_samples;
+        double samples_per_min = sample_rate * 60;
+        double speed_multi = ArpSequencerData::speed_multi_to_value(data->speed_multi);
+        double steps_per_min = info->bpm * 4 / 1.0 * speed_multi;
+        double steps_per_sample = steps_per_min / samples_per_min;
+        int samples_offset = 0;
+        const int fine = data->fine_offset.get_value();
+        if (0 != fine)
+        {
+            float multi = 1;
+            switch (fine)
+            {
+            case -5:
+                multi = -1.5;
+                break;
+            case -4:
+                multi = -2;
+                break;
+            case -3:
+                multi = -3;
+                break;
+            case -2:
+                multi = -6;
+                break;
+            case -1:
+                multi = -8;
+                break;
+            case 1:
+                multi = 8;
+                break;
+            case 2:
+                multi = 6;
+                break;
+            case 3:
+                multi = 3;
+                break;
+            case 4:
+                multi = 2;
+                break;
+            case 5:
+                multi = 1.5;
+                break;
+            }
+            const float samples_per_step = 1.0f / steps_per_sample;
+            samples_offset = floor(samples_per_step / multi);
+        }
+        std::int64_t sync_sample_pos = samples_since_start + start_sample_ + samples_offset;
+        std::int64_t step = next_step_on_hold;
+        step_at_sample_current_buffer = -1;
+
+        double samples_per_step =
+            samples_per_min / steps_per_min; // WILL BE OVERRIDDEN IN STANDALONE!
+
+        bool is_extern_synced = false;
+        if (is_standalone())
+        {
+            is_extern_synced = info->standalone_features_pimpl->is_extern_synced;
+        }
+
+        for (int i = 0; i < num_samples_; ++i)
+        {
+            if (++sync_sample_pos < 0)
+            {
+                continue;
+            }
+
+            if (is_standalone() && is_extern_synced)
+            {
+                StepQueue &steps_in_block(info->standalone_features_pimpl->steps_in_block);
+                if (steps_in_block.size())
+                {
+                    const Step &step__(steps_in_block.get_first());
+                    if (step__.at_absolute_sample == sync_sample_pos - samples_offset)
+                    {
+                        if (samples_offset > 0)
+                        {
+                            steps_on_hold.add(step__.step_id,
+                                              step__.at_absolute_sample + samples_offset,
+                                              step__.samples_per_step);
+                        }
+                        else if (samples_offset < 0)
+                        {
+                            steps_on_hold.add(step__.step_id + 1,
+                                              step__.at_absolute_sample +
+                                                  (samples_per_step + samples_offset),
+                                              step__.samples_per_step);
+                        }
+                        else
+                        {
+                            step = step__.step_id;
+                            samples_per_step = step__.samples_per_step;
+                            steps_in_block.remove_first();
+                        }
+                    }
+                }
+                if (steps_on_hold.size())
+                {
+                    for (int i = 0; i < steps_on_hold.size(); ++i)
+                    {
+                        const Step &step__(steps_on_hold.get(i));
+                        if (step__.at_absolute_sample == sync_sample_pos - samples_offset)
+                        {
+                            step = step__.step_id;
+                            samples_per_step = step__.samples_per_step;
+                            steps_on_hold.remove(i);
+                            i--;
+                        }
+                        // CLEAN
+                        else if (step__.at_absolute_sample < sync_sample_pos - samples_offset)
+                        {
+                            steps_on_hold.remove(i);
+                            i--;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                step = std::floor(steps_per_sample *
+                                  sync_sample_pos); //+1; // +1 for future processing
+                if (step < 0)
+                {
+                    step = 0;
+                }
+            }
+
+            // step += data->step_offset.get_value();
+
+            --shuffle_to_back_counter;
+
+            if (step != next_step_on_hold)
+            {
+                next_step_on_hold = step;
+
+                if (current_step % 2 == 0)
+                {
+                    shuffle_to_back_counter = std::floor(
+                        samples_per_step * ArpSequencerData::shuffle_to_value(data->shuffle));
+                }
+                else
+                {
+                    shuffle_to_back_counter = 0;
+                }
+
+                found_a_step = true;
+            }
+
+            if (found_a_step && shuffle_to_back_counter == 0)
+            {
+                step_at_sample_current_buffer = i;
+                current_step = next_step_on_hold;
+                return i;
+            }
+        }
+
+        return num_samples_;
+    }
+
+    //==============================================================================
+    inline int get_current_step() const noexcept
+    {
+        return int(current_step + data->step_offset.get_value()) % SUM_ENV_ARP_STEPS;
+    }
+    inline int get_current_absolute_step() const noexcept
+    {
+        return int(current_step + data->step_offset.get_value());
+    }
+    inline int get_step_before() const noexcept
+    {
+        if (int(current_step + data->step_offset.get_value()) > 0)
+            return (int(current_step + data->step_offset.get_value()) - 1) % SUM_ENV_ARP_STEPS;
+        else
+            return 0;
+    }
+    inline float get_current_tune() const noexcept
+    {
+        return data->tune[get_current_step()].get_value();
+    }
+    inline bool found_last_process_a_step() const noexcept
+    {
+        return step_at_sample_current_buffer != -1;
+    }
+    inline bool last_found_step_is_enabled() const noexcept
+    {
+        bool success = false;
+        if (found_last_process_a_step())
+        {
+            if (data->step[get_current_step()])
+            {
+                success = true;
+            }
+        }
+
+        return success;
+    }
+    inline void reset() noexcept
+    {
+        current_step = 0;
+        next_step_on_hold = 0;
+        shuffle_to_back_counter = 0;
+        steps_on_hold.clear();
+        step_at_sample_current_buffer = data->step[0] ? 0 : -1;
+    }
+
+    void sample_rate_or_block_changed() noexcept override {}
+
+    void set_user_arp_start_point_in_samples(std::int64_t user_arp_start_point_in_samples_) noexcept
+    {
+        user_arp_start_point_in_samples = user_arp_start_point_in_samples_;
+    }
+
+  public:
+    //==============================================================================
+    COLD ArpSequencer(RuntimeNotifyer *const notifyer_, RuntimeInfo *info_,
+                      const ArpSequencerData *data_) noexcept
+        : RuntimeListener(notifyer_),
+
+          info(info_), data(data_), current_step(0), next_step_on_hold(0),
+          step_at_sample_current_buffer(-1),
+
+          shuffle_to_back_counter(0), found_a_step(false),
+
+          user_arp_start_point_in_samples(0)
+    {
+#ifdef JUCE_DEBUG
+        std::cout << "MONIQUE: init SEQUENCER" << std::endl;
+#endif
+    }
+
+    COLD ~ArpSequencer() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ArpSequencer)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// RUNS THE STAGES OF A BLOCK AS JOBS OF A DEPENDENCY GRAPH. A JOB STARTS IF ALL JOBS IT DEPENDS
+// ON ARE DONE, SO EVERY ORDER THE WORKERS PICK GIVES THE SAME RESULT AS THE SERIAL ORDER OF THE
+// JOB IDS. THE AUDIO THREAD TAKES JOBS TOO AND NEVER WAITS ON A LOCK. THE REAL TIME WORKERS
+// START ON THE MESSAGE THREAD THE FIRST TIME PARALLEL RENDERING IS ASKED FOR. THEY SPIN FOR TWO
+// BLOCK PERIODS AFTER A BLOCK, SO WHILE THE HOST PLAYS THEY ARE AWAKE FOR THE NEXT ONE, AND SLEEP
+// ONLY IF THE HOST STOPS CALLING.
+class mono_RenderGraph;
+
+// ONE POOL OF WORKERS FOR ALL GRAPHS OF THE PROCESS (ALL INSTANCES), ONE WORKER PER CORE BESIDES
+// THE ONE OF THE AUDIO THREAD. EVERY GRAPH OWNS A SLOT. A WORKER HELPS ALL GRAPHS WITH PENDING
+// JOBS, SPINS SPIN_MICROSECONDS FOR NEW JOBS AND THEN WAITS UNTIL A GRAPH STARTS A BLOCK. IT NEVER
+// SPINS FROM ONE BLOCK TO THE NEXT.
+class mono_RenderWorkerPool
+{
+  public:
+    static constexpr int MAX_GRAPHS = 64;
+    // THE WIDEST LEVEL OF THE VOICE GRAPH
+    static constexpr int MAX_HELPERS_PER_GRAPH = 3;
+
+  private:
+    static constexpr int SPIN_MICROSECONDS = 30;
+
+    struct Slot
+    {
+        std::atomic_bool is_used{false};
+        std::atomic<mono_RenderGraph *> graph{nullptr};
+        // WORKERS INSIDE OF THE GRAPH, IT IS NOT DELETED BEFORE THEY ARE OUT
+        std::atomic_int num_visitors{0};
+    };
+    Slot slots[MAX_GRAPHS];
+
+    std::atomic_int generation{0};
+    const std::int64_t spin_ticks;
+
+    //==========================================================================
+    class Worker : public juce::Thread
+    {
+        mono_RenderWorkerPool &pool;
+
+        void run() override;
+
+      public:
+        juce::WaitableEvent wake_up;
+        std::atomic_bool is_sleeping{false};
+
+        COLD Worker(mono_RenderWorkerPool &pool_) noexcept
+            : juce::Thread("Monique Render Worker"), pool(pool_)
+        {
+        }
+        COLD ~Worker() noexcept {}
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Worker)
+    };
+    juce::OwnedArray<Worker> workers;
+    std::atomic_int num_workers{0};
+    juce::CriticalSection start_lock;
+
+    inline void process_graphs() noexcept;
+
+  public:
+    //==========================================================================
+    inline bool are_workers_started() const noexcept { return num_workers.load() > 0; }
+
+    // WAKES THE SLEEPING WORKERS FOR THE JOBS OF A NEW BLOCK
+    inline void notify() noexcept
+    {
+        generation.fetch_add(1);
+
+        int num_signaled = 0;
+        const int num_started_workers = num_workers.load();
+        for (int i = 0; i != num_started_workers && num_signaled != MAX_HELPERS_PER_GRAPH; ++i)
+        {
+            Worker *const worker = workers.getUnchecked(i);
+            if (worker->is_sleeping.load())
+            {
+                worker->wake_up.signal();
+                ++num_signaled;
+            }
+        }
+    }
+
+    //==========================================================================
+    // RETURNS THE SLOT, -1 IF ALL ARE USED (THE GRAPH RENDERS SERIAL)
+    COLD int add_graph(mono_RenderGraph *graph_) noexcept
+    {
+        for (int slot_id = 0; slot_id != MAX_GRAPHS; ++slot_id)
+        {
+            bool is_used = false;
+            if (slots[slot_id].is_used.compare_exchange_strong(is_used, true))
+            {
+                slots[slot_id].graph.store(graph_);
+                return slot_id;
+            }
+        }
+        return -1;
+    }
+    COLD void remove_graph(int slot_id_) noexcept
+    {
+        Slot &slot = slots[slot_id_];
+        slot.graph.store(nullptr);
+        while (slot.num_visitors.load() != 0)
+        {
+            juce::Thread::yield();
+        }
+        slot.is_used.store(false);
+    }
+
+    //==========================================================================
+    // RETURNS THE NUMBER OF WORKERS
+    COLD int start_workers(int block_size_, double sample_rate_) noexcept
+    {
+        const juce::ScopedLock lock(start_lock);
+        if (workers.size() == 0)
+        {
+            const int num_cores = juce::SystemStats::getNumCpus();
+            for (int i = 0; i < num_cores - 1; ++i)
+            {
+                Worker *const worker = workers.add(new Worker(*this));
+#if JUCE_VERSION >= 0x70006
+                if (!worker->startRealtimeThread(
+                        juce::Thread::RealtimeOptions().withApproximateAudioProcessingTime(
+                            block_size_, sample_rate_)) &&
+                    !worker->isThreadRunning())
+                {
+                    // NO PERMISSION FOR REAL TIME SCHEDULING
+                    worker->startThread(juce::Thread::Priority::highest);
+                }
+#elif JUCE_VERSION >= 0x70003
+                juce::ignoreUnused(block_size_, sample_rate_);
+                worker->startThread(juce::Thread::Priority::highest);
+#else
+                juce::ignoreUnused(block_size_, sample_rate_);
+                worker->startThread(juce::Thread::realtimeAudioPriority);
+#endif
+            }
+            num_workers.store(workers.size());
+        }
+        return workers.size();
+    }
+
+    //==========================================================================
+    COLD mono_RenderWorkerPool() noexcept
+        : spin_ticks(juce::Time::secondsToHighResolutionTicks(SPIN_MICROSECONDS / 1000000.0))
+    {
+    }
+    COLD ~mono_RenderWorkerPool() noexcept
+    {
+        num_workers.store(0);
+        for (int i = 0; i != workers.size(); ++i)
+        {
+            workers.getUnchecked(i)->signalThreadShouldExit();
+            workers.getUnchecked(i)->wake_up.signal();
+        }
+        for (int i = 0; i != workers.size(); ++i)
+        {
+            workers.getUnchecked(i)->stopThread(1000);
+        }
+        workers.clear();
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_RenderWorkerPool)
+};
+
+//==============================================================================
+class mono_RenderGraph : public RuntimeListener, juce::AsyncUpdater
+{
+    friend class mono_RenderWorkerPool;
+
+  public:
+    typedef void (*job_function_t)(void *owner_, int job_id_);
+
+    static constexpr int MAX_JOBS = 32;
+    // SMALLER BLOCKS ARE NOT WORTH TO WAKE THE WORKERS
+    static constexpr int MIN_PARALLEL_BLOCK_SIZE = 16;
+
+  private:
+    struct Job
+    {
+        int num_dependencies;
+        int num_successors;
+        int successors[MAX_JOBS];
+
+        // 0 IS READY, -1 IS TAKEN OR DONE
+        std::atomic_int pending_dependencies{-1};
+    };
+    Job jobs[MAX_JOBS];
+    const int num_jobs;
+
+    const job_function_t job_function;
+    void *const owner;
+
+    // ALL JOBS ARE DONE BETWEEN THE BLOCKS
+    std::atomic_int num_done_jobs;
+
+    std::atomic_bool is_start_requested{false};
+
+    juce::SharedResourcePointer<mono_RenderWorkerPool> pool;
+    const int slot_id;
+
+    //==========================================================================
+    // RETURNS IF ALL JOBS OF THE CURRENT BLOCK ARE DONE
+    inline void process_jobs() noexcept
+    {
+        while (num_done_jobs.load() != num_jobs)
+        {
+            for (int job_id = 0; job_id != num_jobs; ++job_id)
+            {
+                Job &job = jobs[job_id];
+                int ready = 0;
+                if (job.pending_dependencies.load(std::memory_order_relaxed) == 0 &&
+                    job.pending_dependencies.compare_exchange_strong(ready, -1))
+                {
+                    job_function(owner, job_id);
+
+                    for (int i = 0; i != job.num_successors; ++i)
+                    {
+                        jobs[job.successors[i]].pending_dependencies.fetch_sub(1);
+                    }
+                    num_done_jobs.fetch_add(1);
+                }
+            }
+        }
+    }
+
+  public:
+    //==========================================================================
+    inline void process(bool parallel_) noexcept
+    {
+        if (parallel_ && !pool->are_workers_started() && !is_start_requested.exchange(true))
+        {
+            triggerAsyncUpdate();
+        }
+
+        if (!parallel_ || slot_id == -1 || !pool->are_workers_started())
+        {
+            for (int job_id = 0; job_id != num_jobs; ++job_id)
+            {
+                job_function(owner, job_id);
+            }
+            return;
+        }
+
+        // A LATE WORKER OF THE LAST BLOCK CAN ALREADY TAKE THE FIRST JOBS OF THIS ONE, SO THE
+        // SUCCESSORS (HIGHER IDS) HAVE TO BE ARMED BEFORE THE JOBS THEY DEPEND ON
+        num_done_jobs.store(0);
+        for (int job_id = num_jobs - 1; job_id >= 0; --job_id)
+        {
+            jobs[job_id].pending_dependencies.store(jobs[job_id].num_dependencies);
+        }
+
+        pool->notify();
+        process_jobs();
+    }
+
+    //==========================================================================
+    // job_id_ WILL NOT START BEFORE must_be_done_before_ IS DONE
+    COLD void add_dependency(int job_id_, int must_be_done_before_) noexcept
+    {
+        // THE SERIAL ORDER HAS TO BE A VALID ORDER
+        jassert(must_be_done_before_ < job_id_);
+
+        Job &before = jobs[must_be_done_before_];
+        before.successors[before.num_successors++] = job_id_;
+        ++jobs[job_id_].num_dependencies;
+    }
+
+    //==========================================================================
+    // RETURNS THE NUMBER OF WORKERS OF THE SHARED POOL
+    COLD int start_workers() noexcept
+    {
+        return slot_id == -1 ? 0 : pool->start_workers(block_size, sample_rate);
+    }
+
+  private:
+    //==========================================================================
+    COLD void handleAsyncUpdate() override { start_workers(); }
+    COLD void sample_rate_or_block_changed() noexcept override {}
+
+  public:
+    //==========================================================================
+    COLD mono_RenderGraph(RuntimeNotifyer *const notifyer_, int num_jobs_,
+                          job_function_t job_function_, void *owner_) noexcept
+        : RuntimeListener(notifyer_), num_jobs(num_jobs_), job_function(job_function_),
+          owner(owner_), num_done_jobs(num_jobs_), pool(), slot_id(pool->add_graph(this))
+    {
+        jassert(num_jobs_ <= MAX_JOBS);
+
+        for (int job_id = 0; job_id != MAX_JOBS; ++job_id)
+        {
+            jobs[job_id].num_dependencies = 0;
+            jobs[job_id].num_successors = 0;
+        }
+    }
+    COLD ~mono_RenderGraph() noexcept
+    {
+        cancelPendingUpdate();
+        if (slot_id != -1)
+        {
+            pool->remove_graph(slot_id);
+        }
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_RenderGraph)
+};
+
+//==============================================================================
+inline void mono_RenderWorkerPool::process_graphs() noexcept
+{
+    for (int slot_id = 0; slot_id != MAX_GRAPHS; ++slot_id)
+    {
+        Slot &slot = slots[slot_id];
+        if (slot.graph.load(std::memory_order_relaxed) == nullptr)
+        {
+            continue;
+        }
+
+        slot.num_visitors.fetch_add(1);
+        if (mono_RenderGraph *const graph = slot.graph.load())
+        {
+            graph->process_jobs();
+        }
+        slot.num_visitors.fetch_sub(1);
+    }
+}
+void mono_RenderWorkerPool::Worker::run()
+{
+    // THE SAME FLOATING POINT MODE AS THE AUDIO THREAD (juce::ScopedNoDenormals)
+    juce::FloatVectorOperations::disableDenormalisedNumberSupport();
+
+    int last_generation = pool.generation.load();
+    while (!threadShouldExit())
+    {
+        const std::int64_t spin_start_ticks = juce::Time::getHighResolutionTicks();
+        while (pool.generation.load() == last_generation)
+        {
+            if (threadShouldExit())
+            {
+                return;
+            }
+
+            if (juce::Time::getHighResolutionTicks() - spin_start_ticks > pool.spin_ticks)
+            {
+                // A GRAPH CHECKS is_sleeping AFTER IT HAS STARTED A BLOCK
+                is_sleeping.store(true);
+                if (pool.generation.load() == last_generation && !threadShouldExit())
+                {
+                    wake_up.wait(-1);
+                }
+                is_sleeping.store(false);
+                break;
+            }
+            juce::Thread::yield();
+        }
+
+        last_generation = pool.generation.load();
+        pool.process_graphs();
+    }
+}
+
+//==============================================================================
+// THE SERIAL ORDER IS THE ORDER OF THE IDS
+enum RENDER_JOBS
+{
+    MORPH_1_JOB,
+    LFO_1_JOB,
+    MASTER_OSC_JOB,
+    FILTER_ENV_1_JOB,
+    MORPH_2_JOB,
+    LFO_2_JOB,
+    SECOND_OSC_JOB,
+    FILTER_ENV_2_JOB,
+    MORPH_3_JOB,
+    LFO_3_JOB,
+    THIRD_OSC_JOB,
+    FILTER_ENV_3_JOB,
+    MORPH_4_JOB,
+    PREPARE_FILTER_1_JOB,
+    PREPARE_FILTER_2_JOB,
+    PREPARE_FILTER_3_JOB,
+    FILTER_1_JOB,
+    FILTER_2_JOB,
+    FILTER_3_JOB,
+
+    SUM_RENDER_JOBS
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+COLD MoniqueSynthesiserVoice::MoniqueSynthesiserVoice(MoniqueAudioProcessor *const audio_processor_,
+                                                      MoniqueSynthData *const synth_data_,
+                                                      RuntimeNotifyer *const notifyer_,
+                                                      RuntimeInfo *const info_,
+                                                      DataBuffer *data_buffer_) noexcept
+    : audio_processor(audio_processor_), synth_data(synth_data_),
+
+      info(info_), data_buffer(data_buffer_),
+
+      arp_sequencer(new ArpSequencer(notifyer_, info, synth_data_->arp_sequencer_data.get())),
+      eq_processor(new EQProcessorStereo(notifyer_, synth_data_, synth_data_->sine_lookup,
+                                         synth_data_->cos_lookup, synth_data_->exp_lookup)),
+      bypass_smoother(0),
+      fx_processor(new FXProcessor(notifyer_, synth_data_, &bypass_smoother,
+                                   synth_data_->sine_lookup, synth_data_->cos_lookup,
+                                   synth_data_->exp_lookup)),
+
+      event_sample_position(0), current_note(-1), pitch_offset(0),
+
+      is_sostenuto_pedal_down(false), stopped_and_sostenuto_pedal_was_down(false),
+      is_soft_pedal_down(false), was_soft_pedal_down_on_note_start(false),
+      is_sustain_pedal_down(false), stopped_and_sustain_pedal_was_down(false),
+
+      current_velocity(0), current_step(0), current_running_arp_step(0),
+      an_arp_note_is_already_running(false), sample_position_for_restart_arp(-1),
+
+      render_job_context(),
+      render_graph(new mono_RenderGraph(notifyer_, SUM_RENDER_JOBS, &process_render_job, this))
+{
+#ifdef JUCE_DEBUG
+    std::cout << "MONIQUE: init BUFFERS's" << std::endl;
+
+    std::cout << "MONIQUE: init OSC's" << std::endl;
+#endif
+
+    master_osc = new MasterOSC(notifyer_, synth_data_, synth_data_->sine_lookup);
+    second_osc = new SecondOSC(notifyer_, synth_data_, 1, synth_data_->sine_lookup);
+    third_osc = new SecondOSC(notifyer_, synth_data_, 2, synth_data_->sine_lookup);
+
+#ifdef JUCE_DEBUG
+    std::cout << "MONIQUE: init LFO's" << std::endl;
+#endif
+
+    lfos = new LFO *[SUM_LFOS];
+    for (int i = 0; i != SUM_LFOS; ++i)
+    {
+        lfos[i] =
+            new LFO(notifyer_, synth_data_, synth_data->lfo_datas[i], synth_data_->sine_lookup);
+    }
+
+    mfos = new LFO *[SUM_MORPHER_GROUPS];
+    for (int i = 0; i != SUM_MORPHER_GROUPS; ++i)
+    {
+        mfos[i] =
+            new LFO(notifyer_, synth_data_, synth_data->mfo_datas[i], synth_data_->sine_lookup);
+    }
+
+#ifdef JUCE_DEBUG
+    std::cout << "MONIQUE: init FILTERS & ENVELOPES" << std::endl;
+#endif
+
+    filter_processors = new FilterProcessor *[SUM_FILTERS];
+#ifdef POLY
+    filter_volume_tracking_envs = new ENV *[SUM_FILTERS];
+#endif
+    for (int i = 0; i != SUM_FILTERS; ++i)
+    {
+        filter_processors[i] =
+            new FilterProcessor(notifyer_, synth_data_, i, synth_data_->sine_lookup,
+                                synth_data_->cos_lookup, synth_data_->exp_lookup);
+#ifdef POLY
+        filter_volume_tracking_envs[i] =
+            new ENV(notifyer_, synth_data_, synth_data_->env_data, synth_data_->sine_lookup,
+                    synth_data_->cos_lookup, synth_data_->exp_lookup);
+#endif
+    }
+
+    // THE READS AND WRITES OF THE SERIAL ORDER
+    render_graph->add_dependency(MASTER_OSC_JOB, MORPH_1_JOB);
+    render_graph->add_dependency(MASTER_OSC_JOB, LFO_1_JOB);
+    // LFO 1 AND FILTER ENV 1 USE THE MORPH GROUP 2 VALUES OF THE LAST BLOCK
+    render_graph->add_dependency(MORPH_2_JOB, LFO_1_JOB);
+    render_graph->add_dependency(MORPH_2_JOB, FILTER_ENV_1_JOB);
+    render_graph->add_dependency(LFO_2_JOB, MORPH_2_JOB);
+    render_graph->add_dependency(SECOND_OSC_JOB, MASTER_OSC_JOB);
+    render_graph->add_dependency(SECOND_OSC_JOB, LFO_2_JOB);
+    render_graph->add_dependency(FILTER_ENV_2_JOB, MORPH_2_JOB);
+    render_graph->add_dependency(LFO_3_JOB, MORPH_2_JOB);
+    render_graph->add_dependency(THIRD_OSC_JOB, MASTER_OSC_JOB);
+    render_graph->add_dependency(THIRD_OSC_JOB, LFO_3_JOB);
+    render_graph->add_dependency(FILTER_ENV_3_JOB, MORPH_2_JOB);
+    // THE FILTERS OVERWRITE THE LFO AMPS OF THE OSCS WITH THE ENV MIX
+    render_graph->add_dependency(PREPARE_FILTER_1_JOB, MASTER_OSC_JOB);
+    render_graph->add_dependency(PREPARE_FILTER_1_JOB, MORPH_2_JOB);
+    render_graph->add_dependency(PREPARE_FILTER_2_JOB, SECOND_OSC_JOB);
+    render_graph->add_dependency(PREPARE_FILTER_2_JOB, FILTER_ENV_2_JOB);
+    render_graph->add_dependency(PREPARE_FILTER_3_JOB, THIRD_OSC_JOB);
+    render_graph->add_dependency(PREPARE_FILTER_3_JOB, FILTER_ENV_3_JOB);
+    // EVERY FILTER NEEDS ALL OSCS AND THE FILTER BEFORE
+    render_graph->add_dependency(FILTER_1_JOB, PREPARE_FILTER_1_JOB);
+    render_graph->add_dependency(FILTER_1_JOB, SECOND_OSC_JOB);
+    render_graph->add_dependency(FILTER_1_JOB, THIRD_OSC_JOB);
+    render_graph->add_dependency(FILTER_2_JOB, PREPARE_FILTER_2_JOB);
+    render_graph->add_dependency(FILTER_2_JOB, FILTER_1_JOB);
+    render_graph->add_dependency(FILTER_3_JOB, PREPARE_FILTER_3_JOB);
+    render_graph->add_dependency(FILTER_3_JOB, FILTER_2_JOB);
+    // THE FINAL MIX USES THE DISTORTION AND FX BYPASS OF MORPH GROUP 3
+    render_graph->add_dependency(FILTER_3_JOB, MORPH_3_JOB);
+}
+COLD MoniqueSynthesiserVoice::~MoniqueSynthesiserVoice() noexcept
+{
+#ifdef JUCE_DEBUG
+    std::cout << "~MoniqueSynthesiserVoice" << std::endl;
+#endif
+    delete render_graph;
+
+    for (int i = SUM_FILTERS - 1; i > -1; --i)
+    {
+#ifdef POLY
+        delete filter_volume_tracking_envs[i];
+#endif
+        delete filter_processors[i];
+    }
+    delete[] filter_processors;
+    for (int i = SUM_LFOS - 1; i > -1; --i)
+    {
+        delete lfos[i];
+    }
+    delete[] lfos;
+    for (int i = SUM_MORPHER_GROUPS - 1; i > -1; --i)
+    {
+        delete mfos[i];
+    }
+    delete[] mfos;
+
+    delete third_osc;
+    delete second_osc;
+    delete master_osc;
+
+    delete arp_sequencer;
+    delete eq_processor;
+    delete fx_processor;
+}
+
+//==============================================================================
+void MoniqueSynthesiserVoice::startNote(int midi_note_number_, float velocity_,
+                                        juce::SynthesiserSound * /*sound*/, int pitch_)
+{
+    start_internal(midi_note_number_, velocity_, event_sample_position, true);
+}
+void MoniqueSynthesiserVoice::start_internal(int midi_note_number_, float velocity_,
+                                             int sample_number_, bool is_human_event_,
+                                             bool trigger_envelopes_, bool isNoteOff) noexcept
+{
+    stopped_and_sostenuto_pedal_was_down = false;
+    stopped_and_sustain_pedal_was_down = false;
+    was_soft_pedal_down_on_note_start = is_soft_pedal_down;
+
+    current_velocity =
+        (1.0f - synth_data->env_data->velosivity) * velocity_ + synth_data->env_data->velosivity;
+
+    // OSCS
+    MoniqueSynthesizer::NoteDownStore *tmp_note_down_store =
+        reinterpret_cast<MoniqueSynthesizer::NoteDownStore *>(note_down_store);
+    const int keys_down = tmp_note_down_store->size();
+    const bool step_automation_is_on =
+        (synth_data->arp_sequencer_data->is_on &&
+         (!synth_data->keep_arp_always_off || synth_data->keep_arp_always_on)) ||
+        synth_data->keep_arp_always_on;
+    bool start_up = (step_automation_is_on && keys_down == 1) ||
+                    (step_automation_is_on &&
+                     (synth_data->arp_sequencer_data->is_sequencer && current_note != -1) &&
+                     !is_human_event_) ||
+                    (step_automation_is_on && keys_down > 0 && !is_human_event_) ||
+                    (!step_automation_is_on && is_human_event_);
+    if (synth_data->arp_sequencer_data->is_sequencer)
+    {
+        if (is_human_event_)
+        {
+            arp_sequencer->set_user_arp_start_point_in_samples(0);
+        }
+    }
+#ifdef POLY
+    if (an_arp_note_is_already_running && step_automation_is_on
+        //|| arp_sequencer->data->connect && keys_down > 1 && step_automation_is_on == false
+        //|| step_automation_is_on && is_human_event_
+    )
+    {
+        trigger_envelopes_ = false;
+    }
+#else
+    if ((arp_sequencer->data->connect && an_arp_note_is_already_running && step_automation_is_on) ||
+        (arp_sequencer->data->connect && keys_down > 1 && step_automation_is_on == false) ||
+        (step_automation_is_on && is_human_event_))
+    {
+        trigger_envelopes_ = false;
+    }
+#endif
+    // KEYTRACK OR NOTE PLAYBACK
+    const float arp_offset = ((step_automation_is_on ||
+                               (step_automation_is_on &&
+                                synth_data->arp_sequencer_data->is_sequencer && current_note != -1))
+                                  ? arp_sequencer->get_current_tune()
+                                  : 0);
+    {
+        // FIRST KEY DOWN
+        const bool first_key_down_event = is_human_event_ && keys_down == 1;
+
+        if (!synth_data->arp_sequencer_data->is_sequencer)
+        {
+            if (keys_down > 0 && is_human_event_ && step_automation_is_on)
+            {
+                // LEGATO ARP - TURN THIS FIRST BLOCK OF TO HAVE IT NORMAL
+#ifndef POLY
+                if ((isNoteOff && arp_sequencer->data->connect) ||
+                    (keys_down > 1 && arp_sequencer->data->connect))
+                    trigger_envelopes_ = false;
+                else
+#endif
+                {
+                    arp_sequencer->set_user_arp_start_point_in_samples(info->samples_since_start +
+                                                                       sample_number_);
+                    arp_sequencer->reset();
+                    an_arp_note_is_already_running = synth_data->arp_sequencer_data->step[0];
+                    start_up = an_arp_note_is_already_running;
+                    trigger_envelopes_ = start_up;
+                }
+            }
+        }
+        else
+        {
+            if (keys_down == 1 && is_human_event_)
+            {
+                arp_sequencer->set_user_arp_start_point_in_samples(0);
+            }
+        }
+
+        const juce::MidiMessage *last_message = tmp_note_down_store->get_last();
+        int last_note = -1;
+        int last_note_id = -1;
+        int current_note_id = -2;
+        if (last_message)
+        {
+            last_note = tmp_note_down_store->get_last()->getNoteNumber();
+            last_note_id = tmp_note_down_store->get_id(last_note);
+        }
+        if (is_human_event_)
+        {
+            current_note_id = tmp_note_down_store->get_id(midi_note_number_);
+        }
+#ifdef POLY
+        int reorder_allowed = synth_data->keytrack_osci[0] + synth_data->keytrack_osci[1] +
+                              synth_data->keytrack_osci[2];
+#else
+        const int reorder_allowed = 0;
+#endif
+        if (!reorder_allowed)
+        {
+            current_note = midi_note_number_;
+        }
+        /*
+        else
+        {
+            if( synth_data->keytrack_osci[0] )
+            {
+                if( keys_down == 1 )
+                {
+                    current_note = midi_note_number_;
+                }
+            }
+            else
+            {
+                current_note = midi_note_number_;
+            }
+        }
+        */
+
+        // INSERT
+        if (current_note_id >= 0 && current_note_id <= 2)
+        {
+            int trigger_again_note_0 = false;
+            int trigger_again_note_1 = false;
+            int trigger_again_note_2 = false;
+            const int incoming_note_value = midi_note_number_;
+            const juce::MidiMessage *message_0 = tmp_note_down_store->get_at(0);
+            const juce::MidiMessage *message_1 = tmp_note_down_store->get_at(1);
+            const juce::MidiMessage *message_2 = tmp_note_down_store->get_at(2);
+            bool trigger_again_note_0_was_running = false;
+            bool trigger_again_note_1_was_running = false;
+            bool trigger_again_note_2_was_running = false;
+
+            if (tmp_note_down_store->size() > 1)
+            {
+                bool done = false;
+
+                // PLAYBACK MODE
+                struct compary
+                {
+                    virtual bool compare(int left_, int right_) const noexcept = 0;
+                    virtual int get_compare_default() const noexcept = 0;
+                    virtual ~compary(){};
+                };
+                struct low_last_compary : public compary
+                {
+                    bool compare(int left_, int right_) const noexcept override
+                    {
+                        return left_ < right_;
+                    }
+                    int get_compare_default() const noexcept override { return -1; }
+                };
+                struct high_last_compary : public compary
+                {
+                    bool compare(int left_, int right_) const noexcept override
+                    {
+                        return left_ > right_;
+                    }
+                    int get_compare_default() const noexcept override { return 999; }
+                };
+#ifdef POLY
+                std::unique_ptr<compary> comparier;
+                std::unique_ptr<compary> comparier2;
+                bool first_and_second_swapped = false;
+                if (synth_data->keytrack_osci_play_mode == 1)
+                {
+                    comparier = new high_last_compary();
+                }
+                if (synth_data->keytrack_osci_play_mode == 0)
+                {
+                    comparier = new low_last_compary();
+                }
+                if (synth_data->keytrack_osci_play_mode == 2 || reorder_allowed == false)
+                {
+                    comparier = nullptr;
+                }
+                if (synth_data->keytrack_osci_play_mode == 3 || reorder_allowed == false)
+                {
+                    comparier = new high_last_compary();
+                    comparier2 = new low_last_compary();
+                }
+#else
+                auto comparier = std::make_unique<low_last_compary>();
+#endif
+
+                int note_0_value = 0;
+                int note_1_value = 0;
+                int note_2_value = 0;
+                if (comparier)
+                {
+                    note_0_value = note_1_value = note_2_value = comparier->get_compare_default();
+                }
+
+                if (message_0)
+                {
+                    note_0_value = message_0->getNoteNumber();
+                }
+                if (message_1)
+                {
+                    note_1_value = message_1->getNoteNumber();
+                }
+                if (message_2)
+                {
+                    note_2_value = message_2->getNoteNumber();
+                }
+
+                if (comparier)
+                {
+                    trigger_again_note_0_was_running = tmp_note_down_store->size() > 1;
+                    trigger_again_note_1_was_running = tmp_note_down_store->size() > 2;
+                    trigger_again_note_2_was_running = tmp_note_down_store->size() > 3;
+
+                    if (comparier->compare(note_0_value, note_1_value))
+                    {
+                        if (comparier->compare(note_0_value, note_2_value))
+                        {
+                            tmp_note_down_store->swap(0, 1);
+                            tmp_note_down_store->swap(1, 2);
+
+                            trigger_again_note_0 = note_1_value;
+                            trigger_again_note_1 = note_2_value;
+                            trigger_again_note_2 = note_0_value;
+
+                            if (current_note_id == 0)
+                            {
+                                current_note_id = 2;
+                                trigger_again_note_2 = false;
+                            }
+                            else if (current_note_id == 1)
+                            {
+                                current_note_id = 0;
+                                trigger_again_note_0 = false;
+                            }
+                            else if (current_note_id == 2)
+                            {
+                                current_note_id = 1;
+                                trigger_again_note_1 = false;
+                            }
+                        }
+                        else
+                        {
+                            tmp_note_down_store->swap(0, 1);
+
+                            trigger_again_note_0 = note_1_value;
+                            trigger_again_note_1 = note_0_value;
+                            trigger_again_note_2 = note_2_value;
+
+                            if (current_note_id == 0)
+                            {
+                                current_note_id = 1;
+                                trigger_again_note_1 = false;
+                            }
+                            else if (current_note_id == 1)
+                            {
+                                current_note_id = 0;
+                                trigger_again_note_0 = false;
+                            }
+                            else if (current_note_id == 2)
+                            {
+                                current_note_id = 2;
+                                trigger_again_note_2 = false;
+                            }
+                        }
+                    }
+                    else if (comparier->compare(note_0_value, note_2_value))
+                    {
+                        if (comparier->compare(note_1_value, note_2_value))
+                        {
+                            tmp_note_down_store->swap(0, 2);
+                            tmp_note_down_store->swap(1, 2);
+
+                            trigger_again_note_0 = note_2_value;
+                            trigger_again_note_1 = note_0_value;
+                            trigger_again_note_2 = note_1_value;
+
+                            if (current_note_id == 0)
+                            {
+                                current_note_id = 1;
+                                trigger_again_note_1 = false;
+                            }
+                            else if (current_note_id == 1)
+                            {
+                                current_note_id = 2;
+                                trigger_again_note_2 = false;
+                            }
+                            else if (current_note_id == 2)
+                            {
+                                current_note_id = 0;
+                                trigger_again_note_0 = false;
+                            }
+                        }
+                        else
+                        {
+                            tmp_note_down_store->swap(0, 2);
+
+                            trigger_again_note_0 = note_2_value;
+                            trigger_again_note_1 = note_1_value;
+                            trigger_again_note_2 = note_0_value;
+
+                            if (current_note_id == 0)
+                            {
+                                current_note_id = 2;
+                                trigger_again_note_2 = false;
+                            }
+                            else if (current_note_id == 1)
+                            {
+                                current_note_id = 1;
+                                trigger_again_note_1 = false;
+                            }
+                            else if (current_note_id == 2)
+                            {
+                                current_note_id = 0;
+                                trigger_again_note_0 = false;
+                            }
+                        }
+                    }
+                    else if (comparier->compare(note_1_value, note_2_value))
+                    {
+                        tmp_note_down_store->swap(1, 2);
+
+                        trigger_again_note_0 = note_0_value;
+                        trigger_again_note_1 = note_2_value;
+                        trigger_again_note_2 = note_1_value;
+
+                        if (current_note_id == 0)
+                        {
+                            current_note_id = 0;
+                            trigger_again_note_0 = false;
+                        }
+                        else if (current_note_id == 1)
+                        {
+                            current_note_id = 2;
+                            trigger_again_note_2 = false;
+                        }
+                        else if (current_note_id == 2)
+                        {
+                            current_note_id = 1;
+                            trigger_again_note_1 = false;
+                        }
+                    }
+                    else
+                    {
+                        if (current_note_id == 0 ||
+                            (note_0_value != comparier->get_compare_default() &&
+                             note_0_value != current_note))
+                        {
+                            trigger_again_note_1 = note_1_value;
+                            trigger_again_note_2 = note_2_value;
+                        }
+                        if (current_note_id == 0)
+                            trigger_again_note_0_was_running = false;
+                        else if (current_note_id == 1)
+                            trigger_again_note_1_was_running = false;
+                        else if (current_note_id == 2)
+                            trigger_again_note_2_was_running = false;
+                    }
+
+                    if (trigger_again_note_0 == comparier->get_compare_default())
+                        trigger_again_note_0 = false;
+                    if (trigger_again_note_1 == comparier->get_compare_default())
+                        trigger_again_note_1 = false;
+                    if (trigger_again_note_2 == comparier->get_compare_default())
+                        trigger_again_note_2 = false;
+                }
+            }
+
+            // PROCESSING
+            const juce::MidiMessage *message = tmp_note_down_store->get_at(current_note_id);
+            if (message)
+            {
+                int note_number = message->getNoteNumber();
+                if (current_note_id == 0 || trigger_again_note_0 != false)
+                {
+                    const int note_to_use =
+                        trigger_again_note_0 != false ? trigger_again_note_0 : note_number;
+                    // OSC TRACKING 1 - SWAP ROOT NOTe
+                    {
+                        current_note = note_to_use;
+                    }
+#ifdef POLY
+                    // CUTOFF TRACKING 1
+                    if (synth_data->keytrack_cutoff[0])
+                    {
+                        // synth_data->filter_datas[0]->cutoff.set_value(
+                        // reverse_cutoff_to_slider_value(
+                        // synth_data->tuning->midiNoteToFrequency(note_to_use+arp_offset) ) );
+                    }
+                    if (trigger_envelopes_)
+                    {
+                        if (!trigger_again_note_0_was_running && !step_automation_is_on)
+                        {
+                            // ENV TRACKING 1
+                            if (synth_data->keytrack_filter_env[0])
+                            {
+                                filter_processors[0]->start_env();
+                            }
+                            // INPUT ENV TRACKING 1
+                            if (synth_data->keytrack_filter_inputs[0])
+                            {
+                                filter_processors[0]->start_input_env(0);
+                            }
+                            if (synth_data->keytrack_filter_inputs[3])
+                            {
+                                filter_processors[1]->start_input_env(0);
+                            }
+                            if (synth_data->keytrack_filter_inputs[6])
+                            {
+                                filter_processors[2]->start_input_env(0);
+                            }
+                            // VOLUME TRACKING 3
+                            if (synth_data->keytrack_filter_volume[0])
+                            {
+                                filter_volume_tracking_envs[0]->start_attack();
+                            }
+                        }
+                    }
+#else
+                    if (trigger_envelopes_)
+                    {
+                        if (!trigger_again_note_0_was_running && !step_automation_is_on)
+                        {
+                            filter_processors[0]->start_env();
+                            filter_processors[1]->start_env();
+                            filter_processors[2]->start_env();
+                            filter_processors[0]->start_input_env(0);
+                            filter_processors[1]->start_input_env(0);
+                            filter_processors[2]->start_input_env(0);
+                            filter_processors[0]->start_input_env(1);
+                            filter_processors[1]->start_input_env(1);
+                            filter_processors[2]->start_input_env(1);
+                            filter_processors[0]->start_input_env(2);
+                            filter_processors[1]->start_input_env(2);
+                            filter_processors[2]->start_input_env(2);
+                        }
+                    }
+#endif
+                }
+                /*else*/ if (current_note_id == 1 || trigger_again_note_1 != false)
+                {
+#ifdef POLY
+                    // OSC TRACKING 2
+                    if (synth_data->keytrack_osci[1])
+                    {
+                        const int note_to_use =
+                            trigger_again_note_1 > false ? trigger_again_note_1 : note_number;
+                        synth_data->osc_datas[1]->tune.set_value(
+                            (note_to_use + synth_data->keytrack_osci_octave_offset[1] * 12) -
+                            current_note);
+                    }
+
+                    if (trigger_envelopes_)
+                    {
+                        if ((!trigger_again_note_1_was_running && !step_automation_is_on) ||
+                            (!trigger_again_note_2_was_running && step_automation_is_on &&
+                             !synth_data->arp_sequencer_data->is_sequencer && is_human_event_))
+                        {
+                            // ENV TRACKING 2
+                            if (synth_data->keytrack_filter_env[1])
+                            {
+                                filter_processors[1]->start_env();
+                            }
+                            // VOLUME TRACKING 2
+                            if (synth_data->keytrack_filter_volume[1])
+                            {
+                                filter_volume_tracking_envs[1]->start_attack();
+                            }
+                            // INPUT ENV TRACKING 2
+                            if (synth_data->keytrack_filter_inputs[0 + 1])
+                            {
+                                filter_processors[0]->start_input_env(0 + 1);
+                            }
+                            if (synth_data->keytrack_filter_inputs[3 + 1])
+                            {
+                                filter_processors[1]->start_input_env(0 + 1);
+                            }
+                            if (synth_data->keytrack_filter_inputs[6 + 1])
+                            {
+                                filter_processors[2]->start_input_env(0 + 1);
+                            }
+                        }
+                    }
+#endif
+                }
+                /*else*/ if (current_note_id == 2 || trigger_again_note_2 != false)
+                {
+#ifdef POLY
+                    // OSC TRACKING 3
+                    if (synth_data->keytrack_osci[2])
+                    {
+                        const int note_to_use =
+                            trigger_again_note_2 > false ? trigger_again_note_2 : note_number;
+                        synth_data->osc_datas[2]->tune.set_value(
+                            (note_to_use + synth_data->keytrack_osci_octave_offset[2] * 12) -
+                            current_note);
+                    }
+
+                    if (trigger_envelopes_)
+                    {
+                        if ((!trigger_again_note_2_was_running && !step_automation_is_on) ||
+                            (!trigger_again_note_2_was_running && step_automation_is_on &&
+                             !synth_data->arp_sequencer_data->is_sequencer && is_human_event_))
+                        {
+                            // ENV TRACKING 3
+                            if (synth_data->keytrack_filter_env[2])
+                            {
+                                filter_processors[2]->start_env();
+                            }
+                            // INPUT ENV TRACKING 3
+                            if (synth_data->keytrack_filter_inputs[0 + 2])
+                            {
+                                filter_processors[0]->start_input_env(0 + 2);
+                            }
+                            if (synth_data->keytrack_filter_inputs[3 + 2])
+                            {
+                                filter_processors[1]->start_input_env(0 + 2);
+                            }
+                            if (synth_data->keytrack_filter_inputs[6 + 2])
+                            {
+                                filter_processors[2]->start_input_env(0 + 2);
+                            }
+                            // VOLUME TRACKING 3
+                            if (synth_data->keytrack_filter_volume[2])
+                            {
+                                filter_volume_tracking_envs[2]->start_attack();
+                            }
+                        }
+                    }
+#endif
+                }
+            }
+            else
+            {
+                DBG("key tracking note select bug");
+            }
+        }
+        else if (current_note_id == -2) // AUTOMATED TUNE OFFSETS
+        {
+            // TODO REPLACE LAST ONE
+        }
+    }
+
+    // WHEN TO TRIGGER THE PROCESSORS
+    if (start_up)
+    {
+        // ROOTS
+        if (trigger_envelopes_)
+        {
+            eq_processor->start_attack();
+            fx_processor->start_attack();
+        }
+
+        // NOTES
+        {
+            master_osc->update(current_note + arp_offset + pitch_offset, sample_number_);
+            second_osc->update(current_note + arp_offset + pitch_offset, sample_number_);
+            third_osc->update(current_note + arp_offset + pitch_offset, sample_number_);
+        }
+
+        // CUTOFF
+        {
+#ifdef POLY
+            if (synth_data->keytrack_cutoff[0])
+            {
+                const int note_0 =
+                    current_note + synth_data->keytrack_cutoff_octave_offset[0] * 12 + arp_offset;
+                synth_data->filter_datas[0]->cutoff.set_value(reverse_cutoff_to_slider_value(
+                    synth_data->tuning->midiNoteToFrequency(note_0)));
+            }
+            if (synth_data->keytrack_cutoff[1])
+            {
+                const int note_1 = current_note + synth_data->osc_datas[1]->tune +
+                                   synth_data->keytrack_cutoff_octave_offset[1] * 12 + arp_offset;
+                synth_data->filter_datas[1]->cutoff.set_value(reverse_cutoff_to_slider_value(
+                    synth_data->tuning->midiNoteToFrequency(note_1)));
+            }
+            if (synth_data->keytrack_cutoff[2])
+            {
+                const int note_2 = current_note + synth_data->osc_datas[2]->tune +
+                                   synth_data->keytrack_cutoff_octave_offset[2] * 12 + arp_offset;
+                synth_data->filter_datas[2]->cutoff.set_value(reverse_cutoff_to_slider_value(
+                    synth_data->tuning->midiNoteToFrequency(note_2)));
+            }
+#endif
+        }
+        // todo trigger if key down - like you ask is_key_x_down
+        // ENVELOPES
+#ifdef POLY
+        for (int i = 0; i != SUM_FILTERS; ++i)
+        {
+            const bool trigger =
+                trigger_envelopes_ &&
+                ((step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer) ||
+                 (step_automation_is_on && !synth_data->arp_sequencer_data->is_sequencer &&
+                  keys_down > i));
+
+            // FILTER ENV TRACKING
+            if (!synth_data->keytrack_filter_env[i] || trigger)
+            {
+                filter_processors[i]->start_env();
+            }
+            // FILTER INPUT ENV TRACKING
+            if (!synth_data->keytrack_filter_inputs[i * SUM_OSCS + 0] || trigger)
+            {
+                filter_processors[i]->start_input_env(0);
+            }
+            if (!synth_data->keytrack_filter_inputs[i * SUM_OSCS + 1] || trigger)
+            {
+                filter_processors[i]->start_input_env(1);
+            }
+            if (!synth_data->keytrack_filter_inputs[i * SUM_OSCS + 2] || trigger)
+            {
+                filter_processors[i]->start_input_env(2);
+            }
+            // FILTER OUT TRACKING
+            if (!synth_data->keytrack_filter_volume[i] || trigger)
+            {
+                filter_volume_tracking_envs[i]->start_attack();
+            }
+        }
+#else
+        const bool trigger =
+            trigger_envelopes_ &&
+            ((step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer) ||
+             (step_automation_is_on && !synth_data->arp_sequencer_data->is_sequencer && keys_down));
+        for (int i = 0; i != SUM_FILTERS; ++i)
+        {
+            // FILTER ENV TRACKING
+            if (trigger)
+            {
+                filter_processors[i]->start_env();
+            }
+            // FILTER INPUT ENV TRACKING
+            if (trigger)
+            {
+                filter_processors[i]->start_input_env(0);
+            }
+            if (trigger)
+            {
+                filter_processors[i]->start_input_env(1);
+            }
+            if (trigger)
+            {
+                filter_processors[i]->start_input_env(2);
+            }
+        }
+#endif
+
+        // KEY SYNC
+        if (synth_data->osc_datas[MASTER_OSC]->sync && trigger_envelopes_)
+        {
+            master_osc->reset();
+            second_osc->reset();
+            third_osc->reset();
+        }
+    }
+}
+
+void MoniqueSynthesiserVoice::stop_arp_controlled(bool force)
+{
+    MoniqueSynthesizer::NoteDownStore *tmp_note_down_store =
+        reinterpret_cast<MoniqueSynthesizer::NoteDownStore *>(note_down_store);
+    const bool step_automation_is_on =
+        synth_data->arp_sequencer_data->is_on &&
+        (!synth_data->keep_arp_always_off || synth_data->keep_arp_always_on);
+    const int keys_down = tmp_note_down_store->size();
+#ifdef POLY
+    for (int i = 0; i != SUM_FILTERS; ++i)
+    {
+        // FILTER ENV TRACKING
+        if (!synth_data->keytrack_filter_env[i] || (step_automation_is_on && keys_down > i) ||
+            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
+        {
+            filter_processors[i]->start_env_release();
+        }
+        // FILTER INPUT TRACKING
+        if (!synth_data->keytrack_filter_inputs[0 * SUM_OSCS + i] ||
+            (step_automation_is_on && keys_down > i) ||
+            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
+        {
+            filter_processors[0]->start_input_env_release(i);
+        }
+        if (!synth_data->keytrack_filter_inputs[1 * SUM_OSCS + i] ||
+            (step_automation_is_on && keys_down > i) ||
+            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
+        {
+            filter_processors[1]->start_input_env_release(i);
+        }
+        if (!synth_data->keytrack_filter_inputs[2 * SUM_OSCS + i] ||
+            (step_automation_is_on && keys_down > i) ||
+            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
+        {
+            filter_processors[2]->start_input_env_release(i);
+        }
+        // FILTER OUT TRACKING
+        if (!synth_data->keytrack_filter_volume[i] || (step_automation_is_on && keys_down > i) ||
+            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
+        {
+            filter_volume_tracking_envs[i]->set_to_release();
+        }
+    }
+    eq_processor->start_release();
+    fx_processor->start_release(false, false);
+#else
+    for (int i = 0; i != SUM_FILTERS; ++i)
+    {
+        // FILTER ENV TRACKING
+        if (force ||
+            (step_automation_is_on && keys_down == 0 && synth_data->arp_sequencer_data->connect) ||
+            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
+        {
+            filter_processors[i]->start_env_release();
+        }
+        // FILTER INPUT TRACKING
+        if (force ||
+            (step_automation_is_on && keys_down == 0 && synth_data->arp_sequencer_data->connect) ||
+            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
+        {
+            filter_processors[0]->start_input_env_release(i);
+        }
+        if (force ||
+            (step_automation_is_on && keys_down == 0 && synth_data->arp_sequencer_data->connect) ||
+            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
+        {
+            filter_processors[1]->start_input_env_release(i);
+        }
+        if (force ||
+            (step_automation_is_on && keys_down == 0 && synth_data->arp_sequencer_data->connect) ||
+            (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
+        {
+            filter_processors[2]->start_input_env_release(i);
+        }
+    }
+    if (force ||
+        (step_automation_is_on && keys_down == 0 && synth_data->arp_sequencer_data->connect) ||
+        (step_automation_is_on && synth_data->arp_sequencer_data->is_sequencer))
+    {
+        eq_processor->start_release();
+        fx_processor->start_release(false, false);
+    }
+#endif
+}
+void MoniqueSynthesiserVoice::stop_controlled(const juce::MidiMessage &m_, int sample_pos_)
+{
+    MoniqueSynthesizer::NoteDownStore *tmp_note_down_store =
+        reinterpret_cast<MoniqueSynthesizer::NoteDownStore *>(note_down_store);
+    const int note_id = tmp_note_down_store->get_id(m_.getNoteNumber());
+    const bool step_automation_is_on =
+        synth_data->arp_sequencer_data->is_on &&
+        (!synth_data->keep_arp_always_off || synth_data->keep_arp_always_on);
+    const int keys_down = tmp_note_down_store->size();
+
+    // PARTIAL STOP
+    if (note_id >= 0 && note_id <= 2)
+    {
+        for (int i = 0; i != 3; ++i)
+        {
+#ifdef POLY
+            if (note_id == i)
+            {
+                // FILTER ENV TRACKING
+                if (synth_data->keytrack_filter_env[i])
+                {
+                    filter_processors[i]->start_env_release();
+                }
+                // FILTER INPUT TRACKING
+                if (synth_data->keytrack_filter_inputs[0 * SUM_OSCS + i])
+                {
+                    filter_processors[0]->start_input_env_release(i);
+                }
+                if (synth_data->keytrack_filter_inputs[1 * SUM_OSCS + i])
+                {
+                    filter_processors[1]->start_input_env_release(i);
+                }
+                if (synth_data->keytrack_filter_inputs[2 * SUM_OSCS + i])
+                {
+                    filter_processors[2]->start_input_env_release(i);
+                }
+                // FILTER OUT TRACKING
+                if (synth_data->keytrack_filter_volume[i])
+                {
+                    filter_volume_tracking_envs[i]->set_to_release();
+                }
+            }
+#endif
+        }
+    }
+    // REMOVE NOTe AND RESTART IF REQUIRED
+    if (tmp_note_down_store->size())
+    {
+#ifdef POLY
+        const int reorder_allowed = synth_data->keytrack_osci[0] + synth_data->keytrack_osci[1] +
+                                    synth_data->keytrack_osci[2];
+        const int play_mode =
+            synth_data->keytrack_osci_play_mode == 2 ? PLAY_MODES::FIFO : PLAY_MODES::LIFO;
+#else
+        const int reorder_allowed = 0;
+        const int play_mode = PLAY_MODES::LIFO;
+#endif
+        if (const juce::MidiMessage *replacement =
+                tmp_note_down_store->remove_note(m_, play_mode, reorder_allowed))
+        {
+            start_internal(replacement->getNoteNumber(), replacement->getFloatVelocity(),
+                           sample_pos_, true, false, true);
+        }
+        // RESTART LAST
+        else if (tmp_note_down_store->get_last() && !reorder_allowed)
+        {
+            const juce::MidiMessage *message = tmp_note_down_store->get_last();
+            start_internal(message->getNoteNumber(), message->getFloatVelocity(), sample_pos_, true,
+                           false, true);
+        }
+        // FULL STOP
+        else if (!tmp_note_down_store->size())
+        {
+            eq_processor->start_release();
+            fx_processor->start_release(false, false);
+
+            for (int i = 0; i != 3; ++i)
+            {
+                filter_processors[i]->start_env_release();
+                filter_processors[i]->start_input_env_release(0);
+                filter_processors[i]->start_input_env_release(1);
+                filter_processors[i]->start_input_env_release(2);
+#ifdef POLY
+                filter_volume_tracking_envs[i]->set_to_release();
+#endif
+            }
+        }
+
+        if (not(synth_data->arp_sequencer_data->is_sequencer &&
+                synth_data->arp_sequencer_data->is_on &&
+                (!synth_data->keep_arp_always_off || synth_data->keep_arp_always_on)) &&
+            tmp_note_down_store->size() == 0)
+        {
+            current_note = -1;
+        }
+    }
+}
+
+void MoniqueSynthesiserVoice::stopNote(float note_number_, bool allowTailOff) {}
+void MoniqueSynthesiserVoice::stop_internal() noexcept
+{
+    stopped_and_sostenuto_pedal_was_down = is_sostenuto_pedal_down;
+    stopped_and_sustain_pedal_was_down = is_sustain_pedal_down;
+
+    if (!is_sostenuto_pedal_down)
+    {
+        eq_processor->start_release();
+        for (int voice_id = 0; voice_id != SUM_FILTERS; ++voice_id)
+        {
+            filter_processors[voice_id]->start_release();
+        }
+    }
+    fx_processor->start_release(is_sustain_pedal_down, is_sostenuto_pedal_down);
+}
+
+//==============================================================================
+void MoniqueSynthesiserVoice::release_if_inactive() noexcept
+{
+    bool is_arp_on = synth_data->arp_sequencer_data->is_on || synth_data->keep_arp_always_on;
+    if (synth_data->keep_arp_always_off)
+    {
+        is_arp_on = false;
+    }
+
+    if (fx_processor->final_env->get_current_stage() == END_ENV &&
+        !synth_data->audio_processor->amp_painter)
+    {
+        bool has_steps_enabled = false;
+        for (int i = 0; i != SUM_ENV_ARP_STEPS; ++i)
+        {
+            if (synth_data->arp_sequencer_data->step[i])
+            {
+                has_steps_enabled = true;
+                break;
+            }
+        }
+        if ((is_arp_on && !has_steps_enabled) || !is_arp_on)
+        {
+            if (fx_processor->zero_samples_counter > fx_processor->delay.get_max_duration() + 10)
+            {
+                current_note = -1;
+                clearCurrentNote();
+            }
+        }
+    }
+    else
+    {
+        fx_processor->zero_samples_counter = 0;
+    }
+}
+
+//==============================================================================
+void MoniqueSynthesiserVoice::start_block() noexcept
+{
+    // GET POSITION INFOS
+    if (is_standalone())
+    {
+        if (synth_data->sync)
+        {
+            if (info->standalone_features_pimpl->is_extern_synced)
+            {
+                info->bpm = audio_processor->get_current_pos_info().bpm;
+            }
+            else
+            {
+                info->bpm = synth_data->speed;
+            }
+        }
+        else
+        {
+            info->standalone_features_pimpl->is_extern_synced = false;
+            info->bpm = synth_data->speed;
+        }
+    }
+    else
+    {
+        if (synth_data->sync)
+        {
+            info->bpm = audio_processor->get_current_pos_info().bpm;
+        }
+        else
+        {
+            info->bpm = synth_data->speed;
+        }
+    }
+
+    info->samples_since_start = audio_processor->get_current_pos_info().timeInSamples;
+    if (audio_processor->get_current_pos_info().isPlaying)
+    {
+        info->relative_samples_since_start = info->samples_since_start;
+    }
+}
+void MoniqueSynthesiserVoice::end_block(int num_samples_) noexcept
+{
+    if (!audio_processor->get_current_pos_info().isPlaying)
+    {
+        info->relative_samples_since_start += num_samples_;
+    }
+}
+void MoniqueSynthesiserVoice::renderNextBlock(juce::AudioSampleBuffer &output_buffer_,
+                                              int start_sample_, int num_samples_)
+{
+    int count_start_sample = start_sample_;
+    int counted_samples = num_samples_;
+    bool is_a_step = false;
+    const bool connect = synth_data->arp_sequencer_data->connect;
+    bool is_arp_on = synth_data->arp_sequencer_data->is_on ||
+                     (synth_data->keep_arp_always_on && !synth_data->keep_arp_always_off);
+    if (synth_data->keep_arp_always_off)
+    {
+        is_arp_on = false;
+    }
+    while (counted_samples > 0)
+    {
+        // SEARCH FOR STEPS (16ths) IN THE CURRENT BUFFER RANGE
+        int samples_to_next_arp_step_in_this_buffer =
+            arp_sequencer->process_samples_to_next_step(count_start_sample, counted_samples);
+        counted_samples -= samples_to_next_arp_step_in_this_buffer;
+
+        // RENDER THE NEXT BLOCK
+        int step_id = arp_sequencer->get_current_step();
+
+        // FORCE AN ARP RESTART
+        if (sample_position_for_restart_arp > -1)
+        {
+            if (step_id == 0)
+            {
+                start_internal(current_note, current_velocity, counted_samples + start_sample_,
+                               false);
+                an_arp_note_is_already_running = true;
+                sample_position_for_restart_arp = -1;
+            }
+        }
+        else if (is_arp_on && current_note == -1)
+        {
+            // current_note = arp_info.current_note != -1 ? arp_info.current_note :
+            // 60+synth_data->note_offset.get_value()-24; current_velocity =
+            // arp_info.current_velocity != 0 ? arp_info.current_velocity : 1;
+
+            // AUTO START
+            {
+                // current_note = 60+synth_data->note_offset.get_value()-24;
+                // current_velocity = 1;
+            }
+        }
+
+        // HANDLE RETIGGERS
+        is_a_step = arp_sequencer->found_last_process_a_step();
+        bool is_step_enabled = arp_sequencer->last_found_step_is_enabled();
+        if (is_a_step && an_arp_note_is_already_running &&
+            (!connect || !is_arp_on || !is_step_enabled))
+        {
+            stop_arp_controlled();
+            an_arp_note_is_already_running = false;
+        }
+
+        const bool is_a_new_arp_step_to_start = (is_arp_on && is_a_step && is_step_enabled);
+        if (is_a_new_arp_step_to_start)
+        {
+            current_running_arp_step = step_id;
+            start_internal(current_note, current_velocity, counted_samples + start_sample_, false);
+            an_arp_note_is_already_running = true;
+        }
+
+        if (samples_to_next_arp_step_in_this_buffer > 0)
+        {
+            render_block(output_buffer_, is_a_step ? step_id : -1,
+                         arp_sequencer->get_current_absolute_step(), count_start_sample,
+                         samples_to_next_arp_step_in_this_buffer);
+        }
+        count_start_sample += samples_to_next_arp_step_in_this_buffer;
+    }
+
+    // FREE IT
+    release_if_inactive();
+}
+
+inline void SmoothManager::smooth_and_morph(bool force_by_load_, bool is_automated_morph_,
+                                            const float *morph_power_buffer_, int num_samples_,
+                                            int smooth_motor_time_in_ms_,
+                                            int morph_motor_time_in_ms_,
+                                            MorphGroup *morph_group_) noexcept
+{
+    // PROCESS THE MORPH
+    const MorphGroup::MorphRoute *const routes = morph_group_->morph_routes.begin();
+    for (int i = 0; i != morph_group_->morph_routes.size(); ++i)
+    {
+        const MorphGroup::MorphRoute &route = routes[i];
+        SmoothedParameter *const param = route.smoother;
+        if (param->param_to_smooth->get_runtime_info().smoothing_is_enabled)
+        {
+            param->smooth_and_morph(force_by_load_, is_automated_morph_, smooth_motor_time_in_ms_,
+                                    morph_motor_time_in_ms_, morph_power_buffer_,
+                                    morph_group_->last_power_of_right, route.left_source_param,
+                                    route.right_source_param, num_samples_);
+        }
+    }
+}
+
+#ifdef JUCE_DEBUG
+#define DEBUG_CHECK_MIN_MAX(x)                                                                     \
+    if (x > max_value)                                                                             \
+    {                                                                                              \
+        std::cout << "x to large: " << x << " max: " << max_value << std::endl;                    \
+    }                                                                                              \
+    else if (x < min_value)                                                                        \
+    {                                                                                              \
+        std::cout << "x to small: " << x << " max: " << min_value << std::endl;                    \
+    }
+#else
+#define DEBUG_CHECK_MIN_MAX(x)
+#endif
+
+// TOOPT
+#define FORCE_MIN_MAX(x) juce::jmax(juce::jmin(x, max_value), min_value)
+
+inline void SmoothedParameter::settle(float value_) noexcept
+{
+    if (!is_settled || settled_value != value_)
+    {
+        juce::FloatVectorOperations::fill(values.getWritePointer(), value_, block_size);
+        settled_value = value_;
+        is_settled = true;
+    }
+}
+inline void SmoothedParameter::settle_modulation(float modulation_) noexcept
+{
+    if (!is_modulation_settled || settled_modulation != modulation_)
+    {
+        juce::FloatVectorOperations::fill(modulation_power.getWritePointer(), modulation_,
+                                          block_size);
+        settled_modulation = modulation_;
+        is_modulation_settled = true;
+    }
+}
+
+void SmoothedParameter::simple_smooth(int smooth_motor_time_in_ms_, int num_samples_) noexcept
+{
+    simple_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+    simple_smoother.set_value(param_to_smooth->get_value());
+    float *const target = values.getWritePointer();
+    if (!simple_smoother.is_steady())
+    {
+
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            target[sid] = FORCE_MIN_MAX(simple_smoother.tick());
+        }
+
+        is_settled = false;
+    }
+    else
+    {
+        settle(FORCE_MIN_MAX(simple_smoother.get_last_value()));
+    }
+
+    param_to_smooth->get_runtime_info().set_last_value_state(target[num_samples_ - 1]);
+}
+// TOOPD FloatVectorOperations
+void SmoothedParameter::smooth_and_morph(bool force_by_load_, bool is_automated_morph_,
+                                         int smooth_motor_time_in_ms_, int morph_motor_time_in_ms_,
+                                         const float *morph_amp_buffer_, float morph_slider_state_,
+                                         const Parameter *left_source_param_,
+                                         const Parameter *right_source_param_,
+                                         int num_samples_) noexcept
+{
+    if (coefficients_time_in_ms != smooth_motor_time_in_ms_)
+    {
+        coefficients_time_in_ms = smooth_motor_time_in_ms_;
+
+        left_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+        right_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+        morph_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+
+        left_modulation_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+        right_modulation_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+
+        // LOOKING FORWART TO PROCESS MODUALATION AND AMP MODUALATION
+        modulation_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+        amp_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+    }
+
+    if (force_by_load_)
+    {
+        morph_power_smoother.set_value(morph_power_smoother.get_last_value());
+        // right_morph_smoother.reset( sample_rate, smooth_motor_time_in_ms_ );
+        // left_morph_smoother.reset( sample_rate, smooth_motor_time_in_ms_ );
+    }
+
+    const bool is_modulateable = has_modulation(param_to_smooth);
+    float *const target = values.getWritePointer();
+    if (!is_modulateable)
+    {
+        left_morph_smoother.set_value(left_source_param_->get_value());
+        right_morph_smoother.set_value(right_source_param_->get_value());
+
+        // AUTOMATED MORPH
+        if (is_automated_morph_)
+        {
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                const float power_of_right_ =
+                    morph_power_smoother.glide_tick(morph_amp_buffer_[sid]);
+                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right_) +
+                                            right_morph_smoother.tick() * power_of_right_);
+            }
+            is_settled = false;
+        }
+        // USER MORPH
+        else
+        {
+            morph_power_smoother.set_value(morph_slider_state_);
+            if (left_morph_smoother.is_steady() && right_morph_smoother.is_steady() &&
+                morph_power_smoother.is_steady())
+            {
+                const float power_of_right = morph_power_smoother.get_last_value();
+                const float left = left_morph_smoother.get_last_value();
+                const float right = right_morph_smoother.get_last_value();
+                settle(FORCE_MIN_MAX(left * (1.0f - power_of_right) + right * power_of_right));
+            }
+            else
+            {
+                for (int sid = 0; sid != num_samples_; ++sid)
+                {
+                    const float power_of_right = morph_power_smoother.tick();
+                    target[sid] =
+                        FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right) +
+                                      right_morph_smoother.tick() * power_of_right);
+                }
+                is_settled = false;
+            }
+
+            // KEEP UP TO DATE FOR A SWITCH
+            morph_power_smoother.reset_glide_countdown();
+        }
+    }
+    // ITS A COPY OF THE PROCESS ABOVE BUT WITH MODULATION
+    else
+    {
+        left_morph_smoother.set_value(left_source_param_->get_value());
+        right_morph_smoother.set_value(right_source_param_->get_value());
+
+        left_modulation_morph_smoother.set_value(left_source_param_->get_modulation_amount());
+        right_modulation_morph_smoother.set_value(right_source_param_->get_modulation_amount());
+
+        // AUTOMATED MORPH
+        float *const target_modulation = modulation_power.getWritePointer();
+        if (is_automated_morph_)
+        {
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                const float power_of_right_ =
+                    morph_power_smoother.glide_tick(morph_amp_buffer_[sid]);
+
+                // VALUE
+                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right_) +
+                                            right_morph_smoother.tick() * power_of_right_);
+                // MODULATION
+                target_modulation[sid] =
+                    left_modulation_morph_smoother.tick() * (1.0f - power_of_right_) +
+                    right_modulation_morph_smoother.tick() * power_of_right_;
+            }
+            is_settled = false;
+            is_modulation_settled = false;
+        }
+        // USER MORPH
+        else
+        {
+            morph_power_smoother.set_value(morph_slider_state_);
+            if (left_morph_smoother.is_steady() && right_morph_smoother.is_steady() &&
+                left_modulation_morph_smoother.is_steady() &&
+                right_modulation_morph_smoother.is_steady() && morph_power_smoother.is_steady())
+            {
+                const float power_of_right = morph_power_smoother.get_last_value();
+                const float left = left_morph_smoother.get_last_value();
+                const float right = right_morph_smoother.get_last_value();
+                settle(FORCE_MIN_MAX(left * (1.0f - power_of_right) + right * power_of_right));
+                const float left_modulation = left_modulation_morph_smoother.get_last_value();
+                const float right_modulation = right_modulation_morph_smoother.get_last_value();
+                settle_modulation(left_modulation * (1.0f - power_of_right) +
+                                  right_modulation * power_of_right);
+            }
+            else
+            {
+                for (int sid = 0; sid != num_samples_; ++sid)
+                {
+                    const float power_of_right = morph_power_smoother.tick();
+                    // VALUE BLOCK
+                    target[sid] =
+                        FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right) +
+                                      right_morph_smoother.tick() * power_of_right);
+                    // MODULATION BLOCK
+                    target_modulation[sid] =
+                        left_modulation_morph_smoother.tick() * (1.0f - power_of_right) +
+                        right_modulation_morph_smoother.tick() * power_of_right;
+                }
+                is_settled = false;
+                is_modulation_settled = false;
+            }
+
+            // KEEP UP TO DATE FOR A SWITCH
+            morph_power_smoother.reset_glide_countdown();
+        }
+        param_to_smooth->get_runtime_info().set_last_modulation_state(
+            target_modulation[num_samples_ - 1]);
+    }
+
+    param_to_smooth->get_runtime_info().set_last_value_state(target[num_samples_ - 1]);
+}
+// TOOPD FloatVectorOperations
+inline void SmoothedParameter::process_modulation(const bool is_modulated_,
+                                                  const float *modulator_power_buffer_,
+                                                  int num_samples_) noexcept
+{
+    // modulation_power_smoother.reset_coefficients( sample_rate, glide_motor_time_in_ms_ ); <---
+    // NOTE: DONE BY SMOOTH_AND_MORPH
+
+    float *const source_and_target = values.getWritePointer();
+    const float *const modulation = modulation_power.getReadPointer();
+    if (is_modulated_)
+    {
+        float current_modulation_power;
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            current_modulation_power = modulation[sid] * modulation_power_smoother.glide_tick(
+                                                             modulator_power_buffer_[sid]);
+            const float in = source_and_target[sid];
+            if (current_modulation_power > 0)
+            {
+                source_and_target[sid] = in + (max_value - in) * current_modulation_power;
+                DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
+            }
+            else
+            {
+                source_and_target[sid] = in + (in - min_value) * current_modulation_power;
+                DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
+            }
+        }
+        is_settled = false;
+
+        param_to_smooth->get_runtime_info().set_last_modulation_amount(current_modulation_power);
+    }
+    else
+    {
+        modulation_power_smoother.set_value(0);
+        float current_modulation_power = 0;
+
+        // A STEADY POWER IS THE TARGET 0 (UP TO DATE) OR ITS LAST VALUE, WHICH AT 0 WOULD NOT
+        // CHANGE THE VALUES
+        if (!modulation_power_smoother.is_steady() ||
+            (!modulation_power_smoother.is_up_to_date() &&
+             modulation_power_smoother.get_last_value() != 0))
+        {
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                current_modulation_power = modulation[sid] * modulation_power_smoother.tick();
+                const float in = source_and_target[sid];
+                if (current_modulation_power < 0)
+                {
+                    source_and_target[sid] = in + (in - min_value) * current_modulation_power;
+                    DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
+                }
+                else
+                {
+                    source_and_target[sid] = in + (max_value - in) * current_modulation_power;
+                    DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
+                }
+            }
+            is_settled = false;
+        }
+
+        param_to_smooth->get_runtime_info().set_last_modulation_amount(current_modulation_power);
+
+        // KEEP UP TO DATE FOR A SWITCH
+        modulation_power_smoother.reset_glide_countdown();
+    }
+}
+// TOOPD FloatVectorOperations
+void SmoothedParameter::process_amp(bool use_env_, int glide_time_in_ms_, ENV *env_,
+                                    float *amp_buffer_, int num_samples_) noexcept
+{
+    const float *source = values.getReadPointer();
+    if (use_env_)
+    {
+        env_->process(amp_buffer_, num_samples_);
+
+        if (amp_power_smoother.is_glide_done())
+        {
+            // THE POWER IS THE ENVELOPE ITSELF
+            amp_power_smoother.glide_tick(amp_buffer_[num_samples_ - 1]);
+            if (is_settled)
+            {
+                juce::FloatVectorOperations::multiply(amp_buffer_, settled_value, num_samples_);
+            }
+            else
+            {
+                juce::FloatVectorOperations::multiply(amp_buffer_, source, num_samples_);
+            }
+        }
+        else
+        {
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                const float current_amp_power = amp_power_smoother.glide_tick(amp_buffer_[sid]);
+                amp_buffer_[sid] = source[sid] * current_amp_power;
+                DEBUG_CHECK_MIN_MAX(amp_buffer_[sid]);
+            }
+        }
+
+        param_to_smooth->get_runtime_info().set_last_modulation_amount(
+            amp_buffer_[num_samples_ - 1]);
+
+        amp_power_smoother.set_info_flag(false);
+    }
+    else
+    {
+        if (!amp_power_smoother.get_info_flag())
+        {
+            amp_power_smoother.set_value(1);
+            amp_power_smoother.set_info_flag(true);
+        }
+        if (!amp_power_smoother.is_up_to_date())
+        {
+            env_->process(amp_buffer_, num_samples_);
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                amp_buffer_[sid] = source[sid] * amp_power_smoother.tick();
+                DEBUG_CHECK_MIN_MAX(amp_buffer_[sid]);
+            }
+        }
+        else
+        {
+            if (is_settled)
+            {
+                juce::FloatVectorOperations::fill(amp_buffer_, settled_value, num_samples_);
+            }
+            else
+            {
+                juce::FloatVectorOperations::copy(amp_buffer_, source, num_samples_);
+            }
+
+            // RESET ENVELOP TO BE UP TO DATE ON A SWITCH
+            env_->overwrite_current_value(amp_buffer_[num_samples_ - 1]);
+        }
+
+        param_to_smooth->get_runtime_info().set_last_modulation_amount(
+            amp_buffer_[num_samples_ - 1]);
+
+        // KEEP UP TO DATE FOR A SWITCH
+        amp_power_smoother.reset_glide_countdown();
+    }
+}
+
+//==============================================================================
+void MoniqueSynthesiserVoice::process_render_job(void *voice_, int job_id_) noexcept
+{
+    static_cast<MoniqueSynthesiserVoice *>(voice_)->render_job(job_id_);
+}
+void MoniqueSynthesiserVoice::render_job(int job_id_) noexcept
+{
+    const RenderJobContext &context = render_job_context;
+    const int num_samples = context.num_samples;
+#if MONIQUE_DSP_CHECKS
+    const std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+#endif
+
+    switch (job_id_)
+    {
+    case MORPH_1_JOB:
+    case MORPH_2_JOB:
+    case MORPH_3_JOB:
+    case MORPH_4_JOB:
+    {
+        const int morph_id = job_id_ == MORPH_1_JOB   ? 0
+                             : job_id_ == MORPH_2_JOB ? 1
+                             : job_id_ == MORPH_3_JOB ? 2
+                                                      : 3;
+        MorphGroup *const morph_groups[SUM_MORPHER_GROUPS] = {
+            synth_data->morph_group_1.get(), synth_data->morph_group_2.get(),
+            synth_data->morph_group_3.get(), synth_data->morph_group_4.get()};
+
+        LFOData *const mfo_data = synth_data->mfo_datas[morph_id];
+        mfo_data->wave_smoother.simple_smooth(context.glide_motor_time, num_samples);
+        mfo_data->phase_shift_smoother.simple_smooth(context.glide_motor_time, num_samples);
+
+        float *const mfo_buffer = data_buffer->mfo_amplitudes.getWritePointer(morph_id);
+        mfos[morph_id]->process(mfo_buffer, context.step_number, context.absolute_step_number,
+                                context.start_sample, num_samples);
+        synth_data->smooth_manager->smooth_and_morph(
+            context.force_by_load, synth_data->is_morph_modulated[morph_id], mfo_buffer,
+            num_samples, context.glide_motor_time, context.morph_motor_time,
+            morph_groups[morph_id]);
+        break;
+    }
+    case LFO_1_JOB:
+    case LFO_2_JOB:
+    case LFO_3_JOB:
+    {
+        const int lfo_id = job_id_ == LFO_1_JOB ? 0 : job_id_ == LFO_2_JOB ? 1 : 2;
+        lfos[lfo_id]->process(data_buffer->lfo_amplitudes.getWritePointer(lfo_id),
+                              context.step_number, context.absolute_step_number,
+                              context.start_sample, num_samples);
+        break;
+    }
+    case MASTER_OSC_JOB:
+        master_osc->process(data_buffer, num_samples);
+        break;
+    case SECOND_OSC_JOB:
+        second_osc->process(data_buffer, num_samples);
+        break;
+    case THIRD_OSC_JOB:
+        third_osc->process(data_buffer, num_samples);
+        break;
+    case FILTER_ENV_1_JOB:
+    case FILTER_ENV_2_JOB:
+    case FILTER_ENV_3_JOB:
+    {
+        const int filter_id = job_id_ == FILTER_ENV_1_JOB   ? 0
+                              : job_id_ == FILTER_ENV_2_JOB ? 1
+                                                            : 2;
+        filter_processors[filter_id]->env->process(
+            data_buffer->filter_env_amps.getWritePointer(filter_id), num_samples);
+        break;
+    }
+    case PREPARE_FILTER_1_JOB:
+    case PREPARE_FILTER_2_JOB:
+    case PREPARE_FILTER_3_JOB:
+        filter_processors[job_id_ - PREPARE_FILTER_1_JOB]->prepare(num_samples);
+        break;
+    case FILTER_1_JOB:
+    case FILTER_2_JOB:
+    case FILTER_3_JOB:
+        filter_processors[job_id_ - FILTER_1_JOB]->process(num_samples);
+        break;
+    default:
+        break;
+    }
+
+#if MONIQUE_DSP_CHECKS
+    if (job_id_ == MASTER_OSC_JOB || job_id_ == SECOND_OSC_JOB || job_id_ == THIRD_OSC_JOB)
+    {
+        add_dsp_stage_ticks(OSC_STAGE, start_ticks);
+    }
+    else if (job_id_ >= PREPARE_FILTER_1_JOB)
+    {
+        add_dsp_stage_ticks(FILTER_STAGE, start_ticks);
+    }
+    else
+    {
+        add_dsp_stage_ticks(MODULATION_STAGE, start_ticks);
+    }
+#endif
+}
+#if MONIQUE_DSP_CHECKS
+void MoniqueSynthesiserVoice::add_dsp_stage_ticks(int stage_, std::int64_t start_ticks_) noexcept
+{
+    dsp_stage_ticks[stage_] += juce::Time::getHighResolutionTicks() - start_ticks_;
+}
+#endif
+
+void MoniqueSynthesiserVoice::render_block(juce::AudioSampleBuffer &output_buffer_,
+                                           int step_number_, int absolute_step_number_,
+                                           int start_sample_, int num_samples_) noexcept
+{
+    const bool render_anything = current_note != -1 || synth_data->audio_processor->amp_painter;
+
+    const int num_samples = num_samples_;
+    if (num_samples == 0)
+    {
+        return;
+    }
+
+    if (step_number_ != -1)
+    {
+        current_step = step_number_;
+    }
+
+    if (Monique_Ui_AmpPainter *amp_painter = synth_data->audio_processor->amp_painter)
+    {
+        amp_painter->calc_new_cycle();
+    }
+
+    // CHECK POSSIBLE BYPASS
+    bool must_process = !bypass_smoother.is_up_to_date() || render_anything;
+    if (!must_process)
+    {
+        must_process =
+            fx_processor->zero_samples_counter < fx_processor->delay.get_max_duration() + 10;
+    }
+    if (!must_process)
+    {
+        must_process = fx_processor->final_env->get_current_stage() != END_ENV;
+    }
+
+    const int glide_motor_time = synth_data->glide_motor_time;
+    const int morph_motor_time = synth_data->morph_motor_time;
+
+    // WORKAROUND TO UPDATE THE MORPH GROUPS
+    const bool force_by_load = synth_data->force_morph_update__load_flag;
+    synth_data->force_morph_update__load_flag = false;
+    /*
+    if( synth_data->force_morph_update__load_flag )
+           {
+               synth_data->force_morph_update__load_flag = false;
+               synth_data->morhp_states[0].notify_value_listeners();
+               synth_data->morhp_states[1].notify_value_listeners();
+               synth_data->morhp_states[2].notify_value_listeners();
+               synth_data->morhp_states[3].notify_value_listeners();
+               synth_data->morhp_switch_states[0].notify_value_listeners();
+               synth_data->morhp_switch_states[1].notify_value_listeners();
+               synth_data->morhp_switch_states[2].notify_value_listeners();
+               synth_data->morhp_switch_states[3].notify_value_listeners();
+           }
+           */
+    synth_data->delay_record_release_smoother.simple_smooth(glide_motor_time, num_samples);
+
+    render_job_context.step_number = step_number_;
+    render_job_context.absolute_step_number = absolute_step_number_;
+    render_job_context.start_sample = start_sample_;
+    render_job_context.num_samples = num_samples;
+    render_job_context.glide_motor_time = glide_motor_time;
+    render_job_context.morph_motor_time = morph_motor_time;
+    render_job_context.force_by_load = force_by_load;
+
+    if (must_process)
+    {
+#ifdef POLY
+        if (synth_data->keytrack_filter_volume[0])
+            filter_volume_tracking_envs[0]->process(
+                synth_data->data_buffer->filter_env_tracking.getWritePointer(0), num_samples);
+        else
+            filter_volume_tracking_envs[0]->reset();
+        if (synth_data->keytrack_filter_volume[1])
+            filter_volume_tracking_envs[1]->process(
+                synth_data->data_buffer->filter_env_tracking.getWritePointer(1), num_samples);
+        else
+            filter_volume_tracking_envs[1]->reset();
+        if (synth_data->keytrack_filter_volume[2])
+            filter_volume_tracking_envs[2]->process(
+                synth_data->data_buffer->filter_env_tracking.getWritePointer(2), num_samples);
+        else
+            filter_volume_tracking_envs[2]->reset();
+#endif
+        {
+            render_graph->process(synth_data->render_in_parallel &&
+                                  num_samples >= mono_RenderGraph::MIN_PARALLEL_BLOCK_SIZE);
+
+#if MONIQUE_DSP_CHECKS
+            const std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+#endif
+            eq_processor->process(num_samples);
+#if MONIQUE_DSP_CHECKS
+            add_dsp_stage_ticks(EQ_STAGE, start_ticks);
+#endif
+        }
+
+        float velocity_to_use = current_velocity;
+        bool is_arp_on = synth_data->arp_sequencer_data->is_on || synth_data->keep_arp_always_on;
+        if (synth_data->keep_arp_always_off)
+        {
+            is_arp_on = false;
+        }
+        float *const velocity_buffer = data_buffer->velocity_buffer.getWritePointer();
+        if (is_arp_on)
+        {
+            const float *const smoothed_arp_step_velocity =
+                synth_data->arp_sequencer_data->velocity_smoothers[current_running_arp_step]
+                    ->get_smoothed_value_buffer();
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                velocity_buffer[sid] = velocity_to_use * smoothed_arp_step_velocity[sid];
+            }
+        }
+        else
+        {
+            juce::FloatVectorOperations::fill(velocity_buffer, velocity_to_use, num_samples_);
+        }
+
+#if MONIQUE_DSP_CHECKS
+        const std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+#endif
+        fx_processor->process(output_buffer_, velocity_buffer, start_sample_, num_samples_);
+#if MONIQUE_DSP_CHECKS
+        add_dsp_stage_ticks(FX_STAGE, start_ticks);
+#endif
+
+        bypass_smoother.set_info_flag(false);
+    }
+    else
+    {
+        // BYPASSED, ONLY THE MORPH GROUPS KEEP MOVING, BY THE JOBS OF THE GRAPH IN THEIR ORDER
+        render_job(MORPH_1_JOB);
+        render_job(MORPH_2_JOB);
+        render_job(MORPH_3_JOB);
+        render_job(MORPH_4_JOB);
+
+        if (!bypass_smoother.get_info_flag())
+        {
+            master_osc->reset();
+            second_osc->reset();
+            third_osc->reset();
+            for (int i = 0; i != SUM_LFOS; ++i)
+            {
+                lfos[i]->reset();
+            }
+            for (int i = 0; i != SUM_MORPHER_GROUPS; ++i)
+            {
+                mfos[i]->reset();
+            }
+            for (int i = 0; i != SUM_FILTERS; ++i)
+            {
+                filter_processors[i]->reset();
+            }
+
+            bypass_smoother.set_info_flag(true);
+        }
+    }
+
+    // VISUALIZE
+    if (Monique_Ui_AmpPainter *amp_painter = synth_data->audio_processor->amp_painter)
+    {
+        amp_painter->add_master_osc(data_buffer->osc_samples.getReadPointer(0),
+                                    data_buffer->osc_switchs.getReadPointer(0), num_samples_);
+        amp_painter->add_osc(1, data_buffer->osc_samples.getReadPointer(1), num_samples_);
+        amp_painter->add_osc(2, data_buffer->osc_samples.getReadPointer(2), num_samples_);
+    }
+
+    // UI INFORMATION
+    for (int i = 0; i != SUM_OSCS; ++i)
+    {
+        synth_data->osc_datas[i]->last_modulation_value =
+            data_buffer->lfo_amplitudes.getReadPointer(i)[num_samples - 1];
+    }
+}
+
+void MoniqueSynthesiserVoice::pitchWheelMoved(int pitch_)
+{
+    pitch_offset =
+        (pitch_ > 0x2000 ? 2.0f / 0x2000 * (pitch_ - 0x2000) : -2.0f / 0x2000 * (0x2000 - pitch_));
+
+    bool is_arp_on = synth_data->arp_sequencer_data->is_on || synth_data->keep_arp_always_on;
+    if (synth_data->keep_arp_always_off)
+    {
+        is_arp_on = false;
+    }
+    float arp_offset = is_arp_on ? arp_sequencer->get_current_tune() : 0;
+    master_osc->update(current_note + arp_offset + pitch_offset, 0);
+    second_osc->update(current_note + arp_offset + pitch_offset, 0);
+    third_osc->update(current_note + arp_offset + pitch_offset, 0);
+}
+
+//==============================================================================
+void MoniqueSynthesiserVoice::reset(bool force) noexcept
+{
+    if (current_note != -1 || force)
+    {
+        current_note = -1;
+        reset_internal();
+        clearCurrentNote();
+    }
+}
+void MoniqueSynthesiserVoice::reset_internal() noexcept
+{
+    arp_sequencer->reset();
+    for (int voice_id = 0; voice_id != SUM_FILTERS; ++voice_id)
+    {
+        filter_processors[voice_id]->reset();
+    }
+    eq_processor->reset();
+    fx_processor->reset();
+    /*
+        master_osc->reset();
+        second_osc->reset();
+        third_osc->reset();
+        */
+}
+void MoniqueSynthesiserVoice::handle_sustain_pedal(bool down_) noexcept
+{
+    is_sustain_pedal_down = down_;
+    if (!down_)
+    {
+        if (stopped_and_sustain_pedal_was_down)
+        {
+            stop_internal();
+        }
+    }
+}
+void MoniqueSynthesiserVoice::handle_sostueno_pedal(bool down_) noexcept
+{
+    is_sostenuto_pedal_down = down_;
+    if (!down_)
+    {
+        if (stopped_and_sostenuto_pedal_was_down)
+        {
+            stop_internal();
+        }
+    }
+}
+void MoniqueSynthesiserVoice::handle_soft_pedal(bool down_) noexcept { is_soft_pedal_down = down_; }
+
+//==============================================================================
+void MoniqueSynthesiserVoice::clear_record_buffer() noexcept
+{
+    fx_processor->delay.clear_record_buffer();
+}
+COLD int MoniqueSynthesiserVoice::start_render_workers() noexcept
+{
+    return render_graph->start_workers();
+}
+float MoniqueSynthesiserVoice::get_filter_env_amp(int filter_id_) const noexcept
+{
+    return filter_processors[filter_id_]->env->get_amp();
+}
+float MoniqueSynthesiserVoice::get_lfo_amp(int lfo_id_) const noexcept
+{
+    return lfos[lfo_id_]->get_current_amp();
+}
+float MoniqueSynthesiserVoice::get_mfo_amp(int lfo_id_) const noexcept
+{
+    return mfos[lfo_id_]->get_current_amp();
+}
+float MoniqueSynthesiserVoice::get_arp_sequence_amp(int step_) const noexcept
+{
+    if (arp_sequencer->get_current_step() == step_)
+    {
+        return fx_processor->final_env->get_amp() * 0.99f + 0.01f;
+    }
+
+    return 0;
+}
+float MoniqueSynthesiserVoice::get_current_frequency() const noexcept
+{
+    return juce::MidiMessage::getMidiNoteInHertz(current_note + arp_sequencer->get_current_tune());
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+void MoniqueSynthesizer::handleSustainPedal(int, bool isDown)
+{
+    voice->handle_sustain_pedal(isDown);
+}
+
+void MoniqueSynthesizer::handleSostenutoPedal(int, bool isDown)
+{
+    voice->handle_sostueno_pedal(isDown);
+}
+
+void MoniqueSynthesizer::handleSoftPedal(int, bool isDown) { voice->handle_soft_pedal(isDown); }
+void MoniqueSynthesizer::handleBankSelect(int controllerValue) noexcept
+{
+    synth_data->set_current_bank(juce::jmin(25, controllerValue));
+}
+void MoniqueSynthesizer::handleProgramChange(int midiChannel, int programNumber)
+{
+    if (programNumber != synth_data->get_current_program())
+    {
+        synth_data->set_current_program(programNumber);
+        if (programNumber == synth_data->get_current_program())
+        {
+            synth_data->load_async();
+        }
+    }
+}
+
+void MoniqueSynthesizer::handleController(int midiChannel, int cc_number_, int cc_value_)
+{
+    switch (cc_number_)
+    {
+    case 0:
+        // FIXME on program change from gui we generate a lot of MIDI CC in messages
+        //       one of these message is a bank select @ channel 12 (0:12:XXX)
+        //       as hot fix bank selects via MIDI CC are disabled for now
+        // handleBankSelect (cc_value_);
+        break;
+    case 0x40:
+        handleSustainPedal(midiChannel, cc_value_ >= 64);
+        break;
+    case 0x42:
+        handleSostenutoPedal(midiChannel, cc_value_ >= 64);
+        break;
+    case 0x43:
+        handleSoftPedal(midiChannel, cc_value_ >= 64);
+        break;
+    default:
+    {
+        Parameter *const learing_param = midi_control_handler->is_learning();
+
+        if (cc_number_ == -99)
+        {
+            cc_number_ = 0; // WE NOW USE PROGRAM CHANGE
+        }
+        const int midi_number = midiChannel == 2 ? cc_number_ + 128 : cc_number_;
+
+        // CONTROL
+        if (!learing_param)
+        {
+            const float pickup_offset = synth_data->midi_pickup_offset;
+            if (!midi_control_handler->dispatch(midi_number, cc_value_, pickup_offset))
+            {
+                // THE ROUTES ARE UPDATED AT THE MOMENT, ASK ALL
+                juce::Array<Parameter *> &paramters = synth_data->get_all_parameters();
+                for (int i = 0; i != paramters.size(); ++i)
+                {
+                    Parameter *const param = paramters.getUnchecked(i);
+                    if (param->midi_control->read_from_if_you_listen(midi_number, cc_value_,
+                                                                     pickup_offset))
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+        // TRAIN
+        else
+        {
+            midi_control_handler->learn_async(midi_number);
+        }
+    }
+    }
+}
+void MoniqueSynthesizer::handlePitchWheel(int /*midiChannel*/, int wheelValue)
+{
+    voice->pitchWheelMoved(wheelValue);
+}
+
+//==============================================================================
+void MoniqueSynthesizer::NoteDownStore::add_note(const juce::MidiMessage &midi_message_,
+                                                 int play_mode_) noexcept
+{
+    if (!notes_down.contains(midi_message_))
+    {
+        notes_down.add(NoteDownStore::MidiMessageCompareable(midi_message_));
+        bool success = false;
+        for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
+        {
+            if (notes_down_order.getUnchecked(i) == nullptr)
+            {
+                notes_down_order.getReference(i) =
+                    new NoteDownStore::MidiMessageCompareable(midi_message_);
+                success = true;
+                break;
+            }
+        }
+        // REPLACE FIRST
+        if (!success)
+        {
+            juce::Array<MidiMessageCompareable *> messages;
+            juce::Array<MidiMessageCompareable *> messagesToKill;
+            for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
+            {
+                if (MidiMessageCompareable *message = notes_down_order.getUnchecked(i))
+                {
+                    messages.add(message);
+                }
+            }
+
+            if (messages.size())
+            {
+                if (play_mode_ == PLAY_MODES::LOW)
+                {
+                    int higest_note = -1;
+                    if (messages.size() == 2)
+                    {
+                        higest_note =
+                            juce::jmax(messages[0]->getNoteNumber(), messages[1]->getNoteNumber());
+                    }
+                    else if (messages.size() == 3)
+                    {
+                        higest_note =
+                            juce::jmax(messages[0]->getNoteNumber(), messages[1]->getNoteNumber(),
+                                       messages[2]->getNoteNumber());
+                    }
+                    else
+                    {
+                        higest_note = messages[0]->getNoteNumber();
+                    }
+                    if (higest_note > midi_message_.getNoteNumber())
+                    {
+                        for (int i = 0; i != messages.size(); ++i)
+                        {
+                            if (messages[i]->getNoteNumber() == higest_note)
+                            {
+                                int working_index = notes_down_order.indexOf(messages[i]);
+                                messagesToKill.add(notes_down_order.getUnchecked(working_index));
+                                notes_down_order.getReference(working_index) =
+                                    new NoteDownStore::MidiMessageCompareable(midi_message_);
+                                break;
+                            }
+                        }
+                    }
+                }
+                else if (play_mode_ == PLAY_MODES::HIGH)
+                {
+                    int lowest_note = 999;
+                    if (messages.size() == 2)
+                    {
+                        lowest_note =
+                            juce::jmax(messages[0]->getNoteNumber(), messages[1]->getNoteNumber());
+                    }
+                    else if (messages.size() == 3)
+                    {
+                        lowest_note =
+                            juce::jmax(messages[0]->getNoteNumber(), messages[1]->getNoteNumber(),
+                                       messages[2]->getNoteNumber());
+                    }
+                    else
+                    {
+                        lowest_note = messages[0]->getNoteNumber();
+                    }
+                    if (lowest_note < midi_message_.getNoteNumber())
+                    {
+                        for (int i = 0; i != messages.size(); ++i)
+                        {
+                            if (messages[i]->getNoteNumber() == lowest_note)
+                            {
+                                int working_index = notes_down_order.indexOf(messages[i]);
+                                messagesToKill.add(notes_down_order.getUnchecked(working_index));
+                                notes_down_order.getReference(working_index) =
+                                    new NoteDownStore::MidiMessageCompareable(midi_message_);
+                                break;
+                            }
+                        }
+                    }
+                }
+                else if (play_mode_ == PLAY_MODES::LIFO)
+                {
+                    for (int i = notes_down.size() - 1; i >= 0; --i)
+                    {
+                        for (int k = 0; k != messages.size(); ++k)
+                        {
+                            if (notes_down.getUnchecked(i).getNoteNumber() ==
+                                messages.getUnchecked(k)->getNoteNumber())
+                            {
+                                int working_index = notes_down_order.indexOf(messages[k]);
+                                messagesToKill.add(notes_down_order.getUnchecked(working_index));
+                                notes_down_order.getReference(working_index) =
+                                    new NoteDownStore::MidiMessageCompareable(midi_message_);
+                                i = -1;
+                                break;
+                            }
+                        }
+                    }
+                }
+                else if (play_mode_ == PLAY_MODES::FIFO)
+                {
+                    for (int i = 0; i < notes_down.size(); ++i)
+                    {
+                        for (int k = 0; k != messages.size(); ++k)
+                        {
+                            if (notes_down.getReference(i).getNoteNumber() ==
+                                messages.getUnchecked(k)->getNoteNumber())
+                            {
+                                int working_index = notes_down_order.indexOf(messages[k]);
+                                messagesToKill.add(notes_down_order.getUnchecked(working_index));
+                                notes_down_order.getReference(working_index) =
+                                    new NoteDownStore::MidiMessageCompareable(midi_message_);
+                                i = notes_down.size();
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+
+            for (int i = 0; i != messagesToKill.size(); ++i)
+            {
+                delete messagesToKill.getUnchecked(i);
+            }
+        }
+    }
+}
+const juce::MidiMessage *
+MoniqueSynthesizer::NoteDownStore::remove_note(const juce::MidiMessage &midi_message_,
+                                               int play_mode_, bool reorder_allowed_) noexcept
+{
+    notes_down.removeFirstMatchingValue(midi_message_);
+    for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
+    {
+        if (juce::MidiMessage *message = notes_down_order.getUnchecked(i))
+        {
+            if (message->getNoteNumber() == midi_message_.getNoteNumber())
+            {
+                if (reorder_allowed_)
+                {
+                    notes_down_order.getReference(i) = get_replacement(*message, play_mode_, i);
+                }
+                else
+                {
+                    notes_down_order.getReference(i) = nullptr;
+                }
+                delete message;
+                return notes_down_order.getUnchecked(i);
+            }
+        }
+    }
+
+    return nullptr;
+}
+MoniqueSynthesizer::NoteDownStore::MidiMessageCompareable *
+MoniqueSynthesizer::NoteDownStore::get_replacement(const juce::MidiMessage &message_,
+                                                   int play_mode_, int index_) noexcept
+{
+    juce::Array<MidiMessageCompareable *> messages;
+    if (MidiMessageCompareable *message = notes_down_order.getUnchecked(0))
+    {
+        messages.add(message);
+    }
+    if (MidiMessageCompareable *message = notes_down_order.getUnchecked(1))
+    {
+        messages.add(message);
+    }
+    if (MidiMessageCompareable *message = notes_down_order.getUnchecked(2))
+    {
+        messages.add(message);
+    }
+
+    int index_of_return = -1;
+    if (play_mode_ == PLAY_MODES::LOW)
+    {
+        int lowest_note = 999;
+        for (int i = 0; i != notes_down.size(); ++i)
+        {
+            const MidiMessageCompareable &message = notes_down.getReference(i);
+            if (message.getNoteNumber() < lowest_note)
+            {
+                bool contains = false;
+                for (int k = 0; k != messages.size(); ++k)
+                {
+                    if (messages.getUnchecked(k)->getNoteNumber() == message.getNoteNumber())
+                    {
+                        contains = true;
+                        break;
+                    }
+                }
+                if (!contains)
+                {
+                    lowest_note = message.getNoteNumber();
+                    index_of_return = i;
+                }
+            }
+        }
+    }
+    else if (play_mode_ == PLAY_MODES::HIGH)
+    {
+        int higest_note = -999;
+        for (int i = 0; i != notes_down.size(); ++i)
+        {
+            const MidiMessageCompareable &message = notes_down.getReference(i);
+            if (message.getNoteNumber() > higest_note)
+            {
+                bool contains = false;
+                for (int k = 0; k != messages.size(); ++k)
+                {
+                    if (messages.getUnchecked(k)->getNoteNumber() == message.getNoteNumber())
+                    {
+                        contains = true;
+                        break;
+                    }
+                }
+                if (!contains)
+                {
+                    higest_note = message.getNoteNumber();
+                    index_of_return = i;
+                }
+            }
+        }
+    }
+    else if (play_mode_ == PLAY_MODES::LIFO)
+    {
+        for (int i = notes_down.size() - 1; i >= 0; --i)
+        {
+            bool contains = false;
+            for (int k = 0; k != messages.size(); ++k)
+            {
+                if (notes_down.getReference(i).getNoteNumber() ==
+                    messages.getUnchecked(k)->getNoteNumber())
+                {
+                    contains = true;
+                    break;
+                }
+            }
+            if (!contains)
+            {
+                index_of_return = i;
+                break;
+            }
+        }
+    }
+    else if (play_mode_ == PLAY_MODES::FIFO)
+    {
+        for (int i = notes_down.size() - 1; i >= 0; --i)
+        {
+            bool contains = false;
+            for (int k = 0; k != messages.size(); ++k)
+            {
+                if (notes_down.getReference(i).getNoteNumber() ==
+                    messages.getUnchecked(k)->getNoteNumber())
+                {
+                    contains = true;
+                    break;
+                }
+            }
+            if (!contains)
+            {
+                index_of_return = i;
+                break;
+            }
+        }
+    }
+
+    if (index_of_return > -1)
+    {
+        return new NoteDownStore::MidiMessageCompareable(notes_down.getUnchecked(index_of_return));
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+void MoniqueSynthesizer::NoteDownStore::reset() noexcept
+{
+    notes_down.clearQuick();
+    for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
+    {
+        if (juce::MidiMessage *message = notes_down_order.getUnchecked(i))
+        {
+            delete message;
+            notes_down_order.getReference(i) = nullptr;
+        }
+    }
+}
+bool MoniqueSynthesizer::NoteDownStore::is_empty() const noexcept { return notes_down.size() == 0; }
+const juce::MidiMessage *MoniqueSynthesizer::NoteDownStore::get_last() const noexcept
+{
+    if (notes_down.size() > 0)
+    {
+        return &notes_down.getReference(notes_down.size() - 1);
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+const int
+MoniqueSynthesizer::NoteDownStore::get_id(const juce::MidiMessage &message_) const noexcept
+{
+    for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
+    {
+        if (juce::MidiMessage *message = notes_down_order.getUnchecked(i))
+        {
+            if (message_.getNoteNumber() == message->getNoteNumber())
+            {
+                return i;
+            }
+        }
+    }
+
+    return -1;
+}
+const int MoniqueSynthesizer::NoteDownStore::get_id(int note_number_) const noexcept
+{
+    for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
+    {
+        if (juce::MidiMessage *message = notes_down_order.getUnchecked(i))
+        {
+            if (note_number_ == message->getNoteNumber())
+            {
+                return i;
+            }
+        }
+    }
+
+    return -1;
+}
+const juce::MidiMessage *MoniqueSynthesizer::NoteDownStore::get_at(int index_) const noexcept
+{
+    if (index_ < 0 || index_ >= notes_down_order.size())
+    {
+        return nullptr;
+    }
+    else
+    {
+        return notes_down_order.getUnchecked(index_);
+    }
+}
+void MoniqueSynthesizer::NoteDownStore::swap(int index_a_, int index_b_) noexcept
+{
+    notes_down_order.swap(index_a_, index_b_);
+}
+MoniqueSynthesizer::NoteDownStore::NoteDownStore(MoniqueSynthData *const synth_data_) noexcept
+    : synth_data(synth_data_)
+{
+    for (int i = 0; i != MAX_PLAYBACK_NOTES; ++i)
+    {
+        notes_down_order.add(nullptr);
+    }
+}
+MoniqueSynthesizer::NoteDownStore::~NoteDownStore() noexcept {}
+
+void MoniqueSynthesizer::render_next_block(juce::AudioBuffer<float> &outputAudio,
+                                           const juce::MidiBuffer &inputMidi, int startSample,
+                                           int numSamples) noexcept
+{
+    process_next_block(outputAudio, inputMidi, startSample, numSamples);
+}
+void MoniqueSynthesizer::render_next_block(juce::AudioBuffer<double> &outputAudio,
+                                           const juce::MidiBuffer &inputMidi, int startSample,
+                                           int numSamples) noexcept
+{
+    // NOT USED
+}
+void MoniqueSynthesizer::process_next_block(juce::AudioBuffer<float> &outputAudio,
+                                            const juce::MidiBuffer &inputMidi, int startSample,
+                                            int numSamples)
+{
+    juce::MidiBuffer::Iterator midiIterator(inputMidi);
+    midiIterator.setNextSamplePosition(startSample);
+
+    int midiEventPos;
+    juce::MidiMessage m;
+
+    const juce::ScopedLock sl(lock);
+
+    synth_data->read_pending_program();
+    voice->start_block();
+    handle_queued_events(startSample);
+
+    int program_chnage_counter_temp = synth_data->changed_programm;
+    if (program_chnage_counter_temp != program_chnage_counter)
+    {
+        program_chnage_counter = program_chnage_counter_temp;
+        if (synth_data->arp_was_on_before_change)
+        {
+            // voice->reset_internal();
+
+            voice->eq_processor->start_release();
+            voice->fx_processor->start_release(false, false);
+
+            for (int i = 0; i != 3; ++i)
+            {
+                voice->filter_processors[i]->start_env_release();
+                voice->filter_processors[i]->start_input_env_release(0);
+                voice->filter_processors[i]->start_input_env_release(1);
+                voice->filter_processors[i]->start_input_env_release(2);
+#ifdef POLY
+                voice->filter_volume_tracking_envs[i]->set_to_release();
+#endif
+            }
+        }
+        // synth_data->arp_was_on_before_change = false;
+        // int note_before_change = synth_data->current_note_before_change;
+        // synth_data->current_note_before_change = -1;
+        // if (synth_data->keep_arp_always_on == false && arp_was_on_before_change&&
+        // synth_data->arp_sequencer_data->is_on == false)
+        //{
+        //		voice->reset();
+        //}
+        // else if (arp_was_on_before_change && note_before_change == -1)
+        //{
+        //	bool is_any_step_on = false;
+        //	for (int i = 0; i != 16; ++i)
+        //	{
+        //		bool is_on = synth_data->arp_sequencer_data->step[i];
+        //		if (is_on)
+        //		{
+        //			is_any_step_on = true;
+        //			break;
+        //		}
+        //	}
+        //	if (is_any_step_on )
+        //	{
+        //		//voice->reset_internal();
+        //	}
+        //	//voice->reset();
+        //}
+        // else
+        //{
+        //	if (note_down_store.size() == 0 )
+        //	{
+        //		voice->reset();
+        //	}
+        //	else
+        //	{
+        //		bool is_any_step_on = false;
+        //		for (int i = 0; i != 16; ++i)
+        //		{
+        //			bool is_on = synth_data->arp_sequencer_data->step[i];
+        //			if (is_on)
+        //			{
+        //				is_any_step_on = true;
+        //				break;
+        //			}
+        //		}
+        //		if (is_any_step_on )
+        //		{
+        //			voice->reset_internal();
+        //		}
+        //	}
+        //}
+    }
+
+    // RENDER UP TO EACH EVENT, EVENTS CLOSER THAN minimum_sub_block_size ARE HANDLED TOGETHER
+    const int num_block_samples = numSamples;
+    bool is_first_event = true;
+    while (numSamples > 0)
+    {
+        if (!midiIterator.getNextEvent(m, midiEventPos))
+        {
+            renderVoices(outputAudio, startSample, numSamples);
+            numSamples = 0;
+            break;
+        }
+
+        const int samplesToNextMidiMessage = midiEventPos - startSample;
+
+        if (samplesToNextMidiMessage >= numSamples)
+        {
+            renderVoices(outputAudio, startSample, numSamples);
+            handle_midi_event(m, midiEventPos);
+            numSamples = 0;
+            break;
+        }
+
+        if (samplesToNextMidiMessage < (is_first_event ? 1 : minimum_sub_block_size))
+        {
+            handle_midi_event(m, midiEventPos);
+            continue;
+        }
+
+        is_first_event = false;
+
+        renderVoices(outputAudio, startSample, samplesToNextMidiMessage);
+        handle_midi_event(m, midiEventPos);
+        startSample += samplesToNextMidiMessage;
+        numSamples -= samplesToNextMidiMessage;
+    }
+
+    while (midiIterator.getNextEvent(m, midiEventPos))
+    {
+        handle_midi_event(m, midiEventPos);
+    }
+
+    voice->end_block(num_block_samples);
+}
+bool MoniqueSynthesizer::queue_event(const juce::MidiMessage &message_) noexcept
+{
+    int start1, size1, start2, size2;
+    queued_events_fifo.prepareToWrite(1, start1, size1, start2, size2);
+    if (size1 + size2 == 0)
+    {
+        return false;
+    }
+
+    queued_events[size1 ? start1 : start2] = message_;
+    queued_events_fifo.finishedWrite(1);
+    return true;
+}
+void MoniqueSynthesizer::handle_queued_events(int pos_in_buffer_) noexcept
+{
+    if (is_note_down_store_reset_queued.exchange(false))
+    {
+        note_down_store.reset();
+    }
+
+    int start1, size1, start2, size2;
+    queued_events_fifo.prepareToRead(queued_events_fifo.getNumReady(), start1, size1, start2,
+                                     size2);
+    for (int i = 0; i != size1; ++i)
+    {
+        handle_midi_event(queued_events[start1 + i], pos_in_buffer_);
+    }
+    for (int i = 0; i != size2; ++i)
+    {
+        handle_midi_event(queued_events[start2 + i], pos_in_buffer_);
+    }
+    queued_events_fifo.finishedRead(size1 + size2);
+}
+
+void MoniqueSynthesizer::handle_midi_event(const juce::MidiMessage &m, int pos_in_buffer_)
+{
+    const int channel = m.getChannel();
+    voice->event_sample_position = pos_in_buffer_;
+
+    if (m.isNoteOn())
+    {
+#ifdef POLY
+        const int play_mode =
+            synth_data->keytrack_osci_play_mode == 2 ? PLAY_MODES::FIFO : PLAY_MODES::LIFO;
+#else
+        const int play_mode = PLAY_MODES::LIFO;
+#endif
+        note_down_store.add_note(m, play_mode);
+        noteOn(channel, m.getNoteNumber(), m.getFloatVelocity());
+
+        /* RETUNE
+            if( note_down_store.size() == 1 )
+            {
+                noteOn (channel, m.getNoteNumber(), m.getFloatVelocity());
+            }
+            else if( note_down_store.size() == 2 )
+            {
+                const bool is_arp_on = synth_data->arp_sequencer_data->is_on ||
+           synth_data->keep_arp_always_on; const float arp_offset = is_arp_on ?
+           voice->arp_sequencer->get_current_tune() : 0;
+                synth_data->osc_datas[1]->tune.set_value((voice->current_note-m.getNoteNumber())*-1);
+                const float note = voice->current_note + synth_data->osc_datas[1]->tune
+           +arp_offset+voice->pitch_offset; voice->second_osc->update( note, pos_in_buffer_ );
+            }
+            else if( note_down_store.size() == 3 )
+            {
+                const bool is_arp_on = synth_data->arp_sequencer_data->is_on ||
+           synth_data->keep_arp_always_on; const float arp_offset = is_arp_on ?
+           voice->arp_sequencer->get_current_tune() : 0;
+                synth_data->osc_datas[2]->tune.set_value((voice->current_note-m.getNoteNumber())*-1);
+                const float note = voice->current_note + synth_data->osc_datas[2]->tune
+           +arp_offset+voice->pitch_offset; voice->third_osc->update( note, pos_in_buffer_ );
+            }
+            */
+    }
+    else if (m.isNoteOff())
+    {
+        voice->stop_controlled(m, pos_in_buffer_);
+    }
+    else if (m.isAllNotesOff() || m.isAllSoundOff())
+    {
+        allNotesOff(channel, true);
+    }
+    else if (m.isPitchWheel())
+    {
+        const int wheelPos = m.getPitchWheelValue();
+        lastPitchWheelValues[channel - 1] = wheelPos;
+        handlePitchWheel(channel, wheelPos);
+    }
+    else if (m.isAftertouch())
+    {
+        handleAftertouch(channel, m.getNoteNumber(), m.getAfterTouchValue());
+    }
+    else if (m.isChannelPressure())
+    {
+        handleChannelPressure(channel, m.getChannelPressureValue());
+    }
+    else if (m.isController())
+    {
+        handleController(channel, m.getControllerNumber(), m.getControllerValue());
+    }
+    else if (m.isProgramChange())
+    {
+        handleProgramChange(channel, m.getProgramChangeNumber());
+    }
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+COLD MoniqueSynthesiserSound::MoniqueSynthesiserSound() noexcept {}
+COLD MoniqueSynthesiserSound::~MoniqueSynthesiserSound() noexcept {}
+
+//==============================================================================
+bool MoniqueSynthesiserSound::appliesToNote(int) { return true; }
+bool MoniqueSynthesiserSound::appliesToChannel(int) { return true; }
+
+//==============================================================================
+// THE ENV AND MFO CURVES ARE RENDERED AT A RATE WHICH GIVES ABOUT ONE POINT PER DRAWN STEP
+// INSTEAD OF ONE POINT PER SAMPLE. THE STAGE TIMES AND PHASES ARE IN MS, SO THE SHAPE STAYS.
+void MoniqueSynthData::get_full_adstr(ENVData &env_data_, CurvePreview &curve_) noexcept
+{
+    const double host_sample_rate = runtime_notifyer->get_sample_rate();
+    if (!curve_.set_inputs({float(host_sample_rate), env_data_.attack.get_value(),
+                            env_data_.decay.get_value(), env_data_.sustain_time.get_value(),
+                            env_data_.release.get_value(),
+                            env_data_.sustain_smoother.get_smoothed_value_buffer()[0],
+                            env_data_.shape_smoother.get_smoothed_value_buffer()[0]}))
+    {
+        return;
+    }
+
+    // THE SUSTAIN IS SHOWN FOR ONE SECOND, A LIMITED SUSTAIN RETRIGGERS THE ATTACK IN THIS TIME
+    static constexpr float SUSTAIN_PREVIEW_MS = 1000;
+    const float attack_ms = get_env_ms(env_data_.attack);
+    const float decay_ms = env_data_.decay > 0 ? get_env_ms(env_data_.decay) : 0;
+    float length_ms = attack_ms + decay_ms + SUSTAIN_PREVIEW_MS + get_env_ms(env_data_.release);
+    if (env_data_.sustain_time < 1)
+    {
+        length_ms +=
+            (attack_ms + decay_ms) * SUSTAIN_PREVIEW_MS / get_env_ms(env_data_.sustain_time);
+    }
+
+    // HALF OF THE POINTS, THE OTHER HALF IS SPACE FOR THE MIN STAGE LENGTHS
+    const double preview_sample_rate =
+        juce::jmin(host_sample_rate, CurvePreview::MAX_POINTS / 2 * 1000.0 / length_ms);
+    const int release_points = int(get_env_samples(env_data_.release, preview_sample_rate)) + 1;
+
+    ENV env(nullptr, this, &env_data_, sine_lookup, cos_lookup, exp_lookup);
+    env.set_preview_sample_rate(preview_sample_rate);
+    env.start_attack();
+    int count_sustain = msToSamplesFast(SUSTAIN_PREVIEW_MS, preview_sample_rate);
+    int num_points = 0;
+    while (env.get_current_stage() != END_ENV && num_points != CurvePreview::MAX_POINTS)
+    {
+        env.process(curve_.points + num_points, 1);
+        ++num_points;
+
+        if (env.get_current_stage() == SUSTAIN)
+        {
+            if (--count_sustain <= 0 || num_points >= CurvePreview::MAX_POINTS - release_points)
+            {
+                env.set_to_release();
+            }
+        }
+    }
+    curve_.num_points = num_points;
+}
+void MoniqueSynthData::get_full_mfo(LFOData &mfo_data_, CurvePreview &curve_,
+                                    MoniqueSynthData *data_) noexcept
+{
+    const double host_sample_rate = runtime_notifyer->get_sample_rate();
+    const int block_size = juce::jmax(1, runtime_notifyer->get_block_size() / 2);
+    const bool is_extern_synced =
+        is_standalone() && runtime_info->standalone_features_pimpl->is_extern_synced;
+    const bool has_changed = curve_.set_inputs(
+        {float(host_sample_rate), float(block_size), float(mfo_data_.speed.get_value()),
+         mfo_data_.wave_smoother.get_smoothed_value_buffer()[0],
+         mfo_data_.phase_shift_smoother.get_smoothed_value_buffer()[0], float(runtime_info->bpm)});
+
+    // THE EXTERN CLOCK CAN MOVE WITHOUT ANY CHANGED INPUT
+    if (!has_changed && !is_extern_synced)
+    {
+        return;
+    }
+
+    // TWO SECONDS, WITHOUT THE FIRST ELEVEN BLOCKS
+    const std::int64_t first_sample = 1 + 11 * block_size;
+    const std::int64_t num_samples =
+        juce::jmax(std::int64_t(1), std::int64_t(host_sample_rate * 2) - first_sample);
+
+    LFO mfo(nullptr, this, &mfo_data_, sine_lookup);
+    if (!is_extern_synced)
+    {
+        // THE PERFECT SYNC IS A FUNCTION OF THE TIME, SO WE RENDER IT AT THE POINT RATE
+        const double points_per_sample = double(CurvePreview::MAX_POINTS) / num_samples;
+        mfo.set_preview_sample_rate(host_sample_rate * points_per_sample);
+        const int first_point = int(first_sample * points_per_sample);
+        for (int point = 0; point < CurvePreview::MAX_POINTS; point += block_size)
+        {
+            const int num_points = juce::jmin(block_size, CurvePreview::MAX_POINTS - point);
+            mfo.process(curve_.points + point, -1, 1, first_point + point, num_points, false);
+        }
+        curve_.num_points = CurvePreview::MAX_POINTS;
+    }
+    else
+    {
+        // THE EXTERN CLOCKS ARE IN SAMPLES, SO WE RENDER AT THE SAMPLE RATE AND KEEP THE LAST
+        // SAMPLE OF EACH POINT
+        mfo.set_preview_sample_rate(host_sample_rate);
+        juce::Array<RuntimeInfo::standalone_features::ClockSync::SyncPosPair>
+            clock_sync_information =
+                runtime_info->standalone_features_pimpl->clock_sync_information
+                    .get_a_working_copy();
+
+        static constexpr int MAX_BLOCK_SIZE = 256;
+        float block[MAX_BLOCK_SIZE];
+        const int num_block_samples = juce::jmin(block_size, MAX_BLOCK_SIZE);
+        const std::int64_t last_sample = first_sample + num_samples;
+        const int num_points = int(juce::jmin(std::int64_t(CurvePreview::MAX_POINTS), num_samples));
+        for (std::int64_t sample = 1; sample < last_sample; sample += num_block_samples)
+        {
+            const int num_samples_to_process =
+                int(juce::jmin(std::int64_t(num_block_samples), last_sample - sample));
+            mfo.process(block, -1, 1, int(sample), num_samples_to_process, false,
+                        &clock_sync_information);
+            for (int sid = 0; sid != num_samples_to_process; ++sid)
+            {
+                const std::int64_t curve_sample = sample + sid - first_sample;
+                if (curve_sample >= 0)
+                {
+                    curve_.points[curve_sample * num_points / num_samples] = block[sid];
+                }
+            }
+        }
+        curve_.num_points = num_points;
+    }
+}
+bool MoniqueSynthData::is_key_down(int id) const noexcept
+{
+    return reinterpret_cast<MoniqueSynthesizer::NoteDownStore *>(voice->note_down_store)
+        ->get_at(id);
+}
+float MoniqueSynthData::get_tracking_env_state(int id) const noexcept
+{
+#ifdef POLY
+    return voice->filter_volume_tracking_envs[id]->get_amp();
+#else
+    return 0;
+#endif
+}
+
+//==============================================================================
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// DSP SELF CHECKS, RUN BY monique-render --check <name> AND BY CTEST
+// Each check runs a stage against a reference (the original or the per sample code path),
+// prints the measured error and timing and fails if the error is out of its bound.
+#if MONIQUE_DSP_CHECKS
+#include <complex>
+#include <cstdio>
+#include <deque>
+
+juce::AudioProcessor *JUCE_CALLTYPE createPluginFilter();
+
+namespace dsp_checks
+{
+static inline double get_ms_since(std::int64_t start_ticks_) noexcept
+{
+    return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() -
+                                                    start_ticks_) *
+           1000;
+}
+
+//==============================================================================
+// ENERGY OF THE DIFFERENCE OF TWO SIGNALS WITH num_cycles_ PERIODS IN num_samples_ IN THEIR
+// HARMONICS BELOW max_frequency_, dB RELATIVE TO THE ENERGY OF THE REFERENCE IN THE SAME HARMONICS
+static double get_harmonics_error_db(const float *reference_, const float *signal_,
+                                     int num_cycles_, int num_samples_, double sample_rate_,
+                                     double max_frequency_) noexcept
+{
+    juce::HeapBlock<std::complex<double>> twiddles(num_samples_);
+    for (int i = 0; i != num_samples_; ++i)
+    {
+        twiddles[i] = std::polar(1.0, -juce::MathConstants<double>::twoPi * i / num_samples_);
+    }
+
+    double sum_reference = 0;
+    double sum_error = 0;
+    const double frequency = sample_rate_ * num_cycles_ / num_samples_;
+    for (int harmonic = 1;
+         harmonic * frequency < max_frequency_ && harmonic * num_cycles_ < num_samples_ / 2;
+         ++harmonic)
+    {
+        const std::int64_t bin = std::int64_t(harmonic) * num_cycles_;
+        std::complex<double> reference = 0;
+        std::complex<double> error = 0;
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            const std::complex<double> &twiddle = twiddles[int(bin * sid % num_samples_)];
+            reference += twiddle * double(reference_[sid]);
+            error += twiddle * (double(signal_[sid]) - double(reference_[sid]));
+        }
+        sum_reference += std::norm(reference);
+        sum_error += std::norm(error);
+    }
+    return 10 * std::log10(juce::jmax(sum_error, 1e-30) / juce::jmax(sum_reference, 1e-30));
+}
+
+//==============================================================================
+// THE BAND LIMITED TABLE SAW AND SQUARE AGAINST THE ORIGINAL BLIT, IN THE AUDIBLE BAND
+static bool check_osc_tables(MoniqueAudioProcessor &processor_) noexcept
+{
+#if MONIQUE_BANDLIMITED_TABLE_OSCILLATORS
+    // THE BOUND GROWS WITH THE FUNDAMENTAL: A LEVEL TILTS ITS PARTIALS FOR ONE NOMINAL CYCLE
+    // LENGTH, AND THE FEWER HARMONICS A LEVEL HAS, THE WIDER THE RANGE OF LENGTHS IT PLAYS
+    struct Bound
+    {
+        double max_fundamental;
+        double max_error_db;
+    };
+    static constexpr Bound bounds[] = {{1000, -44}, {2000, -40}, {5000, -33}, {8000, -22}};
+    static constexpr double MAX_FREQUENCY = 16000;
+    static constexpr int ANALYSIS_SAMPLES = 16384;
+    enum OUTPUTS
+    {
+        BLIT_SAW,
+        BLIT_SQUARE,
+        TABLE_SAW,
+        TABLE_SQUARE,
+
+        SUM_OUTPUTS
+    };
+
+    const double sample_rate = processor_.getSampleRate();
+    PerfectCycleCounter cycle_counter(processor_.runtime_notifyer);
+
+    bool passed = true;
+    double blit_ms = 0;
+    double table_ms = 0;
+    std::int64_t sum_samples = 0;
+    std::printf("table oscillators against the BLIT, error in the harmonics under %.0f Hz\n",
+                MAX_FREQUENCY);
+    const Bound *bound = bounds;
+    int last_num_cycles = 0;
+    for (double frequency = 20; frequency < 8000; frequency *= 1.12)
+    {
+        while (frequency > bound->max_fundamental)
+        {
+            ++bound;
+        }
+
+        // AN ODD NUMBER OF CYCLES IN THE WINDOW PUTS THE HARMONICS ON ANALYSIS BINS, WITHOUT
+        // SAMPLES ON THE SAME PHASES. THE INTEGRATORS SETTLE FOR A SECOND.
+        const int num_samples = ANALYSIS_SAMPLES;
+        const int num_cycles = int(frequency * num_samples / sample_rate / 2) * 2 + 1;
+        if (num_cycles == last_num_cycles)
+        {
+            continue;
+        }
+        last_num_cycles = num_cycles;
+        const int num_settle_samples = int(sample_rate);
+        const double cycle_frequency = sample_rate * num_cycles / num_samples;
+        juce::HeapBlock<float> outputs(SUM_OUTPUTS * num_samples);
+        float *const blit_saws = outputs + BLIT_SAW * num_samples;
+        float *const blit_squares = outputs + BLIT_SQUARE * num_samples;
+        float *const table_saws = outputs + TABLE_SAW * num_samples;
+        float *const table_squares = outputs + TABLE_SQUARE * num_samples;
+
+        cycle_counter.set_frequency(cycle_frequency);
+        const double samples_per_cycle = cycle_counter.get_cylces_per_sec();
+
+        mono_BlitSaw blit_saw;
+        mono_BlitSquare blit_square;
+        blit_saw.updateHarmonics(samples_per_cycle);
+        blit_square.updateHarmonics(samples_per_cycle);
+        cycle_counter.reset();
+        std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+        for (int sid = -num_settle_samples; sid != num_samples; ++sid)
+        {
+            cycle_counter.tick();
+            const float saw = blit_saw.tick(cycle_counter.get_last_phase());
+            const float square = blit_square.tick(cycle_counter.get_last_angle());
+            if (sid >= 0)
+            {
+                blit_saws[sid] = saw;
+                blit_squares[sid] = square;
+            }
+        }
+        blit_ms += get_ms_since(start_ticks);
+
+        // THE PHASE SCALES OF mono_OscWaves: THE TABLES READ CYCLES, THE SAW PHASE RUNS AT HALF
+        // SPEED
+        mono_TableWave table_saw(true);
+        mono_TableWave table_square(false);
+        table_saw.updateHarmonics(samples_per_cycle);
+        table_square.updateHarmonics(samples_per_cycle);
+        cycle_counter.reset();
+        start_ticks = juce::Time::getHighResolutionTicks();
+        for (int sid = -num_settle_samples; sid != num_samples; ++sid)
+        {
+            cycle_counter.tick();
+            const float saw =
+                table_saw.tick(cycle_counter.get_last_phase() / juce::MathConstants<double>::pi);
+            const float square = table_square.tick(cycle_counter.get_last_angle() /
+                                                   juce::MathConstants<double>::twoPi);
+            if (sid >= 0)
+            {
+                table_saws[sid] = saw;
+                table_squares[sid] = square;
+            }
+        }
+        table_ms += get_ms_since(start_ticks);
+        sum_samples += num_settle_samples + num_samples;
+
+        const double saw_error_db = get_harmonics_error_db(
+            blit_saws, table_saws, num_cycles, num_samples, sample_rate, MAX_FREQUENCY);
+        const double square_error_db = get_harmonics_error_db(
+            blit_squares, table_squares, num_cycles, num_samples, sample_rate, MAX_FREQUENCY);
+        const bool is_in_bound =
+            saw_error_db < bound->max_error_db && square_error_db < bound->max_error_db;
+        passed = passed && is_in_bound;
+        std::printf("  %7.1f Hz: saw %6.1f dB, square %6.1f dB, bound %4.0f dB%s\n",
+                    cycle_frequency, saw_error_db, square_error_db, bound->max_error_db,
+                    is_in_bound ? "" : "  FAILED");
+    }
+    std::printf("saw + square per sample: BLIT %.1f ns, tables %.1f ns\n",
+                blit_ms * 1e6 / double(sum_samples), table_ms * 1e6 / double(sum_samples));
+    return passed;
+#else
+    juce::ignoreUnused(processor_);
+    std::printf("skipped, built with the BLIT oscillators\n");
+    return true;
+#endif
+}
+
+//==============================================================================
+// THE BLOCK PASSES OF THE OSC WAVES AND FM AGAINST THE SAME PASSES CALLED FOR EVERY SAMPLE ON
+// ITS OWN, THE ORDER OF THE OLD PER SAMPLE LOOP OF MasterOSC AND SecondOSC. THE WAVE MORPH STAYS
+// BELOW THE NOISE, THE NOISE GENERATORS ARE NOT SEEDED.
+static bool check_osc_blocks(MoniqueAudioProcessor &processor_) noexcept
+{
+    static constexpr float MAX_ERROR = 1e-5f;
+    static constexpr int NUM_BLOCKS = 2000;
+    enum INPUTS
+    {
+        WAVE_FORMS,
+        PHASE_OFFSETS,
+        FM_AMOUNTS,
+        FM_SHAPES,
+        MODULATOR,
+        BLOCK_OUTPUT,
+        SAMPLE_OUTPUT,
+
+        SUM_INPUTS
+    };
+
+    const int block_size = processor_.getBlockSize();
+    const float *const sine_lookup = processor_.synth_data->sine_lookup;
+    PerfectCycleCounter cycle_counter(processor_.runtime_notifyer);
+    mono_OscWaves block_waves(sine_lookup, block_size);
+    mono_OscWaves sample_waves(sine_lookup, block_size);
+
+    mono_AudioSampleBuffer<SUM_INPUTS> buffers(block_size);
+    float *const wave_forms = buffers.getWritePointer(WAVE_FORMS);
+    float *const phase_offsets = buffers.getWritePointer(PHASE_OFFSETS);
+    float *const fm_amounts = buffers.getWritePointer(FM_AMOUNTS);
+    float *const fm_shapes = buffers.getWritePointer(FM_SHAPES);
+    float *const modulator = buffers.getWritePointer(MODULATOR);
+    float *const block_output = buffers.getWritePointer(BLOCK_OUTPUT);
+    float *const sample_output = buffers.getWritePointer(SAMPLE_OUTPUT);
+    juce::HeapBlock<double> phases(block_size);
+    juce::HeapBlock<double> angles(block_size);
+    juce::HeapBlock<double> samples_per_cycle(block_size);
+    juce::HeapBlock<bool> holds(block_size);
+
+    juce::Random random(1);
+    float max_error = 0;
+    double block_ms = 0;
+    double sample_ms = 0;
+    for (int block = 0; block != NUM_BLOCKS; ++block)
+    {
+        // A GLIDING PITCH, A WAVE MORPH OVER ONE OR MORE PAIRS, OPTIONAL OFFSETS, FM AND HOLDS
+        const float wave_start = random.nextFloat() * 2;
+        const float wave_end = random.nextInt(3) == 0 ? wave_start : random.nextFloat() * 2;
+        const bool has_phase_offsets = random.nextBool();
+        const bool has_holds = random.nextInt(4) == 0;
+        const float fm_amount = random.nextInt(3) == 0 ? 0 : random.nextFloat();
+        for (int sid = 0; sid != block_size; ++sid)
+        {
+            const float position = float(sid) / block_size;
+            const double time = double(block) * block_size + sid;
+            cycle_counter.set_frequency(440 + 400 * std::sin(time / processor_.getSampleRate()));
+            cycle_counter.tick();
+            phases[sid] = cycle_counter.get_last_phase();
+            angles[sid] = cycle_counter.get_last_angle();
+            samples_per_cycle[sid] = cycle_counter.get_cylces_per_sec();
+
+            wave_forms[sid] = wave_start + (wave_end - wave_start) * position;
+            phase_offsets[sid] = position;
+            fm_amounts[sid] = fm_amount * position;
+            fm_shapes[sid] = 1 - position;
+            modulator[sid] = float(std::sin(angles[sid] * 3));
+            holds[sid] = has_holds && (sid / 16) % 2 == 1;
+        }
+
+        std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+        block_waves.process(block_output, wave_forms, phases, angles, samples_per_cycle,
+                            has_phase_offsets ? phase_offsets : nullptr,
+                            has_holds ? holds.get() : nullptr, block_size);
+        add_fm(block_output, modulator, fm_amounts, fm_shapes, block_size);
+        block_ms += get_ms_since(start_ticks);
+
+        start_ticks = juce::Time::getHighResolutionTicks();
+        for (int sid = 0; sid != block_size; ++sid)
+        {
+            sample_waves.process(sample_output + sid, wave_forms + sid, phases + sid, angles + sid,
+                                 samples_per_cycle + sid,
+                                 has_phase_offsets ? phase_offsets + sid : nullptr,
+                                 has_holds ? holds + sid : nullptr, 1);
+            add_fm(sample_output + sid, modulator + sid, fm_amounts + sid, fm_shapes + sid, 1);
+        }
+        sample_ms += get_ms_since(start_ticks);
+
+        for (int sid = 0; sid != block_size; ++sid)
+        {
+            max_error = juce::jmax(max_error, std::abs(block_output[sid] - sample_output[sid]));
+        }
+    }
+
+    std::printf("max difference %g (bound %g), per block: blocks %.3f ms, samples %.3f ms\n",
+                max_error, MAX_ERROR, block_ms / NUM_BLOCKS, sample_ms / NUM_BLOCKS);
+    return max_error <= MAX_ERROR;
+}
+
+//==============================================================================
+// THE INPUTS AS LANES OF ONE FILTER AGAINST ONE FILTER PER INPUT, FOR ALL TYPES AND THE TYPE
+// CROSS FADES. WITHOUT SILENCE THE OUTPUT IS BIT EXACT. THE LANES SHARE THE SILENCE DETECTION,
+// A LANE CAN KEEP A TAIL BELOW 1e-8 THAT A SINGLE FILTER DROPS, THE RESONANCE PICKS IT UP AGAIN.
+template <int num_lanes_>
+static void process_filter_frames(DoubleAnalogFilter &filter_, FILTER_TYPS type_,
+                                  const float *resonance_, const float *cutoff_,
+                                  float *const *io_, int num_samples_,
+                                  int control_rate_ = MONIQUE_FILTER_CONTROL_RATE) noexcept
+{
+    filter_.update_filter_to(type_);
+    for (int sid = 0; sid != num_samples_; ++sid)
+    {
+        if (sid % control_rate_ == 0)
+        {
+            const int num_control_samples = juce::jmin(control_rate_, num_samples_ - sid);
+            switch (type_)
+            {
+            case LPF_2_PASS:
+                filter_.updateLow2Pass(resonance_ + sid, cutoff_ + sid, num_control_samples);
+                break;
+            case HIGH_2_PASS:
+                filter_.updateHigh2Pass(resonance_ + sid, cutoff_ + sid, num_control_samples);
+                break;
+            case BPF:
+                filter_.updateBand(resonance_ + sid, cutoff_ + sid, num_control_samples);
+                break;
+            default:
+                break;
+            }
+        }
+
+        alignas(16) float frame[FILTER_LANES] = {};
+        for (int lane = 0; lane != num_lanes_; ++lane)
+        {
+            frame[lane] = io_[lane][sid];
+        }
+        switch (type_)
+        {
+        case LPF_2_PASS:
+            filter_.processLow2Pass<num_lanes_>(frame);
+            break;
+        case HIGH_2_PASS:
+            filter_.processHigh2Pass<num_lanes_>(frame);
+            break;
+        case BPF:
+            filter_.processBand<num_lanes_>(frame);
+            break;
+        default:
+            filter_.processPass<num_lanes_>(frame);
+        }
+        for (int lane = 0; lane != num_lanes_; ++lane)
+        {
+            io_[lane][sid] = frame[lane];
+        }
+    }
+}
+static bool check_filter_lanes(MoniqueAudioProcessor &processor_) noexcept
+{
+    static constexpr float MAX_ERROR = 1e-5f;
+    static constexpr int NUM_BLOCKS = 4000;
+    static constexpr int BLOCKS_PER_TYPE = 100;
+    static constexpr int NUM_TYPES = 4;
+    static const FILTER_TYPS types[NUM_TYPES] = {LPF_2_PASS, HIGH_2_PASS, BPF, PASS};
+    static const char *const type_names[NUM_TYPES] = {"LP", "HP", "BP", "PASS"};
+    enum BUFFERS
+    {
+        RESONANCE,
+        CUTOFF,
+        LANES_IO,
+        SINGLE_IO = LANES_IO + SUM_INPUTS_PER_FILTER,
+
+        SUM_BUFFERS = SINGLE_IO + SUM_INPUTS_PER_FILTER
+    };
+
+    // LIKE MoniqueAudioProcessor::process, THE FILTERS DO NOT FLUSH DENORMALS
+    juce::ScopedNoDenormals no_denormals;
+    const int block_size = processor_.getBlockSize();
+    DoubleAnalogFilter lanes_filter(processor_.runtime_notifyer);
+    std::unique_ptr<DoubleAnalogFilter> single_filters[SUM_INPUTS_PER_FILTER];
+    mono_AudioSampleBuffer<SUM_BUFFERS> buffers(block_size);
+    float *const resonance = buffers.getWritePointer(RESONANCE);
+    float *const cutoff = buffers.getWritePointer(CUTOFF);
+    float *lanes_io[SUM_INPUTS_PER_FILTER];
+    float *single_io[SUM_INPUTS_PER_FILTER];
+    for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+    {
+        single_filters[input_id] =
+            std::make_unique<DoubleAnalogFilter>(processor_.runtime_notifyer);
+        lanes_io[input_id] = buffers.getWritePointer(LANES_IO + input_id);
+        single_io[input_id] = buffers.getWritePointer(SINGLE_IO + input_id);
+    }
+
+    juce::Random random(1);
+    float max_errors[NUM_TYPES] = {};
+    double lanes_ms[NUM_TYPES] = {};
+    double single_ms[NUM_TYPES] = {};
+    for (int block = 0; block != NUM_BLOCKS; ++block)
+    {
+        // A NEW TYPE EVERY BLOCKS_PER_TYPE, CUTOFF AND RESONANCE SWEEPS, SILENT PASSAGES
+        const int type_id = (block / BLOCKS_PER_TYPE + block / (NUM_TYPES * BLOCKS_PER_TYPE)) %
+                            NUM_TYPES;
+        const bool is_silent = (block / 30) % 5 == 4;
+        for (int sid = 0; sid != block_size; ++sid)
+        {
+            const double time = (double(block) * block_size + sid) / processor_.getSampleRate();
+            resonance[sid] = float(0.5 + 0.5 * std::sin(time * 0.7));
+            cutoff[sid] = float(0.5 + 0.45 * std::sin(time * 3.1));
+            for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+            {
+                const float amp = is_silent ? 0 : 1.5f / (input_id + 1);
+                lanes_io[input_id][sid] = single_io[input_id][sid] =
+                    amp * (random.nextFloat() * 2 - 1);
+            }
+        }
+
+        std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+        process_filter_frames<SUM_INPUTS_PER_FILTER>(lanes_filter, types[type_id], resonance,
+                                                     cutoff, lanes_io, block_size);
+        lanes_ms[type_id] += get_ms_since(start_ticks);
+
+        start_ticks = juce::Time::getHighResolutionTicks();
+        for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+        {
+            process_filter_frames<1>(*single_filters[input_id], types[type_id], resonance, cutoff,
+                                     single_io + input_id, block_size);
+        }
+        single_ms[type_id] += get_ms_since(start_ticks);
+
+        for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+        {
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                max_errors[type_id] =
+                    juce::jmax(max_errors[type_id],
+                               std::abs(lanes_io[input_id][sid] - single_io[input_id][sid]));
+            }
+        }
+    }
+
+    bool passed = true;
+    for (int type_id = 0; type_id != NUM_TYPES; ++type_id)
+    {
+        const int num_blocks = NUM_BLOCKS / NUM_TYPES;
+        std::printf("%-4s max difference %g (bound %g), per block: %d lanes %.4f ms, "
+                    "%d filters %.4f ms\n",
+                    type_names[type_id], max_errors[type_id], MAX_ERROR, SUM_INPUTS_PER_FILTER,
+                    lanes_ms[type_id] / num_blocks, SUM_INPUTS_PER_FILTER,
+                    single_ms[type_id] / num_blocks);
+        passed = passed && max_errors[type_id] <= MAX_ERROR;
+    }
+    return passed;
+}
+
+//==============================================================================
+// THE COEFFICIENTS AT MONIQUE_FILTER_CONTROL_RATE AGAINST THE PER SAMPLE PATH (RATE 1), WITH A
+// 5 HZ CUTOFF LFO (0.4 DEPTH) AND A 1.3 HZ RESONANCE LFO. THE DIFFERENCE IS MEASURED AS RMS
+// RELATIVE TO THE RMS OF THE PER SAMPLE OUTPUT. IT GROWS BY ~12 DB PER DOUBLED RATE.
+static bool check_filter_control_rate(MoniqueAudioProcessor &processor_) noexcept
+{
+    static constexpr double MAX_ERROR_DB = -50;
+    static constexpr int NUM_BLOCKS_PER_TYPE = 1000;
+    static constexpr int NUM_TYPES = 3;
+    static const FILTER_TYPS types[NUM_TYPES] = {LPF_2_PASS, HIGH_2_PASS, BPF};
+    static const char *const type_names[NUM_TYPES] = {"LP", "HP", "BP"};
+    enum BUFFERS
+    {
+        RESONANCE,
+        CUTOFF,
+        CONTROL_RATE_IO,
+        SAMPLE_RATE_IO = CONTROL_RATE_IO + SUM_INPUTS_PER_FILTER,
+
+        SUM_BUFFERS = SAMPLE_RATE_IO + SUM_INPUTS_PER_FILTER
+    };
+
+    juce::ScopedNoDenormals no_denormals;
+    const int block_size = processor_.getBlockSize();
+    mono_AudioSampleBuffer<SUM_BUFFERS> buffers(block_size);
+    float *const resonance = buffers.getWritePointer(RESONANCE);
+    float *const cutoff = buffers.getWritePointer(CUTOFF);
+    float *control_rate_io[SUM_INPUTS_PER_FILTER];
+    float *sample_rate_io[SUM_INPUTS_PER_FILTER];
+    for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+    {
+        control_rate_io[input_id] = buffers.getWritePointer(CONTROL_RATE_IO + input_id);
+        sample_rate_io[input_id] = buffers.getWritePointer(SAMPLE_RATE_IO + input_id);
+    }
+
+    bool passed = true;
+    for (int type_id = 0; type_id != NUM_TYPES; ++type_id)
+    {
+        DoubleAnalogFilter control_rate_filter(processor_.runtime_notifyer);
+        DoubleAnalogFilter sample_rate_filter(processor_.runtime_notifyer);
+        juce::Random random(1);
+        double signal_power = 0;
+        double error_power = 0;
+        double control_rate_ms = 0;
+        double sample_rate_ms = 0;
+        for (int block = 0; block != NUM_BLOCKS_PER_TYPE; ++block)
+        {
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                const double time =
+                    (double(block) * block_size + sid) / processor_.getSampleRate();
+                const double two_pi_time = juce::MathConstants<double>::twoPi * time;
+                resonance[sid] = float(0.5 + 0.4 * std::sin(two_pi_time * 1.3));
+                cutoff[sid] = float(0.5 + 0.4 * std::sin(two_pi_time * 5));
+                for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+                {
+                    control_rate_io[input_id][sid] = sample_rate_io[input_id][sid] =
+                        (random.nextFloat() * 2 - 1) / (input_id + 1);
+                }
+            }
+
+            std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+            process_filter_frames<SUM_INPUTS_PER_FILTER>(control_rate_filter, types[type_id],
+                                                         resonance, cutoff, control_rate_io,
+                                                         block_size);
+            control_rate_ms += get_ms_since(start_ticks);
+
+            start_ticks = juce::Time::getHighResolutionTicks();
+            process_filter_frames<SUM_INPUTS_PER_FILTER>(sample_rate_filter, types[type_id],
+                                                         resonance, cutoff, sample_rate_io,
+                                                         block_size, 1);
+            sample_rate_ms += get_ms_since(start_ticks);
+
+            for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+            {
+                for (int sid = 0; sid != block_size; ++sid)
+                {
+                    const double reference = sample_rate_io[input_id][sid];
+                    const double error = control_rate_io[input_id][sid] - reference;
+                    signal_power += reference * reference;
+                    error_power += error * error;
+                }
+            }
+        }
+
+        // NO ERROR AT RATE 1
+        const double error_db =
+            error_power > 0 ? 10 * std::log10(error_power / signal_power) : -999.0;
+        std::printf("%s rate %d: difference %.1f dB (bound %.1f dB), per block: %.4f ms, "
+                    "rate 1 %.4f ms\n",
+                    type_names[type_id], MONIQUE_FILTER_CONTROL_RATE, error_db, MAX_ERROR_DB,
+                    control_rate_ms / NUM_BLOCKS_PER_TYPE, sample_rate_ms / NUM_BLOCKS_PER_TYPE);
+        passed = passed && error_db <= MAX_ERROR_DB;
+    }
+    return passed;
+}
+
+//==============================================================================
+// THE PAN LAW TABLE AGAINST THE EXACT LAW OVER A DENSE PAN SWEEP, AND THE COST OF BOTH. IN THE
+// OUTER TABLE SEGMENTS THE INTERPOLATION CUTS THE KINK OF THE 0.00001 GAIN FLOOR (-100 DB), WHICH
+// ADDS UP TO 1e-5 THERE.
+static bool check_pan_law(MoniqueAudioProcessor &processor_) noexcept
+{
+    static constexpr double MAX_ERROR = 1e-5;
+    static constexpr double MAX_OUTER_ERROR = 2e-5;
+    static constexpr int NUM_SWEEP_POINTS = 1000000;
+    static constexpr int NUM_BLOCKS = 2000;
+    enum BUFFERS
+    {
+        PAN,
+        LEFT,
+        RIGHT,
+
+        SUM_BUFFERS
+    };
+
+    double max_error = 0;
+    double max_outer_error = 0;
+    for (int i = 0; i <= NUM_SWEEP_POINTS; ++i)
+    {
+        const double position = double(i) / NUM_SWEEP_POINTS;
+        double exact_left, exact_right;
+        PanLaw::get_exact(position, exact_left, exact_right);
+        float left, right;
+        pan_law.get(float(position * 2 - 1), left, right);
+        const double error =
+            juce::jmax(std::abs(left - exact_left), std::abs(right - exact_right));
+        const double table_position = position * PanLaw::TABLE_SIZE;
+        if (table_position < 1 || table_position > PanLaw::TABLE_SIZE - 1)
+        {
+            max_outer_error = juce::jmax(max_outer_error, error);
+        }
+        else
+        {
+            max_error = juce::jmax(max_error, error);
+        }
+    }
+
+    const int block_size = processor_.getBlockSize();
+    mono_AudioSampleBuffer<SUM_BUFFERS> buffers(block_size);
+    float *const pans = buffers.getWritePointer(PAN);
+    float *const lefts = buffers.getWritePointer(LEFT);
+    float *const rights = buffers.getWritePointer(RIGHT);
+    juce::Random random(1);
+    double table_ms = 0;
+    double exact_ms = 0;
+    double sum = 0;
+    for (int block = 0; block != NUM_BLOCKS; ++block)
+    {
+        for (int sid = 0; sid != block_size; ++sid)
+        {
+            pans[sid] = random.nextFloat() * 2 - 1;
+        }
+
+        std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+        pan_law.get(pans, lefts, rights, block_size);
+        table_ms += get_ms_since(start_ticks);
+        sum += lefts[block_size - 1] + rights[0];
+
+        start_ticks = juce::Time::getHighResolutionTicks();
+        for (int sid = 0; sid != block_size; ++sid)
+        {
+            double left, right;
+            PanLaw::get_exact((pans[sid] + 1) * 0.5, left, right);
+            lefts[sid] = float(left);
+            rights[sid] = float(right);
+        }
+        exact_ms += get_ms_since(start_ticks);
+        sum += lefts[block_size - 1] + rights[0];
+    }
+
+    const double num_samples = double(NUM_BLOCKS) * block_size;
+    std::printf("max error %g (bound %g), outer segments %g (bound %g)\n", max_error, MAX_ERROR,
+                max_outer_error, MAX_OUTER_ERROR);
+    std::printf("per sample: table %.2f ns, exact law %.2f ns (checksum %.1f)\n",
+                table_ms * 1e6 / num_samples, exact_ms * 1e6 / num_samples, sum);
+    return max_error <= MAX_ERROR && max_outer_error <= MAX_OUTER_ERROR;
+}
+
+//==============================================================================
+// A SECOND INSTANCE PLAYS THE SAME NOTES WITH THE PARALLEL RENDER GRAPH, ITS OUTPUT HAS TO BE BIT
+// EXACT THE SERIAL ONE
+static bool check_render_graph(MoniqueAudioProcessor &processor_) noexcept
+{
+    static constexpr int NUM_BLOCKS = 2000;
+    static constexpr int NOTE_LENGTH_IN_BLOCKS = 40;
+
+    juce::ScopedNoDenormals no_denormals;
+    const double sample_rate = processor_.getSampleRate();
+    const int block_size = processor_.getBlockSize();
+    std::unique_ptr<juce::AudioProcessor> parallel_instance(createPluginFilter());
+    parallel_instance->setNonRealtime(processor_.isNonRealtime());
+    parallel_instance->setRateAndBufferSizeDetails(sample_rate, block_size);
+    parallel_instance->prepareToPlay(sample_rate, block_size);
+    MoniqueAudioProcessor &parallel_processor =
+        static_cast<MoniqueAudioProcessor &>(*parallel_instance);
+
+    processor_.synth_data->render_in_parallel.set_value(false);
+    parallel_processor.synth_data->render_in_parallel.set_value(true);
+    const int num_workers = parallel_processor.voice->start_render_workers();
+
+    const int num_channels = processor_.getTotalNumOutputChannels();
+    juce::AudioBuffer<float> serial_buffer(num_channels, block_size);
+    juce::AudioBuffer<float> parallel_buffer(num_channels, block_size);
+    juce::MidiBuffer midi;
+    double serial_ms = 0;
+    double parallel_ms = 0;
+    double max_diff = 0;
+    std::int64_t first_mismatch = -1;
+    for (int block = 0; block != NUM_BLOCKS; ++block)
+    {
+        // NOTES START ON THE BLOCK AND STOP INSIDE OF IT
+        midi.clear();
+        const int note = 36 + block / NOTE_LENGTH_IN_BLOCKS * 7 % 36;
+        if (block % NOTE_LENGTH_IN_BLOCKS == 0)
+        {
+            midi.addEvent(juce::MidiMessage::noteOn(1, note, 0.8f), 0);
+        }
+        else if (block % NOTE_LENGTH_IN_BLOCKS == NOTE_LENGTH_IN_BLOCKS * 3 / 4)
+        {
+            midi.addEvent(juce::MidiMessage::noteOff(1, note), block_size / 3);
+        }
+
+        serial_buffer.clear();
+        std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+        processor_.synth->render_next_block(serial_buffer, midi, 0, block_size);
+        serial_ms += get_ms_since(start_ticks);
+
+        parallel_buffer.clear();
+        start_ticks = juce::Time::getHighResolutionTicks();
+        parallel_processor.synth->render_next_block(parallel_buffer, midi, 0, block_size);
+        parallel_ms += get_ms_since(start_ticks);
+
+        for (int channel = 0; channel != num_channels; ++channel)
+        {
+            const float *const serial = serial_buffer.getReadPointer(channel);
+            const float *const parallel = parallel_buffer.getReadPointer(channel);
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                const double diff = std::abs(double(parallel[sid]) - double(serial[sid]));
+                if (diff > 0 && first_mismatch == -1)
+                {
+                    first_mismatch = std::int64_t(block) * block_size + sid;
+                }
+                max_diff = juce::jmax(max_diff, diff);
+            }
+        }
+    }
+    parallel_instance->releaseResources();
+
+    if (num_workers == 0)
+    {
+        std::printf("single core, the parallel instance renders serial\n");
+    }
+    std::printf("%d workers, per block: serial %.4f ms, parallel %.4f ms\n", num_workers,
+                serial_ms / NUM_BLOCKS, parallel_ms / NUM_BLOCKS);
+    std::printf("max diff %g, first mismatch at sample %lld\n", max_diff,
+                static_cast<long long>(first_mismatch));
+    return first_mismatch == -1;
+}
+
+//==============================================================================
+// THE SEGMENTED DELAY RECORD AGAINST THE SAMPLE BY SAMPLE ONE OF THE ORIGINAL DELAY, IN STEREO
+// AND MONO, WITH RANDOM BLOCK SIZES, RECORD SWITCHES, CLEARS, SIZE AND TEMPO CHANGES. THE OUTPUT
+// HAS TO BE BIT EXACT.
+static bool check_delay_record(MoniqueAudioProcessor &processor_) noexcept
+{
+    static constexpr int NUM_BLOCKS = 12000;
+    enum BUFFERS
+    {
+        SEGMENTED_LEFT,
+        SEGMENTED_RIGHT,
+        REFERENCE_LEFT,
+        REFERENCE_RIGHT,
+        POWER,
+        PAN,
+        RELEASE,
+
+        SUM_BUFFERS
+    };
+
+    juce::ScopedNoDenormals no_denormals;
+    MoniqueSynthData *const synth_data = processor_.synth_data;
+    const bool was_stereo = synth_data->is_stereo;
+    const int block_size = processor_.getBlockSize();
+    mono_Delay segmented(processor_.runtime_notifyer, synth_data);
+    mono_Delay reference(processor_.runtime_notifyer, synth_data);
+    reference.is_per_sample_record = true;
+    mono_AudioSampleBuffer<SUM_BUFFERS> buffers(block_size);
+    float *const segmented_left = buffers.getWritePointer(SEGMENTED_LEFT);
+    float *const segmented_right = buffers.getWritePointer(SEGMENTED_RIGHT);
+    float *const reference_left = buffers.getWritePointer(REFERENCE_LEFT);
+    float *const reference_right = buffers.getWritePointer(REFERENCE_RIGHT);
+    float *const powers = buffers.getWritePointer(POWER);
+    float *const pans = buffers.getWritePointer(PAN);
+    float *const releases = buffers.getWritePointer(RELEASE);
+
+    juce::Random random(1);
+    double segmented_ms = 0;
+    double reference_ms = 0;
+    int first_mismatch = -1;
+    int reflexion_size = 11;
+    int record_size = 17;
+    bool record = false;
+    std::int64_t time = 0;
+    for (int block = 0; block != NUM_BLOCKS; ++block)
+    {
+        // 4 BARS ARE 4 SECONDS AT 240 BPM, THE SECOND HALF RUNS AT 170 BPM, THE LAST QUARTER MONO
+        if (block % 97 == 0)
+        {
+            reflexion_size = random.nextInt(20);
+        }
+        if (block % 389 == 0)
+        {
+            record_size = 17 + random.nextInt(3);
+        }
+        if (block % 150 == 0)
+        {
+            record = random.nextInt(3) != 0;
+        }
+        if (block % 211 == 0)
+        {
+            segmented.clear_record_buffer();
+            reference.clear_record_buffer();
+        }
+        const double bpm = block < NUM_BLOCKS / 2 ? 240 : 170;
+        const bool is_stereo = block < NUM_BLOCKS * 3 / 4;
+        synth_data->is_stereo.set_value_without_notification(is_stereo);
+
+        const int num_samples = 1 + random.nextInt(block_size);
+        for (int sid = 0; sid != num_samples; ++sid, ++time)
+        {
+            const double seconds = time / processor_.getSampleRate();
+            segmented_left[sid] = reference_left[sid] = random.nextFloat() - 0.5f;
+            segmented_right[sid] = reference_right[sid] = random.nextFloat() - 0.5f;
+            powers[sid] = float(0.6 + 0.3 * std::sin(seconds * 0.9));
+            pans[sid] = float(0.5 + 0.5 * std::sin(seconds * 1.7));
+            releases[sid] = float(0.97 + 0.03 * std::sin(seconds * 0.3));
+        }
+
+        std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+        segmented.set_reflexion_size(reflexion_size, record_size, 50, bpm);
+        segmented.process(segmented_left, segmented_right, powers, pans, releases, record,
+                          num_samples);
+        segmented_ms += get_ms_since(start_ticks);
+
+        start_ticks = juce::Time::getHighResolutionTicks();
+        reference.set_reflexion_size(reflexion_size, record_size, 50, bpm);
+        reference.process(reference_left, reference_right, powers, pans, releases, record,
+                          num_samples);
+        reference_ms += get_ms_since(start_ticks);
+
+        for (int sid = 0; sid != num_samples && first_mismatch == -1; ++sid)
+        {
+            if (segmented_left[sid] != reference_left[sid] ||
+                (is_stereo && segmented_right[sid] != reference_right[sid]))
+            {
+                first_mismatch = block;
+            }
+        }
+    }
+    synth_data->is_stereo.set_value_without_notification(was_stereo);
+
+    std::printf("%s, first mismatch in block %d, segmented %.2f ms, per sample %.2f ms\n",
+                first_mismatch == -1 ? "bit exact" : "MISMATCH", first_mismatch, segmented_ms,
+                reference_ms);
+    return first_mismatch == -1;
+}
+
+//==============================================================================
+// THE SAME STEP OPERATIONS ON THE QUEUE AND ON A std::deque REFERENCE
+static inline int size_of(const StepQueue &steps_) noexcept { return steps_.size(); }
+static inline int size_of(const std::deque<Step> &steps_) noexcept { return int(steps_.size()); }
+static inline const Step &get_step(const StepQueue &steps_, int i_) noexcept
+{
+    return steps_.get(i_);
+}
+static inline const Step &get_step(const std::deque<Step> &steps_, int i_) noexcept
+{
+    return steps_[i_];
+}
+static inline void add_step(StepQueue &steps_, int step_id_, std::int64_t at_absolute_sample_,
+                            std::int64_t samples_per_step_) noexcept
+{
+    steps_.add(step_id_, at_absolute_sample_, samples_per_step_);
+}
+static inline void add_step(std::deque<Step> &steps_, int step_id_,
+                            std::int64_t at_absolute_sample_,
+                            std::int64_t samples_per_step_) noexcept
+{
+    if (steps_.size() < StepQueue::CAPACITY)
+    {
+        steps_.push_back(Step{step_id_, at_absolute_sample_, int(samples_per_step_)});
+    }
+}
+static inline void remove_step(StepQueue &steps_, int i_) noexcept { steps_.remove(i_); }
+static inline void remove_step(std::deque<Step> &steps_, int i_) noexcept
+{
+    steps_.erase(steps_.begin() + i_);
+}
+static inline void clear_steps(StepQueue &steps_) noexcept { steps_.clear(); }
+static inline void clear_steps(std::deque<Step> &steps_) noexcept { steps_.clear(); }
+
+// THE STEPS OF THE STANDALONE CLOCK HANDLING AND THE ARP SEQUENCER
+template <class steps_t> struct StepSimulation
+{
+    static constexpr int CLOCKS_PER_STEP = 6;
+    static constexpr int CLOCKS_PER_BAR = 96;
+
+    steps_t steps_in_block;
+    steps_t steps_on_hold;
+    int clock_absolute = 0;
+    std::int64_t last_clock_sample = 0;
+    int max_size = 0;
+    double ms = 0;
+
+    void clock(std::int64_t at_sample_, double speed_multiplyer_) noexcept
+    {
+        const std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+        const std::int64_t samples_per_clock = at_sample_ - last_clock_sample;
+        if (speed_multiplyer_ == 1)
+        {
+            if (clock_absolute % CLOCKS_PER_STEP == 0)
+            {
+                add_step(steps_in_block, clock_absolute / CLOCKS_PER_STEP, at_sample_ + 1,
+                         samples_per_clock);
+            }
+        }
+        else if (speed_multiplyer_ > 1)
+        {
+            const int sub_clocks = int(speed_multiplyer_);
+            const double samples_per_sub_clock = samples_per_clock / speed_multiplyer_;
+            const int clock_id = clock_absolute % CLOCKS_PER_BAR * sub_clocks;
+            for (int i = 0; i != sub_clocks; ++i)
+            {
+                const int sub_clock_id = (clock_id + i) % CLOCKS_PER_BAR;
+                if (sub_clock_id % CLOCKS_PER_STEP == 0)
+                {
+                    add_step(steps_in_block, sub_clock_id / CLOCKS_PER_STEP,
+                             at_sample_ + std::int64_t(samples_per_sub_clock * i) + 1,
+                             std::int64_t(samples_per_sub_clock));
+                }
+            }
+        }
+        else
+        {
+            const double factor = CLOCKS_PER_STEP / speed_multiplyer_;
+            const double clocks_in_bar =
+                std::fmod(clock_absolute, CLOCKS_PER_BAR / speed_multiplyer_);
+            if (std::fmod(clocks_in_bar, factor) == 0)
+            {
+                add_step(steps_in_block, int(clocks_in_bar / factor), at_sample_ + 1,
+                         std::int64_t(samples_per_clock / speed_multiplyer_));
+            }
+        }
+        last_clock_sample = at_sample_;
+        clock_absolute = (clock_absolute + 1) % (CLOCKS_PER_BAR * 16);
+        max_size = juce::jmax(max_size, size_of(steps_in_block));
+        ms += get_ms_since(start_ticks);
+    }
+
+    // EVERY 4TH STEP IS HELD BACK BY AN OFFSET, THE OLD ONES ARE CLEANED
+    void block(std::int64_t block_start_, int block_size_) noexcept
+    {
+        const std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+        while (size_of(steps_in_block) && get_step(steps_in_block, 0).at_absolute_sample <
+                                              block_start_ - block_size_)
+        {
+            remove_step(steps_in_block, 0);
+        }
+        for (std::int64_t sample = block_start_; sample != block_start_ + block_size_; ++sample)
+        {
+            if (size_of(steps_in_block) && get_step(steps_in_block, 0).at_absolute_sample <= sample)
+            {
+                const Step step = get_step(steps_in_block, 0);
+                if (step.step_id % 4 == 0)
+                {
+                    add_step(steps_on_hold, step.step_id, sample + step.samples_per_step / 3,
+                             step.samples_per_step);
+                }
+                remove_step(steps_in_block, 0);
+            }
+            for (int i = 0; i < size_of(steps_on_hold); ++i)
+            {
+                if (get_step(steps_on_hold, i).at_absolute_sample <= sample)
+                {
+                    remove_step(steps_on_hold, i);
+                    --i;
+                }
+            }
+        }
+        max_size = juce::jmax(max_size, size_of(steps_on_hold));
+        ms += get_ms_since(start_ticks);
+    }
+
+    void start() noexcept
+    {
+        clear_steps(steps_in_block);
+        clear_steps(steps_on_hold);
+        clock_absolute = 0;
+    }
+};
+
+template <class steps_a_t, class steps_b_t>
+static bool is_equal(const steps_a_t &a_, const steps_b_t &b_) noexcept
+{
+    if (size_of(a_) != size_of(b_))
+    {
+        return false;
+    }
+    for (int i = 0; i != size_of(a_); ++i)
+    {
+        const Step &step_a = get_step(a_, i);
+        const Step &step_b = get_step(b_, i);
+        if (step_a.step_id != step_b.step_id ||
+            step_a.at_absolute_sample != step_b.at_absolute_sample ||
+            step_a.samples_per_step != step_b.samples_per_step)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==============================================================================
+// A 300 BPM EXTERNAL CLOCK, EACH CLOCK JITTERS BY UP TO 30% OF ITS INTERVAL, AT ALL SPEED
+// MULTIPLIERS ABOVE 1 AND SOME BELOW, WITH THE HOST AND A LARGE BLOCK SIZE. THE STEP QUEUES
+// HAVE TO MATCH A std::deque REFERENCE AFTER EVERY BLOCK AND MUST NEVER RUN FULL.
+static bool check_step_queue(MoniqueAudioProcessor &processor_) noexcept
+{
+    static constexpr int NUM_CLOCKS = 50000;
+    static constexpr int LARGE_BLOCK_SIZE = 8192;
+    static constexpr int CLOCKS_PER_START = 9973;
+    static const int speed_multis[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                       -1, -3, -7, -15};
+
+    const double samples_per_clock = processor_.getSampleRate() * 60 / (300 * 24);
+    bool passed = true;
+    for (const int block_size : {processor_.getBlockSize(), LARGE_BLOCK_SIZE})
+    {
+        for (const int speed_multi : speed_multis)
+        {
+            const double speed_multiplyer = ArpSequencerData::speed_multi_to_value(speed_multi);
+            std::unique_ptr<StepSimulation<StepQueue>> queue(new StepSimulation<StepQueue>());
+            std::unique_ptr<StepSimulation<std::deque<Step>>> reference(
+                new StepSimulation<std::deque<Step>>());
+            juce::Random random(1);
+            std::int64_t block_start = 0;
+            int first_mismatch = -1;
+            for (int clock = 0; clock != NUM_CLOCKS; ++clock)
+            {
+                const std::int64_t at_sample =
+                    std::int64_t((clock + (random.nextDouble() - 0.5) * 0.6) * samples_per_clock);
+                while (at_sample >= block_start + block_size)
+                {
+                    queue->block(block_start, block_size);
+                    reference->block(block_start, block_size);
+                    block_start += block_size;
+                    if (first_mismatch == -1 &&
+                        (!is_equal(queue->steps_in_block, reference->steps_in_block) ||
+                         !is_equal(queue->steps_on_hold, reference->steps_on_hold)))
+                    {
+                        first_mismatch = clock;
+                    }
+                }
+                if (clock % CLOCKS_PER_START == 0)
+                {
+                    queue->start();
+                    reference->start();
+                }
+                queue->clock(at_sample, speed_multiplyer);
+                reference->clock(at_sample, speed_multiplyer);
+            }
+
+            const bool is_full = queue->max_size >= StepQueue::CAPACITY;
+            std::printf("%d x%.3g: max fill %d of %d, %s, queue %.2f ms, std::deque %.2f ms\n",
+                        block_size, speed_multiplyer, queue->max_size, StepQueue::CAPACITY,
+                        first_mismatch == -1 ? "equal" : "MISMATCH", queue->ms, reference->ms);
+            if (first_mismatch != -1)
+            {
+                std::printf("  first mismatch after clock %d\n", first_mismatch);
+            }
+            passed = passed && first_mismatch == -1 && !is_full;
+        }
+    }
+    return passed;
+}
+
+//==============================================================================
+// ONE EQ BAND AS IT WAS BEFORE THE BANK: THE LADDER OF THE FORMER AnalogFilter
+// (processLowResonance WITH A FIXED CUTOFF) INTO THE juce::IIRFilter HIGH PASS, WHICH ONLY SNAPS
+// TO ZERO ON INTEL, HERE ON ALL TARGETS LIKE THE BANK
+class EQBandReference
+{
+    const float cutoff;
+    const double sample_rate;
+    float c[5];
+
+    float p = 0, k = 0, r = 0, res = 0, res_original = -1;
+    float y1 = 0, y2 = 0, y3 = 0, y4 = 0;
+    float oldx = 0, oldy1 = 0, oldy2 = 0, oldy3 = 0;
+    int zero_counter = 0;
+    float v1 = 0, v2 = 0;
+
+    static inline void snap_to_zero(float &n_) noexcept
+    {
+        if (!(n_ < -1.0e-8f || n_ > 1.0e-8f))
+        {
+            n_ = 0;
+        }
+    }
+
+  public:
+    inline float process(float in_, float resonance_) noexcept
+    {
+        if (res_original != resonance_)
+        {
+            res_original = res = resonance_;
+            const float f = cutoff / sample_rate;
+            p = f * (1.8f - 0.8f * f);
+            k = p * 2 - 1;
+            const float t = (1.0f - p) * 1.386249f;
+            const float t2 = 12.0f + t * t;
+            r = res * (t2 + 6.0f * t) / (t2 - 6.0f * t);
+        }
+
+        snap_to_zero(in_);
+        zero_counter = in_ != 0 || y4 != 0 ? 0 : zero_counter + 1;
+        if (zero_counter < 50)
+        {
+            in_ -= r * y4;
+            snap_to_zero(y1);
+
+            y1 = in_ * p + oldx * p - k * y1;
+            y2 = y1 * p + oldy1 * p - k * y2;
+            y3 = y2 * p + oldy2 * p - k * y3;
+            y4 = y3 * p + oldy3 * p - k * y4;
+
+            y4 -= (y4 * y4 * y4) / 6;
+            snap_to_zero(y4);
+
+            oldx = in_;
+            oldy1 = y1;
+            oldy2 = y2;
+            oldy3 = y3;
+
+            in_ = soft_clipp_greater_1_2(sample_mix(y4, y3 * res));
+            snap_to_zero(in_);
+        }
+
+        float out = c[0] * in_ + v1;
+        snap_to_zero(out);
+        v1 = c[1] * in_ - c[3] * out + v2;
+        v2 = c[2] * in_ - c[4] * out;
+        return out * 4;
+    }
+
+    COLD EQBandReference(int band_id_, double sample_rate_) noexcept
+        : cutoff(get_low_pass_band_frequency(band_id_, sample_rate_)), sample_rate(sample_rate_)
+    {
+        const juce::IIRCoefficients coefficients(juce::IIRCoefficients::makeHighPass(
+            sample_rate_, get_high_pass_band_frequency(band_id_)));
+        for (int i = 0; i != 5; ++i)
+        {
+            c[i] = coefficients.coefficients[i];
+        }
+    }
+};
+
+//==============================================================================
+// THE EQ BANK AGAINST ONE SCALAR FILTER PER BAND AND CHANNEL, STEREO AND MONO, WITH RANDOM BLOCK
+// SIZES, A SHAPE SWEEP, LOUD (CLIPPING), QUIET AND SILENT INPUT AND BANDS WITHOUT ENVELOPE, SO
+// GROUPS STOP AND ARE SKIPPED. THE MIXED OUTPUT HAS TO BE BIT EXACT.
+static bool check_eq_bank(MoniqueAudioProcessor &processor_) noexcept
+{
+    static constexpr int NUM_BLOCKS = 12000;
+    enum BUFFERS
+    {
+        LEFT_IN,
+        RIGHT_IN,
+        SHAPE,
+        LEFT_SUMS,
+        RIGHT_SUMS,
+        BAND_ENVS,
+
+        SUM_BUFFERS = BAND_ENVS + SUM_EQ_BANDS
+    };
+
+    // DENORMALS FLUSHED LIKE IN MoniqueAudioProcessor::process
+    juce::ScopedNoDenormals no_denormals;
+    const int block_size = processor_.getBlockSize();
+    const double sample_rate = processor_.getSampleRate();
+    EQFilterBank bank(processor_.runtime_notifyer);
+    std::unique_ptr<EQBandReference> references[2][SUM_EQ_BANDS];
+    mono_AudioSampleBuffer<SUM_BUFFERS> buffers(block_size);
+    const float *const ins[2] = {buffers.getReadPointer(LEFT_IN), buffers.getReadPointer(RIGHT_IN)};
+    const float *const sums[2] = {buffers.getReadPointer(LEFT_SUMS),
+                                  buffers.getReadPointer(RIGHT_SUMS)};
+    const float *band_envs[SUM_EQ_BANDS];
+    for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+    {
+        band_envs[band_id] = buffers.getReadPointer(BAND_ENVS + band_id);
+        for (int channel = 0; channel != 2; ++channel)
+        {
+            references[channel][band_id] = std::make_unique<EQBandReference>(band_id, sample_rate);
+        }
+    }
+
+    juce::Random random(1);
+    std::int64_t time_samples = 0;
+    int first_mismatch = -1;
+    double bank_ms = 0;
+    double reference_ms = 0;
+    for (int block = 0; block != NUM_BLOCKS && first_mismatch == -1; ++block)
+    {
+        // EVERY THIRD 500 BLOCKS MONO, THE UPPER BANDS (THE SECOND GROUP) AND ALL BANDS WITHOUT
+        // ENVELOPE FOR A WHILE
+        const int num_samples = 1 + random.nextInt(block_size);
+        const bool is_stereo = (block / 500) % 3 != 2;
+        const bool is_silent = (block / 40) % 6 == 5;
+        const float amp = is_silent ? 0 : block % 20 < 15 ? 1.5f : 0.3f;
+        const bool are_upper_bands_off = (block / 50) % 4 == 3;
+        const bool are_all_bands_off = (block / 70) % 5 == 4;
+        for (int sid = 0; sid != num_samples; ++sid, ++time_samples)
+        {
+            const double time = double(time_samples) / sample_rate;
+            buffers.getWritePointer(LEFT_IN)[sid] = amp * (random.nextFloat() * 2 - 1);
+            buffers.getWritePointer(RIGHT_IN)[sid] = amp * (random.nextFloat() * 2 - 1);
+            buffers.getWritePointer(SHAPE)[sid] = float(0.5 + 0.49 * std::sin(time * 0.9));
+            for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+            {
+                const bool is_off = are_all_bands_off || (are_upper_bands_off && band_id >= 4);
+                buffers.getWritePointer(BAND_ENVS + band_id)[sid] =
+                    is_off ? 0 : float(std::abs(std::sin(time * 2.3 * (band_id + 1))));
+            }
+        }
+
+        const float *const shapes = buffers.getReadPointer(SHAPE);
+        std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+        if (is_stereo)
+        {
+            bank.process_bands<EQ_LANES>(ins[0], ins[1], band_envs, shapes,
+                                         buffers.getWritePointer(LEFT_SUMS),
+                                         buffers.getWritePointer(RIGHT_SUMS), num_samples);
+        }
+        else
+        {
+            bank.process_bands<EQ_CHANNEL_LANES>(ins[0], nullptr, band_envs, shapes,
+                                                 buffers.getWritePointer(LEFT_SUMS), nullptr,
+                                                 num_samples);
+        }
+        bank_ms += get_ms_since(start_ticks);
+
+        start_ticks = juce::Time::getHighResolutionTicks();
+        const int num_channels = is_stereo ? 2 : 1;
+        for (int sid = 0; sid != num_samples; ++sid)
+        {
+            for (int channel = 0; channel != num_channels; ++channel)
+            {
+                float bands[SUM_EQ_BANDS];
+                for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+                {
+                    bands[band_id] = references[channel][band_id]->process(
+                        ins[channel][sid] * band_envs[band_id][sid], shapes[sid] * 0.8f);
+                }
+                if (EQFilterBank::mix_bands(bands) != sums[channel][sid])
+                {
+                    first_mismatch = block;
+                }
+            }
+        }
+        reference_ms += get_ms_since(start_ticks);
+    }
+
+    std::printf("%s, first mismatch in block %d, bank %.2f ms, %d band filters %.2f ms\n",
+                first_mismatch == -1 ? "bit exact" : "MISMATCH", first_mismatch, bank_ms,
+                SUM_EQ_BANDS * 2, reference_ms);
+    return first_mismatch == -1;
+}
+
+//==============================================================================
+// ONE CHANNEL OF THE REVERB AS IT WAS BEFORE THE SUB BLOCKS: PER SAMPLE COMBS AND ALLPASSES WITH
+// WRAPPING INDICES AND THE PARAMETERS UPDATED WHEN THEY CHANGE
+class ReverbReference
+{
+    struct Delay
+    {
+        juce::HeapBlock<float> buffer;
+        int size = 0;
+        int index = 0;
+
+        void set_size(int size_) noexcept
+        {
+            size = size_;
+            buffer.calloc((size_t)size_);
+        }
+    };
+    Delay combs[8];
+    Delay all_passes[4];
+
+    float room = -1, dry_level = -1, width = -1;
+    float wet_gain_1 = 0, wet_gain_2 = 0, feedback = 0;
+
+  public:
+    inline float process(float in_, float room_, float dry_level_, float width_) noexcept
+    {
+        if (room != room_ || dry_level != dry_level_ || width != width_)
+        {
+            room = room_;
+            dry_level = dry_level_;
+            width = width_;
+            const float wet = (1.0f - dry_level_) * WET_SCALE_FACTOR;
+            wet_gain_1 = 0.5f * wet * (1.0f + width_);
+            wet_gain_2 = 0.5f * wet * (1.0f - width_);
+            feedback = room_ * ROOM_SCALE_FACTOR + ROOM_OFFSET;
+        }
+
+        float out = 0;
+        const float input = in_ * REVERB_GAIN;
+        for (Delay &comb : combs)
+        {
+            const float last = comb.buffer[comb.index];
+            float temp = input + (last * feedback);
+            JUCE_UNDENORMALISE(temp);
+            comb.buffer[comb.index] = temp;
+            comb.index = (comb.index + 1) % comb.size;
+            out += last;
+        }
+        for (Delay &all_pass : all_passes)
+        {
+            const float buffered = all_pass.buffer[all_pass.index];
+            float temp = out + (buffered * 0.5f);
+            JUCE_UNDENORMALISE(temp);
+            all_pass.buffer[all_pass.index] = temp;
+            all_pass.index = (all_pass.index + 1) % all_pass.size;
+            out = buffered - out;
+        }
+
+        return out * wet_gain_1 + out * wet_gain_2 + in_ * dry_level;
+    }
+
+    COLD ReverbReference(int channel_, double sample_rate_) noexcept
+    {
+        static const int combTunings[] = {1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617};
+        static const int allPassTunings[] = {556, 441, 341, 225};
+        const int spread = channel_ == LEFT ? 0 : 23;
+        const int intSampleRate = (int)sample_rate_;
+        for (int i = 0; i != 8; ++i)
+        {
+            combs[i].set_size(
+                (intSampleRate * (combTunings[i] * ROOM_SCALE + spread * ROOM_SCALE)) / 44100);
+        }
+        for (int i = 0; i != 4; ++i)
+        {
+            all_passes[i].set_size(
+                (intSampleRate * (allPassTunings[i] * ROOM_SCALE + spread * ROOM_SCALE)) / 44100);
+        }
+    }
+};
+
+//==============================================================================
+// THE SUB BLOCK REVERB AGAINST THE PER SAMPLE ONE, STEREO AND MONO, WITH RANDOM BLOCK SIZES SPLIT
+// LIKE THE FX DO (SO MOST TAILS ARE NOT A MULTIPLE OF SUB_BLOCK_SIZE) AND ROOM, WIDTH AND DRY/WET
+// CONSTANT OVER A BLOCK. SMOOTHED RAMPS ARE NOT COVERED, THE REVERB SAMPLES THEM ONCE PER SUB
+// BLOCK ON PURPOSE. THE OUTPUT HAS TO BE BIT EXACT.
+static bool check_reverb(MoniqueAudioProcessor &processor_) noexcept
+{
+    static constexpr int NUM_BLOCKS = 6000;
+    enum BUFFERS
+    {
+        LEFT_IN,
+        RIGHT_IN,
+        LEFT_OUT,
+        RIGHT_OUT,
+
+        SUM_BUFFERS
+    };
+
+    // DENORMALS FLUSHED LIKE IN MoniqueAudioProcessor::process
+    juce::ScopedNoDenormals no_denormals;
+    const int block_size = processor_.getBlockSize();
+    const double sample_rate = processor_.getSampleRate();
+    mono_Reverb reverb(processor_.runtime_notifyer);
+    ReverbReference reference_left(LEFT, sample_rate);
+    ReverbReference reference_right(RIGHT, sample_rate);
+    mono_AudioSampleBuffer<SUM_BUFFERS> buffers(block_size);
+    const float *const left_in = buffers.getReadPointer(LEFT_IN);
+    const float *const right_in = buffers.getReadPointer(RIGHT_IN);
+    float *const left_out = buffers.getWritePointer(LEFT_OUT);
+    float *const right_out = buffers.getWritePointer(RIGHT_OUT);
+
+    juce::Random random(1);
+    int first_mismatch = -1;
+    double reverb_ms = 0;
+    double reference_ms = 0;
+    float room = 0.5f, dry_level = 0.6f, width = 1;
+    for (int block = 0; block != NUM_BLOCKS && first_mismatch == -1; ++block)
+    {
+        // EVERY THIRD 500 BLOCKS MONO, NEW PARAMETERS NOW AND THEN, SOME SILENCE TO LET THE TAILS
+        // DECAY
+        const int num_samples = 1 + random.nextInt(block_size);
+        const bool is_stereo = (block / 500) % 3 != 2;
+        const float amp = (block / 40) % 6 == 5 ? 0 : 0.8f;
+        if (block % 25 == 0)
+        {
+            room = random.nextFloat();
+            dry_level = random.nextFloat();
+            width = random.nextFloat();
+        }
+        for (int sid = 0; sid != num_samples; ++sid)
+        {
+            buffers.getWritePointer(LEFT_IN)[sid] = amp * (random.nextFloat() * 2 - 1);
+            buffers.getWritePointer(RIGHT_IN)[sid] = amp * (random.nextFloat() * 2 - 1);
+        }
+
+        std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+        for (int start_sid = 0; start_sid < num_samples; start_sid += mono_Reverb::SUB_BLOCK_SIZE)
+        {
+            const int num_sub_samples =
+                juce::jmin(mono_Reverb::SUB_BLOCK_SIZE, num_samples - start_sid);
+            reverb.process(left_in + start_sid, is_stereo ? right_in + start_sid : nullptr,
+                           left_out + start_sid, is_stereo ? right_out + start_sid : nullptr,
+                           room, dry_level, width, num_sub_samples);
+        }
+        reverb_ms += get_ms_since(start_ticks);
+
+        start_ticks = juce::Time::getHighResolutionTicks();
+        for (int sid = 0; sid != num_samples; ++sid)
+        {
+            if (reference_left.process(left_in[sid], room, dry_level, width) != left_out[sid])
+            {
+                first_mismatch = block;
+            }
+            if (is_stereo &&
+                reference_right.process(right_in[sid], room, dry_level, width) != right_out[sid])
+            {
+                first_mismatch = block;
+            }
+        }
+        reference_ms += get_ms_since(start_ticks);
+    }
+
+    std::printf("%s, first mismatch in block %d, sub blocks %.2f ms, per sample %.2f ms\n",
+                first_mismatch == -1 ? "bit exact" : "MISMATCH", first_mismatch, reverb_ms,
+                reference_ms);
+    return first_mismatch == -1;
+}
+
+//==============================================================================
+struct Check
+{
+    const char *name;
+    bool (*run)(MoniqueAudioProcessor &) noexcept;
+};
+static const Check checks[] = {
+    {"osc-tables", check_osc_tables},
+    {"osc-blocks", check_osc_blocks},
+    {"filter-lanes", check_filter_lanes},
+    {"filter-control-rate", check_filter_control_rate},
+    {"pan-law", check_pan_law},
+    {"render-graph", check_render_graph},
+    {"step-queue", check_step_queue},
+    {"delay-record", check_delay_record},
+    {"eq-bank", check_eq_bank},
+    {"reverb", check_reverb},
+};
+} // namespace dsp_checks
+
+juce::StringArray get_dsp_check_names() noexcept
+{
+    juce::StringArray names;
+    for (const dsp_checks::Check &check : dsp_checks::checks)
+    {
+        names.add(check.name);
+    }
+    return names;
+}
+bool run_dsp_check(juce::AudioProcessor &processor_, const juce::String &name_) noexcept
+{
+    for (const dsp_checks::Check &check : dsp_checks::checks)
+    {
+        if (name_ == check.name)
+        {
+            std::printf("check %s, %d Hz, block size %d\n", check.name,
+                        int(processor_.getSampleRate()), processor_.getBlockSize());
+            const bool passed = check.run(static_cast<MoniqueAudioProcessor &>(processor_));
+            std::printf("check %s: %s\n", check.name, passed ? "OK" : "FAILED");
+            return passed;
+        }
+    }
+    std::printf("unknown check %s, the checks are: %s\n", name_.toRawUTF8(),
+                get_dsp_check_names().joinIntoString(", ").toRawUTF8());
+    return false;
+}
+void print_dsp_stage_times(juce::AudioProcessor &processor_) noexcept
+{
+    static const char *const names[MoniqueSynthesiserVoice::SUM_DSP_STAGES] = {
+        "modulation", "osc", "filter", "eq", "fx"};
+
+    const MoniqueSynthesiserVoice &voice = *static_cast<MoniqueAudioProcessor &>(processor_).voice;
+    std::printf("  dsp stages, cpu time of all render threads:\n");
+    for (int stage = 0; stage != MoniqueSynthesiserVoice::SUM_DSP_STAGES; ++stage)
+    {
+        std::printf("    %-10s %10.2f ms\n", names[stage],
+                    juce::Time::highResolutionTicksToSeconds(voice.dsp_stage_ticks[stage]) * 1000);
+    }
+}
+#endif
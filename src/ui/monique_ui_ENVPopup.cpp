@@ -674,9 +674,6 @@ void Monique_Ui_ENVPopup::paint(juce::Graphics &g)
 
 #include "mono_ui_includeHacks_END.h"
     {
-        curve.clearQuick();
-        curve.ensureStorageAllocated(50000);
-
         synth_data->get_full_adstr(*env_data, curve);
 
         int plotter_x = plotter->getX();
@@ -697,14 +694,14 @@ void Monique_Ui_ENVPopup::paint(juce::Graphics &g)
             g.drawRoundedRectangle(plotter_x, plotter_y, plotter_width, plotter_hight, 3, 1);
         }
 
-        const int curve_size = curve.size();
-        float scale_w = float(plotter_width) / (curve.size());
+        const int curve_size = curve.num_points;
+        float scale_w = float(plotter_width) / curve_size;
 
         int last_x = -1;
         int last_y = -1;
         for (int i = 0; i != curve_size; ++i)
         {
-            float value = 1.0f - curve[i];
+            float value = 1.0f - curve.points[i];
             const int x = scale_w * i + plotter_x;
             const int y = value * plotter_hight + plotter_y;
             if (last_x != x || last_y != y)
@@ -62,7 +62,7 @@ class Monique_Ui_ENVPopup : public juce::Component,
   private:
     bool is_repainting;
     const bool left;
-    juce::Array<float> curve;
+    CurvePreview curve;
     Monique_Ui_Mainwindow *const parent;
     ENVData *const env_data;
     Parameter *const sustain;
@@ -63,7 +63,7 @@ class Monique_Ui_MFOPopup : public juce::Component,
     float last_speed;
     float last_offset;
 
-    juce::Array<float> curve;
+    CurvePreview curve;
     Monique_Ui_Mainwindow *const parent;
     LFOData *const mfo_data;
     juce::Array<juce::Component *> observed_comps;
@@ -6141,8 +6141,9 @@ void Monique_Ui_Mainwindow::buttonClicked(juce::Button *buttonThatWasClicked)
         synth_data->keep_arp_always_off = false;
         audio_processor->reset_pending_notes();
 
-        audio_processor->noteOn(1, 60 + synth_data->note_offset.get_value() - 24, 1.0f);
-        audio_processor->noteOff(1, 60 + synth_data->note_offset.get_value() - 24, 0);
+        const int note = 60 + synth_data->note_offset.get_value() - 24;
+        audio_processor->queue_event(juce::MidiMessage::noteOn(1, note, 1.0f));
+        audio_processor->queue_event(juce::MidiMessage::noteOff(1, note, 0.0f));
 
         button_flasher = std::make_unique<ButtonFlasher>(this, buttonThatWasClicked, true, 1);
     }